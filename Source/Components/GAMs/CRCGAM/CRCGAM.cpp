@@ -136,19 +136,19 @@ bool CRCGAM::Setup() {
         if (outputSignalType == UnsignedInteger8Bit) {
             crcHelper = new CRCHelperT<uint8>();
             crcHelper->ComputeTable(&polynomial);
-            REPORT_ERROR(ErrorManagement::Information, "Table computed!");
+            REPORT_ERROR(ErrorManagement::Information, "Table computed! Using the %s CRC.", crcHelper->GetImplementation());
             outputData = reinterpret_cast<uint8*>(GetOutputSignalMemory(0u));
         }
         else if (outputSignalType == UnsignedInteger16Bit) {
             crcHelper = new CRCHelperT<uint16>();
             crcHelper->ComputeTable(&polynomial);
-            REPORT_ERROR(ErrorManagement::Information, "Table computed!");
+            REPORT_ERROR(ErrorManagement::Information, "Table computed! Using the %s CRC.", crcHelper->GetImplementation());
             outputData = reinterpret_cast<uint16*>(GetOutputSignalMemory(0u));
         }
         else if (outputSignalType == UnsignedInteger32Bit) {
             crcHelper = new CRCHelperT<uint32>();
             crcHelper->ComputeTable(&polynomial);
-            REPORT_ERROR(ErrorManagement::Information, "Table computed!");
+            REPORT_ERROR(ErrorManagement::Information, "Table computed! Using the %s CRC.", crcHelper->GetImplementation());
             outputData = reinterpret_cast<uint32*>(GetOutputSignalMemory(0u));
         }
         else {
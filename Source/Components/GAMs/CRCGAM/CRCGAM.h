@@ -52,6 +52,10 @@ namespace MARTe {
  * - The initial CRC value.
  * - The Inverted option: 1 is you want the CRC checksum reflected, 0 otherwise.
  *
+ * The CRC is computed eight bytes at a time (slicing-by-8). For uint32 outputs on x86-64 processors,
+ * large input areas are processed with the SSE4.2 crc32 instruction if Polynomial = 0x1EDC6F41 (CRC-32C)
+ * or with carry-less multiplication (PCLMULQDQ) otherwise (see CRCHelperT and CRCHardwareHelper).
+ *
  * The number of OutputSignals must be equal to 1.
  *
  * The configuration syntax is (names and signal quantities are only given as an example):
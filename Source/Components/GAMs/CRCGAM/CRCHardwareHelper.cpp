@@ -0,0 +1,311 @@
+/**
+ * @file CRCHardwareHelper.cpp
+ * @brief Source file for class CRCHardwareHelper
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class CRCHardwareHelper (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+/*lint -estring(829, *cpuid.h*) -estring(829, *immintrin.h*) compiler intrinsics*/
+#if defined(__x86_64__) && (defined(__clang__) || (defined(__GNUC__) && ((__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 9)))))
+#define CRCGAM_X86_64_INTRINSICS
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "CRCHardwareHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+
+/**
+ * No hardware implementation.
+ */
+const MARTe::uint8 CRC_HARDWARE_NONE = 0u;
+
+/**
+ * SSE4.2 crc32 instruction (CRC-32C polynomial only).
+ */
+const MARTe::uint8 CRC_HARDWARE_CRC32C = 1u;
+
+/**
+ * PCLMULQDQ folding (any polynomial).
+ */
+const MARTe::uint8 CRC_HARDWARE_PCLMUL = 2u;
+
+/**
+ * The CRC-32C (Castagnoli) polynomial implemented by the crc32 instruction.
+ */
+const MARTe::uint32 CRC_HARDWARE_CASTAGNOLI = 0x1EDC6F41u;
+
+/**
+ * @brief Computes x^exponent modulo (x^32 + polynomial).
+ */
+MARTe::uint64 CRCHardwareXPowerModulo(const MARTe::uint32 polynomial,
+                                      const MARTe::uint32 exponent) {
+    MARTe::uint32 remainder = 1u;
+    for (MARTe::uint32 i = 0u; i < exponent; i++) {
+        bool carry = ((remainder & 0x80000000u) != 0u);
+        remainder <<= 1u;
+        if (carry) {
+            remainder ^= polynomial;
+        }
+    }
+    return static_cast<MARTe::uint64>(remainder);
+}
+
+/**
+ * @brief Computes floor(x^64 / (x^32 + polynomial)).
+ */
+MARTe::uint64 CRCHardwareBarrettConstant(const MARTe::uint32 polynomial) {
+    const MARTe::uint64 fullPolynomial = (static_cast<MARTe::uint64>(1u) << 32u) | static_cast<MARTe::uint64>(polynomial);
+    //x^64 - x^32 * (x^32 + polynomial)
+    MARTe::uint64 remainder = static_cast<MARTe::uint64>(polynomial) << 32u;
+    MARTe::uint64 quotient = static_cast<MARTe::uint64>(1u) << 32u;
+    for (MARTe::uint32 i = 32u; i > 0u; i--) {
+        MARTe::uint32 bit = i - 1u;
+        if (((remainder >> (32u + bit)) & 1u) != 0u) {
+            quotient |= (static_cast<MARTe::uint64>(1u) << bit);
+            remainder ^= (fullPolynomial << bit);
+        }
+    }
+    return quotient;
+}
+
+#ifdef CRCGAM_X86_64_INTRINSICS
+
+/**
+ * @brief Reverses the order of the bits of a 32-bit value.
+ */
+MARTe::uint32 CRCHardwareReflect(MARTe::uint32 value) {
+    value = ((value >> 1u) & 0x55555555u) | ((value & 0x55555555u) << 1u);
+    value = ((value >> 2u) & 0x33333333u) | ((value & 0x33333333u) << 2u);
+    value = ((value >> 4u) & 0x0F0F0F0Fu) | ((value & 0x0F0F0F0Fu) << 4u);
+    value = ((value >> 8u) & 0x00FF00FFu) | ((value & 0x00FF00FFu) << 8u);
+    return (value >> 16u) | (value << 16u);
+}
+
+/**
+ * @brief Reads the processor features from cpuid.
+ * @param[out] sse42 true if the crc32 instruction and SSSE3 are supported.
+ * @param[out] pclmul true if PCLMULQDQ and SSSE3 are supported.
+ */
+void CRCHardwareFeatures(bool &sse42,
+                         bool &pclmul) {
+    unsigned int eax = 0u;
+    unsigned int ebx = 0u;
+    unsigned int ecx = 0u;
+    unsigned int edx = 0u;
+    sse42 = false;
+    pclmul = false;
+    if (__get_cpuid(1u, &eax, &ebx, &ecx, &edx) != 0) {
+        bool ssse3 = ((ecx & (1u << 9u)) != 0u);
+        sse42 = (ssse3 && ((ecx & (1u << 20u)) != 0u));
+        pclmul = (ssse3 && ((ecx & (1u << 1u)) != 0u));
+    }
+}
+
+/**
+ * @brief CRC-32C of nBlocks blocks of 16 bytes with the crc32 instruction.
+ * @details The instruction processes the bits of each byte from the least significant one,
+ * so the bytes are bit-reversed and the CRC register is kept reflected.
+ */
+__attribute__((target("sse4.2,ssse3")))
+MARTe::uint32 CRCHardwareComputeCRC32C(const MARTe::uint8 * const data,
+                                       const MARTe::uint32 nBlocks,
+                                       const MARTe::uint32 initCRC) {
+    const __m128i nibbleMask = _mm_set1_epi8(0x0F);
+    //reverse of the low nibble, placed in the high nibble
+    const __m128i reverseLow = _mm_setr_epi8(0x00, static_cast<char>(0x80), 0x40, static_cast<char>(0xC0), 0x20, static_cast<char>(0xA0), 0x60,
+                                             static_cast<char>(0xE0), 0x10, static_cast<char>(0x90), 0x50, static_cast<char>(0xD0), 0x30,
+                                             static_cast<char>(0xB0), 0x70, static_cast<char>(0xF0));
+    //reverse of the high nibble, placed in the low nibble
+    const __m128i reverseHigh = _mm_setr_epi8(0x00, 0x08, 0x04, 0x0C, 0x02, 0x0A, 0x06, 0x0E, 0x01, 0x09, 0x05, 0x0D, 0x03, 0x0B, 0x07, 0x0F);
+    unsigned long long crc = static_cast<unsigned long long>(CRCHardwareReflect(initCRC));
+    for (MARTe::uint32 n = 0u; n < nBlocks; n++) {
+        /*lint -e{826} unaligned 16 byte load*/
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&data[n * 16u]));
+        __m128i low = _mm_and_si128(block, nibbleMask);
+        __m128i high = _mm_and_si128(_mm_srli_epi16(block, 4), nibbleMask);
+        block = _mm_or_si128(_mm_shuffle_epi8(reverseLow, low), _mm_shuffle_epi8(reverseHigh, high));
+        crc = _mm_crc32_u64(crc, static_cast<unsigned long long>(_mm_cvtsi128_si64(block)));
+        crc = _mm_crc32_u64(crc, static_cast<unsigned long long>(_mm_cvtsi128_si64(_mm_unpackhi_epi64(block, block))));
+    }
+    return CRCHardwareReflect(static_cast<MARTe::uint32>(crc));
+}
+
+/**
+ * @brief CRC of nBlocks blocks of 64 bytes with carry-less multiplication folding.
+ * @details Four 128-bit accumulators (one per 16 bytes) are folded over 512 bits at each step,
+ * then folded into one accumulator, reduced to 64 bits and finally to 32 bits with a Barrett reduction.
+ * The bytes are swapped so that the first byte holds the highest degree coefficients.
+ */
+__attribute__((target("pclmul,ssse3")))
+MARTe::uint32 CRCHardwareComputePCLMUL(const MARTe::uint8 * const data,
+                                       const MARTe::uint32 nBlocks,
+                                       const MARTe::uint32 initCRC,
+                                       const MARTe::uint64 * const constants) {
+    const __m128i swapMask = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    const __m128i fold512 = _mm_set_epi64x(static_cast<long long>(constants[0]), static_cast<long long>(constants[1]));
+    const __m128i fold128 = _mm_set_epi64x(static_cast<long long>(constants[2]), static_cast<long long>(constants[3]));
+    /*lint -e{826} unaligned 16 byte loads*/
+    const __m128i *blocks = reinterpret_cast<const __m128i *>(data);
+    __m128i x0 = _mm_shuffle_epi8(_mm_loadu_si128(&blocks[0]), swapMask);
+    __m128i x1 = _mm_shuffle_epi8(_mm_loadu_si128(&blocks[1]), swapMask);
+    __m128i x2 = _mm_shuffle_epi8(_mm_loadu_si128(&blocks[2]), swapMask);
+    __m128i x3 = _mm_shuffle_epi8(_mm_loadu_si128(&blocks[3]), swapMask);
+    //the initial value multiplies the highest degree coefficients of the message
+    x0 = _mm_xor_si128(x0, _mm_slli_si128(_mm_cvtsi32_si128(static_cast<int>(initCRC)), 12));
+    for (MARTe::uint32 n = 1u; n < nBlocks; n++) {
+        const __m128i *next = &blocks[n * 4u];
+        x0 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x0, fold512, 0x11), _mm_clmulepi64_si128(x0, fold512, 0x00)),
+                           _mm_shuffle_epi8(_mm_loadu_si128(&next[0]), swapMask));
+        x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, fold512, 0x11), _mm_clmulepi64_si128(x1, fold512, 0x00)),
+                           _mm_shuffle_epi8(_mm_loadu_si128(&next[1]), swapMask));
+        x2 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x2, fold512, 0x11), _mm_clmulepi64_si128(x2, fold512, 0x00)),
+                           _mm_shuffle_epi8(_mm_loadu_si128(&next[2]), swapMask));
+        x3 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x3, fold512, 0x11), _mm_clmulepi64_si128(x3, fold512, 0x00)),
+                           _mm_shuffle_epi8(_mm_loadu_si128(&next[3]), swapMask));
+    }
+    //x0 * x^384 + x1 * x^256 + x2 * x^128 + x3
+    x0 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x0, fold128, 0x11), _mm_clmulepi64_si128(x0, fold128, 0x00)), x1);
+    x0 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x0, fold128, 0x11), _mm_clmulepi64_si128(x0, fold128, 0x00)), x2);
+    x0 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x0, fold128, 0x11), _mm_clmulepi64_si128(x0, fold128, 0x00)), x3);
+    //x0 * x^32 reduced to 96 bits: high * (x^96 mod P) + low * x^32
+    __m128i reduce = _mm_set_epi64x(0, static_cast<long long>(constants[4]));
+    x0 = _mm_xor_si128(_mm_clmulepi64_si128(x0, reduce, 0x01), _mm_slli_si128(_mm_move_epi64(x0), 4));
+    //to 64 bits: bits 64-95 * (x^64 mod P) + low
+    reduce = _mm_set_epi64x(0, static_cast<long long>(constants[5]));
+    x0 = _mm_xor_si128(_mm_clmulepi64_si128(x0, reduce, 0x01), _mm_move_epi64(x0));
+    //Barrett reduction: quotient = ((x0 >> 32) * mu) >> 32, crc = x0 + quotient * P
+    const __m128i barrett = _mm_set_epi64x(static_cast<long long>(constants[7]), static_cast<long long>(constants[6]));
+    __m128i quotient = _mm_clmulepi64_si128(_mm_srli_epi64(x0, 32), barrett, 0x00);
+    quotient = _mm_srli_epi64(quotient, 32);
+    x0 = _mm_xor_si128(x0, _mm_clmulepi64_si128(quotient, barrett, 0x10));
+    return static_cast<MARTe::uint32>(_mm_cvtsi128_si32(x0));
+}
+
+#endif
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+CRCHardwareHelper::CRCHardwareHelper() {
+    implementation = CRC_HARDWARE_NONE;
+    for (uint32 i = 0u; i < 8u; i++) {
+        constants[i] = 0u;
+    }
+}
+
+CRCHardwareHelper::~CRCHardwareHelper() {
+
+}
+
+bool CRCHardwareHelper::Initialise(const uint32 polynomial) {
+    implementation = CRC_HARDWARE_NONE;
+    constants[0] = CRCHardwareXPowerModulo(polynomial, 576u);
+    constants[1] = CRCHardwareXPowerModulo(polynomial, 512u);
+    constants[2] = CRCHardwareXPowerModulo(polynomial, 192u);
+    constants[3] = CRCHardwareXPowerModulo(polynomial, 128u);
+    constants[4] = CRCHardwareXPowerModulo(polynomial, 96u);
+    constants[5] = CRCHardwareXPowerModulo(polynomial, 64u);
+    constants[6] = CRCHardwareBarrettConstant(polynomial);
+    constants[7] = (static_cast<uint64>(1u) << 32u) | static_cast<uint64>(polynomial);
+#ifdef CRCGAM_X86_64_INTRINSICS
+    bool sse42;
+    bool pclmul;
+    CRCHardwareFeatures(sse42, pclmul);
+    if ((sse42) && (polynomial == CRC_HARDWARE_CASTAGNOLI)) {
+        implementation = CRC_HARDWARE_CRC32C;
+    }
+    else if (pclmul) {
+        implementation = CRC_HARDWARE_PCLMUL;
+    }
+    else {
+        implementation = CRC_HARDWARE_NONE;
+    }
+#endif
+    return IsAvailable();
+}
+
+void CRCHardwareHelper::Disable() {
+    implementation = CRC_HARDWARE_NONE;
+}
+
+bool CRCHardwareHelper::IsAvailable() const {
+    return (implementation != CRC_HARDWARE_NONE);
+}
+
+const char8 *CRCHardwareHelper::GetName() const {
+    const char8 *name = "none";
+    if (implementation == CRC_HARDWARE_CRC32C) {
+        name = "crc32c";
+    }
+    else if (implementation == CRC_HARDWARE_PCLMUL) {
+        name = "pclmul";
+    }
+    else {
+        name = "none";
+    }
+    return name;
+}
+
+/*lint -e{715} data and size are not used on architectures without intrinsics*/
+uint32 CRCHardwareHelper::Compute(const uint8 * const data,
+                                  const uint32 size,
+                                  const uint32 initCRC,
+                                  uint32 &processed) const {
+    uint32 crc = initCRC;
+    processed = 0u;
+#ifdef CRCGAM_X86_64_INTRINSICS
+    if (implementation == CRC_HARDWARE_CRC32C) {
+        uint32 nBlocks = size / 16u;
+        if (nBlocks > 0u) {
+            crc = CRCHardwareComputeCRC32C(data, nBlocks, initCRC);
+            processed = nBlocks * 16u;
+        }
+    }
+    else if (implementation == CRC_HARDWARE_PCLMUL) {
+        uint32 nBlocks = size / 64u;
+        if (nBlocks > 0u) {
+            crc = CRCHardwareComputePCLMUL(data, nBlocks, initCRC, &constants[0]);
+            processed = nBlocks * 64u;
+        }
+    }
+    else {
+        processed = 0u;
+    }
+#endif
+    return crc;
+}
+
+}
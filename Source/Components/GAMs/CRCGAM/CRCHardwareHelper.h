@@ -0,0 +1,128 @@
+/**
+ * @file CRCHardwareHelper.h
+ * @brief Header file for class CRCHardwareHelper
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class CRCHardwareHelper
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SOURCE_COMPONENTS_GAMS_CRCGAM_CRCHARDWAREHELPER_H_
+#define SOURCE_COMPONENTS_GAMS_CRCGAM_CRCHARDWAREHELPER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Computes 32-bit CRCs of large buffers with the x86-64 CRC instructions.
+ * @details The CRC is the one of CRC<uint32> (most significant bit first, no final
+ * inversion). The implementation is selected at run-time by Initialise():
+ * - the SSE4.2 crc32 instruction if the polynomial is the CRC-32C (Castagnoli)
+ *   polynomial 0x1EDC6F41. The instruction works on bit-reflected data, so the
+ *   bits of each input byte are reversed with SSSE3 shuffles;
+ * - carry-less multiplication (PCLMULQDQ) folding of 64 bytes per step, followed
+ *   by a Barrett reduction, for any other polynomial.
+ *
+ * Only whole blocks (16 bytes for crc32, 64 bytes for the folding) are processed:
+ * the caller completes the CRC of the remaining bytes starting from the returned value.
+ * On other architectures, or if the processor lacks the instructions, IsAvailable() is false.
+ */
+class CRCHardwareHelper {
+public:
+    /**
+     * @brief Constructor. No hardware implementation is selected.
+     */
+    CRCHardwareHelper();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    ~CRCHardwareHelper();
+
+    /**
+     * @brief Selects the hardware implementation for the polynomial and precomputes its constants.
+     * @param[in] polynomial the divisor polynomial without the x^32 term.
+     * @return true if the processor supports an implementation for \a polynomial.
+     */
+    bool Initialise(const uint32 polynomial);
+
+    /**
+     * @brief Deselects the hardware implementation.
+     * @post
+     *   !IsAvailable()
+     */
+    void Disable();
+
+    /**
+     * @brief Returns true if Initialise() selected an implementation.
+     * @return true if Compute() can be called.
+     */
+    bool IsAvailable() const;
+
+    /**
+     * @brief Returns the name of the selected implementation.
+     * @return "crc32c", "pclmul" or "none".
+     */
+    const char8 *GetName() const;
+
+    /**
+     * @brief Computes the CRC of the largest number of whole blocks in \a data.
+     * @param[in] data the bytes against which the CRC will be computed.
+     * @param[in] size the number of bytes in \a data.
+     * @param[in] initCRC the initial CRC value.
+     * @param[out] processed the number of bytes of \a data included in the returned CRC.
+     * @return the CRC of the first \a processed bytes of \a data.
+     * @pre
+     *   IsAvailable()
+     */
+    uint32 Compute(const uint8 * const data,
+                   const uint32 size,
+                   const uint32 initCRC,
+                   uint32 &processed) const;
+
+private:
+
+    /**
+     * The selected implementation (none, crc32 or carry-less multiplication folding).
+     */
+    uint8 implementation;
+
+    /**
+     * The folding and reduction constants: x^576, x^512, x^192, x^128, x^96 and x^64 modulo the polynomial,
+     * the Barrett constant floor(x^64 / polynomial) and the polynomial with the x^32 term.
+     */
+    uint64 constants[8];
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SOURCE_COMPONENTS_GAMS_CRCGAM_CRCHARDWAREHELPER_H_ */
@@ -68,6 +68,12 @@ public:
      */
     virtual void Compute(const uint8 * const data, int32 const size, void * const initCRC, bool const inputInverted, void * const retVal) = 0;
 
+    /**
+     * @brief To be specialised by CRCHelperT for all the supported types.
+     * @return the name of the implementation used by Compute.
+     */
+    virtual const char8 *GetImplementation() const = 0;
+
 };
 }
 
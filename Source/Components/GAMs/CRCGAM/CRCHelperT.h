@@ -31,9 +31,11 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
 #include "CRC.h"
 /*lint -efile(766,CRCHelperT.h) CRCHelper.h are used in this file*/
 #include "CRCHelper.h"
+#include "CRCHardwareHelper.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -41,10 +43,21 @@
 namespace MARTe {
 /**
  * @brief Helper class to compute the CRC using different templates.
+ * @details The CRC is computed eight bytes at a time (slicing-by-8) with eight lookup tables,
+ * derived in ComputeTable() from the byte-wise CRC<T>. For 32-bit CRCs the blocks of large buffers
+ * are computed by the CRCHardwareHelper when the processor supports it, unless disabled in the constructor.
+ * ComputeTable() checks these implementations against CRC<T>::Compute on a test pattern and
+ * falls back to CRC<T>::Compute if they differ.
  */
 template <typename T>
 class CRCHelperT : public CRCHelper {
 public:
+    /**
+     * @brief Constructor.
+     * @param[in] hardwareAccelerationIn if false the CRCHardwareHelper is never used.
+     */
+    CRCHelperT(const bool hardwareAccelerationIn = true);
+
     /**
      * @brief Destructor. NOOP.
      */
@@ -64,12 +77,48 @@ public:
      */
     virtual void Compute(const uint8 * const data, int32 const size, void * const initCRC, bool const inputInverted, void * const retVal);
 
+    /**
+     * @see CRCHelper::GetImplementation
+     * @return "table" (CRC<T>::Compute), "slicing-by-8", "crc32c" or "pclmul", as selected by ComputeTable().
+     */
+    virtual const char8 *GetImplementation() const;
+
 private:
 
+    /**
+     * @brief Computes the CRC eight bytes at a time.
+     * @param[in] data the first byte.
+     * @param[in] size the number of bytes.
+     * @param[in] initCRC the initial CRC value.
+     * @param[in] step 1 to process data[0], data[1], ..., -1 to process data[0], data[-1], ...
+     * @return the CRC.
+     */
+    T ComputeSlicing(const uint8 * const data, const int32 size, const T initCRC, const int32 step) const;
+
     /**
      * CRC template class.
      */
     CRC<T> crc;
+
+    /**
+     * table[k][b] is the CRC of the byte b followed by k zero bytes.
+     */
+    T table[8][256];
+
+    /**
+     * True if the tables are consistent with CRC<T>::Compute.
+     */
+    bool useSlicing;
+
+    /**
+     * True if the CRCHardwareHelper can be used.
+     */
+    bool hardwareAcceleration;
+
+    /**
+     * The hardware implementation for 32-bit CRCs.
+     */
+    CRCHardwareHelper hardware;
 };
 }
 
@@ -79,19 +128,133 @@ private:
 namespace MARTe {
 
 /*lint -esym(9107, MARTe::CRCHelperT*) [MISRA C++ Rule 3-1-1] required for template implementation*/
+template<typename T>
+CRCHelperT<T>::CRCHelperT(const bool hardwareAccelerationIn) :
+        CRCHelper() {
+    useSlicing = false;
+    hardwareAcceleration = hardwareAccelerationIn;
+}
+
 template<typename T>
 void CRCHelperT<T>::ComputeTable(void * const pol) {
-    crc.ComputeTable(*static_cast<T*>(pol));
+    T polynomial = *static_cast<T*>(pol);
+    crc.ComputeTable(polynomial);
+    const uint32 shift = static_cast<uint32>((sizeof(T) - 1u) * 8u);
+    for (uint32 b = 0u; b < 256u; b++) {
+        uint8 byte = static_cast<uint8>(b);
+        table[0u][b] = crc.Compute(&byte, 1, static_cast<T>(0u), false);
+    }
+    for (uint32 k = 1u; k < 8u; k++) {
+        for (uint32 b = 0u; b < 256u; b++) {
+            T previous = table[k - 1u][b];
+            table[k][b] = static_cast<T>(static_cast<T>(previous << 8u) ^ table[0u][static_cast<uint8>(previous >> shift)]);
+        }
+    }
+    //Check the fast implementations against the byte-wise CRC
+    const int32 patternSize = 256;
+    uint8 pattern[patternSize];
+    uint32 seed = 12345u;
+    for (int32 i = 0; i < patternSize; i++) {
+        seed = (seed * 1103515245u) + 12345u;
+        pattern[i] = static_cast<uint8>(seed >> 16u);
+    }
+    const T initCRC = static_cast<T>(0xA5A5A5A5u);
+    const T expected = crc.Compute(&pattern[0], patternSize, initCRC, false);
+    useSlicing = (ComputeSlicing(&pattern[0], patternSize, initCRC, 1) == expected);
+    if (useSlicing) {
+        useSlicing = (ComputeSlicing(&pattern[patternSize - 1], patternSize - 1, initCRC, -1) == crc.Compute(&pattern[patternSize - 1], patternSize - 1, initCRC, true));
+    }
+    if (!useSlicing) {
+        REPORT_ERROR_STATIC(ErrorManagement::Warning, "The slicing-by-8 CRC differs from the byte-wise CRC: using the byte-wise CRC.");
+    }
+    hardware.Disable();
+    if ((useSlicing) && (hardwareAcceleration) && (sizeof(T) == 4u)) {
+        if (hardware.Initialise(static_cast<uint32>(polynomial))) {
+            uint32 processed = 0u;
+            T hardwareCRC = static_cast<T>(hardware.Compute(&pattern[0], static_cast<uint32>(patternSize), static_cast<uint32>(initCRC), processed));
+            hardwareCRC = ComputeSlicing(&pattern[processed], patternSize - static_cast<int32>(processed), hardwareCRC, 1);
+            if (hardwareCRC != expected) {
+                REPORT_ERROR_STATIC(ErrorManagement::Warning, "The %s CRC differs from the byte-wise CRC: using slicing-by-8.", hardware.GetName());
+                hardware.Disable();
+            }
+        }
+    }
+}
+
+template<typename T>
+T CRCHelperT<T>::ComputeSlicing(const uint8 * const data, const int32 size, const T initCRC, const int32 step) const {
+    const uint32 width = static_cast<uint32>(sizeof(T));
+    T crcValue = initCRC;
+    const uint8 *next = data;
+    int32 remaining = size;
+    while (remaining >= 8) {
+        uint8 bytes[8];
+        if (step > 0) {
+            for (uint32 j = 0u; j < 8u; j++) {
+                bytes[j] = next[j];
+            }
+        }
+        else {
+            for (uint32 j = 0u; j < 8u; j++) {
+                bytes[j] = *(next - j);
+            }
+        }
+        next = &next[step * 8];
+        //The first sizeof(T) bytes are combined with the CRC register, most significant byte first
+        for (uint32 j = 0u; j < width; j++) {
+            bytes[j] ^= static_cast<uint8>(crcValue >> ((width - 1u - j) * 8u));
+        }
+        crcValue = static_cast<T>(table[7u][bytes[0u]] ^ table[6u][bytes[1u]] ^ table[5u][bytes[2u]] ^ table[4u][bytes[3u]] ^
+                                  table[3u][bytes[4u]] ^ table[2u][bytes[5u]] ^ table[1u][bytes[6u]] ^ table[0u][bytes[7u]]);
+        remaining -= 8;
+    }
+    const uint32 shift = (width - 1u) * 8u;
+    while (remaining > 0) {
+        uint8 index = static_cast<uint8>(static_cast<uint8>(crcValue >> shift) ^ *next);
+        crcValue = static_cast<T>(table[0u][index] ^ static_cast<T>(crcValue << 8u));
+        next = &next[step];
+        remaining--;
+    }
+    return crcValue;
 }
 
 template<typename T>
 void CRCHelperT<T>::Compute(const uint8 * const data, int32 const size, void * const initCRC, bool const inputInverted, void * const retVal) {
-    T crcValue = crc.Compute(data, size, *static_cast<T*>(initCRC), inputInverted);
+    T crcValue = *static_cast<T*>(initCRC);
+    if (useSlicing) {
+        int32 processed = 0;
+        if ((!inputInverted) && (hardware.IsAvailable()) && (size > 0)) {
+            uint32 hardwareProcessed = 0u;
+            crcValue = static_cast<T>(hardware.Compute(data, static_cast<uint32>(size), static_cast<uint32>(crcValue), hardwareProcessed));
+            processed = static_cast<int32>(hardwareProcessed);
+        }
+        if (processed < size) {
+            crcValue = ComputeSlicing(&data[processed], size - processed, crcValue, inputInverted ? -1 : 1);
+        }
+    }
+    else {
+        crcValue = crc.Compute(data, size, crcValue, inputInverted);
+    }
     if (retVal != NULL_PTR(void *)) {
         *static_cast<T*>(retVal) = crcValue;
     }
 }
 
+template<typename T>
+const char8 *CRCHelperT<T>::GetImplementation() const {
+    const char8 *name = "table";
+    if (hardware.IsAvailable()) {
+        name = hardware.GetName();
+    }
+    else if (useSlicing) {
+        name = "slicing-by-8";
+    }
+    else {
+        name = "table";
+    }
+    return name;
+}
+
 }
 
 #endif /* SOURCE_COMPONENTS_GAMS_CRCGAM_CRCHELPERT_H_ */
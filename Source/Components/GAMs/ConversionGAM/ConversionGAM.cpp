@@ -500,6 +500,12 @@ bool ConversionGAM::Setup() {
                         if (conversionHelpers[idx]->LoadGain(cdb)) {
                             REPORT_ERROR(ErrorManagement::ParametersError, "Gain set for conversion %d", idx);
                         }
+                        if (conversionHelpers[idx]->LoadOffset(cdb)) {
+                            REPORT_ERROR(ErrorManagement::Information, "Offset set for conversion %d", idx);
+                        }
+                        if (conversionHelpers[idx]->LoadSaturate(cdb)) {
+                            REPORT_ERROR(ErrorManagement::Information, "Saturation set for conversion %d", idx);
+                        }
                         ret = cdb.MoveToAncestor(1u);
                     }
                 }
@@ -45,6 +45,15 @@ namespace MARTe {
  * also be specified so that outputSignal[i] = gain[i] * inputSignal[i], where i is the input signal index (see GetNumberOfInputSignals()).
  * If the signal is an array (or has more than one sample), this operation is applied to each element/sample.
  *
+ * An Offset can also be specified, so that outputSignal[i] = gain[i] * inputSignal[i] + offset[i]. In this case
+ * the operation is computed in float32 (float32 outputs with 8 or 16 bit integer or float32 inputs) or in float64,
+ * and the result is clamped to the range of integer output types.
+ *
+ * By default the out-of-range values of narrowing conversions wrap around as in a C cast. If Saturate = 1 is set
+ * in the output signal, they are clamped to the limits of the output type instead (NaN is converted to 0 for integer outputs).
+ *
+ * The conversion loop for each signal is selected in Setup, so that Execute performs a single loop per signal.
+ *
  * The number of input and output signals shall be the same, i.e. GetNumberOfInputSignals() == GetNumberOfOutputSignals().
  *
  * For each input signal, the number of elements multiplied by the number of samples shall be the
@@ -66,6 +75,10 @@ namespace MARTe {
  *             DataSource = "Drv2"
  *             Type = int16
  *         }
+ *         Signal3 = {
+ *             DataSource = "Drv2"
+ *             Type = float32
+ *         }
  *     }
  *     OutputSignals = {
  *         Signal1 = {
@@ -78,6 +91,13 @@ namespace MARTe {
  *             DataSource = "LCD"
  *             Type = int32
  *         }
+ *         Signal3 = {
+ *             DataSource = "DAC"
+ *             Type = int16
+ *             Gain = 3276.7 //Optional. Default = 1.
+ *             Offset = 0 //Optional. Default = 0.
+ *             Saturate = 1 //Optional. Default = 0.
+ *         }
  *     }
  * }
  * </pre>
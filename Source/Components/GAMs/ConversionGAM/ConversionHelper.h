@@ -69,6 +69,20 @@ public:
      */
     virtual bool LoadGain(StructuredDataI &data) = 0;
 
+    /**
+     * @brief Reads the Offset parameter which is added to the scaled input.
+     * @param data where to read the Offset parameter.
+     * @return true if the Offset was specified.
+     */
+    virtual bool LoadOffset(StructuredDataI &data) = 0;
+
+    /**
+     * @brief Reads the Saturate parameter. If set to 1 the values outside the range of the output type are clamped to its limits.
+     * @param data where to read the Saturate parameter.
+     * @return true if the Saturate parameter was set to 1.
+     */
+    virtual bool LoadSaturate(StructuredDataI &data) = 0;
+
     /**
      * @brief Gets a pointer to input signal memory.
      * @return a pointer to input signal memory.
@@ -27,10 +27,12 @@
 /*---------------------------------------------------------------------------*/
 /*                        Standard header includes                           */
 /*---------------------------------------------------------------------------*/
+#include <limits>
 
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "MemoryOperationsHelper.h"
 #include "StructuredDataI.h"
 #include "ConversionHelper.h"
 
@@ -38,8 +40,64 @@
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
+/**
+ * @brief Type in which the Gain and the Offset are applied by ConversionHelperT: float32 if the
+ * output is float32 and all the input values are exactly representable in float32, float64 otherwise.
+ */
+template<typename inputType, typename outputType>
+struct ConversionHelperScaleType {
+    typedef float64 Type;
+};
+
+/**
+ * @see ConversionHelperScaleType
+ */
+template<>
+struct ConversionHelperScaleType<uint8, float32> {
+    typedef float32 Type;
+};
+
+/**
+ * @see ConversionHelperScaleType
+ */
+template<>
+struct ConversionHelperScaleType<int8, float32> {
+    typedef float32 Type;
+};
+
+/**
+ * @see ConversionHelperScaleType
+ */
+template<>
+struct ConversionHelperScaleType<uint16, float32> {
+    typedef float32 Type;
+};
+
+/**
+ * @see ConversionHelperScaleType
+ */
+template<>
+struct ConversionHelperScaleType<int16, float32> {
+    typedef float32 Type;
+};
+
+/**
+ * @see ConversionHelperScaleType
+ */
+template<>
+struct ConversionHelperScaleType<float32, float32> {
+    typedef float32 Type;
+};
+
 /**
  * @brief Support class for the ConversionGAM. One instance for each input signal is to be allocated.
+ * @details The conversion kernel is selected when the parameters are loaded, so that Convert() is a single loop
+ * over all the elements and samples, written so that it can be vectorised by the compiler:
+ * - no Gain, Offset or Saturate: the values are copied (same types) or cast to the outputType;
+ * - Gain only: outputSignal = Gain * static_cast<outputType>(inputSignal), with the Gain of type outputType;
+ * - Saturate only, integer types: the values outside the range of the outputType are clamped to its limits;
+ * - otherwise: outputSignal = Gain * inputSignal + Offset, computed in ConversionHelperScaleType. The result is
+ *   clamped to the range of the outputType if Saturate is set or if the outputType is an integer (NaN is converted to 0).
  */
 /*lint -esym(9107, MARTe::ConversionHelperT*) [MISRA C++ Rule 3-1-1]. Justification: Required for template implementation.
  * No code is actually being generated and the header files can be included in multiple unit files.*/
@@ -58,7 +116,7 @@ public:
 
     /**
      * @see ConversionHelper::Convert.
-     * @details Converts for the declared type names. A cast to the declared inputType and outputType is performed and the signals are copied.
+     * @details Converts for the declared type names with the kernel selected by the loaded parameters.
      */
     virtual void Convert();
 
@@ -67,7 +125,57 @@ public:
      */
     virtual bool LoadGain(StructuredDataI &data);
 
+    /**
+     * @see ConversionHelper::LoadOffset.
+     */
+    virtual bool LoadOffset(StructuredDataI &data);
+
+    /**
+     * @see ConversionHelper::LoadSaturate.
+     */
+    virtual bool LoadSaturate(StructuredDataI &data);
+
 private:
+    /**
+     * The type in which the Gain and the Offset are applied.
+     */
+    typedef typename ConversionHelperScaleType<inputType, outputType>::Type ScaleType;
+
+    /**
+     * @brief Selects the conversion kernel for the loaded parameters.
+     */
+    void SelectKernel();
+
+    /**
+     * @brief Copies the values (inputType and outputType are the same type).
+     */
+    void ConvertCopy(const inputType * const src, outputType * const dest, const uint32 numberOfValues) const;
+
+    /**
+     * @brief Casts the values to the outputType.
+     */
+    void ConvertCast(const inputType * const src, outputType * const dest, const uint32 numberOfValues) const;
+
+    /**
+     * @brief Casts the values to the outputType and multiplies them by the gain.
+     */
+    void ConvertGain(const inputType * const src, outputType * const dest, const uint32 numberOfValues) const;
+
+    /**
+     * @brief Clamps the integer values to the range of the integer outputType.
+     */
+    void ConvertSaturate(const inputType * const src, outputType * const dest, const uint32 numberOfValues) const;
+
+    /**
+     * @brief Applies the scaleGain and the scaleOffset.
+     */
+    void ConvertScale(const inputType * const src, outputType * const dest, const uint32 numberOfValues) const;
+
+    /**
+     * @brief Applies the scaleGain and the scaleOffset and clamps the result to the range of the outputType.
+     */
+    void ConvertScaleSaturate(const inputType * const src, outputType * const dest, const uint32 numberOfValues) const;
+
     /**
      * True if the Gain parameter was defined.
      */
@@ -77,6 +185,32 @@ private:
      * The gain that is used to scale the input signal.
      */
     outputType gain;
+
+    /**
+     * True if the Offset parameter was defined.
+     */
+    bool offsetDefined;
+
+    /**
+     * True if the Saturate parameter was set to 1.
+     */
+    bool saturate;
+
+    /**
+     * The Gain in the ScaleType (1 if not defined).
+     */
+    ScaleType scaleGain;
+
+    /**
+     * The Offset in the ScaleType (0 if not defined).
+     */
+    ScaleType scaleOffset;
+
+    /**
+     * The selected conversion kernel.
+     */
+    void (ConversionHelperT<inputType, outputType>::*kernel)(const inputType * const src, outputType * const dest, const uint32 numberOfValues) const;
+
     /*lint -e{1712} This class does not have a default constructor because
      * the inputMemory and the outputMemory must be defined on construction and both remain constant
      * during the object's lifetime*/
@@ -87,6 +221,91 @@ private:
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
+/**
+ * @brief Returns true if the two types are the same type.
+ */
+template<typename typeA, typename typeB>
+inline bool ConversionHelperSameType() {
+    typedef std::numeric_limits<typeA> limitsA;
+    typedef std::numeric_limits<typeB> limitsB;
+    return ((sizeof(typeA) == sizeof(typeB)) && (limitsA::is_integer == limitsB::is_integer) && (limitsA::is_signed == limitsB::is_signed));
+}
+
+/**
+ * @brief Returns the lowest finite value of the type.
+ */
+template<typename type>
+inline type ConversionHelperLowest() {
+    type lowest = std::numeric_limits<type>::min();
+    if (!std::numeric_limits<type>::is_integer) {
+        lowest = -std::numeric_limits<type>::max();
+    }
+    return lowest;
+}
+
+/**
+ * @brief Clamps an integer value to the range of the integer outputType.
+ * @details The comparisons are performed in int32 whenever all the values of both types fit in it.
+ */
+template<typename inputType, typename outputType>
+inline outputType ConversionHelperSaturate(const inputType value) {
+    typedef std::numeric_limits<inputType> inputLimits;
+    typedef std::numeric_limits<outputType> outputLimits;
+    const bool inputInt32 = (sizeof(inputType) < 4u) || ((sizeof(inputType) == 4u) && (inputLimits::is_signed));
+    const bool outputInt32 = (sizeof(outputType) < 4u) || ((sizeof(outputType) == 4u) && (outputLimits::is_signed));
+    const bool inputUnsigned64 = (sizeof(inputType) == 8u) && (!inputLimits::is_signed);
+    const bool outputUnsigned64 = (sizeof(outputType) == 8u) && (!outputLimits::is_signed);
+    outputType ret;
+    if (inputInt32 && outputInt32) {
+        const int32 v = static_cast<int32>(value);
+        const int32 minimum = static_cast<int32>(outputLimits::min());
+        const int32 maximum = static_cast<int32>(outputLimits::max());
+        ret = static_cast<outputType>((v < minimum) ? minimum : ((v > maximum) ? maximum : v));
+    }
+    else if (inputUnsigned64) {
+        const uint64 v = static_cast<uint64>(value);
+        const uint64 maximum = static_cast<uint64>(outputLimits::max());
+        ret = (v > maximum) ? outputLimits::max() : static_cast<outputType>(v);
+    }
+    else if (outputUnsigned64) {
+        const int64 v = static_cast<int64>(value);
+        ret = (v < 0) ? static_cast<outputType>(0) : static_cast<outputType>(v);
+    }
+    else {
+        const int64 v = static_cast<int64>(value);
+        const int64 minimum = static_cast<int64>(outputLimits::min());
+        const int64 maximum = static_cast<int64>(outputLimits::max());
+        ret = static_cast<outputType>((v < minimum) ? minimum : ((v > maximum) ? maximum : v));
+    }
+    return ret;
+}
+
+/**
+ * @brief Clamps a floating point value to the range of the outputType.
+ * @details The limits converted to scaleType may be rounded away from zero (e.g. 2^31 for int32 in float32),
+ * so the comparisons include them. NaN is converted to 0 for integer outputTypes.
+ */
+template<typename scaleType, typename outputType>
+inline outputType ConversionHelperSaturateFloat(const scaleType value) {
+    const scaleType minimum = static_cast<scaleType>(ConversionHelperLowest<outputType>());
+    const scaleType maximum = static_cast<scaleType>(std::numeric_limits<outputType>::max());
+    outputType ret;
+    if (value >= maximum) {
+        ret = std::numeric_limits<outputType>::max();
+    }
+    else if (value <= minimum) {
+        ret = ConversionHelperLowest<outputType>();
+    }
+    /*lint -e{777} NaN is the only value not equal to itself*/
+    else if ((value == value) || (!std::numeric_limits<outputType>::is_integer)) {
+        ret = static_cast<outputType>(value);
+    }
+    else {
+        ret = static_cast<outputType>(0);
+    }
+    return ret;
+}
+
 template<typename inputType, typename outputType>
 ConversionHelperT<inputType, outputType>::ConversionHelperT(
         const void * const inputMemoryIn, void * const outputMemoryIn) :
@@ -94,6 +313,12 @@ ConversionHelperT<inputType, outputType>::ConversionHelperT(
     gainDefined = false;
     /*lint -e{9117} [MISRA C++ Rule 5-0-4]. Justification: the type of the gain will depend on the outputType.*/
     gain = static_cast<outputType>(0);
+    offsetDefined = false;
+    saturate = false;
+    scaleGain = static_cast<ScaleType>(1.0);
+    scaleOffset = static_cast<ScaleType>(0.0);
+    kernel = &ConversionHelperT<inputType, outputType>::ConvertCast;
+    SelectKernel();
 }
 
 template<typename inputType, typename outputType>
@@ -104,31 +329,124 @@ ConversionHelperT<inputType, outputType>::~ConversionHelperT() {
 template<typename inputType, typename outputType>
 bool ConversionHelperT<inputType, outputType>::LoadGain(StructuredDataI &data) {
     gainDefined = data.Read("Gain", gain);
+    if (gainDefined) {
+        if (!data.Read("Gain", scaleGain)) {
+            scaleGain = static_cast<ScaleType>(gain);
+        }
+    }
+    else {
+        scaleGain = static_cast<ScaleType>(1.0);
+    }
+    SelectKernel();
     return gainDefined;
 }
 
+template<typename inputType, typename outputType>
+bool ConversionHelperT<inputType, outputType>::LoadOffset(StructuredDataI &data) {
+    offsetDefined = data.Read("Offset", scaleOffset);
+    if (!offsetDefined) {
+        scaleOffset = static_cast<ScaleType>(0.0);
+    }
+    SelectKernel();
+    return offsetDefined;
+}
+
+template<typename inputType, typename outputType>
+bool ConversionHelperT<inputType, outputType>::LoadSaturate(StructuredDataI &data) {
+    uint8 saturateValue = 0u;
+    if (!data.Read("Saturate", saturateValue)) {
+        saturateValue = 0u;
+    }
+    saturate = (saturateValue != 0u);
+    SelectKernel();
+    return saturate;
+}
+
+template<typename inputType, typename outputType>
+void ConversionHelperT<inputType, outputType>::SelectKernel() {
+    const bool integerInput = std::numeric_limits<inputType>::is_integer;
+    const bool integerOutput = std::numeric_limits<outputType>::is_integer;
+    if ((offsetDefined) || ((saturate) && (gainDefined))) {
+        if ((saturate) || (integerOutput)) {
+            kernel = &ConversionHelperT<inputType, outputType>::ConvertScaleSaturate;
+        }
+        else {
+            kernel = &ConversionHelperT<inputType, outputType>::ConvertScale;
+        }
+    }
+    else if (saturate) {
+        if ((integerInput) && (integerOutput)) {
+            kernel = &ConversionHelperT<inputType, outputType>::ConvertSaturate;
+        }
+        else {
+            kernel = &ConversionHelperT<inputType, outputType>::ConvertScaleSaturate;
+        }
+    }
+    else if (gainDefined) {
+        kernel = &ConversionHelperT<inputType, outputType>::ConvertGain;
+    }
+    else if (ConversionHelperSameType<inputType, outputType>()) {
+        kernel = &ConversionHelperT<inputType, outputType>::ConvertCopy;
+    }
+    else {
+        kernel = &ConversionHelperT<inputType, outputType>::ConvertCast;
+    }
+}
+
+template<typename inputType, typename outputType>
+void ConversionHelperT<inputType, outputType>::ConvertCopy(const inputType * const src, outputType * const dest, const uint32 numberOfValues) const {
+    (void) MemoryOperationsHelper::Copy(dest, src, static_cast<uint32>(numberOfValues * sizeof(outputType)));
+}
+
+template<typename inputType, typename outputType>
+void ConversionHelperT<inputType, outputType>::ConvertCast(const inputType * const src, outputType * const dest, const uint32 numberOfValues) const {
+    for (uint32 i = 0u; i < numberOfValues; i++) {
+        /*lint -e{734} -e{571} Loss of precision is responsibility of the conversion requested by the user.*/
+        dest[i] = static_cast<outputType>(src[i]);
+    }
+}
+
+template<typename inputType, typename outputType>
+void ConversionHelperT<inputType, outputType>::ConvertGain(const inputType * const src, outputType * const dest, const uint32 numberOfValues) const {
+    const outputType g = gain;
+    for (uint32 i = 0u; i < numberOfValues; i++) {
+        /*lint -e{734} -e{571} Loss of precision is responsibility of the conversion requested by the user.*/
+        dest[i] = g * static_cast<outputType>(src[i]);
+    }
+}
+
+template<typename inputType, typename outputType>
+void ConversionHelperT<inputType, outputType>::ConvertSaturate(const inputType * const src, outputType * const dest, const uint32 numberOfValues) const {
+    for (uint32 i = 0u; i < numberOfValues; i++) {
+        dest[i] = ConversionHelperSaturate<inputType, outputType>(src[i]);
+    }
+}
+
+template<typename inputType, typename outputType>
+void ConversionHelperT<inputType, outputType>::ConvertScale(const inputType * const src, outputType * const dest, const uint32 numberOfValues) const {
+    const ScaleType g = scaleGain;
+    const ScaleType o = scaleOffset;
+    for (uint32 i = 0u; i < numberOfValues; i++) {
+        /*lint -e{734} -e{571} Loss of precision is responsibility of the conversion requested by the user.*/
+        dest[i] = static_cast<outputType>((static_cast<ScaleType>(src[i]) * g) + o);
+    }
+}
+
+template<typename inputType, typename outputType>
+void ConversionHelperT<inputType, outputType>::ConvertScaleSaturate(const inputType * const src, outputType * const dest, const uint32 numberOfValues) const {
+    const ScaleType g = scaleGain;
+    const ScaleType o = scaleOffset;
+    for (uint32 i = 0u; i < numberOfValues; i++) {
+        dest[i] = ConversionHelperSaturateFloat<ScaleType, outputType>((static_cast<ScaleType>(src[i]) * g) + o);
+    }
+}
+
 template<typename inputType, typename outputType>
 void ConversionHelperT<inputType, outputType>::Convert() {
-    uint32 s;
-    uint32 n;
-    uint32 idx;
     outputType *dest = reinterpret_cast<outputType *>(outputMemory);
     const inputType *src = reinterpret_cast<const inputType *>(inputMemory);
     if ((dest != NULL) && (src != NULL)) {
-        for (s = 0u; s < numberOfSamples; s++) {
-            for (n = 0u; n < numberOfElements; n++) {
-                idx = s * numberOfElements;
-                idx += n;
-                if (gainDefined) {
-                    /*lint -e{734} -e{571} Loss of precision is responsibility of the conversion requested by the user.*/
-                    dest[idx] = gain * static_cast<outputType>(src[idx]);
-                }
-                else {
-                    /*lint -e{734} -e{571} Loss of precision is responsibility of the conversion requested by the user.*/
-                    dest[idx] = static_cast<outputType>(src[idx]);
-                }
-            }
-        }
+        (this->*kernel)(src, dest, numberOfSamples * numberOfElements);
     }
 }
 
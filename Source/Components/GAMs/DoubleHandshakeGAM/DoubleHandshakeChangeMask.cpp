@@ -0,0 +1,285 @@
+/**
+ * @file DoubleHandshakeChangeMask.cpp
+ * @brief Source file for class DoubleHandshakeChangeMask
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class DoubleHandshakeChangeMask (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "DoubleHandshakeChangeMask.h"
+#include "MemoryOperationsHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace {
+
+/**
+ * The number of bytes compared at once.
+ */
+const MARTe::uint32 WORD_SIZE = 8u;
+
+/**
+ * The number of channels in each word of the channel bitmasks.
+ */
+const MARTe::uint32 CHANNELS_PER_MASK_WORD = 32u;
+
+/**
+ * @brief Returns the index of the lowest bit set in \a value (which must not be zero).
+ */
+inline MARTe::uint32 LowestBitSet(const MARTe::uint32 value) {
+#ifdef __GNUC__
+    return static_cast<MARTe::uint32>(__builtin_ctz(value));
+#else
+    MARTe::uint32 bit = 0u;
+    while (((value >> bit) & 1u) == 0u) {
+        bit++;
+    }
+    return bit;
+#endif
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+DoubleHandshakeChangeMask::DoubleHandshakeChangeMask() {
+    numberOfChannels = 0u;
+    bufferSize = 0u;
+    numberOfMaskWords = 0u;
+    active = NULL_PTR(uint32*);
+    pending = NULL_PTR(uint32*);
+    pendingIdx = 0u;
+    maxNumberOfWords = 0u;
+    changeWords = NULL_PTR(ChangeMaskWord*);
+    numberOfChangeWords = 0u;
+    nonZeroWords = NULL_PTR(ChangeMaskWord*);
+    numberOfNonZeroWords = 0u;
+}
+
+DoubleHandshakeChangeMask::~DoubleHandshakeChangeMask() {
+    if (active != NULL_PTR(uint32*)) {
+        delete[] active;
+    }
+    if (pending != NULL_PTR(uint32*)) {
+        delete[] pending;
+    }
+    if (changeWords != NULL_PTR(ChangeMaskWord*)) {
+        delete[] changeWords;
+    }
+    if (nonZeroWords != NULL_PTR(ChangeMaskWord*)) {
+        delete[] nonZeroWords;
+    }
+}
+
+bool DoubleHandshakeChangeMask::Initialise(const uint32 numberOfChannelsIn,
+                                           const uint32 bufferSizeIn) {
+    bool ret = (changeWords == NULL_PTR(ChangeMaskWord*));
+    if (ret) {
+        numberOfChannels = numberOfChannelsIn;
+        bufferSize = bufferSizeIn;
+        numberOfMaskWords = ((numberOfChannels + CHANNELS_PER_MASK_WORD) - 1u) / CHANNELS_PER_MASK_WORD;
+        if (numberOfMaskWords > 0u) {
+            active = new uint32[numberOfMaskWords];
+            pending = new uint32[numberOfMaskWords];
+            for (uint32 w = 0u; w < numberOfMaskWords; w++) {
+                active[w] = 0xFFFFFFFFu;
+                pending[w] = 0u;
+            }
+            uint32 lastBits = (numberOfChannels % CHANNELS_PER_MASK_WORD);
+            if (lastBits > 0u) {
+                active[numberOfMaskWords - 1u] = ((1u << lastBits) - 1u);
+            }
+        }
+        pendingIdx = numberOfMaskWords;
+
+        //each range adds at most one entry for each word that it fully covers plus the two partial words at its ends
+        maxNumberOfWords = ((bufferSize / WORD_SIZE) + (2u * numberOfChannels)) + 1u;
+        changeWords = new ChangeMaskWord[maxNumberOfWords];
+        nonZeroWords = new ChangeMaskWord[maxNumberOfWords];
+        numberOfChangeWords = 0u;
+        numberOfNonZeroWords = 0u;
+    }
+    return ret;
+}
+
+bool DoubleHandshakeChangeMask::AddChangeRange(const uint32 channel,
+                                               const uint32 offset,
+                                               const uint32 size) {
+    return AddRange(changeWords, numberOfChangeWords, channel, offset, size);
+}
+
+bool DoubleHandshakeChangeMask::AddNonZeroRange(const uint32 channel,
+                                                const uint32 offset,
+                                                const uint32 size) {
+    return AddRange(nonZeroWords, numberOfNonZeroWords, channel, offset, size);
+}
+
+bool DoubleHandshakeChangeMask::AddRange(ChangeMaskWord * const words,
+                                         uint32 &numberOfWords,
+                                         const uint32 channel,
+                                         const uint32 offset,
+                                         const uint32 size) const {
+    bool ret = (words != NULL_PTR(ChangeMaskWord*));
+    if (ret) {
+        ret = (channel < numberOfChannels);
+    }
+    if (ret) {
+        ret = (offset <= bufferSize);
+    }
+    if (ret) {
+        ret = (size <= (bufferSize - offset));
+    }
+    uint32 position = offset;
+    uint32 end = (offset + size);
+    while ((position < end) && (ret)) {
+        uint32 wordOffset = (position - (position % WORD_SIZE));
+        uint32 wordEnd = (wordOffset + WORD_SIZE);
+        if (wordEnd > end) {
+            wordEnd = end;
+        }
+        //the mask is built byte by byte, so that it does not depend on the endianness
+        uint8 maskBytes[WORD_SIZE];
+        (void) MemoryOperationsHelper::Set(&maskBytes[0], '\0', WORD_SIZE);
+        for (uint32 k = position; k < wordEnd; k++) {
+            maskBytes[k - wordOffset] = 0xFFu;
+        }
+        uint64 rangeMask = 0u;
+        (void) MemoryOperationsHelper::Copy(&rangeMask, &maskBytes[0], WORD_SIZE);
+
+        bool merged = false;
+        if (numberOfWords > 0u) {
+            ChangeMaskWord &last = words[numberOfWords - 1u];
+            if ((last.offset == wordOffset) && (channel >= last.firstChannel)) {
+                last.mask |= rangeMask;
+                if (channel > last.lastChannel) {
+                    last.lastChannel = channel;
+                }
+                merged = true;
+            }
+        }
+        if (!merged) {
+            ret = (numberOfWords < maxNumberOfWords);
+            if (ret) {
+                ChangeMaskWord &word = words[numberOfWords];
+                word.offset = wordOffset;
+                word.size = (bufferSize - wordOffset);
+                if (word.size > WORD_SIZE) {
+                    word.size = WORD_SIZE;
+                }
+                word.mask = rangeMask;
+                word.firstChannel = channel;
+                word.lastChannel = channel;
+                numberOfWords++;
+            }
+        }
+        position = wordEnd;
+    }
+    return ret;
+}
+
+uint64 DoubleHandshakeChangeMask::Load(const uint8 * const buffer,
+                                       const ChangeMaskWord &word) {
+    //the buffers are not required to be 8-byte aligned, so the word is copied and not dereferenced
+    uint64 value = 0u;
+    (void) MemoryOperationsHelper::Copy(&value, &buffer[word.offset], word.size);
+    return value;
+}
+
+void DoubleHandshakeChangeMask::MarkChannels(const ChangeMaskWord &word) {
+    //a word shared by more channels marks all of them: executing a channel which did not change is harmless
+    for (uint32 c = word.firstChannel; c <= word.lastChannel; c++) {
+        /*lint -e{613} NULL pointer checked by the caller.*/
+        pending[c / CHANNELS_PER_MASK_WORD] |= (1u << (c % CHANNELS_PER_MASK_WORD));
+    }
+}
+
+void DoubleHandshakeChangeMask::Update(const uint8 * const current,
+                                       const uint8 * const previous) {
+    if (pending != NULL_PTR(uint32*)) {
+        for (uint32 w = 0u; w < numberOfMaskWords; w++) {
+            /*lint -e{613} NULL pointer checked.*/
+            pending[w] = active[w];
+        }
+        for (uint32 w = 0u; w < numberOfChangeWords; w++) {
+            /*lint -e{613} NULL pointer checked.*/
+            const ChangeMaskWord &word = changeWords[w];
+            uint64 diff = ((Load(current, word) ^ Load(previous, word)) & word.mask);
+            if (diff != 0u) {
+                MarkChannels(word);
+            }
+        }
+        for (uint32 w = 0u; w < numberOfNonZeroWords; w++) {
+            /*lint -e{613} NULL pointer checked.*/
+            const ChangeMaskWord &word = nonZeroWords[w];
+            if ((Load(current, word) & word.mask) != 0u) {
+                MarkChannels(word);
+            }
+        }
+        pendingIdx = 0u;
+    }
+}
+
+bool DoubleHandshakeChangeMask::GetNextChannel(uint32 &channel) {
+    bool found = false;
+    while ((!found) && (pendingIdx < numberOfMaskWords)) {
+        /*lint -e{613} NULL pointer checked (numberOfMaskWords is zero otherwise).*/
+        uint32 bits = pending[pendingIdx];
+        if (bits != 0u) {
+            uint32 bit = LowestBitSet(bits);
+            /*lint -e{613} NULL pointer checked (numberOfMaskWords is zero otherwise).*/
+            pending[pendingIdx] = (bits & (bits - 1u));
+            channel = ((pendingIdx * CHANNELS_PER_MASK_WORD) + bit);
+            found = true;
+        }
+        else {
+            pendingIdx++;
+        }
+    }
+    return found;
+}
+
+void DoubleHandshakeChangeMask::SetActive(const uint32 channel,
+                                          const bool activeIn) {
+    if (channel < numberOfChannels) {
+        uint32 bit = (1u << (channel % CHANNELS_PER_MASK_WORD));
+        if (activeIn) {
+            /*lint -e{613} NULL pointer checked (numberOfChannels is zero otherwise).*/
+            active[channel / CHANNELS_PER_MASK_WORD] |= bit;
+        }
+        else {
+            /*lint -e{613} NULL pointer checked (numberOfChannels is zero otherwise).*/
+            active[channel / CHANNELS_PER_MASK_WORD] &= ~bit;
+        }
+    }
+}
+
+}
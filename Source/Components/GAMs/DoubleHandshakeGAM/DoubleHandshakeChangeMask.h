@@ -0,0 +1,240 @@
+/**
+ * @file DoubleHandshakeChangeMask.h
+ * @brief Header file for class DoubleHandshakeChangeMask
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class DoubleHandshakeChangeMask
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SOURCE_COMPONENTS_GAMS_DOUBLEHANDSHAKEGAM_DOUBLEHANDSHAKECHANGEMASK_H_
+#define SOURCE_COMPONENTS_GAMS_DOUBLEHANDSHAKEGAM_DOUBLEHANDSHAKECHANGEMASK_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Selects the channels of a double handshake GAM which have to be executed in a cycle.
+ * @details Each channel (command) owns byte ranges of the GAM input buffer:
+ *   - change ranges (AddChangeRange()): the channel is dirty if the range differs from
+ *     the same range of the buffer of the previous values;
+ *   - non-zero ranges (AddNonZeroRange()): the channel is dirty if the range is not zero.
+ *
+ * The ranges are compared eight bytes at a time: Initialise() and the Add methods precompute, for
+ * each 64-bit word of the buffer covered by a range, the mask of the bytes to compare and the channels
+ * which own them, so that Update() costs one XOR (or AND) per word instead of a byte-wise compare
+ * per channel. The dirty channels, together with the channels flagged with SetActive(), are
+ * kept in a bitmask and returned in increasing order by GetNextChannel().
+ *
+ * All the channels are active after Initialise(), so that the first cycle executes all of them.
+ */
+class DoubleHandshakeChangeMask {
+public:
+    /**
+     * @brief Constructor. No channels.
+     */
+    DoubleHandshakeChangeMask();
+
+    /**
+     * @brief Destructor. Frees the memory.
+     */
+    ~DoubleHandshakeChangeMask();
+
+    /**
+     * @brief Allocates the masks.
+     * @param[in] numberOfChannelsIn the number of channels.
+     * @param[in] bufferSizeIn the size in bytes of the compared buffers.
+     * @return false if the object was already initialised.
+     * @post
+     *   all the channels are active.
+     */
+    bool Initialise(const uint32 numberOfChannelsIn,
+                    const uint32 bufferSizeIn);
+
+    /**
+     * @brief Adds a range which makes \a channel dirty when it differs from the previous value.
+     * @param[in] channel the channel which owns the range.
+     * @param[in] offset the offset of the range in the buffers.
+     * @param[in] size the number of bytes of the range.
+     * @return false if \a channel or the range are out of bounds.
+     */
+    bool AddChangeRange(const uint32 channel,
+                        const uint32 offset,
+                        const uint32 size);
+
+    /**
+     * @brief Adds a range which makes \a channel dirty when it is not zero.
+     * @param[in] channel the channel which owns the range.
+     * @param[in] offset the offset of the range in the buffers.
+     * @param[in] size the number of bytes of the range.
+     * @return false if \a channel or the range are out of bounds.
+     */
+    bool AddNonZeroRange(const uint32 channel,
+                         const uint32 offset,
+                         const uint32 size);
+
+    /**
+     * @brief Computes the channels to be executed in this cycle: the dirty and the active ones.
+     * @param[in] current the current values (at least bufferSizeIn bytes).
+     * @param[in] previous the previous values (at least bufferSizeIn bytes).
+     */
+    void Update(const uint8 * const current,
+                const uint8 * const previous);
+
+    /**
+     * @brief Returns the next channel to be executed in this cycle.
+     * @param[out] channel the channel.
+     * @return false if all the channels selected by Update() have been returned.
+     */
+    bool GetNextChannel(uint32 &channel);
+
+    /**
+     * @brief Flags a channel that has to be executed at every cycle, independently of its inputs
+     * (e.g. because it is waiting for a timeout).
+     * @param[in] channel the channel.
+     * @param[in] activeIn true if the channel has to be executed at every cycle.
+     */
+    void SetActive(const uint32 channel,
+                   const bool activeIn);
+
+private:
+
+    /**
+     * @brief A 64-bit word of the buffers and the channels which own its bytes.
+     */
+    struct ChangeMaskWord {
+        /**
+         * The offset of the word in the buffers (multiple of 8).
+         */
+        uint32 offset;
+
+        /**
+         * The number of bytes of the word inside the buffers (8 but for the last word).
+         */
+        uint32 size;
+
+        /**
+         * The bytes of the word which belong to the channels.
+         */
+        uint64 mask;
+
+        /**
+         * The first channel which owns bytes of this word.
+         */
+        uint32 firstChannel;
+
+        /**
+         * The last channel which owns bytes of this word.
+         */
+        uint32 lastChannel;
+    };
+
+    /**
+     * @brief Adds a range to \a words, merging with the last word if possible.
+     * @return false if \a channel or the range are out of bounds.
+     */
+    bool AddRange(ChangeMaskWord * const words,
+                  uint32 &numberOfWords,
+                  const uint32 channel,
+                  const uint32 offset,
+                  const uint32 size) const;
+
+    /**
+     * @brief Reads the word \a word of \a buffer.
+     */
+    static uint64 Load(const uint8 * const buffer,
+                       const ChangeMaskWord &word);
+
+    /**
+     * @brief Sets the bits of the channels of \a word in #pending.
+     */
+    void MarkChannels(const ChangeMaskWord &word);
+
+    /**
+     * The number of channels.
+     */
+    uint32 numberOfChannels;
+
+    /**
+     * The size of the buffers.
+     */
+    uint32 bufferSize;
+
+    /**
+     * The number of 32-bit words of the channel bitmasks.
+     */
+    uint32 numberOfMaskWords;
+
+    /**
+     * The channels which have to be executed at every cycle.
+     */
+    uint32 *active;
+
+    /**
+     * The channels still to be returned by GetNextChannel().
+     */
+    uint32 *pending;
+
+    /**
+     * The word of #pending being read by GetNextChannel().
+     */
+    uint32 pendingIdx;
+
+    /**
+     * The maximum number of entries of #changeWords and #nonZeroWords.
+     */
+    uint32 maxNumberOfWords;
+
+    /**
+     * The words compared with the previous values.
+     */
+    ChangeMaskWord *changeWords;
+
+    /**
+     * The number of entries of #changeWords.
+     */
+    uint32 numberOfChangeWords;
+
+    /**
+     * The words compared with zero.
+     */
+    ChangeMaskWord *nonZeroWords;
+
+    /**
+     * The number of entries of #nonZeroWords.
+     */
+    uint32 numberOfNonZeroWords;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SOURCE_COMPONENTS_GAMS_DOUBLEHANDSHAKEGAM_DOUBLEHANDSHAKECHANGEMASK_H_ */
@@ -251,6 +251,20 @@ bool DoubleHandshakeMasterGAM::Setup() {
             previousValue = new uint8[offset];
             ret = MemoryOperationsHelper::Set(previousValue, '\0', offset);
         }
+        if (ret) {
+            ret = changeMask.Initialise(numberOfInputCommands, offset);
+            for (uint32 i = 0u; (i < numberOfInputCommands) && (ret); i++) {
+                /*lint -e{613} NULL pointer checked.*/
+                ret = changeMask.AddChangeRange(i, inputCommandOffset[i], inputCommandSize[i]);
+                if (ret) {
+                    /*lint -e{613} NULL pointer checked.*/
+                    ret = changeMask.AddNonZeroRange(i, inputAckOffset[i], inputCommandSize[i]);
+                }
+            }
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Failed to initialise the change mask");
+            }
+        }
     }
 
     //
@@ -361,8 +375,10 @@ bool DoubleHandshakeMasterGAM::Setup() {
 
 bool DoubleHandshakeMasterGAM::Execute() {
 
-    /*lint -e{850} the loop variable is not modified within the loop*/
-    for (uint32 i = 0u; i < numberOfInputCommands; i++) {
+    //only the channels whose command or ack changed and the ones waiting for the slave have to be executed
+    changeMask.Update(inputs, previousValue);
+    uint32 i = 0u;
+    while (changeMask.GetNextChannel(i)) {
         /*lint -e{613} NULL pointer checked.*/
         uint64 elapsed = (HighResolutionTimer::Counter() - startSMCycleTime[i]);
 
@@ -500,6 +516,8 @@ bool DoubleHandshakeMasterGAM::Execute() {
         else{
 
         }
+        /*lint -e{613} NULL pointer checked.*/
+        changeMask.SetActive(i, ((state[i] == SENDING) || (state[i] == CLEAR) || (state[i] == DONE)));
     }
 
     return true;
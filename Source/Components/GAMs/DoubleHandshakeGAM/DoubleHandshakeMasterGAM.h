@@ -32,6 +32,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "GAM.h"
+#include "DoubleHandshakeChangeMask.h"
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
@@ -90,6 +91,11 @@ namespace MARTe{
  *   - From DONE if the slave changes the ack to something different than zero.\n
  *   - From SENDING, CLEAR or DONE if the specified timeout expires.
  *
+ * @details The state machine of a channel in READY or ERROR state only reacts to a change of its command or (in READY) to a non-zero ack.
+ * At each cycle the command and ack signals are compared word by word with the previous values (see DoubleHandshakeChangeMask) and only
+ * the channels which changed, together with the ones in SENDING, CLEAR or DONE state, are executed, so that the cost of a cycle with large
+ * sets of idle commands does not grow with the number of commands.
+ *
  * @details Follows an example of configuration:
  * <pre>
  * +DoubleHandshakeMasterGAM = {
@@ -265,6 +271,11 @@ protected:
      * The double handshake procedure timeout
      */
     uint64 timeout;
+
+    /**
+     * Selects the channels to be executed in each cycle
+     */
+    DoubleHandshakeChangeMask changeMask;
 };
 
 }
@@ -211,6 +211,16 @@ bool DoubleHandshakeSlaveGAM::Setup() {
             previousValue = new uint8[offset];
             ret = MemoryOperationsHelper::Set(previousValue, '\0', offset);
         }
+        if (ret) {
+            ret = changeMask.Initialise(numberOfInputCommands, offset);
+            for (uint32 i = 0u; (i < numberOfInputCommands) && (ret); i++) {
+                /*lint -e{613} NULL pointer checked.*/
+                ret = changeMask.AddChangeRange(i, inputCommandOffset[i], inputCommandSize[i]);
+            }
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Failed to initialise the change mask");
+            }
+        }
     }
 
     //
@@ -327,8 +337,10 @@ bool DoubleHandshakeSlaveGAM::Setup() {
 
 bool DoubleHandshakeSlaveGAM::Execute() {
 
-    /*lint -e{850} the loop variable is not modified within the loop*/
-    for (uint32 i = 0u; i < numberOfInputCommands; i++) {
+    //only the channels whose command changed and the ones waiting for the internal processing or the clear have to be executed
+    changeMask.Update(inputs, previousValue);
+    uint32 i = 0u;
+    while (changeMask.GetNextChannel(i)) {
         /*lint -e{613} NULL pointer checked.*/
         uint64 elapsed = (HighResolutionTimer::Counter() - startSMCycleTime[i]);
         /*lint -e{613} NULL pointer checked.*/
@@ -424,6 +436,8 @@ bool DoubleHandshakeSlaveGAM::Execute() {
         else{
 
         }
+        /*lint -e{613} NULL pointer checked.*/
+        changeMask.SetActive(i, ((state[i] == SENDING) || (state[i] == DONE)));
     }
     return true;
 }
@@ -32,6 +32,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "GAM.h"
+#include "DoubleHandshakeChangeMask.h"
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
@@ -75,6 +76,10 @@ namespace MARTe {
  *   - From DONE if the command signal changes to something different than zero.\n
  *   - From SENDING or DONE if the specified timeout expires.
  *
+ * @details The state machine of a channel in READY or ERROR state only reacts to a change of its command. At each cycle the command
+ * signals are compared word by word with the previous values (see DoubleHandshakeChangeMask) and only the channels which changed,
+ * together with the ones in SENDING or DONE state, are executed.
+ *
  * @details Follows an example of configuration.
  * <pre>
  * +DoubleHandshakeSlaveGAM = {
@@ -232,6 +237,11 @@ protected:
      * The double handshake procedure timeout
      */
     uint64 timeout;
+
+    /**
+     * Selects the channels to be executed in each cycle
+     */
+    DoubleHandshakeChangeMask changeMask;
 };
 
 }
@@ -0,0 +1,258 @@
+/**
+ * @file FilterFFTHelper.cpp
+ * @brief Source file for class FilterFFTHelper
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class FilterFFTHelper (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <math.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "FilterFFTHelper.h"
+#include "MemoryOperationsHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * PI with float64 precision (FastMath::PI is float32), used to compute the twiddle factors.
+ */
+const MARTe::float64 FILTER_FFT_PI = 3.14159265358979323846;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+FilterFFTHelper::FilterFFTHelper() {
+    fftSize = 0u;
+    numberOfSignals = 0u;
+    numberOfSamples = 0u;
+    bitReverse = NULL_PTR(uint32 *);
+    twiddleRe = NULL_PTR(float64 *);
+    twiddleIm = NULL_PTR(float64 *);
+    filterRe = NULL_PTR(float64 *);
+    filterIm = NULL_PTR(float64 *);
+    history = NULL_PTR(float64 *);
+    workRe = NULL_PTR(float64 *);
+    workIm = NULL_PTR(float64 *);
+}
+
+/*lint -e{1551} no exception thrown while freeing the memory*/
+FilterFFTHelper::~FilterFFTHelper() {
+    if (bitReverse != NULL_PTR(uint32 *)) {
+        delete[] bitReverse;
+    }
+    if (twiddleRe != NULL_PTR(float64 *)) {
+        delete[] twiddleRe;
+    }
+    if (twiddleIm != NULL_PTR(float64 *)) {
+        delete[] twiddleIm;
+    }
+    if (filterRe != NULL_PTR(float64 *)) {
+        delete[] filterRe;
+    }
+    if (filterIm != NULL_PTR(float64 *)) {
+        delete[] filterIm;
+    }
+    if (history != NULL_PTR(float64 *)) {
+        delete[] history;
+    }
+    if (workRe != NULL_PTR(float64 *)) {
+        delete[] workRe;
+    }
+    if (workIm != NULL_PTR(float64 *)) {
+        delete[] workIm;
+    }
+}
+
+bool FilterFFTHelper::Initialise(const float32 * const coefficients,
+                                 const uint32 nOfCoefficients,
+                                 const uint32 nOfSignals,
+                                 const uint32 nOfSamples) {
+    bool ok = (history == NULL_PTR(float64 *));
+    if (ok) {
+        ok = ((coefficients != NULL_PTR(const float32 *)) && (nOfCoefficients > 0u) && (nOfSignals > 0u) && (nOfSamples > 0u));
+    }
+    uint32 log2Size = 0u;
+    if (ok) {
+        //The linear convolution of the block needs nOfCoefficients - 1 previous samples
+        uint32 minimumSize = (nOfCoefficients - 1u) + nOfSamples;
+        fftSize = 2u;
+        log2Size = 1u;
+        while ((fftSize < minimumSize) && (ok)) {
+            ok = (fftSize < 0x80000000u);
+            if (ok) {
+                fftSize <<= 1u;
+                log2Size++;
+            }
+        }
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "The FFT size needed for %u coefficients and %u samples is too large", nOfCoefficients, nOfSamples);
+        }
+    }
+    if (ok) {
+        numberOfSignals = nOfSignals;
+        numberOfSamples = nOfSamples;
+
+        bitReverse = new uint32[fftSize];
+        for (uint32 i = 0u; i < fftSize; i++) {
+            uint32 reversed = 0u;
+            uint32 idx = i;
+            for (uint32 b = 0u; b < log2Size; b++) {
+                reversed = (reversed << 1u) | (idx & 1u);
+                idx >>= 1u;
+            }
+            bitReverse[i] = reversed;
+        }
+
+        uint32 halfSize = fftSize / 2u;
+        twiddleRe = new float64[halfSize];
+        twiddleIm = new float64[halfSize];
+        for (uint32 k = 0u; k < halfSize; k++) {
+            float64 angle = (-2.0 * FILTER_FFT_PI * static_cast<float64>(k)) / static_cast<float64>(fftSize);
+            twiddleRe[k] = cos(angle);
+            twiddleIm[k] = sin(angle);
+        }
+
+        workRe = new float64[fftSize];
+        workIm = new float64[fftSize];
+        filterRe = new float64[fftSize];
+        filterIm = new float64[fftSize];
+        //Transform of the zero-padded coefficients, with the 1 / fftSize of the inverse transform folded in.
+        float64 scale = 1.0 / static_cast<float64>(fftSize);
+        for (uint32 i = 0u; i < fftSize; i++) {
+            workRe[i] = (i < nOfCoefficients) ? (static_cast<float64>(coefficients[i]) * scale) : (0.0);
+            workIm[i] = 0.0;
+        }
+        Transform(false);
+        for (uint32 i = 0u; i < fftSize; i++) {
+            filterRe[i] = workRe[i];
+            filterIm[i] = workIm[i];
+        }
+
+        history = new float64[numberOfSignals * fftSize];
+        Reset();
+    }
+    return ok;
+}
+
+void FilterFFTHelper::Reset() {
+    if (history != NULL_PTR(float64 *)) {
+        (void) MemoryOperationsHelper::Set(reinterpret_cast<void *>(history), '\0', static_cast<uint32>(numberOfSignals * fftSize * sizeof(float64)));
+    }
+}
+
+void FilterFFTHelper::Transform(const bool inverse) {
+    //Bit reversal permutation
+    for (uint32 i = 0u; i < fftSize; i++) {
+        uint32 j = bitReverse[i];
+        if (j > i) {
+            float64 aux = workRe[i];
+            workRe[i] = workRe[j];
+            workRe[j] = aux;
+            aux = workIm[i];
+            workIm[i] = workIm[j];
+            workIm[j] = aux;
+        }
+    }
+    //Butterflies. The inverse transform uses the conjugated twiddle factors.
+    float64 sign = inverse ? (-1.0) : (1.0);
+    for (uint32 half = 1u; half < fftSize; half <<= 1u) {
+        uint32 twiddleStep = fftSize / (2u * half);
+        for (uint32 start = 0u; start < fftSize; start += (2u * half)) {
+            for (uint32 k = 0u; k < half; k++) {
+                float64 wRe = twiddleRe[k * twiddleStep];
+                float64 wIm = sign * twiddleIm[k * twiddleStep];
+                uint32 a = start + k;
+                uint32 b = a + half;
+                float64 tRe = (workRe[b] * wRe) - (workIm[b] * wIm);
+                float64 tIm = (workRe[b] * wIm) + (workIm[b] * wRe);
+                workRe[b] = workRe[a] - tRe;
+                workIm[b] = workIm[a] - tIm;
+                workRe[a] += tRe;
+                workIm[a] += tIm;
+            }
+        }
+    }
+}
+
+void FilterFFTHelper::Execute(float32 ** const input,
+                              float32 ** const output) {
+    if ((history != NULL_PTR(float64 *)) && (input != NULL_PTR(float32 **)) && (output != NULL_PTR(float32 **))) {
+        uint32 keep = fftSize - numberOfSamples;
+        //Drop the oldest block and append the new one
+        for (uint32 i = 0u; i < numberOfSignals; i++) {
+            float64 *segment = &history[i * fftSize];
+            (void) MemoryOperationsHelper::Move(reinterpret_cast<void *>(segment), reinterpret_cast<const void *>(&segment[numberOfSamples]),
+                                                static_cast<uint32>(keep * sizeof(float64)));
+            for (uint32 n = 0u; n < numberOfSamples; n++) {
+                segment[keep + n] = static_cast<float64>(input[i][n]);
+            }
+        }
+        //Two real signals per complex transform
+        for (uint32 i = 0u; i < numberOfSignals; i += 2u) {
+            bool pair = ((i + 1u) < numberOfSignals);
+            const float64 *segmentRe = &history[i * fftSize];
+            for (uint32 n = 0u; n < fftSize; n++) {
+                workRe[n] = segmentRe[n];
+            }
+            if (pair) {
+                const float64 *segmentIm = &history[(i + 1u) * fftSize];
+                for (uint32 n = 0u; n < fftSize; n++) {
+                    workIm[n] = segmentIm[n];
+                }
+            }
+            else {
+                (void) MemoryOperationsHelper::Set(reinterpret_cast<void *>(workIm), '\0', static_cast<uint32>(fftSize * sizeof(float64)));
+            }
+            Transform(false);
+            for (uint32 n = 0u; n < fftSize; n++) {
+                float64 re = (workRe[n] * filterRe[n]) - (workIm[n] * filterIm[n]);
+                float64 im = (workRe[n] * filterIm[n]) + (workIm[n] * filterRe[n]);
+                workRe[n] = re;
+                workIm[n] = im;
+            }
+            Transform(true);
+            for (uint32 n = 0u; n < numberOfSamples; n++) {
+                output[i][n] = static_cast<float32>(workRe[keep + n]);
+            }
+            if (pair) {
+                for (uint32 n = 0u; n < numberOfSamples; n++) {
+                    output[i + 1u][n] = static_cast<float32>(workIm[keep + n]);
+                }
+            }
+        }
+    }
+}
+
+uint32 FilterFFTHelper::GetFFTSize() const {
+    return fftSize;
+}
+
+}
@@ -0,0 +1,179 @@
+/**
+ * @file FilterFFTHelper.h
+ * @brief Header file for class FilterFFTHelper
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class FilterFFTHelper
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef FILTERFFTHELPER_H_
+#define FILTERFFTHELPER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Frequency domain (overlap-save) implementation of a FIR filter for the FilterGAM.
+ * @details For each signal the helper keeps the last fftSize input samples (the current block
+ * of numberOfSamples and the fftSize - numberOfSamples previous ones). Every Execute() the segment
+ * is transformed with a radix-2 FFT, multiplied by the (pre-computed) transform of the zero-padded
+ * coefficients and transformed back. Since fftSize >= numberOfCoefficients - 1 + numberOfSamples, the last
+ * numberOfSamples values of the circular convolution are equal to the linear convolution, i.e. to:
+ *
+ * \f$
+ * y[n] = \sum_{k=0}^{M-1}num[k]*x[n-k]
+ * \f$
+ *
+ * The input history is carried between calls, so that the output is continuous across cycles,
+ * and is cleared by Reset().
+ *
+ * The signals are real, so two signals are packed in the real and imaginary parts of the same complex
+ * transform (the coefficients are also real and thus the two results do not mix).
+ *
+ * The FFT is computed in float64 and the result converted to float32. The outputs are therefore not
+ * bit-for-bit equal to the time domain implementation, but the difference is bounded by the float32 rounding
+ * of the time domain accumulation.
+ */
+class FilterFFTHelper {
+public:
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    FilterFFTHelper();
+
+    /**
+     * @brief Destructor. Frees the allocated memory.
+     */
+    ~FilterFFTHelper();
+
+    /**
+     * @brief Computes the FFT size, the twiddle factors and the transform of the coefficients and allocates the signal history.
+     * @param[in] coefficients the FIR coefficients.
+     * @param[in] nOfCoefficients the number of FIR coefficients.
+     * @param[in] nOfSignals the number of signals.
+     * @param[in] nOfSamples the number of samples of each signal per Execute().
+     * @return true if all the parameters are > 0 and the FFT size (power of 2) does not overflow.
+     */
+    bool Initialise(const float32 * const coefficients,
+                    const uint32 nOfCoefficients,
+                    const uint32 nOfSignals,
+                    const uint32 nOfSamples);
+
+    /**
+     * @brief Filters a block of numberOfSamples for all the signals.
+     * @param[in] input the input memory of each signal.
+     * @param[out] output the output memory of each signal.
+     */
+    void Execute(float32 ** const input,
+                 float32 ** const output);
+
+    /**
+     * @brief Sets the input history of all the signals to zero.
+     */
+    void Reset();
+
+    /**
+     * @brief Gets the FFT size.
+     * @return the FFT size.
+     */
+    uint32 GetFFTSize() const;
+
+private:
+
+    /**
+     * @brief In-place radix-2 decimation in time FFT of the work buffers.
+     * @param[in] inverse if true computes the (not scaled) inverse transform.
+     */
+    void Transform(const bool inverse);
+
+    /**
+     * FFT size (power of 2).
+     */
+    uint32 fftSize;
+
+    /**
+     * Number of signals.
+     */
+    uint32 numberOfSignals;
+
+    /**
+     * Number of samples per Execute().
+     */
+    uint32 numberOfSamples;
+
+    /**
+     * Bit reversed index of each position.
+     */
+    uint32 *bitReverse;
+
+    /**
+     * Real part of exp(-2 pi j k / fftSize), k = 0...fftSize / 2 - 1.
+     */
+    float64 *twiddleRe;
+
+    /**
+     * Imaginary part of exp(-2 pi j k / fftSize), k = 0...fftSize / 2 - 1.
+     */
+    float64 *twiddleIm;
+
+    /**
+     * Real part of the transform of the coefficients (scaled by 1 / fftSize).
+     */
+    float64 *filterRe;
+
+    /**
+     * Imaginary part of the transform of the coefficients (scaled by 1 / fftSize).
+     */
+    float64 *filterIm;
+
+    /**
+     * Last fftSize input samples of each signal (oldest first).
+     */
+    float64 *history;
+
+    /**
+     * Real part of the work buffer.
+     */
+    float64 *workRe;
+
+    /**
+     * Imaginary part of the work buffer.
+     */
+    float64 *workIm;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* FILTERFFTHELPER_H_ */
@@ -50,13 +50,25 @@ FilterGAM::FilterGAM() :
     numberOfDenCoeff = 0u;
     staticGain = 0.0F;
     numberOfSamples = 0u;
-    lastInputs = NULL_PTR(float32**);
-    lastOutputs = NULL_PTR(float32**);
+    inputHistory = NULL_PTR(float32*);
+    outputHistory = NULL_PTR(float32*);
+    numberOfOutputStates = 0u;
+    inputPosition = 0u;
+    outputPosition = 0u;
     output = NULL_PTR(float32**);
     input = NULL_PTR(float32**);
     numberOfSignals = 0u;
     gainInfinite = false;
     resetInEachState = true;
+    sosStructure = false;
+    sos = NULL_PTR(float64*);
+    numberOfSections = 0u;
+    sosGain = 1.0;
+    sos32 = NULL_PTR(FilterSOSHelperT<float32>*);
+    sos64 = NULL_PTR(FilterSOSHelperT<float64>*);
+    signalType = Float32Bit;
+    fftThreshold = 0u;
+    fftFilter = NULL_PTR(FilterFFTHelper*);
 }
 
 FilterGAM::~FilterGAM() {
@@ -66,21 +78,23 @@ FilterGAM::~FilterGAM() {
     if (den != NULL_PTR(float32*)) {
         delete[] den;
     }
-    if (lastInputs != NULL_PTR(float32**)) {
-        for (uint32 i = 0u; i < numberOfSignals; i++) {
-            if (lastInputs[i] != NULL_PTR(float32*)) {
-                delete[] lastInputs[i];
-            }
-        }
-        delete[] lastInputs;
+    if (sos != NULL_PTR(float64*)) {
+        delete[] sos;
     }
-    if (lastOutputs != NULL_PTR(float32**)) {
-        for (uint32 i = 0u; i < numberOfSignals; i++) {
-            if (lastOutputs[i] != NULL_PTR(float32*)) {
-                delete[] lastOutputs[i];
-            }
-        }
-        delete[] lastOutputs;
+    if (sos32 != NULL_PTR(FilterSOSHelperT<float32>*)) {
+        delete sos32;
+    }
+    if (sos64 != NULL_PTR(FilterSOSHelperT<float64>*)) {
+        delete sos64;
+    }
+    if (fftFilter != NULL_PTR(FilterFFTHelper*)) {
+        delete fftFilter;
+    }
+    if (inputHistory != NULL_PTR(float32*)) {
+        delete[] inputHistory;
+    }
+    if (outputHistory != NULL_PTR(float32*)) {
+        delete[] outputHistory;
     }
     if (input != NULL_PTR(float32**)) {
         for (uint32 i = 0u; i < numberOfSignals; i++) {
@@ -101,15 +115,64 @@ FilterGAM::~FilterGAM() {
 }
 
 bool FilterGAM::Initialise(StructuredDataI &data) {
-    AnyType functionsArray = data.GetType("Num");
     bool errorDetected = false;
     bool ok = GAM::Initialise(data);
     if (ok) {
-        ok = (functionsArray.GetDataPointer() != NULL);
+        StreamString structure;
+        if (data.Read("Structure", structure)) {
+            if (structure == "SOS") {
+                sosStructure = true;
+            }
+            else if (structure == "DirectForm") {
+                sosStructure = false;
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Wrong value for Structure (expected values DirectForm or SOS)");
+                errorDetected = true;
+                ok = false;
+            }
+        }
+    }
+    if (ok) {
+        if (sosStructure) {
+            ok = InitialiseSOS(data);
+        }
+        else {
+            ok = InitialiseDirectForm(data);
+        }
+        errorDetected = !ok;
+    }
+    if (ok) {
+        uint32 aux;
+        ok = data.Read("ResetInEachState", aux);
         if (!ok) {
-            REPORT_ERROR(ErrorManagement::InitialisationError, "Error getting pointer to the numerator");
-            errorDetected = true;
+            REPORT_ERROR(ErrorManagement::Warning, "ResetInEachState not specified. resetInEachState = true by default ");
         }
+        else {
+            if (aux == 1u) {
+                resetInEachState = true;
+            }
+            else if (aux == 0u) {
+                resetInEachState = false;
+            }
+            else {
+                if (!errorDetected) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "Wrong value for ResetInEachState (expected values 0 or 1)");
+                    errorDetected = true;
+                }
+            }
+        }
+    }
+    return !errorDetected;
+}
+
+bool FilterGAM::InitialiseDirectForm(StructuredDataI &data) {
+    AnyType functionsArray = data.GetType("Num");
+    bool errorDetected = false;
+    bool ok = (functionsArray.GetDataPointer() != NULL);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "Error getting pointer to the numerator");
+        errorDetected = true;
     }
     if (ok) {
         numberOfNumCoeff = functionsArray.GetNumberOfElements(0u);
@@ -186,27 +249,87 @@ bool FilterGAM::Initialise(StructuredDataI &data) {
         }
     }
     if (ok) {
-        uint32 aux;
-        ok = data.Read("ResetInEachState", aux);
+        if (!data.Read("FFTThreshold", fftThreshold)) {
+            fftThreshold = 0u;
+        }
+    }
+    return !errorDetected;
+}
+
+bool FilterGAM::InitialiseSOS(StructuredDataI &data) {
+    AnyType functionsMatrix = data.GetType("SOS");
+    bool ok = (functionsMatrix.GetDataPointer() != NULL);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "Error getting pointer to SOS");
+    }
+    uint32 numberOfColumns = 0u;
+    if (ok) {
+        if (functionsMatrix.GetNumberOfDimensions() == 2u) {
+            numberOfColumns = functionsMatrix.GetNumberOfElements(0u);
+            numberOfSections = functionsMatrix.GetNumberOfElements(1u);
+        }
+        else {
+            //A single section may be written as a vector
+            numberOfColumns = functionsMatrix.GetNumberOfElements(0u);
+            numberOfSections = 1u;
+        }
+        ok = (numberOfColumns == 6u);
         if (!ok) {
-            REPORT_ERROR(ErrorManagement::Warning, "ResetInEachState not specified. resetInEachState = true by default ");
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Each SOS section must have 6 coefficients {b0 b1 b2 a0 a1 a2}");
+        }
+    }
+    if (ok) {
+        ok = (numberOfSections > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The number of SOS sections must be > 0");
+        }
+    }
+    if (ok) {
+        sos = new float64[numberOfSections * 6u];
+        if (numberOfSections > 1u) {
+            Matrix<float64> sosMatrix(sos, numberOfSections, 6u);
+            ok = data.Read("SOS", sosMatrix);
         }
         else {
-            if (aux == 1u) {
-                resetInEachState = true;
-            }
-            else if (aux == 0u) {
-                resetInEachState = false;
+            Vector<float64> sosVector(sos, 6u);
+            ok = data.Read("SOS", sosVector);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Error reading SOS");
+        }
+    }
+    if (ok) {
+        if (!data.Read("Gain", sosGain)) {
+            sosGain = 1.0;
+        }
+    }
+    //Check that a0 != 0 and compute the static gain as the product of the static gains of all the sections.
+    float64 gain = sosGain;
+    for (uint32 s = 0u; (s < numberOfSections) && (ok); s++) {
+        if (sos != NULL_PTR(float64*)) {
+            const float64 *section = &sos[s * 6u];
+            ok = !IsEqual(section[3], 0.0);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "a0 of the SOS section %u cannot be 0", s);
             }
             else {
-                if (!errorDetected) {
-                    REPORT_ERROR(ErrorManagement::InitialisationError, "Wrong value for ResetInEachState (expected values 0 or 1)");
-                    errorDetected = true;
+                float64 sumNumerator = (section[0] + section[1]) + section[2];
+                float64 sumDenominator = (section[3] + section[4]) + section[5];
+                if (!IsEqual(sumDenominator, 0.0)) {
+                    gain *= (sumNumerator / sumDenominator);
+                }
+                else {
+                    gainInfinite = true;
                 }
             }
         }
     }
-    return !errorDetected;
+    if (ok) {
+        if (!gainInfinite) {
+            staticGain = static_cast<float32>(gain);
+        }
+    }
+    return ok;
 }
 
 bool FilterGAM::Setup() {
@@ -227,34 +350,25 @@ bool FilterGAM::Setup() {
             errorDetected = true;
         }
     }
-    //initialise lastInputs & lastOutputs
-    if (!errorDetected) {
-        lastInputs = new float32*[numberOfSignals];
-        lastOutputs = new float32*[numberOfSignals];
-        uint32 numberOfElementsToSet1 = static_cast<uint32>(sizeof(float32*) * numberOfSignals);
-        (void) MemoryOperationsHelper::Set(reinterpret_cast<void *>(lastInputs), '\0', numberOfElementsToSet1);
-        (void) MemoryOperationsHelper::Set(reinterpret_cast<void *>(lastOutputs), '\0', numberOfElementsToSet1);
-        //if due to MISRA rules
-        if ((lastInputs != NULL_PTR(float32**)) && (lastOutputs != NULL_PTR(float32**))) {
-            /*lint -e{9114} implicit conversion is safe*/
-            for (uint32 m = 0u; (m < numberOfSignals) && (!errorDetected); m++) {
-                if (numberOfNumCoeff > 1u) {
-                    lastInputs[m] = new float32[numberOfNumCoeff - 1u];
-                    if (lastInputs[m] != NULL_PTR(float32*)) {
-                        for (uint32 i = 0u; i < (numberOfNumCoeff - 1u); i++) {
-                            lastInputs[m][i] = 0.0F;
-                        }
-                    }
-                }
-                if (numberOfDenCoeff > 1u) {
-                    lastOutputs[m] = new float32[numberOfDenCoeff - 1u];
-                    if (lastOutputs[m] != NULL_PTR(float32*)) {
-                        for (uint32 i = 0u; i < (numberOfDenCoeff - 1u); i++) {
-                            lastOutputs[m][i] = 0.0F;
-                        }
-                    }
-                }
-            }
+    //initialise the input and output histories (mirrored ring buffers)
+    if ((!errorDetected) && (!sosStructure)) {
+        numberOfOutputStates = (numberOfDenCoeff > 0u) ? (numberOfDenCoeff - 1u) : (0u);
+        uint32 inputHistorySize = numberOfSignals * 2u * numberOfNumCoeff;
+        inputHistory = new float32[inputHistorySize];
+        (void) MemoryOperationsHelper::Set(reinterpret_cast<void *>(inputHistory), '\0', static_cast<uint32>(inputHistorySize * sizeof(float32)));
+        if (numberOfOutputStates > 0u) {
+            uint32 outputHistorySize = numberOfSignals * 2u * numberOfOutputStates;
+            outputHistory = new float32[outputHistorySize];
+            (void) MemoryOperationsHelper::Set(reinterpret_cast<void *>(outputHistory), '\0', static_cast<uint32>(outputHistorySize * sizeof(float32)));
+        }
+        inputPosition = 0u;
+        outputPosition = 0u;
+    }
+    //All the signals must have the same type. float64 is only supported by the SOS structure.
+    signalType = Float32Bit;
+    if ((!errorDetected) && (sosStructure)) {
+        if (GetSignalType(InputSignals, 0u) == Float64Bit) {
+            signalType = Float64Bit;
         }
     }
     uint32 *numberOfSamplesInput = NULL_PTR(uint32*);
@@ -308,14 +422,14 @@ bool FilterGAM::Setup() {
                     REPORT_ERROR(ErrorManagement::ParametersError, "numberOfSamplesOutput must be 1 ");
                     errorDetected = true;
                 }
-                ok = (GetSignalType(InputSignals, i) == Float32Bit);
+                ok = (GetSignalType(InputSignals, i) == signalType);
                 if ((!ok) && (!errorDetected)) {
-                    REPORT_ERROR(ErrorManagement::ParametersError, "GetSignalType for the input signal %u failed (not float32 as it should be) ", auxIndex);
+                    REPORT_ERROR(ErrorManagement::ParametersError, "GetSignalType for the input signal %u failed (not float32 or float64 with Structure = SOS, as it should be) ", auxIndex);
                     errorDetected = true;
                 }
-                ok = (GetSignalType(OutputSignals, i) == Float32Bit);
+                ok = (GetSignalType(OutputSignals, i) == signalType);
                 if ((!ok) && (!errorDetected)) {
-                    REPORT_ERROR(ErrorManagement::ParametersError, "GetSignalType for the input signal %u failed (not float32 as it should be)", auxIndex);
+                    REPORT_ERROR(ErrorManagement::ParametersError, "GetSignalType for the output signal %u failed (not float32 or float64 with Structure = SOS, as it should be)", auxIndex);
                     errorDetected = true;
                 }
             }
@@ -428,7 +542,27 @@ bool FilterGAM::Setup() {
             errorDetected = true;
         }
     }
-    if (!errorDetected) {
+    if ((!errorDetected) && (sosStructure)) {
+        if (signalType == Float64Bit) {
+            sos64 = new FilterSOSHelperT<float64>();
+            ok = sos64->Initialise(sos, numberOfSections, sosGain, numberOfSignals, numberOfSamples);
+            for (uint32 i = 0u; (i < numberOfSignals) && (ok); i++) {
+                ok = sos64->SetChannel(i, static_cast<float64*>(GetInputSignalMemory(i)), static_cast<float64*>(GetOutputSignalMemory(i)));
+            }
+        }
+        else {
+            sos32 = new FilterSOSHelperT<float32>();
+            ok = sos32->Initialise(sos, numberOfSections, sosGain, numberOfSignals, numberOfSamples);
+            for (uint32 i = 0u; (i < numberOfSignals) && (ok); i++) {
+                ok = sos32->SetChannel(i, static_cast<float32*>(GetInputSignalMemory(i)), static_cast<float32*>(GetOutputSignalMemory(i)));
+            }
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Failed to initialise the SOS filter");
+            errorDetected = true;
+        }
+    }
+    if ((!errorDetected) && (!sosStructure)) {
         input = new float32*[numberOfSignals];
         output = new float32*[numberOfSignals];
         if ((input != NULL_PTR(float32**)) && (output != NULL_PTR(float32**))) {
@@ -437,6 +571,23 @@ bool FilterGAM::Setup() {
                 output[i] = static_cast<float32*>(GetOutputSignalMemory(i));
             }
         }
+        //Use the overlap-save implementation for long FIR filters applied to blocks of samples
+        if ((fftThreshold > 0u) && (numberOfSamples > 1u)) {
+            if (numberOfDenCoeff > 1u) {
+                REPORT_ERROR(ErrorManagement::Warning, "FFTThreshold is only applicable to FIR filters (Den = {1}). The time domain implementation will be used");
+            }
+            else if ((static_cast<uint64>(numberOfNumCoeff) * static_cast<uint64>(numberOfSamples)) >= static_cast<uint64>(fftThreshold)) {
+                fftFilter = new FilterFFTHelper();
+                ok = fftFilter->Initialise(num, numberOfNumCoeff, numberOfSignals, numberOfSamples);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "Failed to initialise the FFT filter");
+                    errorDetected = true;
+                }
+            }
+            else {
+                //The time domain implementation is cheaper
+            }
+        }
     }
 //Free pointers MISRA rules
     if (numberOfSamplesInput != NULL_PTR(uint32*)) {
@@ -455,67 +606,55 @@ bool FilterGAM::Setup() {
 }
 
 bool FilterGAM::Execute() {
-    uint32 n = 0u;
-    float32 accumulator;
+    if (sos32 != NULL_PTR(FilterSOSHelperT<float32>*)) {
+        sos32->Execute();
+    }
+    else if (sos64 != NULL_PTR(FilterSOSHelperT<float64>*)) {
+        sos64->Execute();
+    }
+    else if (fftFilter != NULL_PTR(FilterFFTHelper*)) {
+        fftFilter->Execute(input, output);
+    }
 //if due to MISRA rules...
-    if ((input != NULL_PTR(float32**)) && (output != NULL_PTR(float32**)) && (lastInputs != NULL_PTR(float32**)) && (lastOutputs != NULL_PTR(float32**))
-            && (num != NULL_PTR(float32*)) && (den != NULL_PTR(float32*))) {
+    else if ((input != NULL_PTR(float32**)) && (output != NULL_PTR(float32**)) && (inputHistory != NULL_PTR(float32*)) && (num != NULL_PTR(float32*))
+            && (den != NULL_PTR(float32*))) {
+        uint32 p = inputPosition;
+        uint32 q = outputPosition;
         for (uint32 i = 0u; i < numberOfSignals; i++) {
-            n = 0u;
-            while (n < numberOfSamples) {
-                accumulator = 0.0F;
+            //All the signals receive the same number of samples, so that the ring positions are shared
+            p = inputPosition;
+            q = outputPosition;
+            float32 *xHistory = &inputHistory[i * 2u * numberOfNumCoeff];
+            float32 *yHistory = NULL_PTR(float32*);
+            if (outputHistory != NULL_PTR(float32*)) {
+                yHistory = &outputHistory[i * 2u * numberOfOutputStates];
+            }
+            for (uint32 n = 0u; n < numberOfSamples; n++) {
+                //x[n] is written twice so that xHistory[p + k] = x[n - k] for k = 0...numberOfNumCoeff - 1 without wrapping
+                p = (p == 0u) ? (numberOfNumCoeff - 1u) : (p - 1u);
+                xHistory[p] = input[i][n];
+                xHistory[p + numberOfNumCoeff] = input[i][n];
+                const float32 *x = &xHistory[p];
+                float32 accumulator = 0.0F;
                 //sum inputs
                 for (uint32 k = 0u; k < numberOfNumCoeff; k++) {
-                    if (n >= k) {
-                        accumulator += input[i][n - k] * num[k];
-                    }
-                    else {
-                        accumulator += (lastInputs[i][(k - n) - 1u]) * num[k];
-                    }
+                    accumulator += x[k] * num[k];
                 }
-                //Sum outputs
-                for (uint32 k = 1u; k < numberOfDenCoeff; k++) {
-                    if (n >= k) {
-                        accumulator -= output[i][n - k] * den[k];
-                    }
-                    else {
-                        accumulator -= lastOutputs[i][(k - n) - 1u] * den[k];
+                //Sum outputs. yHistory[q + k - 1] = y[n - k] for k = 1...numberOfDenCoeff - 1
+                if (yHistory != NULL_PTR(float32*)) {
+                    const float32 *y = &yHistory[q];
+                    for (uint32 k = 1u; k < numberOfDenCoeff; k++) {
+                        accumulator -= y[k - 1u] * den[k];
                     }
+                    q = (q == 0u) ? (numberOfOutputStates - 1u) : (q - 1u);
+                    yHistory[q] = accumulator;
+                    yHistory[q + numberOfOutputStates] = accumulator;
                 }
                 output[i][n] = accumulator;
-                n++;
-            }
-
-            //update the last values
-            if (numberOfNumCoeff > 2u) {
-                /*lint -e{9117} implicit conversion is safe*/
-                for (uint32 k = (numberOfNumCoeff - 2u); k > 0u; k--) {
-                    if (numberOfSamples > k) {
-                        lastInputs[i][k] = input[i][(numberOfSamples - k) - 1u];
-                    }
-                    else {
-                        lastInputs[i][k] = lastInputs[i][k - 1];
-                    }
-                }
-            }
-            if (numberOfNumCoeff > 1u) {
-                lastInputs[i][0] = input[i][numberOfSamples - 1u];
-            }
-            if (numberOfDenCoeff > 2u) {
-                /*lint -e{9117} implicit conversion is safe*/
-                for (uint32 k = (numberOfDenCoeff - 2u); k > 0u; k--) {
-                    if (numberOfSamples > k) {
-                        lastOutputs[i][k] = output[i][(numberOfSamples - k) - 1u];
-                    }
-                    else {
-                        lastOutputs[i][k] = lastOutputs[i][k - 1];
-                    }
-                }
-            }
-            if (numberOfDenCoeff > 1u) {
-                lastOutputs[i][0] = output[i][numberOfSamples - 1u];
             }
         }
+        inputPosition = p;
+        outputPosition = q;
     }
     return true;
 }
@@ -527,52 +666,44 @@ bool FilterGAM::PrepareNextState(const char8 *const currentStateName,
                                  const char8 *const nextStateName) {
     bool ret = true;
     if (resetInEachState) {
-        if ((lastInputs != NULL_PTR(float32**)) && (lastOutputs != NULL_PTR(float32**))) {
-            for (uint32 i = 0u; i < numberOfSignals; i++) {
-                if (lastInputs[i] != NULL_PTR(float32*)) {
-                    for (uint32 n = 0u; n < (numberOfNumCoeff - 1u); n++) {
-                        lastInputs[i][n] = 0.0F;
-                    }
-                }
-                if (lastOutputs[i] != NULL_PTR(float32*)) {
-                    for (uint32 n = 0u; n < (numberOfDenCoeff - 1u); n++) {
-                        lastOutputs[i][n] = 0.0F;
-                    }
-                }
-            }
-        }
-        else {
-            REPORT_ERROR(ErrorManagement::ParametersError, "lastInputs or lastOutputs = NULL ");
-            ret = false;
-        }
+        ret = ResetStates();
     }
     else {
         //If the currentStateName and lastStateExecuted are different-> rest values
         if (lastStateExecuted != currentStateName) {
-            if ((lastInputs != NULL_PTR(float32**)) && (lastOutputs != NULL_PTR(float32**))) {
-                for (uint32 i = 0u; i < numberOfSignals; i++) {
-                    if (lastInputs[i] != NULL_PTR(float32*)) {
-                        for (uint32 n = 0u; n < (numberOfNumCoeff - 1u); n++) {
-                            lastInputs[i][n] = 0.0F;
-                        }
-                    }
-                    if (lastOutputs[i] != NULL_PTR(float32*)) {
-                        for (uint32 n = 0u; n < (numberOfDenCoeff - 1u); n++) {
-                            lastOutputs[i][n] = 0.0F;
-                        }
-                    }
-                }
-            }
-            else {
-                REPORT_ERROR(ErrorManagement::ParametersError, "lastInputs or lastOutputs = NULL ");
-                ret = false;
-            }
+            ret = ResetStates();
         }
         lastStateExecuted = nextStateName;
     }
     return ret;
 }
 
+bool FilterGAM::ResetStates() {
+    bool ret = true;
+    if (sos32 != NULL_PTR(FilterSOSHelperT<float32>*)) {
+        sos32->Reset();
+    }
+    else if (sos64 != NULL_PTR(FilterSOSHelperT<float64>*)) {
+        sos64->Reset();
+    }
+    else if (fftFilter != NULL_PTR(FilterFFTHelper*)) {
+        fftFilter->Reset();
+    }
+    else if (inputHistory != NULL_PTR(float32*)) {
+        (void) MemoryOperationsHelper::Set(reinterpret_cast<void *>(inputHistory), '\0',
+                                           static_cast<uint32>(numberOfSignals * 2u * numberOfNumCoeff * sizeof(float32)));
+        if (outputHistory != NULL_PTR(float32*)) {
+            (void) MemoryOperationsHelper::Set(reinterpret_cast<void *>(outputHistory), '\0',
+                                               static_cast<uint32>(numberOfSignals * 2u * numberOfOutputStates * sizeof(float32)));
+        }
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::ParametersError, "inputHistory = NULL ");
+        ret = false;
+    }
+    return ret;
+}
+
 uint32 FilterGAM::GetNumberOfNumCoeff() const {
     return numberOfNumCoeff;
 }
@@ -622,6 +753,22 @@ uint32 FilterGAM::GetNumberOfSignals() const {
 uint32 FilterGAM::GetNumberOfSamples() const {
     return numberOfSamples;
 }
+
+bool FilterGAM::IsSOSStructure() const {
+    return sosStructure;
+}
+
+uint32 FilterGAM::GetNumberOfSections() const {
+    return numberOfSections;
+}
+
+uint32 FilterGAM::GetFFTSize() const {
+    uint32 ret = 0u;
+    if (fftFilter != NULL_PTR(FilterFFTHelper*)) {
+        ret = fftFilter->GetFFTSize();
+    }
+    return ret;
+}
 CLASS_REGISTER(FilterGAM, "1.0")
 }
 
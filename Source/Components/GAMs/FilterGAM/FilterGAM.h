@@ -32,6 +32,8 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 
+#include "FilterFFTHelper.h"
+#include "FilterSOSHelperT.h"
 #include "GAM.h"
 #include "StructuredDataI.h"
 /*---------------------------------------------------------------------------*/
@@ -62,7 +64,21 @@ namespace MARTe {
  * \f$
  *
  * The GAM supports multiple input signals (and output signal) only if the characteristics of the input arrays are the same
- * (i.e. The input signals have the same number of elements, the same number of samples and the same type). Currently, the only type supported is float32.
+ * (i.e. The input signals have the same number of elements, the same number of samples and the same type). With the direct form
+ * structure the only type supported is float32.
+ *
+ * Alternatively (Structure = "SOS") the filter can be specified as a cascade of second-order sections (e.g. as returned by the
+ * MATLAB tf2sos). Each section is computed using the transposed direct form II, which is numerically more robust than the
+ * direct form for high order IIR filters. In this mode the signals can be float32 or float64 and all the signals are filtered
+ * together, with the state of all the signals stored channel-interleaved so that each section is computed for all the signals
+ * with vector instructions (see FilterSOSHelperT).
+ *
+ * For FIR filters (Den = {1}) applied to blocks of samples (i.e. more than one sample per signal and per cycle) the
+ * time domain cost (number of coefficients x number of samples) can be replaced by a frequency domain overlap-save
+ * convolution (see FilterFFTHelper). This is enabled by setting FFTThreshold: if number of coefficients x number of samples
+ * >= FFTThreshold the overlap-save implementation is used. The input history is kept across cycles and reset as for the
+ * time domain implementation. The FFT is computed in float64, so that the results are equal to the time domain implementation
+ * within the float32 rounding.
  *
  * The inputs and outputs must be arrays (could be arrays of 1 elements).
  *
@@ -82,6 +98,7 @@ namespace MARTe {
  *     Num = {0.5 0.5} //Compulsory. Filter numerator coefficient.
  *     Den = {1} //Compulsory. Filter denominator coefficient.
  *     ResetInEachState //Optional. If true the filter will be reset on each state change. Otherwise it will be reset only if the filter was not used in the previous state.
+ *     FFTThreshold = 10000 //Optional. Only for FIR filters and signals with more than one sample. If (number of Num coefficients x number of samples) >= FFTThreshold the filter is computed in the frequency domain. Default 0 (never).
  *     InputSignals = {
  *         InputSignal1 = { //Filter will be applied to each signal. The number of input and output signals must be the same.
  *             DataSource = "DDB1"
@@ -104,6 +121,30 @@ namespace MARTe {
  *     }
  * }
  * </pre>
+ *
+ * The configuration syntax of the SOS structure is:
+ *
+ * <pre>
+ * +Filter2 = {
+ *     Class = FilterGAM
+ *     Structure = "SOS" //Optional. "DirectForm" (default) or "SOS".
+ *     SOS = {{0.1 0.2 0.1 1 -0.5 0.2} {1 2 1 1 -0.8 0.4}} //Compulsory if Structure = "SOS". One row {b0 b1 b2 a0 a1 a2} per section. a0 != 0.
+ *     Gain = 1.0 //Optional. Overall gain of the cascade. Default 1.0.
+ *     ResetInEachState = 1
+ *     InputSignals = {
+ *         InputSignal1 = {
+ *             DataSource = "DDB1"
+ *             Type = float64 //float32 or float64. All the input and output signals must have the same type.
+ *         }
+ *     }
+ *     OutputSignals = {
+ *         OutputSignal1 = {
+ *             DataSource = "LCD"
+ *             Type = float64
+ *         }
+ *     }
+ * }
+ * </pre>
  */
 class FilterGAM: public GAM, public StatefulI {
 public:
@@ -126,7 +167,7 @@ public:
 
     /**
      * @brief Free the allocated memory
-     * @details If num, den, lastInputs and/or lastOutputs are not NULL
+     * @details If num, den, inputHistory and/or outputHistory are not NULL
      * the associated memory is freed.
      */
     virtual ~FilterGAM();
@@ -173,8 +214,7 @@ public:
      *   GetNumberOfSignals() = numberOfSignals &&
      *   input != NULL &&
      *   output != NULL &&
-     *   lastInputs != NULL &&
-     *   lastOutputs != NULL
+     *   inputHistory != NULL
      */
     virtual bool Setup();
 
@@ -204,18 +244,17 @@ public:
     bool GetResetInEachState () const;
 
     /**
-     * @brief Resets the lastInputs and lastOutputs if necessary.
+     * @brief Resets the inputHistory and outputHistory if necessary.
      * @details The behaviour of this function can be configured in order to reset the filter every time
      * it is called or when in the previous state the Execute() has not be called not called (and thus the filter has not be applied on such state).
      * @return true if preconditions are met.
      * @pre
-     *   lastInputs != NULL &&
-     *   lastOutput != NULL  &&
+     *   inputHistory != NULL
      *
      * @post
-     *   lastInputs[m][n] = 0 &&
-     *   lastOutput[m][n] = 0
-     * where m denote the signal index and the n one of the last state of the signal m.
+     *   inputHistory[m] = 0 &&
+     *   outputHistory[m] = 0
+     * for all the signals and states.
      */
     virtual bool PrepareNextState(const char8 * const currentStateName,
                                   const char8 * const nextStateName);
@@ -281,7 +320,48 @@ public:
      */
     uint32 GetNumberOfSignals() const;
 
+    /**
+     * @brief Queries if the filter is implemented as a cascade of second-order sections.
+     * @return true if Structure = "SOS".
+     */
+    bool IsSOSStructure() const;
+
+    /**
+     * @brief Gets the number of second-order sections.
+     * @return the number of sections (0 if the structure is not SOS).
+     */
+    uint32 GetNumberOfSections() const;
+
+    /**
+     * @brief Gets the size of the FFT used by the overlap-save implementation.
+     * @return the FFT size or 0 if the filter is computed in the time domain.
+     * @pre
+     *   Setup()
+     */
+    uint32 GetFFTSize() const;
+
 private:
+
+    /**
+     * @brief Reads the Num and Den coefficients and computes the static gain.
+     * @param[in] data the GAM configuration.
+     * @return true if the coefficients are valid and normalised.
+     */
+    bool InitialiseDirectForm(StructuredDataI & data);
+
+    /**
+     * @brief Reads the SOS coefficients and the Gain and computes the static gain.
+     * @param[in] data the GAM configuration.
+     * @return true if all the sections have 6 coefficients and a0 != 0.
+     */
+    bool InitialiseSOS(StructuredDataI & data);
+
+    /**
+     * @brief Sets to zero the state of all the signals.
+     * @return true if the state memory is allocated.
+     */
+    bool ResetStates();
+
     /**
      * Pointer to the numerator coefficients.
      */
@@ -303,14 +383,31 @@ private:
     uint32 numberOfDenCoeff;
 
     /**
-     * Array of pointer to the last input values
+     * Mirrored ring buffers (2 * numberOfNumCoeff elements per signal) with the last input values.
+     * Each sample is written at the ring position and at the ring position + numberOfNumCoeff, so that
+     * the last numberOfNumCoeff inputs are always contiguous (newest first) starting at inputPosition.
+     */
+    float32 *inputHistory;
+
+    /**
+     * Mirrored ring buffers (2 * numberOfOutputStates elements per signal) with the last output values.
      */
-    float32 **lastInputs;
+    float32 *outputHistory;
 
     /**
-     * Array of pointers to the last output values
+     * Number of past outputs needed (numberOfDenCoeff - 1).
      */
-    float32 **lastOutputs;
+    uint32 numberOfOutputStates;
+
+    /**
+     * Position of the newest input in the ring (shared by all the signals).
+     */
+    uint32 inputPosition;
+
+    /**
+     * Position of the newest output in the ring (shared by all the signals).
+     */
+    uint32 outputPosition;
 
     /**
      * Holds the the static gain of the filter computed from its coefficients
@@ -347,6 +444,51 @@ private:
 
     /*allows to choose between reset the filter every time the state changes or only when in the previous state the filter was not executed. */
     bool resetInEachState;
+
+    /**
+     * True if the filter is implemented as a cascade of second-order sections.
+     */
+    bool sosStructure;
+
+    /**
+     * The SOS coefficients, 6 per section {b0 b1 b2 a0 a1 a2}.
+     */
+    float64 *sos;
+
+    /**
+     * Number of second-order sections.
+     */
+    uint32 numberOfSections;
+
+    /**
+     * Overall gain of the SOS cascade.
+     */
+    float64 sosGain;
+
+    /**
+     * The SOS engine for float32 signals.
+     */
+    FilterSOSHelperT<float32> *sos32;
+
+    /**
+     * The SOS engine for float64 signals.
+     */
+    FilterSOSHelperT<float64> *sos64;
+
+    /**
+     * The type of all the signals.
+     */
+    TypeDescriptor signalType;
+
+    /**
+     * Minimum number of coefficients x number of samples for which the overlap-save implementation is used (0 = never).
+     */
+    uint32 fftThreshold;
+
+    /**
+     * The overlap-save implementation (NULL if the time domain implementation is used).
+     */
+    FilterFFTHelper *fftFilter;
 };
 
 }
@@ -0,0 +1,475 @@
+/**
+ * @file FilterSOSHelperT.h
+ * @brief Header file for class FilterSOSHelperT
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class FilterSOSHelperT
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef FILTERSOSHELPERT_H_
+#define FILTERSOSHELPERT_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "GeneralDefinitions.h"
+#include "MemoryOperationsHelper.h"
+#include "TypeCharacteristics.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * Alignment (in bytes) of the state and working buffers of the FilterSOSHelperT.
+ * It matches the width of an AVX register so that any SIMD width up to 256 bits can use aligned loads.
+ */
+static const uint32 FILTER_SOS_ALIGNMENT = 32u;
+
+/**
+ * Number of coefficients stored for each section (b0, b1, b2, a1 and a2, i.e. normalised with a0 = 1).
+ */
+static const uint32 FILTER_SOS_COEFFICIENTS = 5u;
+
+/**
+ * @brief Cascade of second-order sections (biquads) applied to a bank of channels.
+ * @details Each section is implemented with the transposed direct form II:
+ *
+ * \f$
+ * y[n] = b_0 x[n] + z_1[n-1]
+ * \f$
+ *
+ * \f$
+ * z_1[n] = b_1 x[n] - a_1 y[n] + z_2[n-1]
+ * \f$
+ *
+ * \f$
+ * z_2[n] = b_2 x[n] - a_2 y[n]
+ * \f$
+ *
+ * The output of each section is the input of the next one.
+ *
+ * All the channels share the same coefficients. The state (z1, z2) of all the channels is stored
+ * channel-interleaved, i.e. for a given section and delay the values of all the channels are contiguous in memory.
+ * The number of channels is padded to a multiple of FILTER_SOS_ALIGNMENT bytes and the buffers are aligned to
+ * FILTER_SOS_ALIGNMENT, so that each section is computed for all the channels in one pass of vector operations
+ * (SSE2 or AVX, depending on the compilation flags, with a scalar fallback otherwise).
+ *
+ * The channel samples are gathered into a working buffer for each input sample, the sections are applied in place
+ * and the result scattered to the output signals. Input and output may share memory.
+ */
+/*lint -e{1712} the implementation does not provide default constructor*/
+/*lint -esym(9107, MARTe::FilterSOSHelperT*) [MISRA C++ Rule 3-1-1] required for template implementation*/
+template<typename Type>
+class FilterSOSHelperT {
+public:
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    FilterSOSHelperT();
+
+    /**
+     * @brief Destructor. Frees the allocated memory.
+     */
+    ~FilterSOSHelperT();
+
+    /**
+     * @brief Allocates the state and loads the coefficients.
+     * @param[in] sosCoefficients the sections, 6 coefficients per section stored as {b0 b1 b2 a0 a1 a2}.
+     * @param[in] nOfSections the number of sections.
+     * @param[in] gain the overall gain of the cascade (applied to the numerator of the first section).
+     * @param[in] nOfChannels the number of channels (signals) to filter.
+     * @param[in] nOfSamples the number of samples of each channel per Execute().
+     * @return true if the parameters are valid (a0 != 0 for all the sections, all the sizes > 0) and the memory could be allocated.
+     */
+    bool Initialise(const float64 * const sosCoefficients,
+                    const uint32 nOfSections,
+                    const float64 gain,
+                    const uint32 nOfChannels,
+                    const uint32 nOfSamples);
+
+    /**
+     * @brief Sets the input and output memory of a given channel.
+     * @param[in] channel the channel index.
+     * @param[in] inputSignal the input memory (nOfSamples elements).
+     * @param[in] outputSignal the output memory (nOfSamples elements).
+     * @return true if the channel index is valid and the helper was initialised.
+     */
+    bool SetChannel(const uint32 channel,
+                    Type * const inputSignal,
+                    Type * const outputSignal);
+
+    /**
+     * @brief Sets all the states of all the channels to zero.
+     */
+    void Reset();
+
+    /**
+     * @brief Filters all the channels.
+     * @pre
+     *   Initialise() && SetChannel() for all the channels
+     */
+    void Execute();
+
+    /**
+     * @brief Gets the number of sections.
+     * @return the number of sections.
+     */
+    uint32 GetNumberOfSections() const;
+
+    /**
+     * @brief Gets the number of channels after padding to the SIMD width.
+     * @return the distance, in elements, between the state of the same channel in two consecutive delays.
+     */
+    uint32 GetStride() const;
+
+private:
+
+    /**
+     * @brief Applies one section to all the (padded) channels.
+     * @param[in,out] x the channel samples on input, the section output on return.
+     * @param[in,out] z1 the first delay of all the channels.
+     * @param[in,out] z2 the second delay of all the channels.
+     * @param[in] coeff the section coefficients {b0 b1 b2 a1 a2}.
+     * @param[in] n the number of (padded) channels.
+     */
+    static void ProcessSection(Type * const x,
+                               Type * const z1,
+                               Type * const z2,
+                               const Type * const coeff,
+                               const uint32 n);
+
+    /**
+     * Number of sections.
+     */
+    uint32 numberOfSections;
+
+    /**
+     * Number of channels.
+     */
+    uint32 numberOfChannels;
+
+    /**
+     * Number of channels padded to FILTER_SOS_ALIGNMENT.
+     */
+    uint32 stride;
+
+    /**
+     * Number of samples per channel.
+     */
+    uint32 numberOfSamples;
+
+    /**
+     * Normalised coefficients, FILTER_SOS_COEFFICIENTS per section.
+     */
+    Type *coefficients;
+
+    /**
+     * Memory as allocated (not aligned).
+     */
+    Type *memory;
+
+    /**
+     * Aligned states. The z1 of section s starts at state[2 * s * stride] and the z2 at state[(2 * s + 1) * stride].
+     */
+    Type *state;
+
+    /**
+     * Aligned working buffer with one sample of each channel.
+     */
+    Type *work;
+
+    /**
+     * Input memory of each channel.
+     */
+    Type **input;
+
+    /**
+     * Output memory of each channel.
+     */
+    Type **output;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+template<typename Type>
+FilterSOSHelperT<Type>::FilterSOSHelperT() {
+    numberOfSections = 0u;
+    numberOfChannels = 0u;
+    stride = 0u;
+    numberOfSamples = 0u;
+    coefficients = NULL_PTR(Type *);
+    memory = NULL_PTR(Type *);
+    state = NULL_PTR(Type *);
+    work = NULL_PTR(Type *);
+    input = NULL_PTR(Type **);
+    output = NULL_PTR(Type **);
+}
+
+/*lint -e{1551} no exception thrown while freeing the memory*/
+template<typename Type>
+FilterSOSHelperT<Type>::~FilterSOSHelperT() {
+    if (coefficients != NULL_PTR(Type *)) {
+        delete[] coefficients;
+    }
+    if (memory != NULL_PTR(Type *)) {
+        delete[] memory;
+    }
+    if (input != NULL_PTR(Type **)) {
+        delete[] input;
+    }
+    if (output != NULL_PTR(Type **)) {
+        delete[] output;
+    }
+    state = NULL_PTR(Type *);
+    work = NULL_PTR(Type *);
+}
+
+template<typename Type>
+bool FilterSOSHelperT<Type>::Initialise(const float64 * const sosCoefficients,
+                                        const uint32 nOfSections,
+                                        const float64 gain,
+                                        const uint32 nOfChannels,
+                                        const uint32 nOfSamples) {
+    bool ok = (memory == NULL_PTR(Type *));
+    if (ok) {
+        ok = ((nOfSections > 0u) && (nOfChannels > 0u) && (nOfSamples > 0u) && (sosCoefficients != NULL_PTR(const float64 *)));
+    }
+    for (uint32 s = 0u; (s < nOfSections) && (ok); s++) {
+        ok = !IsEqual(sosCoefficients[(s * 6u) + 3u], 0.0);
+    }
+    if (ok) {
+        numberOfSections = nOfSections;
+        numberOfChannels = nOfChannels;
+        numberOfSamples = nOfSamples;
+        const uint32 lanes = static_cast<uint32>(FILTER_SOS_ALIGNMENT / sizeof(Type));
+        stride = ((numberOfChannels + lanes) - 1u) / lanes;
+        stride *= lanes;
+
+        coefficients = new Type[numberOfSections * FILTER_SOS_COEFFICIENTS];
+        for (uint32 s = 0u; s < numberOfSections; s++) {
+            const float64 *sos = &sosCoefficients[s * 6u];
+            float64 a0 = sos[3];
+            float64 g = (s == 0u) ? (gain) : (1.0);
+            Type *coeff = &coefficients[s * FILTER_SOS_COEFFICIENTS];
+            coeff[0] = static_cast<Type>((g * sos[0]) / a0);
+            coeff[1] = static_cast<Type>((g * sos[1]) / a0);
+            coeff[2] = static_cast<Type>((g * sos[2]) / a0);
+            coeff[3] = static_cast<Type>(sos[4] / a0);
+            coeff[4] = static_cast<Type>(sos[5] / a0);
+        }
+
+        //2 delays per section + the working buffer + the alignment margin.
+        uint32 nOfElements = (((2u * numberOfSections) + 1u) * stride) + lanes;
+        memory = new Type[nOfElements];
+        uintp misalignment = reinterpret_cast<uintp>(memory) % static_cast<uintp>(FILTER_SOS_ALIGNMENT);
+        uint32 offset = 0u;
+        if (misalignment != 0u) {
+            offset = static_cast<uint32>((static_cast<uintp>(FILTER_SOS_ALIGNMENT) - misalignment) / sizeof(Type));
+        }
+        state = &memory[offset];
+        work = &state[2u * numberOfSections * stride];
+        (void) MemoryOperationsHelper::Set(reinterpret_cast<void *>(memory), '\0', static_cast<uint32>(nOfElements * sizeof(Type)));
+
+        input = new Type*[numberOfChannels];
+        output = new Type*[numberOfChannels];
+        for (uint32 c = 0u; c < numberOfChannels; c++) {
+            input[c] = NULL_PTR(Type *);
+            output[c] = NULL_PTR(Type *);
+        }
+    }
+    return ok;
+}
+
+template<typename Type>
+bool FilterSOSHelperT<Type>::SetChannel(const uint32 channel,
+                                        Type * const inputSignal,
+                                        Type * const outputSignal) {
+    bool ok = ((channel < numberOfChannels) && (input != NULL_PTR(Type **)) && (output != NULL_PTR(Type **)));
+    if (ok) {
+        input[channel] = inputSignal;
+        output[channel] = outputSignal;
+    }
+    return ok;
+}
+
+template<typename Type>
+void FilterSOSHelperT<Type>::Reset() {
+    if (state != NULL_PTR(Type *)) {
+        (void) MemoryOperationsHelper::Set(reinterpret_cast<void *>(state), '\0', static_cast<uint32>((((2u * numberOfSections) + 1u) * stride) * sizeof(Type)));
+    }
+}
+
+template<typename Type>
+void FilterSOSHelperT<Type>::Execute() {
+    if ((state != NULL_PTR(Type *)) && (input != NULL_PTR(Type **)) && (output != NULL_PTR(Type **))) {
+        for (uint32 n = 0u; n < numberOfSamples; n++) {
+            for (uint32 c = 0u; c < numberOfChannels; c++) {
+                work[c] = input[c][n];
+            }
+            for (uint32 s = 0u; s < numberOfSections; s++) {
+                Type *z1 = &state[(2u * s) * stride];
+                ProcessSection(work, z1, &z1[stride], &coefficients[s * FILTER_SOS_COEFFICIENTS], stride);
+            }
+            for (uint32 c = 0u; c < numberOfChannels; c++) {
+                output[c][n] = work[c];
+            }
+        }
+    }
+}
+
+template<typename Type>
+void FilterSOSHelperT<Type>::ProcessSection(Type * const x,
+                                            Type * const z1,
+                                            Type * const z2,
+                                            const Type * const coeff,
+                                            const uint32 n) {
+    for (uint32 c = 0u; c < n; c++) {
+        Type xc = x[c];
+        Type yc = (coeff[0] * xc) + z1[c];
+        z1[c] = ((coeff[1] * xc) - (coeff[3] * yc)) + z2[c];
+        z2[c] = (coeff[2] * xc) - (coeff[4] * yc);
+        x[c] = yc;
+    }
+}
+
+#if defined(__AVX__)
+/**
+ * @brief float32 AVX implementation of FilterSOSHelperT<>::ProcessSection(). 8 channels per operation.
+ */
+template<>
+inline void FilterSOSHelperT<float32>::ProcessSection(float32 * const x,
+                                                      float32 * const z1,
+                                                      float32 * const z2,
+                                                      const float32 * const coeff,
+                                                      const uint32 n) {
+    const __m256 b0 = _mm256_set1_ps(coeff[0]);
+    const __m256 b1 = _mm256_set1_ps(coeff[1]);
+    const __m256 b2 = _mm256_set1_ps(coeff[2]);
+    const __m256 a1 = _mm256_set1_ps(coeff[3]);
+    const __m256 a2 = _mm256_set1_ps(coeff[4]);
+    for (uint32 c = 0u; c < n; c += 8u) {
+        __m256 xc = _mm256_load_ps(&x[c]);
+        __m256 yc = _mm256_add_ps(_mm256_mul_ps(b0, xc), _mm256_load_ps(&z1[c]));
+        _mm256_store_ps(&z1[c], _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(b1, xc), _mm256_mul_ps(a1, yc)), _mm256_load_ps(&z2[c])));
+        _mm256_store_ps(&z2[c], _mm256_sub_ps(_mm256_mul_ps(b2, xc), _mm256_mul_ps(a2, yc)));
+        _mm256_store_ps(&x[c], yc);
+    }
+}
+
+/**
+ * @brief float64 AVX implementation of FilterSOSHelperT<>::ProcessSection(). 4 channels per operation.
+ */
+template<>
+inline void FilterSOSHelperT<float64>::ProcessSection(float64 * const x,
+                                                      float64 * const z1,
+                                                      float64 * const z2,
+                                                      const float64 * const coeff,
+                                                      const uint32 n) {
+    const __m256d b0 = _mm256_set1_pd(coeff[0]);
+    const __m256d b1 = _mm256_set1_pd(coeff[1]);
+    const __m256d b2 = _mm256_set1_pd(coeff[2]);
+    const __m256d a1 = _mm256_set1_pd(coeff[3]);
+    const __m256d a2 = _mm256_set1_pd(coeff[4]);
+    for (uint32 c = 0u; c < n; c += 4u) {
+        __m256d xc = _mm256_load_pd(&x[c]);
+        __m256d yc = _mm256_add_pd(_mm256_mul_pd(b0, xc), _mm256_load_pd(&z1[c]));
+        _mm256_store_pd(&z1[c], _mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(b1, xc), _mm256_mul_pd(a1, yc)), _mm256_load_pd(&z2[c])));
+        _mm256_store_pd(&z2[c], _mm256_sub_pd(_mm256_mul_pd(b2, xc), _mm256_mul_pd(a2, yc)));
+        _mm256_store_pd(&x[c], yc);
+    }
+}
+#elif defined(__SSE2__)
+/**
+ * @brief float32 SSE2 implementation of FilterSOSHelperT<>::ProcessSection(). 4 channels per operation.
+ */
+template<>
+inline void FilterSOSHelperT<float32>::ProcessSection(float32 * const x,
+                                                      float32 * const z1,
+                                                      float32 * const z2,
+                                                      const float32 * const coeff,
+                                                      const uint32 n) {
+    const __m128 b0 = _mm_set1_ps(coeff[0]);
+    const __m128 b1 = _mm_set1_ps(coeff[1]);
+    const __m128 b2 = _mm_set1_ps(coeff[2]);
+    const __m128 a1 = _mm_set1_ps(coeff[3]);
+    const __m128 a2 = _mm_set1_ps(coeff[4]);
+    for (uint32 c = 0u; c < n; c += 4u) {
+        __m128 xc = _mm_load_ps(&x[c]);
+        __m128 yc = _mm_add_ps(_mm_mul_ps(b0, xc), _mm_load_ps(&z1[c]));
+        _mm_store_ps(&z1[c], _mm_add_ps(_mm_sub_ps(_mm_mul_ps(b1, xc), _mm_mul_ps(a1, yc)), _mm_load_ps(&z2[c])));
+        _mm_store_ps(&z2[c], _mm_sub_ps(_mm_mul_ps(b2, xc), _mm_mul_ps(a2, yc)));
+        _mm_store_ps(&x[c], yc);
+    }
+}
+
+/**
+ * @brief float64 SSE2 implementation of FilterSOSHelperT<>::ProcessSection(). 2 channels per operation.
+ */
+template<>
+inline void FilterSOSHelperT<float64>::ProcessSection(float64 * const x,
+                                                      float64 * const z1,
+                                                      float64 * const z2,
+                                                      const float64 * const coeff,
+                                                      const uint32 n) {
+    const __m128d b0 = _mm_set1_pd(coeff[0]);
+    const __m128d b1 = _mm_set1_pd(coeff[1]);
+    const __m128d b2 = _mm_set1_pd(coeff[2]);
+    const __m128d a1 = _mm_set1_pd(coeff[3]);
+    const __m128d a2 = _mm_set1_pd(coeff[4]);
+    for (uint32 c = 0u; c < n; c += 2u) {
+        __m128d xc = _mm_load_pd(&x[c]);
+        __m128d yc = _mm_add_pd(_mm_mul_pd(b0, xc), _mm_load_pd(&z1[c]));
+        _mm_store_pd(&z1[c], _mm_add_pd(_mm_sub_pd(_mm_mul_pd(b1, xc), _mm_mul_pd(a1, yc)), _mm_load_pd(&z2[c])));
+        _mm_store_pd(&z2[c], _mm_sub_pd(_mm_mul_pd(b2, xc), _mm_mul_pd(a2, yc)));
+        _mm_store_pd(&x[c], yc);
+    }
+}
+#endif
+
+template<typename Type>
+uint32 FilterSOSHelperT<Type>::GetNumberOfSections() const {
+    return numberOfSections;
+}
+
+template<typename Type>
+uint32 FilterSOSHelperT<Type>::GetStride() const {
+    return stride;
+}
+
+}
+
+#endif /* FILTERSOSHELPERT_H_ */
@@ -84,6 +84,32 @@ public:
      */
     virtual uint32 InRange(const void * const mem)=0;
 
+    /**
+     * @brief Adds the occurrences of a block of values to an histogram.
+     * @details Equivalent to incrementing histogram[InRange(&mem[i])] for each of the \a numberOfValues values.
+     * @param[in] mem holds the occurrence values (contiguous).
+     * @param[in] numberOfValues the number of values in \a mem.
+     * @param[in,out] histogram the GetNumberOfBins() counters to be incremented.
+     */
+    virtual void Accumulate(const void * const mem,
+                            const uint32 numberOfValues,
+                            uint32 * const histogram)=0;
+
+    /**
+     * @brief Sets the number of partial histograms used by Accumulate.
+     * @details With more than one partial histogram, consecutive values are counted in
+     * different partial histograms, which are merged into the output histogram at the end of each Accumulate.
+     * This breaks the read-modify-write dependency between consecutive values that fall in the same bin.
+     * @param[in] nPartialsIn the number of partial histograms (0 is interpreted as 1).
+     */
+    virtual void SetNumberOfPartialHistograms(const uint32 nPartialsIn)=0;
+
+    /**
+     * @brief Gets the number of partial histograms used by Accumulate.
+     * @return the number of partial histograms.
+     */
+    virtual uint32 GetNumberOfPartialHistograms()=0;
+
 };
 
 }
@@ -38,8 +38,19 @@
 namespace MARTe {
 /*lint -esym(9107, MARTe::HistogramComparator*) the definition must be in the header because it is a template*/
 
+/**
+ * Number of values whose bin indexes are computed in a batch by HistogramComparatorT::Accumulate.
+ */
+static const uint32 HISTOGRAM_BLOCK_SIZE = 64u;
+
 /**
  * @brief Template version of Comparator
+ * @details The bin of a value is computed by multiplying its offset from the lower bound by a precomputed
+ * reciprocal of the bin width and by clamping the result, without branches. Since the reciprocal is not
+ * exact, the estimate is then corrected (by at most one bin) against the bin edges minLim + i * delta,
+ * so that the result is the same as comparing the value against each bin range.
+ * The values in [minLim + (nBins - 2) * delta, maxLim), which only exist if (maxLim - minLim) is not a multiple
+ * of delta (e.g. for integer types), are counted in the last bin before the upper bound.
  */
 template<typename T>
 class HistogramComparatorT: public HistogramComparator {
@@ -80,8 +91,44 @@ public:
      */
     virtual uint32 InRange(const void * const mem);
 
+    /**
+     * @see HistogramComparator::Accumulate()
+     */
+    virtual void Accumulate(const void * const mem,
+                            const uint32 numberOfValues,
+                            uint32 * const histogram);
+
+    /**
+     * @see HistogramComparator::SetNumberOfPartialHistograms()
+     */
+    virtual void SetNumberOfPartialHistograms(const uint32 nPartialsIn);
+
+    /**
+     * @see HistogramComparator::GetNumberOfPartialHistograms()
+     */
+    virtual uint32 GetNumberOfPartialHistograms();
+
 private:
 
+    /**
+     * @brief Computes the bin of \a value.
+     * @param[in] value the occurrence value.
+     * @return the bin index in [0, nBins - 1].
+     */
+    inline uint32 BinIndex(const T value) const;
+
+    /**
+     * @brief Computes the lower edge of the inner bin \a i.
+     * @param[in] i the inner bin index (bin i + 1 of the histogram).
+     * @return minLim + i * delta.
+     */
+    inline T Edge(const uint32 i) const;
+
+    /**
+     * @brief (Re)allocates the partial histograms for the current number of bins and sets them to zero.
+     */
+    void AllocatePartials();
+
     /**
      * The upper bound
      */
@@ -97,10 +144,30 @@ private:
      */
     T delta;
 
+    /**
+     * The reciprocal of delta (zero if delta is not positive)
+     */
+    float64 scale;
+
     /**
      * The number of bins
      */
     uint32 nBins;
+
+    /**
+     * The number of bins between minLim and maxLim (nBins - 2)
+     */
+    uint32 nInnerBins;
+
+    /**
+     * The number of partial histograms
+     */
+    uint32 nPartials;
+
+    /**
+     * The nPartials partial histograms of nBins counters (only allocated if nPartials > 1)
+     */
+    uint32 *partials;
 };
 }
 
@@ -116,13 +183,20 @@ HistogramComparatorT<T>::HistogramComparatorT() :
     maxLim = static_cast<T>(0);
     minLim = static_cast<T>(0);
     nBins = 3u;
+    nInnerBins = 1u;
     delta = static_cast<T>(0);
-
+    scale = 0.0;
+    nPartials = 1u;
+    partials = NULL_PTR(uint32 *);
 }
 
+/*lint -e{1551} no exception thrown while freeing the memory*/
 template<typename T>
 HistogramComparatorT<T>::~HistogramComparatorT() {
-
+    if (partials != NULL_PTR(uint32 *)) {
+        delete[] partials;
+        partials = NULL_PTR(uint32 *);
+    }
 }
 
 template<typename T>
@@ -143,6 +217,19 @@ void HistogramComparatorT<T>::SetNumberOfBins(const uint32 nBinsIn) {
         uint32 nBinsTemp = (nBins - 2u);
         /*lint -e{737} -e{9117} -e{9125} -e{573} -e{9115} Loss of precision is responsibility of the conversion requested by the user.*/
         delta = static_cast<T>(range / nBinsTemp);
+        //Integer ranges smaller than the number of bins would otherwise give a zero width.
+        if ((delta <= static_cast<T>(0)) && (range > static_cast<T>(0))) {
+            delta = static_cast<T>(1);
+        }
+        nInnerBins = nBinsTemp;
+    }
+    else {
+        nInnerBins = 1u;
+    }
+    /*lint -e{9117} -e{9125} -e{915} Loss of precision is responsibility of the conversion requested by the user.*/
+    scale = (delta > static_cast<T>(0)) ? (1.0 / static_cast<float64>(delta)) : (0.0);
+    if (nPartials > 1u) {
+        AllocatePartials();
     }
 }
 
@@ -151,37 +238,109 @@ uint32 HistogramComparatorT<T>::GetNumberOfBins() {
     return nBins;
 }
 
+template<typename T>
+T HistogramComparatorT<T>::Edge(const uint32 i) const {
+    /*lint -e{737} -e{9117} -e{9125} -e{9119} -e{9114} -e{9115} -e{776} Loss of precision is responsibility of the conversion requested by the user.*/
+    return static_cast<T>(minLim + static_cast<T>(i * delta));
+}
 
 template<typename T>
-uint32 HistogramComparatorT<T>::InRange(const void* const mem) {
+uint32 HistogramComparatorT<T>::BinIndex(const T value) const {
+    //All the conditions are evaluated as selects, so that the compiler can vectorise the loop over the values.
+    uint32 geMin = (value >= minLim) ? (1u) : (0u);
+    uint32 geMax = (value >= maxLim) ? (1u) : (0u);
+    //Clamp so that the offset from minLim can neither overflow nor wrap around.
+    T clamped = (value < minLim) ? (minLim) : (value);
+    clamped = (clamped > maxLim) ? (maxLim) : (clamped);
+    /*lint -e{9117} -e{9125} -e{915} Loss of precision is responsibility of the conversion requested by the user.*/
+    float64 position = static_cast<float64>(static_cast<T>(clamped - minLim)) * scale;
+    float64 lastInner = static_cast<float64>(nInnerBins - 1u);
+    position = (position >= 0.0) ? (position) : (0.0);
+    position = (position < lastInner) ? (position) : (lastInner);
+    uint32 inner = static_cast<uint32>(position);
+    //The reciprocal is not exact: move the estimate to the bin whose edges contain the value.
+    inner -= (clamped < Edge(inner)) ? (1u) : (0u);
+    inner += (((inner + 1u) < nInnerBins) && (clamped >= Edge(inner + 1u))) ? (1u) : (0u);
+    return geMin * ((geMax * (nBins - 1u)) + ((1u - geMax) * (inner + 1u)));
+}
 
+template<typename T>
+uint32 HistogramComparatorT<T>::InRange(const void* const mem) {
     const T* toCompare = reinterpret_cast<T*>(const_cast<void *>(mem));
+    return BinIndex(*toCompare);
+}
 
-    uint32 ret = 0u;
-    if (*toCompare < minLim) {
-        ret = 0u;
-    }
-    else if (*toCompare >= maxLim) {
-        ret = (nBins - 1u);
+template<typename T>
+void HistogramComparatorT<T>::Accumulate(const void * const mem,
+                                         const uint32 numberOfValues,
+                                         uint32 * const histogram) {
+    const T* values = reinterpret_cast<T*>(const_cast<void *>(mem));
+    uint32 indexes[HISTOGRAM_BLOCK_SIZE];
+    bool usePartials = (partials != NULL_PTR(uint32 *));
+    uint32 partial = 0u;
+    uint32 done = 0u;
+    while (done < numberOfValues) {
+        uint32 blockSize = (numberOfValues - done);
+        if (blockSize > HISTOGRAM_BLOCK_SIZE) {
+            blockSize = HISTOGRAM_BLOCK_SIZE;
+        }
+        for (uint32 i = 0u; i < blockSize; i++) {
+            indexes[i] = BinIndex(values[done + i]);
+        }
+        if (usePartials) {
+            /*lint -e{613} partials is not NULL if usePartials*/
+            for (uint32 i = 0u; i < blockSize; i++) {
+                partials[(partial * nBins) + indexes[i]]++;
+                partial++;
+                if (partial == nPartials) {
+                    partial = 0u;
+                }
+            }
+        }
+        else {
+            for (uint32 i = 0u; i < blockSize; i++) {
+                histogram[indexes[i]]++;
+            }
+        }
+        done += blockSize;
     }
-    else {
-        //do the division with a
-        for (uint32 i = 0u; (i < (nBins - 2u)); i++) {
-            /*lint -e{737} -e{9117} -e{9125} -e{9119} -e{9114} -e{9115} -e{776} Loss of precision is responsibility of the conversion requested by the user.*/
-            T minRange = (minLim + static_cast<T>(i * delta));
-            /*lint -e{737} -e{9117} -e{9125} -e{9119} -e{9114} -e{9115} -e{776} Loss of precision is responsibility of the conversion requested by the user.*/
-            T maxRange = (minLim + static_cast<T>((i + 1u) * delta));
-            /*lint -e{737} -e{9117} -e{9125} Loss of precision is responsibility of the conversion requested by the user.*/
-            if (((*toCompare) >= (minRange)) && ((*toCompare) < maxRange)) {
-                ret = (i + 1u);
-                break;
+    if (usePartials) {
+        /*lint -e{613} partials is not NULL if usePartials*/
+        for (uint32 p = 0u; p < nPartials; p++) {
+            uint32 *partialHistogram = &partials[p * nBins];
+            for (uint32 b = 0u; b < nBins; b++) {
+                histogram[b] += partialHistogram[b];
+                partialHistogram[b] = 0u;
             }
         }
     }
+}
 
-    return ret;
+template<typename T>
+void HistogramComparatorT<T>::SetNumberOfPartialHistograms(const uint32 nPartialsIn) {
+    nPartials = (nPartialsIn > 0u) ? (nPartialsIn) : (1u);
+    AllocatePartials();
 }
 
+template<typename T>
+uint32 HistogramComparatorT<T>::GetNumberOfPartialHistograms() {
+    return nPartials;
 }
-#endif /* COMPARATORT_H_ */
 
+template<typename T>
+void HistogramComparatorT<T>::AllocatePartials() {
+    if (partials != NULL_PTR(uint32 *)) {
+        delete[] partials;
+        partials = NULL_PTR(uint32 *);
+    }
+    if ((nPartials > 1u) && (nBins > 0u)) {
+        uint32 size = (nPartials * nBins);
+        partials = new uint32[size];
+        for (uint32 i = 0u; i < size; i++) {
+            partials[i] = 0u;
+        }
+    }
+}
+
+}
+#endif /* COMPARATORT_H_ */
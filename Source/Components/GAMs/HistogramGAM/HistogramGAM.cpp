@@ -189,6 +189,8 @@ HistogramGAM::HistogramGAM() :
 
     beginCycle = 0u;
     cycleCounter = 0u;
+    numberOfValues = NULL_PTR(uint32 *);
+    numberOfPartialHistograms = 1u;
 }
 
 /*lint -e{1551} destructor does not throw any exception */
@@ -203,6 +205,10 @@ HistogramGAM::~HistogramGAM() {
         delete[] comps;
         comps = NULL_PTR(HistogramComparator **);
     }
+    if (numberOfValues != NULL_PTR(uint32 *)) {
+        delete[] numberOfValues;
+        numberOfValues = NULL_PTR(uint32 *);
+    }
 }
 
 bool HistogramGAM::Initialise(StructuredDataI &data) {
@@ -219,6 +225,15 @@ bool HistogramGAM::Initialise(StructuredDataI &data) {
             REPORT_ERROR(ErrorManagement::Information, "Going to reset when the next state name is: %s", stateChangeResetName.Buffer());
         }
     }
+    if (ret) {
+        if (!data.Read("NumberOfPartialHistograms", numberOfPartialHistograms)) {
+            numberOfPartialHistograms = 1u;
+        }
+        ret = (numberOfPartialHistograms > 0u);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "NumberOfPartialHistograms must be > 0");
+        }
+    }
     return ret;
 }
 
@@ -228,31 +243,26 @@ bool HistogramGAM::Setup() {
 
     if (ret) {
         comps = new HistogramComparator *[numberOfInputSignals];
+        numberOfValues = new uint32[numberOfInputSignals];
 
         for (uint32 i = 0u; (i < numberOfInputSignals); i++) {
             /*lint -e{613} the NULL pointer is checked before*/
             comps[i] = NULL_PTR(HistogramComparator *);
+            /*lint -e{613} the NULL pointer is checked before*/
+            numberOfValues[i] = 0u;
         }
-        //check that the number of dimensions of the input signals is one
+        //all the elements of all the samples are counted
         /*lint -e{850} the variable i does not change in the loop */
         for (uint32 i = 0u; (i < numberOfInputSignals) && (ret); i++) {
-            uint32 numberOfElements;
+            uint32 numberOfElements = 0u;
+            uint32 numberOfSamples = 0u;
             ret = GetSignalNumberOfElements(InputSignals, i, numberOfElements);
             if (ret) {
-                ret = (numberOfElements == 1u);
-                if (!ret) {
-                    REPORT_ERROR(ErrorManagement::FatalError, "The input signal %d must have NumberOfElements=1", i);
-                }
+                ret = GetSignalNumberOfSamples(InputSignals, i, numberOfSamples);
             }
             if (ret) {
-                uint32 numberOfSamples;
-                ret = GetSignalNumberOfSamples(InputSignals, i, numberOfSamples);
-                if (ret) {
-                    ret = (numberOfSamples == 1u);
-                    if (!ret) {
-                        REPORT_ERROR(ErrorManagement::FatalError, "The input signal %d must have NumberOfSamples=1", i);
-                    }
-                }
+                /*lint -e{613} the NULL pointer is checked before*/
+                numberOfValues[i] = (numberOfElements * numberOfSamples);
             }
             if (ret) {
                 TypeDescriptor td = GetSignalType(InputSignals, i);
@@ -314,6 +324,8 @@ bool HistogramGAM::Setup() {
                 else {
                     /*lint -e{613} the NULL pointer is checked before*/
                     comps[i]->SetNumberOfBins(numberOfElements);
+                    /*lint -e{613} the NULL pointer is checked before*/
+                    comps[i]->SetNumberOfPartialHistograms(numberOfPartialHistograms);
                 }
             }
             if (ret) {
@@ -359,8 +371,7 @@ bool HistogramGAM::Execute() {
         for (uint32 i = 0u; i < numberOfInputSignals; i++) {
             uint32 *outputSignal = reinterpret_cast<uint32 *>(GetOutputSignalMemory(i));
             /*lint -e{613} the NULL pointer is checked before*/
-            uint32 index = comps[i]->InRange(GetInputSignalMemory(i));
-            outputSignal[index]++;
+            comps[i]->Accumulate(GetInputSignalMemory(i), numberOfValues[i], outputSignal);
         }
     }
     else {
@@ -46,7 +46,8 @@ namespace MARTe {
  * @details For each input signal the following parameters can be defined:\n
  *   MinLim = [the minimum value of the signal]\n
  *   MaxLim = [the maximum value of the signal]\n
- * All the signals in input must be scalar and the number of samples per cycle must be one.\n
+ * The input signals can be scalars or arrays with any number of samples: every element of every sample is
+ * counted in the histogram in each cycle (e.g. to histogram a full ADC block).\n
  * Each output signal represents the histogram of the relative input signal, so the number of input and output
  * signals must coincide. The output signal must be an array of at least three elements and the number of elements
  * is the desired number of bins of the histogram. The algorithm divides the signal range (maxLim - minLim)
@@ -79,7 +80,11 @@ namespace MARTe {
  *
  * The output signals type must be uint32.\n
  * The user can also define the GAM parameter \a BeginCycleNumber that enables the histogram
- * to start counting only after the specified number of MARTe cycles has passed. Default for this parameter is zero.
+ * to start counting only after the specified number of MARTe cycles has passed. Default for this parameter is zero.\n
+ * The optional GAM parameter \a NumberOfPartialHistograms (default 1) sets how many partial histograms are used to count
+ * the values of a block. Consecutive values are counted in different partial histograms, which are added to the output
+ * histogram at the end of each Execute. This avoids stalling on consecutive increments of the same bin, which are
+ * very frequent with slowly varying signals. Values from 2 to 4 are advised for inputs with many elements or samples.
  *
  * @details
  * The configuration syntax is (names and signal quantities are only given as an example):
@@ -88,6 +93,7 @@ namespace MARTe {
  *     Class = HistogramGAM
  *     BeginCycleNumber = 0 //Optional. Start to compute histogram only after BeginCycleNumber cycles
  *     StateChangeResetName = All //Optional. If set it will reset when the PrepareNextState, nextStaName == StateChangeResetName. If the StateChangeResetName is set to "All", it will always reset.
+ *     NumberOfPartialHistograms = 4 //Optional. Number of partial histograms used to count the values of each Execute. Default = 1.
  *     InputSignals = {
  *         BeginCycleNumber = 10
  *         Signal1 = {
@@ -101,6 +107,7 @@ namespace MARTe {
  *         Signal1 = {
  *             DataSource = "Drv1"
  *             Type = float32
+ *             NumberOfElements = 1000
  *             MinLim = 10.5
  *             MaxLim = 20.5
  *         }
@@ -137,7 +144,8 @@ public:
     /**
      * @see GAM::Initialise()
      * @details The following parameter can be defined in the configuration:\n
-     *   BeginCycleNumber: how many cycles to wait before starting to compute the histogram.
+     *   BeginCycleNumber: how many cycles to wait before starting to compute the histogram.\n
+     *   NumberOfPartialHistograms: how many partial histograms are used to count the values (> 0, default 1).
      */
     virtual bool Initialise(StructuredDataI &data);
 
@@ -145,8 +153,6 @@ public:
      * @see GAM::Setup()
      * @details Checks that:\n
      *   (NumberOfInputSignals==NumberOfOutputSignals)\n
-     *   (NumberOfElements == 1) for each input signal\n
-     *   (NumberOfSamples == 1) for each input signal\n
      *   (NumberOfElements >= 3) for each output signal\n
      *   (Type == uint32) for each output signal\n
      *  @return true if the conditions above are met.
@@ -156,7 +162,7 @@ public:
     /**
      * @see GAM::Excute()
      * @details Executes the histogram algorithm counting and dividing the occurrences of the signals
-     * among the defined number of bins.
+     * among the defined number of bins. All the elements and samples of each input signal are counted.
      * @return true
      */
     virtual bool Execute();
@@ -188,6 +194,16 @@ protected:
      */
     uint32 cycleCounter;
 
+    /**
+     * The number of values (elements * samples) of each input signal.
+     */
+    uint32 *numberOfValues;
+
+    /**
+     * The number of partial histograms used by each comparator.
+     */
+    uint32 numberOfPartialHistograms;
+
     /**
      * The name of the state to reset the histogram counters.
      */
@@ -33,6 +33,47 @@
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace {
+
+/**
+ * @brief Copies the blocks of a step with a compile-time block size, which the compiler reduces to one load and one store per block.
+ */
+template<MARTe::uint32 blockSize>
+void Interleaved2FlatGAMCopyFixed(MARTe::uint8 * const destination, const MARTe::uint8 * const source, const MARTe::Interleaved2FlatGAMCopyStep &step) {
+    const MARTe::uint32 numberOfSamples = step.numberOfSamples;
+    const MARTe::uint32 sourceStride = step.sourceStride;
+    const MARTe::uint32 destinationStride = step.destinationStride;
+    for (MARTe::uint32 k = 0u; k < numberOfSamples; k++) {
+        const MARTe::uint8 * const src = &source[k * sourceStride];
+        MARTe::uint8 * const dest = &destination[k * destinationStride];
+        //Reading the whole block before writing it allows the compiler to merge the byte accesses
+        MARTe::uint8 block[blockSize];
+        for (MARTe::uint32 b = 0u; b < blockSize; b++) {
+            block[b] = src[b];
+        }
+        for (MARTe::uint32 b = 0u; b < blockSize; b++) {
+            dest[b] = block[b];
+        }
+    }
+}
+
+/**
+ * @brief Copies the blocks of a step of any size.
+ */
+void Interleaved2FlatGAMCopyAny(MARTe::uint8 * const destination, const MARTe::uint8 * const source, const MARTe::Interleaved2FlatGAMCopyStep &step) {
+    for (MARTe::uint32 k = 0u; k < step.numberOfSamples; k++) {
+        (void) MARTe::MemoryOperationsHelper::Copy(&destination[k * step.destinationStride], &source[k * step.sourceStride], step.size);
+    }
+}
+
+/**
+ * @brief Copies a step with contiguous blocks in a single copy.
+ */
+void Interleaved2FlatGAMCopyBlock(MARTe::uint8 * const destination, const MARTe::uint8 * const source, const MARTe::Interleaved2FlatGAMCopyStep &step) {
+    (void) MARTe::MemoryOperationsHelper::Copy(destination, source, step.size * step.numberOfSamples);
+}
+
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -51,6 +92,8 @@ Interleaved2FlatGAM::Interleaved2FlatGAM() :
     numberOfOutputPacketChunks = NULL_PTR(uint32 *);
     packetOutputChunkSize = NULL_PTR(uint32 *);
     totalSignalsByteSize = 0u;
+    copySteps = NULL_PTR(Interleaved2FlatGAMCopyStep *);
+    numberOfCopySteps = 0u;
 }
 
 Interleaved2FlatGAM::~Interleaved2FlatGAM() {
@@ -86,6 +129,10 @@ Interleaved2FlatGAM::~Interleaved2FlatGAM() {
         delete[] packetOutputChunkSize;
     }
 
+    if (copySteps != NULL_PTR(Interleaved2FlatGAMCopyStep *)) {
+        delete[] copySteps;
+    }
+
 }
 
 /*lint -e{613} null pointer checked.*/
@@ -329,94 +376,157 @@ bool Interleaved2FlatGAM::Setup() {
 
     }
 
+    if (ret) {
+        ComputeCopyPlan(totalNumberOfInputChunkSizes + totalNumberOfOutputChunkSizes);
+    }
+
     return ret;
 }
 
-/*lint -e{613} null pointer checked.*/
-bool Interleaved2FlatGAM::Execute() {
-    bool ret = MemoryOperationsHelper::Copy(GetOutputSignalsMemory(), GetInputSignalsMemory(), totalSignalsByteSize);
+/*lint -e{613} null pointers checked in Setup.*/
+void Interleaved2FlatGAM::ComputeCopyPlan(const uint32 totalNumberOfChunks) {
+    const uint32 numberOfSignals = numberOfInputSignals + numberOfOutputSignals;
+    //One step for each chunk and at most one block copy before each interleaved signal and one at the end
+    copySteps = new Interleaved2FlatGAMCopyStep[totalNumberOfChunks + numberOfSignals + 1u];
+    numberOfCopySteps = 0u;
+    //The ranges of the output memory written by the interleaved signals
+    uint32 *coveredStart = new uint32[numberOfSignals];
+    uint32 *coveredEnd = new uint32[numberOfSignals];
+    uint32 numberOfCovered = 0u;
+
+    //Interleaved to flat: the k-th sample of the i-th member goes to the i-th member region, at k * chunkSize
     uint32 cnt = 0u;
     uint32 offset = 0u;
-    for (uint32 n = 0u; (n < numberOfInputSignals); n++) {
-        //do the split of the signals
-        uint8 *originSource = reinterpret_cast<uint8 *>(GetInputSignalMemory(n));
-
-        uint8 *originDest = &(reinterpret_cast<uint8 *>(GetOutputSignalsMemory()))[offset];
-
-        //this should be the number of samples
-        /*lint -e{613} null pointer checked before.*/
-        for (uint32 k = 0u; k < numberOfInputSamples[n]; k++) {
-            //return to the gam pointet
-            uint8 *dest = originDest;
-            //go to the k-th packet in the data source
-            /*lint -e{613} null pointer checked before.*/
-            uint32 index = (k * inputByteSize[n]);
-            /*lint -e{613} null pointer checked before.*/
-            uint8 *source = &originSource[index];
-            /*lint -e{613} null pointer checked before.*/
+    for (uint32 n = 0u; n < numberOfInputSignals; n++) {
+        const uint32 signalSize = (inputByteSize[n] * numberOfInputSamples[n]);
+        if (numberOfInputPacketChunks[n] > 0u) {
+            uint32 memberOffset = 0u;
+            uint32 regionOffset = offset;
             for (uint32 i = 0u; i < numberOfInputPacketChunks[n]; i++) {
-                //get the chunk size
-                index = (cnt + i);
-                /*lint -e{613} null pointer checked before.*/
-                uint32 chunkSize = packetInputChunkSize[index];
-                //put the k-th element
-                index = (k * chunkSize);
-                dest = &dest[index];
-                (void) MemoryOperationsHelper::Copy(dest, source, chunkSize);
-                //skip the N-k other samples to go to the next chunk mem
-                index = ((numberOfInputSamples[n] - k) * chunkSize);
-                dest = &dest[index];
-                //get the next chunk in source
-                source = &source[chunkSize];
+                const uint32 chunkSize = packetInputChunkSize[cnt + i];
+                Interleaved2FlatGAMCopyStep &step = copySteps[numberOfCopySteps];
+                step.sourceOffset = (offset + memberOffset);
+                step.sourceStride = inputByteSize[n];
+                step.destinationOffset = regionOffset;
+                step.destinationStride = chunkSize;
+                step.size = chunkSize;
+                step.numberOfSamples = numberOfInputSamples[n];
+                numberOfCopySteps++;
+                memberOffset += chunkSize;
+                regionOffset += (chunkSize * numberOfInputSamples[n]);
             }
+            coveredStart[numberOfCovered] = offset;
+            coveredEnd[numberOfCovered] = (offset + signalSize);
+            numberOfCovered++;
         }
-        offset += (inputByteSize[n] * numberOfInputSamples[n]);
+        offset += signalSize;
         cnt += numberOfInputPacketChunks[n];
-
     }
 
+    //Flat to interleaved: the i-th member region is spread over the samples of the output signal
     cnt = 0u;
     offset = 0u;
-    for (uint32 n = 0u; (n < numberOfOutputSignals); n++) {
-        //do the split of the signals
-        uint8 *originSource = &(reinterpret_cast<uint8 *>(GetInputSignalsMemory()))[offset];
-
-        uint8 *originDest = reinterpret_cast<uint8 *>(GetOutputSignalMemory(n));
-
-        //this should be the number of samples
-        /*lint -e{613} null pointer checked before.*/
-        for (uint32 k = 0u; k < numberOfOutputSamples[n]; k++) {
-            //return to the gam pointet
-            uint8 *source = originSource;
-            //go to the k-th packet in the data source
-            /*lint -e{613} null pointer checked before.*/
-            uint32 index = (k * outputByteSize[n]);
-            /*lint -e{613} null pointer checked before.*/
-            uint8 *dest = &originDest[index];
-            /*lint -e{613} null pointer checked before.*/
+    for (uint32 n = 0u; n < numberOfOutputSignals; n++) {
+        const uint32 signalSize = (outputByteSize[n] * numberOfOutputSamples[n]);
+        if (numberOfOutputPacketChunks[n] > 0u) {
+            uint32 memberOffset = 0u;
+            uint32 regionOffset = offset;
             for (uint32 i = 0u; i < numberOfOutputPacketChunks[n]; i++) {
-                //get the chunk size
-                index = (cnt + i);
-                /*lint -e{613} null pointer checked before.*/
-                uint32 chunkSize = packetOutputChunkSize[index];
-                //put the k-th element
-                index = (k * chunkSize);
-                source = &source[index];
-                (void) MemoryOperationsHelper::Copy(dest, source, chunkSize);
-                //skip the N-k other samples to go to the next chunk mem
-                index = ((numberOfOutputSamples[n] - k) * chunkSize);
-                source = &source[index];
-                //get the next chunk in source
-                dest = &dest[chunkSize];
+                const uint32 chunkSize = packetOutputChunkSize[cnt + i];
+                Interleaved2FlatGAMCopyStep &step = copySteps[numberOfCopySteps];
+                step.sourceOffset = regionOffset;
+                step.sourceStride = chunkSize;
+                step.destinationOffset = (offset + memberOffset);
+                step.destinationStride = outputByteSize[n];
+                step.size = chunkSize;
+                step.numberOfSamples = numberOfOutputSamples[n];
+                numberOfCopySteps++;
+                memberOffset += chunkSize;
+                regionOffset += (chunkSize * numberOfOutputSamples[n]);
             }
+            coveredStart[numberOfCovered] = offset;
+            coveredEnd[numberOfCovered] = (offset + signalSize);
+            numberOfCovered++;
         }
-        offset += (outputByteSize[n] * numberOfOutputSamples[n]);
+        offset += signalSize;
         cnt += numberOfOutputPacketChunks[n];
-
     }
 
-    return ret;
+    //Sort the covered ranges (which do not overlap, see Setup) and copy the gaps as blocks
+    for (uint32 i = 1u; i < numberOfCovered; i++) {
+        uint32 j = i;
+        while ((j > 0u) && (coveredStart[j - 1u] > coveredStart[j])) {
+            const uint32 start = coveredStart[j];
+            const uint32 end = coveredEnd[j];
+            coveredStart[j] = coveredStart[j - 1u];
+            coveredEnd[j] = coveredEnd[j - 1u];
+            coveredStart[j - 1u] = start;
+            coveredEnd[j - 1u] = end;
+            j--;
+        }
+    }
+    uint32 position = 0u;
+    for (uint32 i = 0u; i <= numberOfCovered; i++) {
+        const uint32 gapEnd = (i < numberOfCovered) ? coveredStart[i] : totalSignalsByteSize;
+        if (gapEnd > position) {
+            Interleaved2FlatGAMCopyStep &step = copySteps[numberOfCopySteps];
+            step.sourceOffset = position;
+            step.sourceStride = (gapEnd - position);
+            step.destinationOffset = position;
+            step.destinationStride = (gapEnd - position);
+            step.size = (gapEnd - position);
+            step.numberOfSamples = 1u;
+            numberOfCopySteps++;
+        }
+        if (i < numberOfCovered) {
+            position = coveredEnd[i];
+        }
+    }
+    delete[] coveredStart;
+    delete[] coveredEnd;
+
+    //Select the copy functions and group the steps by block size
+    for (uint32 i = 0u; i < numberOfCopySteps; i++) {
+        Interleaved2FlatGAMCopyStep &step = copySteps[i];
+        if (((step.sourceStride == step.size) && (step.destinationStride == step.size)) || (step.numberOfSamples == 1u)) {
+            step.copyFunction = &Interleaved2FlatGAMCopyBlock;
+        }
+        else if (step.size == 1u) {
+            step.copyFunction = &Interleaved2FlatGAMCopyFixed<1u>;
+        }
+        else if (step.size == 2u) {
+            step.copyFunction = &Interleaved2FlatGAMCopyFixed<2u>;
+        }
+        else if (step.size == 4u) {
+            step.copyFunction = &Interleaved2FlatGAMCopyFixed<4u>;
+        }
+        else if (step.size == 8u) {
+            step.copyFunction = &Interleaved2FlatGAMCopyFixed<8u>;
+        }
+        else {
+            step.copyFunction = &Interleaved2FlatGAMCopyAny;
+        }
+    }
+    for (uint32 i = 1u; i < numberOfCopySteps; i++) {
+        uint32 j = i;
+        while ((j > 0u) && (copySteps[j - 1u].size > copySteps[j].size)) {
+            const Interleaved2FlatGAMCopyStep step = copySteps[j];
+            copySteps[j] = copySteps[j - 1u];
+            copySteps[j - 1u] = step;
+            j--;
+        }
+    }
+}
 
+/*lint -e{613} null pointer checked.*/
+bool Interleaved2FlatGAM::Execute() {
+    const uint8 * const source = reinterpret_cast<uint8 *>(GetInputSignalsMemory());
+    uint8 * const destination = reinterpret_cast<uint8 *>(GetOutputSignalsMemory());
+    for (uint32 i = 0u; i < numberOfCopySteps; i++) {
+        const Interleaved2FlatGAMCopyStep &step = copySteps[i];
+        step.copyFunction(&destination[step.destinationOffset], &source[step.sourceOffset], step);
+    }
+    return true;
 }
 CLASS_REGISTER(Interleaved2FlatGAM, "1.0")
 }
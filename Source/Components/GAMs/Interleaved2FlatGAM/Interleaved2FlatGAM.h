@@ -38,6 +38,48 @@
 
 namespace MARTe {
 
+/**
+ * @brief One step of the Interleaved2FlatGAM copy plan: numberOfSamples blocks of size bytes, each read at
+ * sourceOffset + k * sourceStride from the input memory and written at destinationOffset + k * destinationStride
+ * in the output memory.
+ */
+struct Interleaved2FlatGAMCopyStep {
+    /**
+     * Offset of the first block in the GAM input memory.
+     */
+    uint32 sourceOffset;
+
+    /**
+     * Offset of the first block in the GAM output memory.
+     */
+    uint32 destinationOffset;
+
+    /**
+     * Distance between consecutive blocks in the GAM input memory.
+     */
+    uint32 sourceStride;
+
+    /**
+     * Distance between consecutive blocks in the GAM output memory.
+     */
+    uint32 destinationStride;
+
+    /**
+     * Size of each block.
+     */
+    uint32 size;
+
+    /**
+     * Number of blocks.
+     */
+    uint32 numberOfSamples;
+
+    /**
+     * The copy function specialised for the block size.
+     */
+    void (*copyFunction)(uint8 * const destination, const uint8 * const source, const Interleaved2FlatGAMCopyStep &step);
+};
+
 /**
  * @brief GAM which allows to translate an interleaved memory region into a flat memory area (and vice-versa).
  * @details Some data-sources are expected to produce signals which are interleaved, i.e. which are in the form:
@@ -57,6 +99,10 @@ namespace MARTe {
  *
  * The size of the input signals shall match the size of the output signals and the sum of the PacketMemberSizes shall be a sub-multiple of the signal size.
  *
+ * The copies are precomputed in Setup as a plan with one strided step for each packet member and one block copy for each range of
+ * signals which is not interleaved, so that every byte of the output memory is written once. The steps are grouped by member size
+ * and the 1, 2, 4 and 8 bytes members are copied with loops specialised for the size.
+ *
  * The configuration syntax is (names and signal quantity are only given as an example):
  *
  * <pre>
@@ -257,7 +303,7 @@ Interleaved2FlatGAM    ();
     virtual ~Interleaved2FlatGAM();
 
     /**
-     * @brief Verifies correctness of the GAM configuration.
+     * @brief Verifies correctness of the GAM configuration and computes the copy plan.
      * @details Checks that:
      *  - The memory size of the input signals is the equal to the memory size of the output signals.
      *  - For each signal, the sum(PacketMemberSizes) is a sub-multiple of the signal size.
@@ -266,7 +312,7 @@ Interleaved2FlatGAM    ();
     virtual bool Setup();
 
     /**
-     * @brief Translates from interleaved to flat memory (or vice-versa).
+     * @brief Translates from interleaved to flat memory (or vice-versa) by executing the copy plan.
      * @return true.
      */
     virtual bool Execute();
@@ -316,6 +362,24 @@ protected:
      */
     uint32 totalSignalsByteSize;
 
+    /**
+     * The copy plan executed by Execute.
+     */
+    Interleaved2FlatGAMCopyStep *copySteps;
+
+    /**
+     * Number of steps in the copy plan.
+     */
+    uint32 numberOfCopySteps;
+
+private:
+
+    /**
+     * @brief Computes the copy plan.
+     * @param[in] totalNumberOfChunks the sum of the number of packet members of all the input and output signals.
+     */
+    void ComputeCopyPlan(const uint32 totalNumberOfChunks);
+
 };
 
 }
@@ -0,0 +1,1893 @@
+/**
+ * @file MathExpressionBlockEvaluator.cpp
+ * @brief Source file for class MathExpressionBlockEvaluator
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MathExpressionBlockEvaluator (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <math.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "AnyType.h"
+#include "MathExpressionBlockEvaluator.h"
+#include "MemoryOperationsHelper.h"
+#include "TypeConversion.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+/*lint -esym(9107, MARTe::MathExpressionBlock*) [MISRA C++ Rule 3-1-1]. Justification: the kernels are templates only used in this unit.*/
+
+/**
+ * Size in bytes reserved for each value of the work buffers, of the internal variables and of the constants.
+ */
+static const uint32 MATH_EXPRESSION_BLOCK_VALUE_SIZE = 8u;
+
+/**
+ * @brief Properties of the types supported by the MathExpressionBlockEvaluator.
+ * @details Wrap is the type used to compute the integer ADD and SUB before the saturation
+ * (unsigned arithmetic in at least 32 bits, so that the promotions cannot overflow).
+ * Product is a type that holds the exact product of two values when isExactProduct is true.
+ */
+template<typename T>
+struct MathExpressionBlockTraits;
+
+template<>
+struct MathExpressionBlockTraits<uint8> {
+    typedef uint32 Wrap;
+    typedef uint64 Product;
+    static const bool isExactProduct = true;
+    static const bool isFloat = false;
+    static const bool isSigned = false;
+    static inline bool IsNegative(const uint8 x) {
+        (void) x;
+        return false;
+    }
+    static inline uint8 Max() {
+        return 0xFFu;
+    }
+    static inline uint8 Min() {
+        return 0u;
+    }
+};
+
+template<>
+struct MathExpressionBlockTraits<int8> {
+    typedef uint32 Wrap;
+    typedef int64 Product;
+    static const bool isExactProduct = true;
+    static const bool isFloat = false;
+    static const bool isSigned = true;
+    static inline bool IsNegative(const int8 x) {
+        return (x < 0);
+    }
+    static inline int8 Max() {
+        return 127;
+    }
+    static inline int8 Min() {
+        return -128;
+    }
+};
+
+template<>
+struct MathExpressionBlockTraits<uint16> {
+    typedef uint32 Wrap;
+    typedef uint64 Product;
+    static const bool isExactProduct = true;
+    static const bool isFloat = false;
+    static const bool isSigned = false;
+    static inline bool IsNegative(const uint16 x) {
+        (void) x;
+        return false;
+    }
+    static inline uint16 Max() {
+        return 0xFFFFu;
+    }
+    static inline uint16 Min() {
+        return 0u;
+    }
+};
+
+template<>
+struct MathExpressionBlockTraits<int16> {
+    typedef uint32 Wrap;
+    typedef int64 Product;
+    static const bool isExactProduct = true;
+    static const bool isFloat = false;
+    static const bool isSigned = true;
+    static inline bool IsNegative(const int16 x) {
+        return (x < 0);
+    }
+    static inline int16 Max() {
+        return 32767;
+    }
+    static inline int16 Min() {
+        return -32768;
+    }
+};
+
+template<>
+struct MathExpressionBlockTraits<uint32> {
+    typedef uint32 Wrap;
+    typedef uint64 Product;
+    static const bool isExactProduct = true;
+    static const bool isFloat = false;
+    static const bool isSigned = false;
+    static inline bool IsNegative(const uint32 x) {
+        (void) x;
+        return false;
+    }
+    static inline uint32 Max() {
+        return 0xFFFFFFFFu;
+    }
+    static inline uint32 Min() {
+        return 0u;
+    }
+};
+
+template<>
+struct MathExpressionBlockTraits<int32> {
+    typedef uint32 Wrap;
+    typedef int64 Product;
+    static const bool isExactProduct = true;
+    static const bool isFloat = false;
+    static const bool isSigned = true;
+    static inline bool IsNegative(const int32 x) {
+        return (x < 0);
+    }
+    static inline int32 Max() {
+        return 2147483647;
+    }
+    static inline int32 Min() {
+        return (-2147483647 - 1);
+    }
+};
+
+template<>
+struct MathExpressionBlockTraits<uint64> {
+    typedef uint64 Wrap;
+    typedef uint64 Product;
+    static const bool isExactProduct = false;
+    static const bool isFloat = false;
+    static const bool isSigned = false;
+    static inline bool IsNegative(const uint64 x) {
+        (void) x;
+        return false;
+    }
+    static inline uint64 Max() {
+        return ~static_cast<uint64>(0u);
+    }
+    static inline uint64 Min() {
+        return 0u;
+    }
+};
+
+template<>
+struct MathExpressionBlockTraits<int64> {
+    typedef uint64 Wrap;
+    typedef int64 Product;
+    static const bool isExactProduct = false;
+    static const bool isFloat = false;
+    static const bool isSigned = true;
+    static inline bool IsNegative(const int64 x) {
+        return (x < 0);
+    }
+    static inline int64 Max() {
+        return static_cast<int64>((~static_cast<uint64>(0u)) >> 1u);
+    }
+    static inline int64 Min() {
+        return (-Max() - 1);
+    }
+};
+
+template<>
+struct MathExpressionBlockTraits<float32> {
+    typedef float32 Wrap;
+    typedef float32 Product;
+    static const bool isExactProduct = true;
+    static const bool isFloat = true;
+    static const bool isSigned = true;
+    static inline bool IsNegative(const float32 x) {
+        return (x < 0.0F);
+    }
+    static inline float32 Max() {
+        return 3.40282347e+38F;
+    }
+    static inline float32 Min() {
+        return -3.40282347e+38F;
+    }
+};
+
+template<>
+struct MathExpressionBlockTraits<float64> {
+    typedef float64 Wrap;
+    typedef float64 Product;
+    static const bool isExactProduct = true;
+    static const bool isFloat = true;
+    static const bool isSigned = true;
+    static inline bool IsNegative(const float64 x) {
+        return (x < 0.0);
+    }
+    static inline float64 Max() {
+        return 1.7976931348623157e+308;
+    }
+    static inline float64 Min() {
+        return -1.7976931348623157e+308;
+    }
+};
+
+/**
+ * @brief Saturating conversion between two integer types (error is set if the value saturates).
+ */
+template<typename To, typename From, bool toFloat, bool fromFloat>
+struct MathExpressionBlockConverter {
+    static inline To Apply(const From x,
+                           bool &error) {
+        To ret;
+        if (MathExpressionBlockTraits<From>::IsNegative(x)) {
+            if (MathExpressionBlockTraits<To>::isSigned) {
+                int64 value = static_cast<int64>(x);
+                if (value < static_cast<int64>(MathExpressionBlockTraits<To>::Min())) {
+                    ret = MathExpressionBlockTraits<To>::Min();
+                    error = true;
+                }
+                else {
+                    ret = static_cast<To>(value);
+                }
+            }
+            else {
+                ret = static_cast<To>(0);
+                error = true;
+            }
+        }
+        else {
+            uint64 value = static_cast<uint64>(x);
+            if (value > static_cast<uint64>(MathExpressionBlockTraits<To>::Max())) {
+                ret = MathExpressionBlockTraits<To>::Max();
+                error = true;
+            }
+            else {
+                ret = static_cast<To>(value);
+            }
+        }
+        return ret;
+    }
+};
+
+/**
+ * @brief Conversion to a floating point type.
+ */
+template<typename To, typename From, bool fromFloat>
+struct MathExpressionBlockConverter<To, From, true, fromFloat> {
+    /*lint -e{715} error is not set: the conversion cannot fail*/
+    static inline To Apply(const From x,
+                           bool &error) {
+        return static_cast<To>(x);
+    }
+};
+
+/**
+ * @brief Saturating conversion from a floating point type to an integer type (NaN is converted to zero).
+ * @details error is set if the value saturates or is NaN.
+ */
+template<typename To, typename From>
+struct MathExpressionBlockConverter<To, From, false, true> {
+    static inline To Apply(const From x,
+                           bool &error) {
+        float64 value = static_cast<float64>(x);
+        To ret;
+        if (value != value) {
+            ret = static_cast<To>(0);
+            error = true;
+        }
+        else if (value >= static_cast<float64>(MathExpressionBlockTraits<To>::Max())) {
+            ret = MathExpressionBlockTraits<To>::Max();
+            error = (value > static_cast<float64>(MathExpressionBlockTraits<To>::Max()));
+        }
+        else if (value <= static_cast<float64>(MathExpressionBlockTraits<To>::Min())) {
+            ret = MathExpressionBlockTraits<To>::Min();
+            error = (value < static_cast<float64>(MathExpressionBlockTraits<To>::Min()));
+        }
+        else {
+            ret = static_cast<To>(value);
+        }
+        return ret;
+    }
+};
+
+/*lint -save -e9117 -e9125 -e9119 -e9114 -e9115 -e776 -e737 -e715 The arithmetic of each type is the one requested by the user expression. The operations that cannot fail do not set error.*/
+/**
+ * @brief ADD operation (saturated for the integer types, setting error).
+ */
+template<typename T>
+struct MathExpressionBlockAdd {
+    typedef T Result;
+    static inline T Apply(const T a,
+                          const T b,
+                          bool &error) {
+        typedef typename MathExpressionBlockTraits<T>::Wrap W;
+        T ret = static_cast<T>(static_cast<W>(a) + static_cast<W>(b));
+        if (!MathExpressionBlockTraits<T>::isFloat) {
+            if (MathExpressionBlockTraits<T>::isSigned) {
+                bool negative = MathExpressionBlockTraits<T>::IsNegative(a);
+                if ((negative == MathExpressionBlockTraits<T>::IsNegative(b)) && (negative != MathExpressionBlockTraits<T>::IsNegative(ret))) {
+                    ret = negative ? (MathExpressionBlockTraits<T>::Min()) : (MathExpressionBlockTraits<T>::Max());
+                    error = true;
+                }
+            }
+            else if (ret < a) {
+                ret = MathExpressionBlockTraits<T>::Max();
+                error = true;
+            }
+            else {
+                //NOOP
+            }
+        }
+        return ret;
+    }
+};
+
+/**
+ * @brief SUB operation (saturated for the integer types, setting error).
+ */
+template<typename T>
+struct MathExpressionBlockSub {
+    typedef T Result;
+    static inline T Apply(const T a,
+                          const T b,
+                          bool &error) {
+        typedef typename MathExpressionBlockTraits<T>::Wrap W;
+        T ret = static_cast<T>(static_cast<W>(a) - static_cast<W>(b));
+        if (!MathExpressionBlockTraits<T>::isFloat) {
+            if (MathExpressionBlockTraits<T>::isSigned) {
+                bool negative = MathExpressionBlockTraits<T>::IsNegative(a);
+                if ((negative != MathExpressionBlockTraits<T>::IsNegative(b)) && (negative != MathExpressionBlockTraits<T>::IsNegative(ret))) {
+                    ret = negative ? (MathExpressionBlockTraits<T>::Min()) : (MathExpressionBlockTraits<T>::Max());
+                    error = true;
+                }
+            }
+            else if (b > a) {
+                ret = MathExpressionBlockTraits<T>::Min();
+                error = true;
+            }
+            else {
+                //NOOP
+            }
+        }
+        return ret;
+    }
+};
+
+/**
+ * @brief MUL operation (saturated for the integer types, setting error).
+ */
+template<typename T>
+struct MathExpressionBlockMul {
+    typedef T Result;
+    static inline T Apply(const T a,
+                          const T b,
+                          bool &error) {
+        typedef typename MathExpressionBlockTraits<T>::Product P;
+        T ret;
+        if (MathExpressionBlockTraits<T>::isFloat) {
+            ret = (a * b);
+        }
+        else if (MathExpressionBlockTraits<T>::isExactProduct) {
+            P product = static_cast<P>(static_cast<P>(a) * static_cast<P>(b));
+            if (product > static_cast<P>(MathExpressionBlockTraits<T>::Max())) {
+                ret = MathExpressionBlockTraits<T>::Max();
+                error = true;
+            }
+            else if (product < static_cast<P>(MathExpressionBlockTraits<T>::Min())) {
+                ret = MathExpressionBlockTraits<T>::Min();
+                error = true;
+            }
+            else {
+                ret = static_cast<T>(product);
+            }
+        }
+        else {
+            //64 bit integers: the product overflows if it cannot be divided back
+            typedef typename MathExpressionBlockTraits<T>::Wrap W;
+            ret = static_cast<T>(static_cast<W>(a) * static_cast<W>(b));
+            bool overflow;
+            if ((MathExpressionBlockTraits<T>::isSigned) && (a == static_cast<T>(-1))) {
+                overflow = (b == MathExpressionBlockTraits<T>::Min());
+            }
+            else {
+                overflow = (a != static_cast<T>(0)) && ((ret / a) != b);
+            }
+            if (overflow) {
+                bool negative = (MathExpressionBlockTraits<T>::IsNegative(a) != MathExpressionBlockTraits<T>::IsNegative(b));
+                ret = negative ? (MathExpressionBlockTraits<T>::Min()) : (MathExpressionBlockTraits<T>::Max());
+                error = true;
+            }
+        }
+        return ret;
+    }
+};
+
+/**
+ * @brief Multiply-add super-instruction: ADD(MUL(a, b), c), with the same result as the two operations.
+ */
+template<typename T>
+struct MathExpressionBlockMulAdd {
+    typedef T Result;
+    static inline T Apply(const T a,
+                          const T b,
+                          const T c,
+                          bool &error) {
+        return MathExpressionBlockAdd<T>::Apply(MathExpressionBlockMul<T>::Apply(a, b, error), c, error);
+    }
+};
+
+/**
+ * @brief DIV operation (for the integer types the division by zero returns zero and sets error).
+ */
+template<typename T>
+struct MathExpressionBlockDiv {
+    typedef T Result;
+    static inline T Apply(const T a,
+                          const T b,
+                          bool &error) {
+        T ret;
+        if (MathExpressionBlockTraits<T>::isFloat) {
+            ret = (a / b);
+        }
+        else if (b == static_cast<T>(0)) {
+            ret = static_cast<T>(0);
+            error = true;
+        }
+        else if ((MathExpressionBlockTraits<T>::isSigned) && (b == static_cast<T>(-1))) {
+            //The minimum value divided by -1 does not fit in the type.
+            ret = MathExpressionBlockSub<T>::Apply(static_cast<T>(0), a, error);
+        }
+        else {
+            ret = static_cast<T>(a / b);
+        }
+        return ret;
+    }
+};
+
+/**
+ * @brief POW operation.
+ */
+template<typename T>
+struct MathExpressionBlockPow {
+    typedef T Result;
+    static inline T Apply(const T a,
+                          const T b,
+                          bool &error) {
+        return static_cast<T>(pow(static_cast<float64>(a), static_cast<float64>(b)));
+    }
+};
+
+/**
+ * @brief SIN operation.
+ */
+template<typename T>
+struct MathExpressionBlockSin {
+    typedef T Result;
+    static inline T Apply(const T a,
+                          bool &error) {
+        return static_cast<T>(sin(static_cast<float64>(a)));
+    }
+};
+
+/**
+ * @brief COS operation.
+ */
+template<typename T>
+struct MathExpressionBlockCos {
+    typedef T Result;
+    static inline T Apply(const T a,
+                          bool &error) {
+        return static_cast<T>(cos(static_cast<float64>(a)));
+    }
+};
+
+/**
+ * @brief AND operation.
+ */
+template<typename T>
+struct MathExpressionBlockAnd {
+    typedef uint8 Result;
+    static inline uint8 Apply(const T a,
+                              const T b,
+                              bool &error) {
+        return static_cast<uint8>(((a != static_cast<T>(0)) ? (1u) : (0u)) & ((b != static_cast<T>(0)) ? (1u) : (0u)));
+    }
+};
+
+/**
+ * @brief OR operation.
+ */
+template<typename T>
+struct MathExpressionBlockOr {
+    typedef uint8 Result;
+    static inline uint8 Apply(const T a,
+                              const T b,
+                              bool &error) {
+        return static_cast<uint8>(((a != static_cast<T>(0)) ? (1u) : (0u)) | ((b != static_cast<T>(0)) ? (1u) : (0u)));
+    }
+};
+
+/**
+ * @brief XOR operation.
+ */
+template<typename T>
+struct MathExpressionBlockXor {
+    typedef uint8 Result;
+    static inline uint8 Apply(const T a,
+                              const T b,
+                              bool &error) {
+        return static_cast<uint8>(((a != static_cast<T>(0)) ? (1u) : (0u)) ^ ((b != static_cast<T>(0)) ? (1u) : (0u)));
+    }
+};
+
+/**
+ * @brief NOT operation.
+ */
+template<typename T>
+struct MathExpressionBlockNot {
+    typedef uint8 Result;
+    static inline uint8 Apply(const T a,
+                              bool &error) {
+        return static_cast<uint8>((a == static_cast<T>(0)) ? (1u) : (0u));
+    }
+};
+
+/**
+ * @brief EQ operation.
+ */
+template<typename T>
+struct MathExpressionBlockEq {
+    typedef uint8 Result;
+    static inline uint8 Apply(const T a,
+                              const T b,
+                              bool &error) {
+        return static_cast<uint8>((a == b) ? (1u) : (0u));
+    }
+};
+
+/**
+ * @brief NEQ operation.
+ */
+template<typename T>
+struct MathExpressionBlockNeq {
+    typedef uint8 Result;
+    static inline uint8 Apply(const T a,
+                              const T b,
+                              bool &error) {
+        return static_cast<uint8>((a != b) ? (1u) : (0u));
+    }
+};
+
+/**
+ * @brief GT operation.
+ */
+template<typename T>
+struct MathExpressionBlockGt {
+    typedef uint8 Result;
+    static inline uint8 Apply(const T a,
+                              const T b,
+                              bool &error) {
+        return static_cast<uint8>((a > b) ? (1u) : (0u));
+    }
+};
+
+/**
+ * @brief LT operation.
+ */
+template<typename T>
+struct MathExpressionBlockLt {
+    typedef uint8 Result;
+    static inline uint8 Apply(const T a,
+                              const T b,
+                              bool &error) {
+        return static_cast<uint8>((a < b) ? (1u) : (0u));
+    }
+};
+
+/**
+ * @brief GTE operation.
+ */
+template<typename T>
+struct MathExpressionBlockGte {
+    typedef uint8 Result;
+    static inline uint8 Apply(const T a,
+                              const T b,
+                              bool &error) {
+        return static_cast<uint8>((a >= b) ? (1u) : (0u));
+    }
+};
+
+/**
+ * @brief LTE operation.
+ */
+template<typename T>
+struct MathExpressionBlockLte {
+    typedef uint8 Result;
+    static inline uint8 Apply(const T a,
+                              const T b,
+                              bool &error) {
+        return static_cast<uint8>((a <= b) ? (1u) : (0u));
+    }
+};
+/*lint -restore*/
+
+/**
+ * @brief Applies a binary operation to numberOfValues elements.
+ * @details strideA (strideB) is 0 if the first (second) operand is a single value used for all the elements.
+ */
+template<typename T, template<typename > class Op, uint32 strideA, uint32 strideB>
+bool MathExpressionBlockBinaryKernel(const MathExpressionBlockInstruction &instruction,
+                                     const uint32 numberOfValues) {
+    typedef typename Op<T>::Result R;
+    const T * const a = static_cast<const T *>(instruction.input[0]);
+    const T * const b = static_cast<const T *>(instruction.input[1]);
+    R * const out = static_cast<R *>(instruction.output);
+    bool error = false;
+    for (uint32 i = 0u; i < numberOfValues; i++) {
+        out[i] = Op<T>::Apply(a[i * strideA], b[i * strideB], error);
+    }
+    return !error;
+}
+
+/**
+ * @brief Applies an unary operation to numberOfValues elements.
+ */
+template<typename T, template<typename > class Op>
+bool MathExpressionBlockUnaryKernel(const MathExpressionBlockInstruction &instruction,
+                                    const uint32 numberOfValues) {
+    typedef typename Op<T>::Result R;
+    const T * const a = static_cast<const T *>(instruction.input[0]);
+    R * const out = static_cast<R *>(instruction.output);
+    bool error = false;
+    for (uint32 i = 0u; i < numberOfValues; i++) {
+        out[i] = Op<T>::Apply(a[i], error);
+    }
+    return !error;
+}
+
+/**
+ * @brief Applies a ternary super-instruction to numberOfValues elements.
+ * @details strideA, strideB and strideC are 0 for the operands that are a single value used for all the elements.
+ */
+template<typename T, template<typename > class Op, uint32 strideA, uint32 strideB, uint32 strideC>
+bool MathExpressionBlockTernaryKernel(const MathExpressionBlockInstruction &instruction,
+                                      const uint32 numberOfValues) {
+    typedef typename Op<T>::Result R;
+    const T * const a = static_cast<const T *>(instruction.input[0]);
+    const T * const b = static_cast<const T *>(instruction.input[1]);
+    const T * const c = static_cast<const T *>(instruction.input[2]);
+    R * const out = static_cast<R *>(instruction.output);
+    bool error = false;
+    for (uint32 i = 0u; i < numberOfValues; i++) {
+        out[i] = Op<T>::Apply(a[i * strideA], b[i * strideB], c[i * strideC], error);
+    }
+    return !error;
+}
+
+/**
+ * @brief Converts numberOfValues elements.
+ */
+template<typename From, typename To>
+bool MathExpressionBlockCastKernel(const MathExpressionBlockInstruction &instruction,
+                                   const uint32 numberOfValues) {
+    const From * const a = static_cast<const From *>(instruction.input[0]);
+    To * const out = static_cast<To *>(instruction.output);
+    bool error = false;
+    for (uint32 i = 0u; i < numberOfValues; i++) {
+        out[i] = MathExpressionBlockConverter<To, From, MathExpressionBlockTraits<To>::isFloat, MathExpressionBlockTraits<From>::isFloat>::Apply(a[i], error);
+    }
+    return !error;
+}
+
+/**
+ * @brief Copies numberOfValues elements (READ and WRITE).
+ */
+template<typename T>
+bool MathExpressionBlockCopyKernel(const MathExpressionBlockInstruction &instruction,
+                                   const uint32 numberOfValues) {
+    (void) MemoryOperationsHelper::Copy(instruction.output, instruction.input[0], static_cast<uint32>(numberOfValues * sizeof(T)));
+    return true;
+}
+
+/**
+ * @brief Sets numberOfValues elements to a single value (READ of a scalar signal, CONST and WRITE of a single value).
+ */
+template<typename T>
+bool MathExpressionBlockBroadcastKernel(const MathExpressionBlockInstruction &instruction,
+                                        const uint32 numberOfValues) {
+    const T value = *static_cast<const T *>(instruction.input[0]);
+    T * const out = static_cast<T *>(instruction.output);
+    for (uint32 i = 0u; i < numberOfValues; i++) {
+        out[i] = value;
+    }
+    return true;
+}
+
+/**
+ * Both the operands of a binary kernel have numberOfValues elements (or both have one).
+ */
+static const uint32 MATH_EXPRESSION_BLOCK_VECTOR_VECTOR = 0u;
+
+/**
+ * The second operand of a binary kernel is a single value.
+ */
+static const uint32 MATH_EXPRESSION_BLOCK_VECTOR_SCALAR = 1u;
+
+/**
+ * The first operand of a binary kernel is a single value.
+ */
+static const uint32 MATH_EXPRESSION_BLOCK_SCALAR_VECTOR = 2u;
+
+/**
+ * @brief Selects the variant of a binary kernel for the operands layout.
+ */
+template<typename T, template<typename > class Op>
+MathExpressionBlockKernel MathExpressionBlockBinaryVariant(const uint32 variant) {
+    MathExpressionBlockKernel kernel;
+    if (variant == MATH_EXPRESSION_BLOCK_VECTOR_SCALAR) {
+        kernel = &MathExpressionBlockBinaryKernel<T, Op, 1u, 0u>;
+    }
+    else if (variant == MATH_EXPRESSION_BLOCK_SCALAR_VECTOR) {
+        kernel = &MathExpressionBlockBinaryKernel<T, Op, 0u, 1u>;
+    }
+    else {
+        kernel = &MathExpressionBlockBinaryKernel<T, Op, 1u, 1u>;
+    }
+    return kernel;
+}
+
+/**
+ * @brief Selects the variant of a ternary kernel for the operands layout.
+ * @param[in] scalars bit 0, 1 and 2 are set if the first, second and third operand are a single value.
+ */
+template<typename T, template<typename > class Op>
+MathExpressionBlockKernel MathExpressionBlockTernaryVariant(const uint32 scalars) {
+    MathExpressionBlockKernel kernel;
+    if (scalars == 1u) {
+        kernel = &MathExpressionBlockTernaryKernel<T, Op, 0u, 1u, 1u>;
+    }
+    else if (scalars == 2u) {
+        kernel = &MathExpressionBlockTernaryKernel<T, Op, 1u, 0u, 1u>;
+    }
+    else if (scalars == 3u) {
+        kernel = &MathExpressionBlockTernaryKernel<T, Op, 0u, 0u, 1u>;
+    }
+    else if (scalars == 4u) {
+        kernel = &MathExpressionBlockTernaryKernel<T, Op, 1u, 1u, 0u>;
+    }
+    else if (scalars == 5u) {
+        kernel = &MathExpressionBlockTernaryKernel<T, Op, 0u, 1u, 0u>;
+    }
+    else if (scalars == 6u) {
+        kernel = &MathExpressionBlockTernaryKernel<T, Op, 1u, 0u, 0u>;
+    }
+    else {
+        //All vectors or all single values
+        kernel = &MathExpressionBlockTernaryKernel<T, Op, 1u, 1u, 1u>;
+    }
+    return kernel;
+}
+
+/**
+ * @brief Selects the kernel of a binary operation for any numeric type.
+ */
+template<template<typename > class Op>
+MathExpressionBlockKernel MathExpressionBlockSelectBinary(const TypeDescriptor &type,
+                                                          const uint32 variant) {
+    MathExpressionBlockKernel kernel = NULL_PTR(MathExpressionBlockKernel);
+    if (type == UnsignedInteger8Bit) {
+        kernel = MathExpressionBlockBinaryVariant<uint8, Op>(variant);
+    }
+    else if (type == SignedInteger8Bit) {
+        kernel = MathExpressionBlockBinaryVariant<int8, Op>(variant);
+    }
+    else if (type == UnsignedInteger16Bit) {
+        kernel = MathExpressionBlockBinaryVariant<uint16, Op>(variant);
+    }
+    else if (type == SignedInteger16Bit) {
+        kernel = MathExpressionBlockBinaryVariant<int16, Op>(variant);
+    }
+    else if (type == UnsignedInteger32Bit) {
+        kernel = MathExpressionBlockBinaryVariant<uint32, Op>(variant);
+    }
+    else if (type == SignedInteger32Bit) {
+        kernel = MathExpressionBlockBinaryVariant<int32, Op>(variant);
+    }
+    else if (type == UnsignedInteger64Bit) {
+        kernel = MathExpressionBlockBinaryVariant<uint64, Op>(variant);
+    }
+    else if (type == SignedInteger64Bit) {
+        kernel = MathExpressionBlockBinaryVariant<int64, Op>(variant);
+    }
+    else if (type == Float32Bit) {
+        kernel = MathExpressionBlockBinaryVariant<float32, Op>(variant);
+    }
+    else if (type == Float64Bit) {
+        kernel = MathExpressionBlockBinaryVariant<float64, Op>(variant);
+    }
+    else {
+        //NOOP
+    }
+    return kernel;
+}
+
+/**
+ * @brief Selects the kernel of an unary operation for any numeric type.
+ */
+template<template<typename > class Op>
+MathExpressionBlockKernel MathExpressionBlockSelectUnary(const TypeDescriptor &type,
+                                                         const uint32 variant) {
+    MathExpressionBlockKernel kernel = NULL_PTR(MathExpressionBlockKernel);
+    (void) variant;
+    if (type == UnsignedInteger8Bit) {
+        kernel = &MathExpressionBlockUnaryKernel<uint8, Op>;
+    }
+    else if (type == SignedInteger8Bit) {
+        kernel = &MathExpressionBlockUnaryKernel<int8, Op>;
+    }
+    else if (type == UnsignedInteger16Bit) {
+        kernel = &MathExpressionBlockUnaryKernel<uint16, Op>;
+    }
+    else if (type == SignedInteger16Bit) {
+        kernel = &MathExpressionBlockUnaryKernel<int16, Op>;
+    }
+    else if (type == UnsignedInteger32Bit) {
+        kernel = &MathExpressionBlockUnaryKernel<uint32, Op>;
+    }
+    else if (type == SignedInteger32Bit) {
+        kernel = &MathExpressionBlockUnaryKernel<int32, Op>;
+    }
+    else if (type == UnsignedInteger64Bit) {
+        kernel = &MathExpressionBlockUnaryKernel<uint64, Op>;
+    }
+    else if (type == SignedInteger64Bit) {
+        kernel = &MathExpressionBlockUnaryKernel<int64, Op>;
+    }
+    else if (type == Float32Bit) {
+        kernel = &MathExpressionBlockUnaryKernel<float32, Op>;
+    }
+    else if (type == Float64Bit) {
+        kernel = &MathExpressionBlockUnaryKernel<float64, Op>;
+    }
+    else {
+        //NOOP
+    }
+    return kernel;
+}
+
+/**
+ * @brief Selects the kernel of a binary operation that is only defined for floating point types.
+ */
+template<template<typename > class Op>
+MathExpressionBlockKernel MathExpressionBlockSelectFloatBinary(const TypeDescriptor &type,
+                                                               const uint32 variant) {
+    MathExpressionBlockKernel kernel = NULL_PTR(MathExpressionBlockKernel);
+    if (type == Float32Bit) {
+        kernel = MathExpressionBlockBinaryVariant<float32, Op>(variant);
+    }
+    else if (type == Float64Bit) {
+        kernel = MathExpressionBlockBinaryVariant<float64, Op>(variant);
+    }
+    else {
+        //NOOP
+    }
+    return kernel;
+}
+
+/**
+ * @brief Selects the kernel of an unary operation that is only defined for floating point types.
+ */
+template<template<typename > class Op>
+MathExpressionBlockKernel MathExpressionBlockSelectFloatUnary(const TypeDescriptor &type,
+                                                              const uint32 variant) {
+    MathExpressionBlockKernel kernel = NULL_PTR(MathExpressionBlockKernel);
+    (void) variant;
+    if (type == Float32Bit) {
+        kernel = &MathExpressionBlockUnaryKernel<float32, Op>;
+    }
+    else if (type == Float64Bit) {
+        kernel = &MathExpressionBlockUnaryKernel<float64, Op>;
+    }
+    else {
+        //NOOP
+    }
+    return kernel;
+}
+
+/**
+ * @brief Selects the kernel of a ternary super-instruction for any numeric type.
+ */
+template<template<typename > class Op>
+MathExpressionBlockKernel MathExpressionBlockSelectTernary(const TypeDescriptor &type,
+                                                           const uint32 scalars) {
+    MathExpressionBlockKernel kernel = NULL_PTR(MathExpressionBlockKernel);
+    if (type == UnsignedInteger8Bit) {
+        kernel = MathExpressionBlockTernaryVariant<uint8, Op>(scalars);
+    }
+    else if (type == SignedInteger8Bit) {
+        kernel = MathExpressionBlockTernaryVariant<int8, Op>(scalars);
+    }
+    else if (type == UnsignedInteger16Bit) {
+        kernel = MathExpressionBlockTernaryVariant<uint16, Op>(scalars);
+    }
+    else if (type == SignedInteger16Bit) {
+        kernel = MathExpressionBlockTernaryVariant<int16, Op>(scalars);
+    }
+    else if (type == UnsignedInteger32Bit) {
+        kernel = MathExpressionBlockTernaryVariant<uint32, Op>(scalars);
+    }
+    else if (type == SignedInteger32Bit) {
+        kernel = MathExpressionBlockTernaryVariant<int32, Op>(scalars);
+    }
+    else if (type == UnsignedInteger64Bit) {
+        kernel = MathExpressionBlockTernaryVariant<uint64, Op>(scalars);
+    }
+    else if (type == SignedInteger64Bit) {
+        kernel = MathExpressionBlockTernaryVariant<int64, Op>(scalars);
+    }
+    else if (type == Float32Bit) {
+        kernel = MathExpressionBlockTernaryVariant<float32, Op>(scalars);
+    }
+    else if (type == Float64Bit) {
+        kernel = MathExpressionBlockTernaryVariant<float64, Op>(scalars);
+    }
+    else {
+        //NOOP
+    }
+    return kernel;
+}
+
+/**
+ * @brief Selects the conversion kernel from the type From.
+ */
+template<typename From>
+MathExpressionBlockKernel MathExpressionBlockSelectCastFrom(const TypeDescriptor &to) {
+    MathExpressionBlockKernel kernel = NULL_PTR(MathExpressionBlockKernel);
+    if (to == UnsignedInteger8Bit) {
+        kernel = &MathExpressionBlockCastKernel<From, uint8>;
+    }
+    else if (to == SignedInteger8Bit) {
+        kernel = &MathExpressionBlockCastKernel<From, int8>;
+    }
+    else if (to == UnsignedInteger16Bit) {
+        kernel = &MathExpressionBlockCastKernel<From, uint16>;
+    }
+    else if (to == SignedInteger16Bit) {
+        kernel = &MathExpressionBlockCastKernel<From, int16>;
+    }
+    else if (to == UnsignedInteger32Bit) {
+        kernel = &MathExpressionBlockCastKernel<From, uint32>;
+    }
+    else if (to == SignedInteger32Bit) {
+        kernel = &MathExpressionBlockCastKernel<From, int32>;
+    }
+    else if (to == UnsignedInteger64Bit) {
+        kernel = &MathExpressionBlockCastKernel<From, uint64>;
+    }
+    else if (to == SignedInteger64Bit) {
+        kernel = &MathExpressionBlockCastKernel<From, int64>;
+    }
+    else if (to == Float32Bit) {
+        kernel = &MathExpressionBlockCastKernel<From, float32>;
+    }
+    else if (to == Float64Bit) {
+        kernel = &MathExpressionBlockCastKernel<From, float64>;
+    }
+    else {
+        //NOOP
+    }
+    return kernel;
+}
+
+/**
+ * @brief Selects the conversion kernel between two numeric types.
+ */
+static MathExpressionBlockKernel MathExpressionBlockSelectCast(const TypeDescriptor &from,
+                                                               const TypeDescriptor &to) {
+    MathExpressionBlockKernel kernel = NULL_PTR(MathExpressionBlockKernel);
+    if (from == UnsignedInteger8Bit) {
+        kernel = MathExpressionBlockSelectCastFrom<uint8>(to);
+    }
+    else if (from == SignedInteger8Bit) {
+        kernel = MathExpressionBlockSelectCastFrom<int8>(to);
+    }
+    else if (from == UnsignedInteger16Bit) {
+        kernel = MathExpressionBlockSelectCastFrom<uint16>(to);
+    }
+    else if (from == SignedInteger16Bit) {
+        kernel = MathExpressionBlockSelectCastFrom<int16>(to);
+    }
+    else if (from == UnsignedInteger32Bit) {
+        kernel = MathExpressionBlockSelectCastFrom<uint32>(to);
+    }
+    else if (from == SignedInteger32Bit) {
+        kernel = MathExpressionBlockSelectCastFrom<int32>(to);
+    }
+    else if (from == UnsignedInteger64Bit) {
+        kernel = MathExpressionBlockSelectCastFrom<uint64>(to);
+    }
+    else if (from == SignedInteger64Bit) {
+        kernel = MathExpressionBlockSelectCastFrom<int64>(to);
+    }
+    else if (from == Float32Bit) {
+        kernel = MathExpressionBlockSelectCastFrom<float32>(to);
+    }
+    else if (from == Float64Bit) {
+        kernel = MathExpressionBlockSelectCastFrom<float64>(to);
+    }
+    else {
+        //NOOP
+    }
+    return kernel;
+}
+
+/**
+ * @brief Selects the copy (or broadcast) kernel, which only depends on the size of the type.
+ */
+static MathExpressionBlockKernel MathExpressionBlockSelectCopy(const TypeDescriptor &type,
+                                                               const bool broadcast) {
+    MathExpressionBlockKernel kernel = NULL_PTR(MathExpressionBlockKernel);
+    if (type.numberOfBits == 8u) {
+        kernel = broadcast ? (&MathExpressionBlockBroadcastKernel<uint8>) : (&MathExpressionBlockCopyKernel<uint8>);
+    }
+    else if (type.numberOfBits == 16u) {
+        kernel = broadcast ? (&MathExpressionBlockBroadcastKernel<uint16>) : (&MathExpressionBlockCopyKernel<uint16>);
+    }
+    else if (type.numberOfBits == 32u) {
+        kernel = broadcast ? (&MathExpressionBlockBroadcastKernel<uint32>) : (&MathExpressionBlockCopyKernel<uint32>);
+    }
+    else if (type.numberOfBits == 64u) {
+        kernel = broadcast ? (&MathExpressionBlockBroadcastKernel<uint64>) : (&MathExpressionBlockCopyKernel<uint64>);
+    }
+    else {
+        //NOOP
+    }
+    return kernel;
+}
+
+/**
+ * @brief Checks if the type is one of the numeric types supported by the evaluator.
+ */
+static bool MathExpressionBlockIsNumeric(const TypeDescriptor &type) {
+    return ((type == UnsignedInteger8Bit) || (type == SignedInteger8Bit) || (type == UnsignedInteger16Bit) || (type == SignedInteger16Bit)
+            || (type == UnsignedInteger32Bit) || (type == SignedInteger32Bit) || (type == UnsignedInteger64Bit) || (type == SignedInteger64Bit)
+            || (type == Float32Bit) || (type == Float64Bit));
+}
+
+/**
+ * @brief A function of the stack machine.
+ */
+struct MathExpressionBlockFunction {
+    /**
+     * The opcode.
+     */
+    const char8 *name;
+    /**
+     * The number of operands (1 or 2).
+     */
+    uint32 numberOfInputs;
+    /**
+     * True if the result is a uint8 boolean instead of the operands type.
+     */
+    bool booleanResult;
+    /**
+     * Selects the kernel for the operands type and layout (NULL if the type is not supported).
+     */
+    MathExpressionBlockKernel (*select)(const TypeDescriptor &type,
+                                        const uint32 variant);
+};
+
+/**
+ * The functions supported by the MathExpressionBlockEvaluator.
+ */
+static const MathExpressionBlockFunction mathExpressionBlockFunctions[] = {
+        { "ADD", 2u, false, &MathExpressionBlockSelectBinary<MathExpressionBlockAdd> },
+        { "SUB", 2u, false, &MathExpressionBlockSelectBinary<MathExpressionBlockSub> },
+        { "MUL", 2u, false, &MathExpressionBlockSelectBinary<MathExpressionBlockMul> },
+        { "DIV", 2u, false, &MathExpressionBlockSelectBinary<MathExpressionBlockDiv> },
+        { "POW", 2u, false, &MathExpressionBlockSelectFloatBinary<MathExpressionBlockPow> },
+        { "SIN", 1u, false, &MathExpressionBlockSelectFloatUnary<MathExpressionBlockSin> },
+        { "COS", 1u, false, &MathExpressionBlockSelectFloatUnary<MathExpressionBlockCos> },
+        { "AND", 2u, true, &MathExpressionBlockSelectBinary<MathExpressionBlockAnd> },
+        { "OR", 2u, true, &MathExpressionBlockSelectBinary<MathExpressionBlockOr> },
+        { "XOR", 2u, true, &MathExpressionBlockSelectBinary<MathExpressionBlockXor> },
+        { "NOT", 1u, true, &MathExpressionBlockSelectUnary<MathExpressionBlockNot> },
+        { "EQ", 2u, true, &MathExpressionBlockSelectBinary<MathExpressionBlockEq> },
+        { "NEQ", 2u, true, &MathExpressionBlockSelectBinary<MathExpressionBlockNeq> },
+        { "GT", 2u, true, &MathExpressionBlockSelectBinary<MathExpressionBlockGt> },
+        { "LT", 2u, true, &MathExpressionBlockSelectBinary<MathExpressionBlockLt> },
+        { "GTE", 2u, true, &MathExpressionBlockSelectBinary<MathExpressionBlockGte> },
+        { "LTE", 2u, true, &MathExpressionBlockSelectBinary<MathExpressionBlockLte> } };
+
+/**
+ * Number of entries in mathExpressionBlockFunctions.
+ */
+static const uint32 MATH_EXPRESSION_BLOCK_NUMBER_OF_FUNCTIONS = static_cast<uint32>(sizeof(mathExpressionBlockFunctions) / sizeof(MathExpressionBlockFunction));
+
+/**
+ * @brief Reads the next whitespace separated token of the stack machine expression.
+ * @param[in] expression the stack machine expression.
+ * @param[in,out] position the position where to start searching, updated to the end of the token.
+ * @param[out] token the token.
+ * @return true if a token was found.
+ */
+static bool MathExpressionBlockGetToken(const char8 * const expression,
+                                        uint32 &position,
+                                        StreamString &token) {
+    token = "";
+    while ((expression[position] == ' ') || (expression[position] == '\t') || (expression[position] == '\n') || (expression[position] == '\r')) {
+        position++;
+    }
+    while ((expression[position] != '\0') && (expression[position] != ' ') && (expression[position] != '\t') && (expression[position] != '\n')
+            && (expression[position] != '\r')) {
+        token += expression[position];
+        position++;
+    }
+    return (token.Size() > 0u);
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+MathExpressionBlockEvaluator::MathExpressionBlockEvaluator() {
+    variables = NULL_PTR(BlockVariable *);
+    numberOfInputs = 0u;
+    numberOfOutputs = 0u;
+    numberOfVariables = 0u;
+    maxNumberOfVariables = 0u;
+    instructions = NULL_PTR(MathExpressionBlockInstruction *);
+    numberOfInstructions = 0u;
+    maxNumberOfInstructions = 0u;
+    buffers = NULL_PTR(uint8 *);
+    numberOfBuffers = 0u;
+    bufferInUse = NULL_PTR(bool *);
+    constants = NULL_PTR(uint8 *);
+    numberOfConstants = 0u;
+    stack = NULL_PTR(BlockOperand *);
+    depth = 0u;
+    optimise = false;
+    fusableInstruction = -1;
+    fusableScalars = 0u;
+    blockSize = 0u;
+}
+
+/*lint -e{1551} no exception thrown while freeing the memory*/
+MathExpressionBlockEvaluator::~MathExpressionBlockEvaluator() {
+    Clean();
+    if (variables != NULL_PTR(BlockVariable *)) {
+        delete[] variables;
+        variables = NULL_PTR(BlockVariable *);
+    }
+}
+
+void MathExpressionBlockEvaluator::Clean() {
+    if (variables != NULL_PTR(BlockVariable *)) {
+        for (uint32 i = 0u; i < numberOfVariables; i++) {
+            if (variables[i].isInternal) {
+                delete[] static_cast<uint8 *>(variables[i].memory);
+                variables[i].memory = NULL_PTR(void *);
+                variables[i].isInternal = false;
+            }
+            variables[i].isReadable = variables[i].isInput;
+            variables[i].isUsed = false;
+            variables[i].constant = -1;
+        }
+        numberOfVariables = (numberOfInputs + numberOfOutputs);
+    }
+    if (instructions != NULL_PTR(MathExpressionBlockInstruction *)) {
+        delete[] instructions;
+        instructions = NULL_PTR(MathExpressionBlockInstruction *);
+    }
+    if (buffers != NULL_PTR(uint8 *)) {
+        delete[] buffers;
+        buffers = NULL_PTR(uint8 *);
+    }
+    if (bufferInUse != NULL_PTR(bool *)) {
+        delete[] bufferInUse;
+        bufferInUse = NULL_PTR(bool *);
+    }
+    if (constants != NULL_PTR(uint8 *)) {
+        delete[] constants;
+        constants = NULL_PTR(uint8 *);
+    }
+    if (stack != NULL_PTR(BlockOperand *)) {
+        delete[] stack;
+        stack = NULL_PTR(BlockOperand *);
+    }
+    numberOfInstructions = 0u;
+    numberOfBuffers = 0u;
+    numberOfConstants = 0u;
+    depth = 0u;
+    fusableInstruction = -1;
+}
+
+bool MathExpressionBlockEvaluator::Initialise(const uint32 nOfInputs,
+                                              const uint32 nOfOutputs) {
+    bool ok = (variables == NULL_PTR(BlockVariable *));
+    if (ok) {
+        numberOfInputs = nOfInputs;
+        numberOfOutputs = nOfOutputs;
+        numberOfVariables = (nOfInputs + nOfOutputs);
+        maxNumberOfVariables = numberOfVariables;
+        if (maxNumberOfVariables > 0u) {
+            variables = new BlockVariable[maxNumberOfVariables];
+            for (uint32 i = 0u; i < maxNumberOfVariables; i++) {
+                variables[i].type = InvalidType;
+                variables[i].memory = NULL_PTR(void *);
+                variables[i].numberOfValues = 0u;
+                variables[i].isInput = (i < nOfInputs);
+                variables[i].isReadable = (i < nOfInputs);
+                variables[i].isInternal = false;
+                variables[i].isUsed = false;
+                variables[i].constant = -1;
+            }
+        }
+    }
+    return ok;
+}
+
+bool MathExpressionBlockEvaluator::SetInput(const uint32 index,
+                                            const char8 * const name,
+                                            const TypeDescriptor &type,
+                                            const void * const memory,
+                                            const uint32 numberOfValues) {
+    bool ok = ((index < numberOfInputs) && (instructions == NULL_PTR(MathExpressionBlockInstruction *)));
+    if (ok) {
+        ok = (MathExpressionBlockIsNumeric(type) && (numberOfValues > 0u) && (memory != NULL_PTR(const void *)));
+    }
+    if (ok) {
+        /*lint -e{613} variables != NULL if index < numberOfInputs*/
+        BlockVariable &variable = variables[index];
+        variable.name = name;
+        variable.type = type;
+        variable.memory = const_cast<void *>(memory);
+        variable.numberOfValues = numberOfValues;
+    }
+    return ok;
+}
+
+bool MathExpressionBlockEvaluator::SetOutput(const uint32 index,
+                                             const char8 * const name,
+                                             const TypeDescriptor &type,
+                                             void * const memory,
+                                             const uint32 numberOfValues) {
+    bool ok = ((index < numberOfOutputs) && (instructions == NULL_PTR(MathExpressionBlockInstruction *)));
+    if (ok) {
+        ok = (MathExpressionBlockIsNumeric(type) && (numberOfValues > 0u) && (memory != NULL_PTR(void *)));
+    }
+    if (ok) {
+        /*lint -e{613} variables != NULL if index < numberOfOutputs*/
+        BlockVariable &variable = variables[numberOfInputs + index];
+        variable.name = name;
+        variable.type = type;
+        variable.memory = memory;
+        variable.numberOfValues = numberOfValues;
+    }
+    return ok;
+}
+
+uint32 MathExpressionBlockEvaluator::FindVariable(const StreamString &name) const {
+    uint32 found = numberOfVariables;
+    for (uint32 i = 0u; (i < numberOfVariables) && (found == numberOfVariables); i++) {
+        /*lint -e{613} variables != NULL if numberOfVariables > 0*/
+        if (variables[i].name == name) {
+            found = i;
+        }
+    }
+    return found;
+}
+
+uint32 MathExpressionBlockEvaluator::AcquireBuffer() {
+    uint32 index = 0u;
+    /*lint -e{613} bufferInUse is allocated by Compile before any call*/
+    while ((index < numberOfBuffers) && (bufferInUse[index])) {
+        index++;
+    }
+    if (index == numberOfBuffers) {
+        numberOfBuffers++;
+    }
+    /*lint -e{613} bufferInUse is allocated by Compile before any call*/
+    bufferInUse[index] = true;
+    return index;
+}
+
+void MathExpressionBlockEvaluator::ReleaseOperand(const BlockOperand &operand) {
+    if (operand.buffer >= 0) {
+        /*lint -e{613} bufferInUse is allocated by Compile before any call*/
+        bufferInUse[operand.buffer] = false;
+    }
+}
+
+MathExpressionBlockInstruction &MathExpressionBlockEvaluator::AddInstruction(const MathExpressionBlockKernel kernel,
+                                                                             const uint32 nOfValues) {
+    /*lint -e{613} instructions is allocated by Compile with one instruction per token*/
+    MathExpressionBlockInstruction &instruction = instructions[numberOfInstructions];
+    numberOfInstructions++;
+    instruction.kernel = kernel;
+    instruction.output = NULL_PTR(void *);
+    for (uint32 i = 0u; i < 3u; i++) {
+        instruction.input[i] = NULL_PTR(const void *);
+    }
+    for (uint32 i = 0u; i < 4u; i++) {
+        instruction.buffer[i] = -1;
+    }
+    instruction.numberOfValues = nOfValues;
+    fusableInstruction = -1;
+    return instruction;
+}
+
+void MathExpressionBlockEvaluator::BindOperand(MathExpressionBlockInstruction &instruction,
+                                               const uint32 index,
+                                               const BlockOperand &operand) {
+    if (operand.buffer >= 0) {
+        instruction.buffer[index + 1u] = operand.buffer;
+    }
+    else {
+        instruction.input[index] = operand.address;
+    }
+}
+
+MathExpressionBlockInstruction &MathExpressionBlockEvaluator::PushResult(const MathExpressionBlockKernel kernel,
+                                                                         const TypeDescriptor &type,
+                                                                         const bool isScalar) {
+    uint32 out = AcquireBuffer();
+    MathExpressionBlockInstruction &instruction = AddInstruction(kernel, isScalar ? (1u) : (blockSize));
+    instruction.buffer[0] = static_cast<int32>(out);
+    /*lint -e{613} stack is allocated by Compile with one entry per token*/
+    BlockOperand &operand = stack[depth];
+    depth++;
+    operand.type = type;
+    operand.address = NULL_PTR(const void *);
+    operand.buffer = static_cast<int32>(out);
+    operand.producer = static_cast<int32>(numberOfInstructions - 1u);
+    operand.variable = -1;
+    operand.constant = -1;
+    operand.isScalar = isScalar;
+    return instruction;
+}
+
+void MathExpressionBlockEvaluator::PushConstant(const uint32 constant,
+                                                const TypeDescriptor &type) {
+    /*lint -e{613} stack is allocated by Compile with one entry per token*/
+    BlockOperand &operand = stack[depth];
+    depth++;
+    operand.type = type;
+    /*lint -e{613} constants is allocated by Compile with one constant per token*/
+    operand.address = &constants[constant * MATH_EXPRESSION_BLOCK_VALUE_SIZE];
+    operand.buffer = -1;
+    operand.producer = -1;
+    operand.variable = -1;
+    operand.constant = static_cast<int32>(constant);
+    operand.isScalar = true;
+}
+
+void MathExpressionBlockEvaluator::Materialise(const uint32 position) {
+    /*lint -e{613} stack is allocated by Compile with one entry per token*/
+    BlockOperand operand = stack[position];
+    if (operand.buffer < 0) {
+        uint32 top = depth;
+        depth = position;
+        MathExpressionBlockInstruction &instruction = PushResult(MathExpressionBlockSelectCopy(operand.type, false), operand.type, operand.isScalar);
+        BindOperand(instruction, 0u, operand);
+        depth = top;
+    }
+}
+
+bool MathExpressionBlockEvaluator::CompileRead(const StreamString &name) {
+    uint32 v = FindVariable(name);
+    bool ok = (v < numberOfVariables);
+    if (ok) {
+        /*lint -e{613} variables != NULL if ok*/
+        ok = variables[v].isReadable;
+    }
+    if (ok) {
+        /*lint -e{613} variables != NULL if ok*/
+        BlockVariable &variable = variables[v];
+        variable.isUsed = true;
+        if (!optimise) {
+            //Copy (or broadcast) to a work buffer
+            MathExpressionBlockInstruction &instruction = PushResult(MathExpressionBlockSelectCopy(variable.type, (variable.numberOfValues != blockSize)),
+                                                                     variable.type, (blockSize == 1u));
+            instruction.input[0] = variable.memory;
+        }
+        else if (variable.constant >= 0) {
+            PushConstant(static_cast<uint32>(variable.constant), variable.type);
+        }
+        else {
+            //Operate directly on the variable memory
+            /*lint -e{613} stack is allocated by Compile with one entry per token*/
+            BlockOperand &operand = stack[depth];
+            depth++;
+            operand.type = variable.type;
+            operand.address = variable.memory;
+            operand.buffer = -1;
+            operand.producer = -1;
+            operand.variable = static_cast<int32>(v);
+            operand.constant = -1;
+            operand.isScalar = (variable.numberOfValues == 1u);
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "Variable %s is not an input signal and was not previously written", name.Buffer());
+    }
+    return ok;
+}
+
+/*lint -e{429} the internal variables memory is freed by Clean()*/
+bool MathExpressionBlockEvaluator::CompileWrite(const StreamString &name) {
+    bool ok = (depth > 0u);
+    uint32 v = numberOfVariables;
+    if (ok) {
+        v = FindVariable(name);
+        if (v == numberOfVariables) {
+            //Internal variable
+            ok = (numberOfVariables < maxNumberOfVariables);
+            if (ok) {
+                /*lint -e{613} variables != NULL if ok*/
+                BlockVariable &variable = variables[numberOfVariables];
+                variable.name = name;
+                /*lint -e{613} stack != NULL if depth > 0*/
+                variable.type = stack[depth - 1u].type;
+                variable.memory = new uint8[blockSize * MATH_EXPRESSION_BLOCK_VALUE_SIZE];
+                variable.numberOfValues = blockSize;
+                variable.isInternal = true;
+                variable.constant = -1;
+                numberOfVariables++;
+            }
+        }
+    }
+    if (ok) {
+        /*lint -e{613} variables != NULL if ok*/
+        BlockVariable &variable = variables[v];
+        /*lint -e{613} stack != NULL if depth > 0*/
+        const BlockOperand value = stack[depth - 1u];
+        ok = !variable.isInput;
+        if (ok) {
+            ok = (variable.type == value.type);
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "Cannot write a %s value to the %s variable %s (use a cast)",
+                                    TypeDescriptor::GetTypeNameFromTypeDescriptor(value.type), TypeDescriptor::GetTypeNameFromTypeDescriptor(variable.type),
+                                    name.Buffer());
+            }
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "Cannot write the input variable %s", name.Buffer());
+        }
+        if (ok) {
+            depth--;
+            //The values below in the stack that read the variable must keep the old value
+            for (uint32 i = 0u; i < depth; i++) {
+                /*lint -e{613} stack != NULL if ok*/
+                if (stack[i].variable == static_cast<int32>(v)) {
+                    Materialise(i);
+                }
+            }
+            variable.isReadable = true;
+            variable.isUsed = true;
+            variable.constant = -1;
+            bool lastResult = (value.producer >= 0) && (static_cast<uint32>(value.producer) == (numberOfInstructions - 1u));
+            if ((optimise) && (value.constant >= 0) && (variable.isInternal)) {
+                //Replaced by the constant in the following READ
+                variable.constant = value.constant;
+            }
+            else if ((optimise) && (lastResult) && ((!value.isScalar) || (blockSize == 1u))) {
+                //Store the result of the last instruction directly in the variable
+                /*lint -e{613} instructions != NULL if lastResult*/
+                MathExpressionBlockInstruction &instruction = instructions[value.producer];
+                instruction.output = variable.memory;
+                instruction.buffer[0] = -1;
+                fusableInstruction = -1;
+            }
+            else {
+                bool broadcast = (value.isScalar) && (blockSize > 1u);
+                MathExpressionBlockInstruction &instruction = AddInstruction(MathExpressionBlockSelectCopy(variable.type, broadcast),
+                                                                             broadcast ? (blockSize) : ((value.isScalar) ? (1u) : (blockSize)));
+                instruction.output = variable.memory;
+                BindOperand(instruction, 0u, value);
+            }
+            ReleaseOperand(value);
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "Invalid WRITE %s", name.Buffer());
+    }
+    return ok;
+}
+
+bool MathExpressionBlockEvaluator::CompileConstant(const StreamString &typeName,
+                                                   const StreamString &value) {
+    TypeDescriptor type = TypeDescriptor::GetTypeDescriptorFromTypeName(typeName.Buffer());
+    bool ok = MathExpressionBlockIsNumeric(type);
+    if (ok) {
+        /*lint -e{613} constants != NULL if ok*/
+        void *constant = &constants[numberOfConstants * MATH_EXPRESSION_BLOCK_VALUE_SIZE];
+        AnyType destination(type, 0u, constant);
+        StreamString valueString = value;
+        AnyType source(valueString);
+        ok = TypeConvert(destination, source);
+        if (ok) {
+            if (optimise) {
+                PushConstant(numberOfConstants, type);
+            }
+            else {
+                MathExpressionBlockInstruction &instruction = PushResult(MathExpressionBlockSelectCopy(type, (blockSize > 1u)), type, (blockSize == 1u));
+                instruction.input[0] = constant;
+            }
+            numberOfConstants++;
+        }
+    }
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "Invalid constant %s %s", typeName.Buffer(), value.Buffer());
+    }
+    return ok;
+}
+
+bool MathExpressionBlockEvaluator::CompileCast(const StreamString &typeName) {
+    TypeDescriptor type = TypeDescriptor::GetTypeDescriptorFromTypeName(typeName.Buffer());
+    bool ok = (MathExpressionBlockIsNumeric(type) && (depth > 0u));
+    if (ok) {
+        /*lint -e{613} stack != NULL if depth > 0*/
+        const BlockOperand value = stack[depth - 1u];
+        if (value.type != type) {
+            MathExpressionBlockKernel kernel = MathExpressionBlockSelectCast(value.type, type);
+            depth--;
+            ReleaseOperand(value);
+            bool isFolded = false;
+            if ((optimise) && (value.constant >= 0)) {
+                //Constant folding (a saturating cast is not folded, so that Execute() reports it)
+                MathExpressionBlockInstruction folded;
+                /*lint -e{613} constants != NULL if optimise*/
+                folded.output = &constants[numberOfConstants * MATH_EXPRESSION_BLOCK_VALUE_SIZE];
+                folded.input[0] = value.address;
+                isFolded = kernel(folded, 1u);
+                if (isFolded) {
+                    PushConstant(numberOfConstants, type);
+                    numberOfConstants++;
+                }
+            }
+            if (!isFolded) {
+                MathExpressionBlockInstruction &instruction = PushResult(kernel, type, value.isScalar);
+                BindOperand(instruction, 0u, value);
+            }
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "Invalid CAST %s", typeName.Buffer());
+    }
+    return ok;
+}
+
+bool MathExpressionBlockEvaluator::CompileFunction(const StreamString &name) {
+    uint32 f = 0u;
+    while ((f < MATH_EXPRESSION_BLOCK_NUMBER_OF_FUNCTIONS) && (!(name == mathExpressionBlockFunctions[f].name))) {
+        f++;
+    }
+    bool ok = (f < MATH_EXPRESSION_BLOCK_NUMBER_OF_FUNCTIONS);
+    if (ok) {
+        const MathExpressionBlockFunction &function = mathExpressionBlockFunctions[f];
+        ok = (depth >= function.numberOfInputs);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "%s needs %u operands", name.Buffer(), function.numberOfInputs);
+        }
+        BlockOperand operands[2];
+        if (ok) {
+            for (uint32 k = 0u; k < function.numberOfInputs; k++) {
+                /*lint -e{613} stack != NULL if depth > 0*/
+                operands[k] = stack[(depth - function.numberOfInputs) + k];
+            }
+            if (function.numberOfInputs == 2u) {
+                ok = (operands[0].type == operands[1].type);
+                if (!ok) {
+                    REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "The operands of %s have different types (%s and %s): use a cast", name.Buffer(),
+                                        TypeDescriptor::GetTypeNameFromTypeDescriptor(operands[0].type),
+                                        TypeDescriptor::GetTypeNameFromTypeDescriptor(operands[1].type));
+                }
+            }
+        }
+        //Single values are computed once, a single value with a vector selects the kernel that reads it for all the elements
+        bool isScalar = true;
+        bool isConstant = true;
+        uint32 variant = MATH_EXPRESSION_BLOCK_VECTOR_VECTOR;
+        if (ok) {
+            for (uint32 k = 0u; k < function.numberOfInputs; k++) {
+                isScalar = (isScalar) && (operands[k].isScalar);
+                isConstant = (isConstant) && (operands[k].constant >= 0);
+            }
+            if ((function.numberOfInputs == 2u) && (!isScalar)) {
+                if (operands[0].isScalar) {
+                    variant = MATH_EXPRESSION_BLOCK_SCALAR_VECTOR;
+                }
+                else if (operands[1].isScalar) {
+                    variant = MATH_EXPRESSION_BLOCK_VECTOR_SCALAR;
+                }
+                else {
+                    //NOOP
+                }
+            }
+        }
+        MathExpressionBlockKernel kernel = NULL_PTR(MathExpressionBlockKernel);
+        if (ok) {
+            kernel = function.select(operands[0].type, variant);
+            ok = (kernel != NULL_PTR(MathExpressionBlockKernel));
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "%s is not available for %s operands", name.Buffer(),
+                                    TypeDescriptor::GetTypeNameFromTypeDescriptor(operands[0].type));
+            }
+        }
+        if (ok) {
+            TypeDescriptor resultType = (function.booleanResult) ? (UnsignedInteger8Bit) : (operands[0].type);
+            int32 fusable = fusableInstruction;
+            depth -= function.numberOfInputs;
+            bool isFolded = false;
+            if ((optimise) && (isConstant)) {
+                //Constant folding (an operation that fails is not folded, so that Execute() reports it)
+                MathExpressionBlockInstruction folded;
+                /*lint -e{613} constants != NULL if optimise*/
+                folded.output = &constants[numberOfConstants * MATH_EXPRESSION_BLOCK_VALUE_SIZE];
+                for (uint32 k = 0u; k < function.numberOfInputs; k++) {
+                    folded.input[k] = operands[k].address;
+                }
+                isFolded = kernel(folded, 1u);
+                if (isFolded) {
+                    PushConstant(numberOfConstants, resultType);
+                    numberOfConstants++;
+                }
+            }
+            if (!isFolded) {
+                //Multiply-add: an ADD of the result of the last instruction, if it is a MUL
+                uint32 product = 2u;
+                if ((optimise) && (name == "ADD") && (fusable >= 0)) {
+                    for (uint32 k = 0u; (k < 2u) && (product == 2u); k++) {
+                        if (operands[k].producer == fusable) {
+                            product = k;
+                        }
+                    }
+                }
+                if (product < 2u) {
+                    const BlockOperand &addend = operands[1u - product];
+                    uint32 scalars = (addend.isScalar) ? (fusableScalars | 4u) : (fusableScalars);
+                    /*lint -e{613} instructions != NULL if fusable >= 0*/
+                    MathExpressionBlockInstruction &instruction = instructions[fusable];
+                    instruction.kernel = MathExpressionBlockSelectTernary<MathExpressionBlockMulAdd>(resultType, scalars);
+                    instruction.numberOfValues = (isScalar) ? (1u) : (blockSize);
+                    BindOperand(instruction, 2u, addend);
+                    ReleaseOperand(addend);
+                    //The result stays in the work buffer of the MUL
+                    /*lint -e{613} stack != NULL*/
+                    stack[depth] = operands[product];
+                    stack[depth].isScalar = isScalar;
+                    depth++;
+                    fusableInstruction = -1;
+                }
+                else {
+                    //The result buffer is acquired before releasing the operands, so that no kernel writes on its inputs
+                    MathExpressionBlockInstruction &instruction = PushResult(kernel, resultType, isScalar);
+                    for (uint32 k = 0u; k < function.numberOfInputs; k++) {
+                        BindOperand(instruction, k, operands[k]);
+                        ReleaseOperand(operands[k]);
+                    }
+                    if ((optimise) && (name == "MUL")) {
+                        fusableInstruction = static_cast<int32>(numberOfInstructions - 1u);
+                        fusableScalars = ((operands[0].isScalar) ? (1u) : (0u)) | ((operands[1].isScalar) ? (2u) : (0u));
+                    }
+                }
+            }
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC(ErrorManagement::UnsupportedFeature, "Unsupported opcode %s", name.Buffer());
+    }
+    return ok;
+}
+
+bool MathExpressionBlockEvaluator::Compile(const char8 * const expression,
+                                           const bool optimiseIn) {
+    bool ok = ((variables != NULL_PTR(BlockVariable *)) && (instructions == NULL_PTR(MathExpressionBlockInstruction *)));
+    if (ok) {
+        ok = (expression != NULL_PTR(const char8 *));
+    }
+    optimise = optimiseIn;
+    //The block size is the largest number of values of the signals
+    blockSize = 1u;
+    for (uint32 i = 0u; (i < numberOfVariables) && (ok); i++) {
+        /*lint -e{613} variables != NULL if ok*/
+        ok = (variables[i].numberOfValues > 0u);
+        if (ok) {
+            /*lint -e{613} variables != NULL if ok*/
+            if (variables[i].numberOfValues > blockSize) {
+                blockSize = variables[i].numberOfValues;
+            }
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "The signal %u was not set", i);
+        }
+    }
+    for (uint32 i = 0u; (i < numberOfVariables) && (ok); i++) {
+        /*lint -e{613} variables != NULL if ok*/
+        const BlockVariable &variable = variables[i];
+        ok = (variable.numberOfValues == blockSize) || ((variable.isInput) && (variable.numberOfValues == 1u));
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "Signal %s has %u values: must be %u%s", variable.name.Buffer(),
+                                variable.numberOfValues, blockSize, (variable.isInput) ? (" or 1") : (""));
+        }
+    }
+    uint32 numberOfTokens = 0u;
+    if (ok) {
+        uint32 position = 0u;
+        StreamString token;
+        while (MathExpressionBlockGetToken(expression, position, token)) {
+            numberOfTokens++;
+        }
+        ok = (numberOfTokens > 0u);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "Empty expression");
+        }
+    }
+    if (ok) {
+        //At most one instruction, one work buffer, one constant, one stack value and one internal variable per token
+        maxNumberOfInstructions = numberOfTokens;
+        instructions = new MathExpressionBlockInstruction[maxNumberOfInstructions];
+        bufferInUse = new bool[numberOfTokens];
+        constants = new uint8[numberOfTokens * MATH_EXPRESSION_BLOCK_VALUE_SIZE];
+        stack = new BlockOperand[numberOfTokens];
+        for (uint32 i = 0u; i < numberOfTokens; i++) {
+            bufferInUse[i] = false;
+        }
+        BlockVariable *allVariables = new BlockVariable[numberOfVariables + numberOfTokens];
+        for (uint32 i = 0u; i < numberOfVariables; i++) {
+            /*lint -e{613} variables != NULL if ok*/
+            allVariables[i] = variables[i];
+        }
+        for (uint32 i = numberOfVariables; i < (numberOfVariables + numberOfTokens); i++) {
+            allVariables[i].type = InvalidType;
+            allVariables[i].memory = NULL_PTR(void *);
+            allVariables[i].numberOfValues = 0u;
+            allVariables[i].isInput = false;
+            allVariables[i].isReadable = false;
+            allVariables[i].isInternal = false;
+            allVariables[i].isUsed = false;
+            allVariables[i].constant = -1;
+        }
+        delete[] variables;
+        variables = allVariables;
+        maxNumberOfVariables = (numberOfVariables + numberOfTokens);
+    }
+    uint32 position = 0u;
+    StreamString token;
+    while ((ok) && (MathExpressionBlockGetToken(expression, position, token))) {
+        if (token == "READ") {
+            StreamString name;
+            ok = MathExpressionBlockGetToken(expression, position, name);
+            if (ok) {
+                ok = CompileRead(name);
+            }
+        }
+        else if (token == "WRITE") {
+            StreamString name;
+            ok = MathExpressionBlockGetToken(expression, position, name);
+            if (ok) {
+                ok = CompileWrite(name);
+            }
+        }
+        else if (token == "CONST") {
+            StreamString typeName;
+            StreamString value;
+            ok = MathExpressionBlockGetToken(expression, position, typeName);
+            if (ok) {
+                ok = MathExpressionBlockGetToken(expression, position, value);
+            }
+            if (ok) {
+                ok = CompileConstant(typeName, value);
+            }
+        }
+        else if (token == "CAST") {
+            StreamString typeName;
+            ok = MathExpressionBlockGetToken(expression, position, typeName);
+            if (ok) {
+                ok = CompileCast(typeName);
+            }
+        }
+        else {
+            ok = CompileFunction(token);
+        }
+    }
+    if (ok) {
+        ok = (depth == 0u);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "%u values left in the stack at the end of the expression", depth);
+        }
+    }
+    for (uint32 i = 0u; (i < (numberOfInputs + numberOfOutputs)) && (ok); i++) {
+        /*lint -e{613} variables != NULL if ok*/
+        ok = variables[i].isUsed;
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "The %s signal %s is not used by the expression", (variables[i].isInput) ? ("input") : ("output"),
+                                variables[i].name.Buffer());
+        }
+    }
+    if (ok) {
+        //Resolve the work buffer addresses
+        buffers = new uint8[numberOfBuffers * blockSize * MATH_EXPRESSION_BLOCK_VALUE_SIZE];
+        for (uint32 i = 0u; i < numberOfInstructions; i++) {
+            /*lint -e{613} instructions != NULL if ok*/
+            MathExpressionBlockInstruction &instruction = instructions[i];
+            if (instruction.buffer[0] >= 0) {
+                instruction.output = &buffers[static_cast<uint32>(instruction.buffer[0]) * blockSize * MATH_EXPRESSION_BLOCK_VALUE_SIZE];
+            }
+            for (uint32 k = 0u; k < 3u; k++) {
+                if (instruction.buffer[k + 1u] >= 0) {
+                    instruction.input[k] = &buffers[static_cast<uint32>(instruction.buffer[k + 1u]) * blockSize * MATH_EXPRESSION_BLOCK_VALUE_SIZE];
+                }
+            }
+        }
+    }
+    if (stack != NULL_PTR(BlockOperand *)) {
+        delete[] stack;
+        stack = NULL_PTR(BlockOperand *);
+    }
+    if (!ok) {
+        Clean();
+    }
+    return ok;
+}
+
+bool MathExpressionBlockEvaluator::Execute() {
+    bool ok = true;
+    //all the instructions are executed, so that the outputs are always written (with saturated values on error)
+    for (uint32 i = 0u; i < numberOfInstructions; i++) {
+        /*lint -e{613} instructions != NULL if numberOfInstructions > 0*/
+        const MathExpressionBlockInstruction &instruction = instructions[i];
+        if (!instruction.kernel(instruction, instruction.numberOfValues)) {
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+uint32 MathExpressionBlockEvaluator::GetBlockSize() const {
+    return blockSize;
+}
+
+uint32 MathExpressionBlockEvaluator::GetNumberOfInstructions() const {
+    return numberOfInstructions;
+}
+
+uint32 MathExpressionBlockEvaluator::GetNumberOfBuffers() const {
+    return numberOfBuffers;
+}
+
+}
@@ -0,0 +1,492 @@
+/**
+ * @file MathExpressionBlockEvaluator.h
+ * @brief Header file for class MathExpressionBlockEvaluator
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MathExpressionBlockEvaluator
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef MATHEXPRESSIONBLOCKEVALUATOR_H_
+#define MATHEXPRESSIONBLOCKEVALUATOR_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "StreamString.h"
+#include "TypeDescriptor.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+struct MathExpressionBlockInstruction;
+
+/**
+ * @brief Function that executes one instruction on all the elements of the block.
+ * @return false if the operation overflowed (the result is saturated) or divided by zero for at least one element.
+ */
+typedef bool (*MathExpressionBlockKernel)(const MathExpressionBlockInstruction &instruction,
+                                          const uint32 numberOfValues);
+
+/**
+ * @brief One instruction of the compiled program.
+ */
+struct MathExpressionBlockInstruction {
+    /**
+     * The typed kernel that executes the instruction.
+     */
+    MathExpressionBlockKernel kernel;
+
+    /**
+     * Where the result is written.
+     */
+    void *output;
+
+    /**
+     * The operands (NULL if not used by the instruction).
+     */
+    const void *input[3];
+
+    /**
+     * Index of the work buffer of output, input[0], input[1] and input[2] (-1 if the location is not a work buffer).
+     * Used to resolve the addresses once all the work buffers are allocated.
+     */
+    int32 buffer[4];
+
+    /**
+     * Number of values computed (blockSize, or 1 if all the operands are single values).
+     */
+    uint32 numberOfValues;
+};
+
+/**
+ * @brief Element-wise evaluator of the stack machine expressions produced by the MathExpressionParser.
+ *
+ * @details The expression is compiled once for blocks of blockSize values: every opcode of the stack machine
+ * (READ, WRITE, CONST, CAST and the functions) becomes one instruction whose kernel loops over all the elements
+ * of the block. The opcodes are therefore interpreted once per block instead of once per element and the kernels
+ * are tight typed loops that the compiler can vectorise.
+ *
+ * The block size is the largest number of values (elements * samples) of the input and output signals.
+ * Input signals must have either one value, which is broadcast to all the elements, or blockSize values.
+ * Output signals must have blockSize values. Variables written by the expression without an associated
+ * output signal are internal and hold blockSize values.
+ *
+ * The stack positions are mapped at compile time to work buffers of blockSize values, a new buffer for
+ * each result, so that no instruction writes on one of its operands.
+ *
+ * Types are not promoted: the two operands of a function must have the same type (use CAST otherwise)
+ * and the result has the type of the operands (uint8 for the comparison and logical operators). SIN, COS and POW
+ * require float32 or float64 operands. A value can only be written to a variable of the same type.
+ * Integer ADD, SUB and MUL saturate and CAST saturates to the limits of the destination type, while integer DIV
+ * by zero returns zero: as with the SafeMath functions used by the RuntimeEvaluator, these are errors and
+ * Execute() returns false.
+ *
+ * If Compile() is asked to optimise, the stack is replaced by direct references to the operands:
+ *  - READ does not copy: the functions read the variables memory (load-var-op) and single values are
+ *    used as such, so that operations on single values are computed once and not for each element;
+ *  - the operations on constants are folded at compile time (but for those that saturate or divide by zero,
+ *    which are kept so that Execute() returns false) and internal variables that are assigned a constant
+ *    are replaced by the constant;
+ *  - the result of the last instruction is written directly in the variable of a WRITE, without copies;
+ *  - a MUL whose result is only used by an ADD is fused in a multiply-add super-instruction.
+ * The results are the same as without the optimisation.
+ *
+ * Supported opcodes: READ, WRITE, CONST, CAST, ADD, SUB, MUL, DIV, POW, SIN, COS, AND, OR, XOR, NOT,
+ * EQ, NEQ, GT, LT, GTE, LTE.
+ */
+class MathExpressionBlockEvaluator {
+public:
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    MathExpressionBlockEvaluator();
+
+    /**
+     * @brief Destructor. Frees the allocated memory.
+     */
+    ~MathExpressionBlockEvaluator();
+
+    /**
+     * @brief Allocates the table of the signal variables.
+     * @param[in] nOfInputs the number of input signals.
+     * @param[in] nOfOutputs the number of output signals.
+     * @return true if the table was not already allocated.
+     */
+    bool Initialise(const uint32 nOfInputs,
+                    const uint32 nOfOutputs);
+
+    /**
+     * @brief Associates an input signal to the variable with the same name.
+     * @param[in] index the input signal index (< nOfInputs).
+     * @param[in] name the signal name.
+     * @param[in] type the signal type.
+     * @param[in] memory the signal memory.
+     * @param[in] numberOfValues the number of elements * samples of the signal.
+     * @return true if the index is valid, the type is numeric and numberOfValues > 0.
+     */
+    bool SetInput(const uint32 index,
+                  const char8 * const name,
+                  const TypeDescriptor &type,
+                  const void * const memory,
+                  const uint32 numberOfValues);
+
+    /**
+     * @brief Associates an output signal to the variable with the same name.
+     * @param[in] index the output signal index (< nOfOutputs).
+     * @param[in] name the signal name.
+     * @param[in] type the signal type.
+     * @param[in] memory the signal memory.
+     * @param[in] numberOfValues the number of elements * samples of the signal.
+     * @return true if the index is valid, the type is numeric and numberOfValues > 0.
+     */
+    bool SetOutput(const uint32 index,
+                   const char8 * const name,
+                   const TypeDescriptor &type,
+                   void * const memory,
+                   const uint32 numberOfValues);
+
+    /**
+     * @brief Compiles the stack machine expression.
+     * @param[in] expression the expression produced by MathExpressionParser::GetStackMachineExpression().
+     * @param[in] optimiseIn if true the program is optimised (see the class details).
+     * @return true if the expression is valid (see the class details), all the input signals are read,
+     * all the output signals are written and the number of values of each signal is compatible with the block size.
+     */
+    bool Compile(const char8 * const expression,
+                 const bool optimiseIn = false);
+
+    /**
+     * @brief Executes the compiled program on all the elements of the block.
+     * @return false if an integer operation or a CAST saturated, or an integer DIV divided by zero,
+     * for at least one element (as the RuntimeEvaluator, all the outputs are written anyway).
+     * @pre Compile() == true
+     */
+    bool Execute();
+
+    /**
+     * @brief Gets the number of elements evaluated by each Execute().
+     * @return the block size.
+     */
+    uint32 GetBlockSize() const;
+
+    /**
+     * @brief Gets the number of instructions of the compiled program.
+     * @return the number of instructions.
+     */
+    uint32 GetNumberOfInstructions() const;
+
+    /**
+     * @brief Gets the number of work buffers used by the compiled program.
+     * @return the number of work buffers.
+     */
+    uint32 GetNumberOfBuffers() const;
+
+private:
+
+    /**
+     * @brief A variable of the expression.
+     */
+    struct BlockVariable {
+        /**
+         * The variable name.
+         */
+        StreamString name;
+        /**
+         * The variable type (InvalidType until written if internal).
+         */
+        TypeDescriptor type;
+        /**
+         * The variable memory.
+         */
+        void *memory;
+        /**
+         * The number of values in memory.
+         */
+        uint32 numberOfValues;
+        /**
+         * True for the input signals.
+         */
+        bool isInput;
+        /**
+         * True for the input signals and for the written variables.
+         */
+        bool isReadable;
+        /**
+         * True if the memory is allocated by the evaluator.
+         */
+        bool isInternal;
+        /**
+         * True if the variable is used by the expression.
+         */
+        bool isUsed;
+        /**
+         * Index of the constant that replaces the variable (-1 if none).
+         */
+        int32 constant;
+    };
+
+    /**
+     * @brief A value of the stack at compile time.
+     */
+    struct BlockOperand {
+        /**
+         * The value type.
+         */
+        TypeDescriptor type;
+        /**
+         * The location of the value if it is not in a work buffer.
+         */
+        const void *address;
+        /**
+         * The work buffer of the value (-1 if none).
+         */
+        int32 buffer;
+        /**
+         * The instruction that computed the value (-1 if none).
+         */
+        int32 producer;
+        /**
+         * The variable that holds the value (-1 if none).
+         */
+        int32 variable;
+        /**
+         * The constant that holds the value (-1 if none).
+         */
+        int32 constant;
+        /**
+         * True if the operand is a single value used for all the elements.
+         */
+        bool isScalar;
+    };
+
+    /**
+     * @brief Finds a variable by name.
+     * @param[in] name the variable name.
+     * @return the variable index or numberOfVariables if not found.
+     */
+    uint32 FindVariable(const StreamString &name) const;
+
+    /**
+     * @brief Gets a free work buffer.
+     * @return the work buffer index.
+     */
+    uint32 AcquireBuffer();
+
+    /**
+     * @brief Releases the work buffer of an operand (if any).
+     * @param[in] operand the operand.
+     */
+    void ReleaseOperand(const BlockOperand &operand);
+
+    /**
+     * @brief Adds an instruction to the program.
+     * @param[in] kernel the instruction kernel.
+     * @param[in] nOfValues the number of values computed by the instruction.
+     * @return the new instruction.
+     */
+    MathExpressionBlockInstruction &AddInstruction(const MathExpressionBlockKernel kernel,
+                                                   const uint32 nOfValues);
+
+    /**
+     * @brief Sets an operand of an instruction.
+     * @param[in] instruction the instruction.
+     * @param[in] index the operand index (0, 1 or 2).
+     * @param[in] operand the operand.
+     */
+    static void BindOperand(MathExpressionBlockInstruction &instruction,
+                            const uint32 index,
+                            const BlockOperand &operand);
+
+    /**
+     * @brief Pushes the result of a new instruction in a new work buffer.
+     * @param[in] kernel the instruction kernel.
+     * @param[in] type the result type.
+     * @param[in] isScalar true if the result is a single value.
+     * @return the new instruction.
+     */
+    MathExpressionBlockInstruction &PushResult(const MathExpressionBlockKernel kernel,
+                                               const TypeDescriptor &type,
+                                               const bool isScalar);
+
+    /**
+     * @brief Pushes a constant.
+     * @param[in] constant the constant index.
+     * @param[in] type the constant type.
+     */
+    void PushConstant(const uint32 constant,
+                      const TypeDescriptor &type);
+
+    /**
+     * @brief Copies to a work buffer an operand of the stack.
+     * @param[in] position the position in the stack.
+     */
+    void Materialise(const uint32 position);
+
+    /**
+     * @brief Compiles READ.
+     * @param[in] name the variable name.
+     * @return true if the variable is readable.
+     */
+    bool CompileRead(const StreamString &name);
+
+    /**
+     * @brief Compiles WRITE.
+     * @param[in] name the variable name.
+     * @return true if the variable can be written with the value in the top of the stack.
+     */
+    bool CompileWrite(const StreamString &name);
+
+    /**
+     * @brief Compiles CONST.
+     * @param[in] typeName the constant type.
+     * @param[in] value the constant value.
+     * @return true if the constant is valid.
+     */
+    bool CompileConstant(const StreamString &typeName,
+                         const StreamString &value);
+
+    /**
+     * @brief Compiles CAST.
+     * @param[in] typeName the destination type.
+     * @return true if the conversion is valid.
+     */
+    bool CompileCast(const StreamString &typeName);
+
+    /**
+     * @brief Compiles a function.
+     * @param[in] name the function opcode.
+     * @return true if the function exists for the types of the operands.
+     */
+    bool CompileFunction(const StreamString &name);
+
+    /**
+     * @brief Frees the memory of a previous compilation.
+     */
+    void Clean();
+
+    /**
+     * The input, output and internal variables.
+     */
+    BlockVariable *variables;
+
+    /**
+     * Number of input signals.
+     */
+    uint32 numberOfInputs;
+
+    /**
+     * Number of output signals.
+     */
+    uint32 numberOfOutputs;
+
+    /**
+     * Number of variables (signals and internal).
+     */
+    uint32 numberOfVariables;
+
+    /**
+     * Maximum number of variables (signals and one internal variable per token).
+     */
+    uint32 maxNumberOfVariables;
+
+    /**
+     * The compiled program.
+     */
+    MathExpressionBlockInstruction *instructions;
+
+    /**
+     * Number of instructions.
+     */
+    uint32 numberOfInstructions;
+
+    /**
+     * Maximum number of instructions (one per token).
+     */
+    uint32 maxNumberOfInstructions;
+
+    /**
+     * The work buffers (numberOfBuffers * blockSize values of up to 8 bytes).
+     */
+    uint8 *buffers;
+
+    /**
+     * Number of work buffers.
+     */
+    uint32 numberOfBuffers;
+
+    /**
+     * Work buffers in use while compiling.
+     */
+    bool *bufferInUse;
+
+    /**
+     * Storage of the constants (8 bytes each).
+     */
+    uint8 *constants;
+
+    /**
+     * Number of constants.
+     */
+    uint32 numberOfConstants;
+
+    /**
+     * The stack while compiling.
+     */
+    BlockOperand *stack;
+
+    /**
+     * Number of values in the stack while compiling.
+     */
+    uint32 depth;
+
+    /**
+     * True if the program is being optimised.
+     */
+    bool optimise;
+
+    /**
+     * The last instruction if it is a MUL that can be fused with an ADD (-1 otherwise).
+     */
+    int32 fusableInstruction;
+
+    /**
+     * The operands of fusableInstruction that are single values (bit 0 and 1 for the first and second).
+     */
+    uint32 fusableScalars;
+
+    /**
+     * Number of values evaluated by Execute().
+     */
+    uint32 blockSize;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* MATHEXPRESSIONBLOCKEVALUATOR_H_ */
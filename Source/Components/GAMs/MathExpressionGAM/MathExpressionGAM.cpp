@@ -47,6 +47,9 @@ MathExpressionGAM::MathExpressionGAM() :
     
     mathParser    = NULL_PTR(MathExpressionParser*);
     evaluator     = NULL_PTR(RuntimeEvaluator*);
+    blockEvaluator = NULL_PTR(MathExpressionBlockEvaluator*);
+    elementWise   = 0u;
+    optimise      = 0u;
     inputSignals  = NULL_PTR(SignalStruct*);
     outputSignals = NULL_PTR(SignalStruct*);
 }
@@ -60,6 +63,9 @@ MathExpressionGAM::~MathExpressionGAM() {
     if (evaluator != NULL) {
         delete evaluator;
     }
+    if (blockEvaluator != NULL) {
+        delete blockEvaluator;
+    }
     if (inputSignals != NULL) {
         delete[] inputSignals;
     }
@@ -81,6 +87,15 @@ bool MathExpressionGAM::Initialise(StructuredDataI &data) {
         }
     }
     
+    if (ok) {
+        if (!data.Read("ElementWise", elementWise)) {
+            elementWise = 0u;
+        }
+        if (!data.Read("Optimise", optimise)) {
+            optimise = 0u;
+        }
+    }
+    
     // Parser initialization
     if (ok) {
         (void) expr.Seek(0LLU);
@@ -94,8 +109,13 @@ bool MathExpressionGAM::Initialise(StructuredDataI &data) {
     
     // Evaluator initialization
     if (ok) {
-        /*lint -e{613} ok = True => mathParser != NULL*/
-        evaluator = new RuntimeEvaluator(mathParser->GetStackMachineExpression());
+        if ((elementWise != 0u) || (optimise != 0u)) {
+            blockEvaluator = new MathExpressionBlockEvaluator();
+        }
+        if (elementWise == 0u) {
+            /*lint -e{613} ok = True => mathParser != NULL*/
+            evaluator = new RuntimeEvaluator(mathParser->GetStackMachineExpression());
+        }
     }
 
     return ok;
@@ -117,6 +137,9 @@ bool MathExpressionGAM::Setup() {
             ok = GetSignalNumberOfElements(InputSignals, signalIdx, inputSignals[signalIdx].numberOfElements);
             inputSignals[signalIdx].type = GetSignalType(InputSignals, signalIdx);
         }
+        if (ok) {
+            ok = GetSignalNumberOfSamples(InputSignals, signalIdx, inputSignals[signalIdx].numberOfSamples);
+        }
     }
     
     for (uint32 signalIdx = 0u; (signalIdx < numberOfOutputSignals) && ok; signalIdx++) {
@@ -126,8 +149,37 @@ bool MathExpressionGAM::Setup() {
             ok = GetSignalNumberOfElements(OutputSignals, signalIdx, outputSignals[signalIdx].numberOfElements);
             outputSignals[signalIdx].type = GetSignalType(OutputSignals, signalIdx);
         }
+        if (ok) {
+            ok = GetSignalNumberOfSamples(OutputSignals, signalIdx, outputSignals[signalIdx].numberOfSamples);
+        }
+    }
+    
+    if (ok) {
+        if (elementWise != 0u) {
+            ok = SetupBlockEvaluator();
+        }
+        else {
+            ok = SetupRuntimeEvaluator();
+            // the optimised program replaces the RuntimeEvaluator when the expression allows it
+            if ((ok) && (blockEvaluator != NULL)) {
+                if (!SetupBlockEvaluator()) {
+                    REPORT_ERROR(ErrorManagement::Warning,
+                        "Expression %s cannot be optimised: it will be evaluated by the RuntimeEvaluator.",
+                        expr.Buffer());
+                    delete blockEvaluator;
+                    blockEvaluator = NULL_PTR(MathExpressionBlockEvaluator*);
+                }
+            }
+        }
     }
     
+    return ok;
+}
+
+bool MathExpressionGAM::SetupRuntimeEvaluator() {
+    
+    bool ok = true;
+    
     // 1. Checks
     for (uint32 signalIdx = 0u; (signalIdx < numberOfInputSignals) && ok; signalIdx++) {
         ok = (inputSignals[signalIdx].numberOfElements == 1u);
@@ -239,10 +291,73 @@ bool MathExpressionGAM::Setup() {
     return ok;
 }
 
+bool MathExpressionGAM::SetupBlockEvaluator() {
+    
+    // without ElementWise only the first value of each signal is evaluated, as by the RuntimeEvaluator
+    const bool scalar = (elementWise == 0u);
+    
+    /*lint -e{613} (elementWise != 0) || (optimise != 0) => blockEvaluator != NULL*/
+    bool ok = blockEvaluator->Initialise(numberOfInputSignals, numberOfOutputSignals);
+    
+    for (uint32 signalIdx = 0u; (signalIdx < numberOfInputSignals) && (ok); signalIdx++) {
+        
+        uint32 numberOfValues = 1u;
+        if (!scalar) {
+            numberOfValues = (inputSignals[signalIdx].numberOfElements * inputSignals[signalIdx].numberOfSamples);
+        }
+        /*lint -e{613} ok = True => blockEvaluator != NULL*/
+        ok = blockEvaluator->SetInput(signalIdx, inputSignals[signalIdx].name.Buffer(), inputSignals[signalIdx].type,
+                                      GetInputSignalMemory(signalIdx), numberOfValues);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError,
+                "Input signal %s must have a numeric type.",
+                (inputSignals[signalIdx].name).Buffer());
+        }
+    }
+    
+    for (uint32 signalIdx = 0u; (signalIdx < numberOfOutputSignals) && (ok); signalIdx++) {
+        
+        uint32 numberOfValues = 1u;
+        if (!scalar) {
+            numberOfValues = (outputSignals[signalIdx].numberOfElements * outputSignals[signalIdx].numberOfSamples);
+        }
+        /*lint -e{613} ok = True => blockEvaluator != NULL*/
+        ok = blockEvaluator->SetOutput(signalIdx, outputSignals[signalIdx].name.Buffer(), outputSignals[signalIdx].type,
+                                       GetOutputSignalMemory(signalIdx), numberOfValues);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError,
+                "Output signal %s must have a numeric type.",
+                (outputSignals[signalIdx].name).Buffer());
+        }
+    }
+    
+    if (ok) {
+        /*lint -e{613} Initialise() = True => mathParser != NULL*/
+        StreamString stackMachineExpression = mathParser->GetStackMachineExpression();
+        /*lint -e{613} ok = True => blockEvaluator != NULL*/
+        ok = blockEvaluator->Compile(stackMachineExpression.Buffer(), (optimise != 0u));
+        if ((!ok) && (!scalar)) {
+            REPORT_ERROR(ErrorManagement::InitialisationError,
+                "Failed element-wise compilation of expression: %s",
+                expr.Buffer());
+        }
+    }
+    
+    return ok;
+}
+
 bool MathExpressionGAM::Execute() {
-    /*lint -e{613} ok = True => evaluator != NULL*/
-    return evaluator->Execute();
     
+    bool ok = true;
+    if (blockEvaluator != NULL) {
+        ok = blockEvaluator->Execute();
+    }
+    else {
+        /*lint -e{613} Setup() = True => evaluator != NULL*/
+        ok = evaluator->Execute();
+    }
+    
+    return ok;
 }
 
 CLASS_REGISTER(MathExpressionGAM, "1.0")
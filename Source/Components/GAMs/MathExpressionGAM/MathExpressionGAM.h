@@ -33,6 +33,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "GAM.h"
+#include "MathExpressionBlockEvaluator.h"
 #include "MathExpressionParser.h"
 #include "RuntimeEvaluator.h"
 
@@ -109,7 +110,7 @@ namespace MARTe {
  * 
  * The GAM supports:
  *  - signals of any numeric type
- *  - scalar signals only
+ *  - scalar signals only (unless `ElementWise = 1`, see below)
  * 
  * During initialisation, each variable in the expression is automatically
  * associated to the signal with the same name:
@@ -158,12 +159,73 @@ namespace MARTe {
  * F = (float64) G*((float64) m1 + (float64) m2)/pow((float64) r, (float64) 2);
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  * 
+ * If the optional `ElementWise` leaf is set to 1 the expression is
+ * applied element-wise to array and multi-sample signals by a
+ * MathExpressionBlockEvaluator: each opcode of the stack machine is
+ * interpreted once per cycle and executed by a typed loop over all
+ * the NumberOfElements * NumberOfSamples values of the signals, instead
+ * of being interpreted once per value. In this mode:
+ *  - all the output signals must have the same number of values N,
+ *    which is the largest number of values of the signals;
+ *  - input signals must have either N values or a single value,
+ *    which is then used for all the elements;
+ *  - types are never promoted: the operands of an operator must have
+ *    the same type and a value can only be assigned to a variable of
+ *    the same type (use typecasts otherwise, e.g. `(float32) 2`);
+ *  - `sin()`, `cos()` and `pow()` require float32 or float64 operands;
+ *  - comparison and logical operators return uint8 values;
+ *  - integer operations that overflow saturate, integer divisions by
+ *    zero return zero and typecasts saturate: as with the RuntimeEvaluator
+ *    these are errors and Execute() returns false;
+ *  - all the input signals must be used and all the output signals
+ *    must be written by the expression.
+ * 
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * +ArrayExprGAM = {
+ *     Class = MathExpressionGAM
+ *     ElementWise = 1
+ *     Expression = "Out = In1 * Gain + (float32) 1.5;"
+ *     InputSignals = {
+ *         In1 = {
+ *             Type = float32
+ *             NumberOfElements = 1000
+ *         }
+ *         Gain = {
+ *             Type = float32
+ *             NumberOfElements = 1
+ *         }
+ *     }
+ *     OutputSignals = {
+ *         Out = {
+ *             Type = float32
+ *             NumberOfElements = 1000
+ *         }
+ *     }
+ * }
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * 
+ * If the optional `Optimise` leaf is set to 1 the stack machine program
+ * is compiled by the MathExpressionBlockEvaluator into an optimised
+ * instruction stream: signals are read and written in place instead
+ * of being pushed to and popped from a stack, operations on constants
+ * are computed once during Setup(), variables assigned a constant are
+ * replaced by the constant and a multiplication followed by an addition
+ * is executed as a single multiply-add instruction. The results are the
+ * same as without optimisation, errors included: an integer overflow or
+ * division by zero makes Execute() return false (operations on constants
+ * that fail are not folded). With `ElementWise = 0` the optimised
+ * program replaces the RuntimeEvaluator only if the expression satisfies
+ * the type rules of the element-wise mode listed above; otherwise a
+ * warning is issued and the RuntimeEvaluator is used.
+ * 
  * The configuration syntax is (signal names are only given as
  * an example and can be changed):
  * 
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  * +ExprGAM = {
  *     Class = MathExpressionGAM
+ *     ElementWise = 0                // Optional. Default = 0.
+ *     Optimise = 0                   // Optional. Default = 0.
  *     Expression = "
  *                   pi = 3.14;
  *                   Out1 = ( In1 + (float32) In2 ) * ((float32) 10);
@@ -261,9 +323,30 @@ protected:
      *        that will evaluate the input expression.
      */
     RuntimeEvaluator*     evaluator;
+    
+    /**
+     * @brief Pointer to the instance of the MathExpressionBlockEvaluator
+     *        that evaluates the expression element-wise (ElementWise = 1)
+     *        or the optimised program (Optimise = 1).
+     */
+    MathExpressionBlockEvaluator* blockEvaluator;
 
 private:
     
+    /**
+     * @brief Checks the signals and compiles the expression
+     *        with the RuntimeEvaluator (scalar signals).
+     * @return `true` on succeed.
+     */
+    bool SetupRuntimeEvaluator();
+    
+    /**
+     * @brief Associates the signals to the MathExpressionBlockEvaluator
+     *        and compiles the expression (ElementWise = 1 or Optimise = 1).
+     * @return `true` on succeed.
+     */
+    bool SetupBlockEvaluator();
+    
     /**
      * @brief Structure to hold information about signals.
      */
@@ -272,6 +355,7 @@ private:
         StreamString    name;
         TypeDescriptor  type;
         uint32          numberOfElements;
+        uint32          numberOfSamples;
         
     };
     
@@ -288,6 +372,16 @@ private:
      */
     StreamString expr;
     
+    /**
+     * @brief 1 if the expression is evaluated element-wise.
+     */
+    uint8 elementWise;
+    
+    /**
+     * @brief 1 if the expression is compiled to an optimised program.
+     */
+    uint8 optimise;
+    
 };
 
 } /* MARTe */
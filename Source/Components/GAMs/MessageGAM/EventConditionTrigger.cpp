@@ -29,12 +29,24 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
 #include "EventConditionTrigger.h"
 #include "EventSem.h"
 #include "QueuedReplyMessageCatcherFilter.h"
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * The default number of triggered events which can wait in the queue.
+ */
+const MARTe::uint32 EVENTCONDITIONTRIGGER_DEFAULT_QUEUED_EVENTS = 16u;
+
+/**
+ * The maximum number of message slots, so that the number of queued messages fits in the int32 atomic counter.
+ */
+const MARTe::uint32 EVENTCONDITIONTRIGGER_MAX_QUEUE_SIZE = 0x7FFFFFFFu;
+}
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -64,7 +76,17 @@ EventConditionTrigger::EventConditionTrigger() :
         executor(*this) {
     eventConditions = NULL_PTR(EventConditionField *);
     numberOfConditions = 0u;
-    replied = 0u;
+    messages = NULL_PTR(ReferenceT<Message> *);
+    numberOfMessages = 0u;
+    messageQueue = NULL_PTR(volatile uint32 *);
+    queueSize = 0u;
+    queueWriteIndex = 0u;
+    queueReadIndex = 0u;
+    queueCount = 0;
+    senderWaiting = 0;
+    numberOfOverflows = 0;
+    numberOfDroppedMessages = 0;
+    replied = 0;
     if (!eventSem.Create()) {
         REPORT_ERROR(ErrorManagement::FatalError, "Could not create EventSem.");
     }
@@ -79,6 +101,12 @@ EventConditionTrigger::~EventConditionTrigger() {
     if (eventConditions != NULL_PTR(EventConditionField *)) {
         delete[] eventConditions;
     }
+    if (messages != NULL_PTR(ReferenceT<Message> *)) {
+        delete[] messages;
+    }
+    if (messageQueue != NULL_PTR(volatile uint32 *)) {
+        delete[] messageQueue;
+    }
 }
 
 bool EventConditionTrigger::Initialise(StructuredDataI &data) {
@@ -105,15 +133,33 @@ bool EventConditionTrigger::Initialise(StructuredDataI &data) {
         cpuMask = cpuMaskIn;
     }
     if (ret) {
+        numberOfMessages = Size();
+        messages = new ReferenceT<Message> [numberOfMessages];
         uint32 n;
-        for (n = 0u; (n < Size()) && (ret); n++) {
-            ReferenceT < Message > msg = Get(n);
-            ret = msg.IsValid();
+        for (n = 0u; (n < numberOfMessages) && (ret); n++) {
+            messages[n] = Get(n);
+            ret = messages[n].IsValid();
             if (!ret) {
                 REPORT_ERROR(ErrorManagement::ParametersError, "Only Messages are allowed inside the container");
             }
         }
     }
+    if (ret) {
+        if (!data.Read("QueueSize", queueSize)) {
+            queueSize = EVENTCONDITIONTRIGGER_DEFAULT_QUEUED_EVENTS * numberOfMessages;
+        }
+        ret = (queueSize >= numberOfMessages);
+        if (ret) {
+            ret = (queueSize <= EVENTCONDITIONTRIGGER_MAX_QUEUE_SIZE);
+        }
+        if (ret) {
+            messageQueue = new uint32[queueSize];
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::ParametersError, "QueueSize (%u) must be at least the number of messages (%u) and at most %u", queueSize, numberOfMessages,
+                         EVENTCONDITIONTRIGGER_MAX_QUEUE_SIZE);
+        }
+    }
     if (ret) {
         executor.SetCPUMask(cpuMask);
     }
@@ -198,20 +244,29 @@ bool EventConditionTrigger::Check(const uint8 * const memoryArea,
         }
 
         if (trigger) {
-            uint32 numberOfChildren = Size();
-            for (uint32 i = 0u; i < numberOfChildren; i++) {
-                ReferenceT < Message > message = Get(i);
-                if (message.IsValid()) {
-                    if (static_cast<bool>(spinLock.FastLock())) {
-                        REPORT_ERROR(ErrorManagement::Information, "Inserted message");
-                        if (!messageQueue.Insert(message)) {
-                            REPORT_ERROR(ErrorManagement::Warning, "Failed Insert of the message in the queue");
-                        }
-                        spinLock.FastUnLock();
+            //The internal thread only removes messages, so the free slots can only increase after this read
+            uint32 queued = static_cast<uint32>(queueCount);
+            trigger = ((queueSize - queued) >= numberOfMessages);
+            if (trigger) {
+                for (uint32 i = 0u; i < numberOfMessages; i++) {
+                    /*lint -e{613} messageQueue is allocated in Initialise.*/
+                    messageQueue[queueWriteIndex] = i;
+                    queueWriteIndex++;
+                    if (queueWriteIndex == queueSize) {
+                        queueWriteIndex = 0u;
                     }
                 }
+                //Publish the slots only after they are written
+                Atomic::Add(&queueCount, static_cast<int32>(numberOfMessages));
+                //Either the internal thread sees the new messages when it looks at queueCount before waiting, or its flag is seen here
+                if (senderWaiting != 0) {
+                    (void) eventSem.Post();
+                }
+            }
+            else {
+                Atomic::Increment(&numberOfOverflows);
+                Atomic::Add(&numberOfDroppedMessages, static_cast<int32>(numberOfMessages));
             }
-            (void) eventSem.Post();
         }
     }
 
@@ -228,11 +283,7 @@ ErrorManagement::ErrorType EventConditionTrigger::Execute(ExecutionInfo & info)
     }
     else if (info.GetStage() != ExecutionInfo::BadTerminationStage) {
         //pull from the queue
-        uint32 nMessages = 0u;
-        if (static_cast<bool>(spinLock.FastLock())) {
-            nMessages = messageQueue.Size();
-            spinLock.FastUnLock();
-        }
+        uint32 nMessages = static_cast<uint32>(queueCount);
 
         if (nMessages > 0u) {
 
@@ -247,16 +298,18 @@ ErrorManagement::ErrorType EventConditionTrigger::Execute(ExecutionInfo & info)
             ReferenceContainer eventReplyContainer;
 
             //Only accept indirect replies
+            uint32 readIndex = queueReadIndex;
             for (uint32 i = 0u; i < nMessages; i++) {
-                ReferenceT < Message > eventMsg;
-                if (static_cast<bool>(spinLock.FastLock())) {
-                    eventMsg = messageQueue.Get(i);
-                    spinLock.FastUnLock();
+                /*lint -e{613} messages and messageQueue are allocated in Initialise.*/
+                ReferenceT < Message > eventMsg = messages[messageQueue[readIndex]];
+                readIndex++;
+                if (readIndex == queueSize) {
+                    readIndex = 0u;
                 }
                 if (eventMsg.IsValid()) {
                     if (eventMsg->ExpectsIndirectReply()) {
                         err = !eventReplyContainer.Insert(eventMsg);
-                        if(err.ErrorsCleared()) {
+                        if(!err.ErrorsCleared()) {
                             REPORT_ERROR(ErrorManagement::Warning, "Error after inserting message");
                         }
                         //REPORT_ERROR(ErrorManagement::Information, "Message %d set as indirect reply", i);
@@ -274,7 +327,7 @@ ErrorManagement::ErrorType EventConditionTrigger::Execute(ExecutionInfo & info)
                 filter->SetMessagesToCatch(eventReplyContainer);
                 filter->SetEventSemaphore(waitSem);
                 err = MessageI::InstallMessageFilter(filter, 0);
-                if(err.ErrorsCleared()) {
+                if(!err.ErrorsCleared()) {
                     REPORT_ERROR(ErrorManagement::Warning, "Error after installing message filter");
                 }
                 //REPORT_ERROR(ErrorManagement::Information, "Filter installed");
@@ -283,12 +336,14 @@ ErrorManagement::ErrorType EventConditionTrigger::Execute(ExecutionInfo & info)
             ok = err.ErrorsCleared();
             /*lint -e{850} the loop variable i is not modified within the loop*/
             for (uint32 i = 0u; (i < nMessages) && (ok); i++) {
-                ReferenceT < Message > eventMsg;
-                if (static_cast<bool>(spinLock.FastLock())) {
-                    eventMsg = messageQueue.Get(0u);
-                    ok = messageQueue.Delete(eventMsg);
-                    spinLock.FastUnLock();
+                /*lint -e{613} messages and messageQueue are allocated in Initialise.*/
+                ReferenceT < Message > eventMsg = messages[messageQueue[queueReadIndex]];
+                queueReadIndex++;
+                if (queueReadIndex == queueSize) {
+                    queueReadIndex = 0u;
                 }
+                //Release the slot to Check()
+                Atomic::Decrement(&queueCount);
                 if (ok) {
                     REPORT_ERROR(ErrorManagement::Information, "Message %s [%d] extracted", eventMsg->GetName(), i);
 
@@ -299,10 +354,7 @@ ErrorManagement::ErrorType EventConditionTrigger::Execute(ExecutionInfo & info)
                             REPORT_ERROR(ErrorManagement::Warning, "Error after sending message");
                         }
                         if (!eventMsg->ExpectsIndirectReply()) {
-                            if (static_cast<bool>(spinLock.FastLock())) {
-                                replied++;
-                                spinLock.FastUnLock();
-                            }
+                            Atomic::Increment(&replied);
                         }
                         REPORT_ERROR(ErrorManagement::Information, "Send message");
                     }
@@ -322,10 +374,7 @@ ErrorManagement::ErrorType EventConditionTrigger::Execute(ExecutionInfo & info)
                         REPORT_ERROR(ErrorManagement::Warning, "Error after waiting semaphore");
                     }
                     if (static_cast<bool>(err)) {
-                        if (static_cast<bool>(spinLock.FastLock())) {
-                            replied += eventReplyContainer.Size();
-                            spinLock.FastUnLock();
-                        }
+                        Atomic::Add(&replied, static_cast<int32>(eventReplyContainer.Size()));
                         err = MessageI::RemoveMessageFilter(filter);
                         if(!err.ErrorsCleared()) {
                             REPORT_ERROR(ErrorManagement::Warning, "Error after removing message filter");
@@ -335,19 +384,17 @@ ErrorManagement::ErrorType EventConditionTrigger::Execute(ExecutionInfo & info)
             }
         }
         else {
-            if (static_cast<bool>(spinLock.FastLock())) {
-                if (messageQueue.Size() == 0u) {
-                    err = !eventSem.Reset();
-                }
-                spinLock.FastUnLock();
-            }
-            if (err.ErrorsCleared()) {
+            err = !eventSem.Reset();
+            //Check() posts the semaphore only when this flag is set: set it and look at the queue again, before waiting
+            (void) Atomic::Exchange(&senderWaiting, 1);
+            if ((err.ErrorsCleared()) && (queueCount == 0)) {
                 err = eventSem.Wait(500u);
                 
                 if(!err.ErrorsCleared()) {
                     err.timeout = false;
                 }
             }
+            senderWaiting = 0;
         }
 
     }
@@ -380,20 +427,13 @@ uint32 EventConditionTrigger::Replied(const SignalMetadata * const metadataIn, c
         }
 
         if (trigger) {
-            uint32 remains = 0u;
-            if (static_cast<bool>(spinLock.FastLock())) {
-                retVal = replied;
-                if(retVal>maxReplies){
-                    remains=(retVal-maxReplies);
-                    retVal = maxReplies;
-                }
-                spinLock.FastUnLock();
+            //The internal thread only increments the counter, so at least retVal replies can be taken
+            retVal = static_cast<uint32>(replied);
+            if (retVal > maxReplies) {
+                retVal = maxReplies;
             }
             if (retVal > 0u) {
-                if (static_cast<bool>(spinLock.FastLock())) {
-                    replied = remains;
-                    spinLock.FastUnLock();
-                }
+                Atomic::Sub(&replied, static_cast<int32>(retVal));
             }
         }
     }
@@ -411,7 +451,12 @@ void EventConditionTrigger::Purge(ReferenceContainer &purgeList) {
         REPORT_ERROR(ErrorManagement::FatalError, "Could not close the EventSem.");
     }
 
-    messageQueue.Purge();
+    if (messages != NULL_PTR(ReferenceT<Message> *)) {
+        delete[] messages;
+        messages = NULL_PTR(ReferenceT<Message> *);
+    }
+    numberOfMessages = 0u;
+    queueCount = 0;
     ReferenceContainer::Purge(purgeList);
 
 }
@@ -420,6 +465,26 @@ const ProcessorType& EventConditionTrigger::GetCPUMask() const {
     return cpuMask;
 }
 
+uint32 EventConditionTrigger::GetNumberOfMessages() const {
+    return numberOfMessages;
+}
+
+uint32 EventConditionTrigger::GetQueueSize() const {
+    return queueSize;
+}
+
+uint32 EventConditionTrigger::GetNumberOfQueuedMessages() const {
+    return static_cast<uint32>(queueCount);
+}
+
+uint32 EventConditionTrigger::GetNumberOfOverflows() const {
+    return static_cast<uint32>(numberOfOverflows);
+}
+
+uint32 EventConditionTrigger::GetNumberOfDroppedMessages() const {
+    return static_cast<uint32>(numberOfDroppedMessages);
+}
+
 CLASS_REGISTER(EventConditionTrigger, "1.0")
 
 }
@@ -34,7 +34,6 @@
 #include "ConfigurationDatabase.h"
 #include "EmbeddedServiceMethodBinderI.h"
 #include "EventSem.h"
-#include "FastPollingMutexSem.h"
 #include "MessageI.h"
 #include "ReferenceContainer.h"
 #include "SingleThreadService.h"
@@ -82,6 +81,11 @@ struct SignalMetadata {
  * @details If the event is triggered, the Check() function will insert the Messages to be sent in a queue that will be consumed by a separated thread.
  * The function Replied() returns the number of replied messages because the reply can be immediate or not (if the Message is declared with IsIndirectReply=true).
  *
+ * @details The queue is a ring of QueueSize message slots, allocated in Initialise, with a single producer (the real-time thread calling Check())
+ * and a single consumer (the internal thread). Check() and Replied() only use atomic counters, so they never allocate memory, lock or change the
+ * reference counters. If the free slots are not enough for all the messages of the event, the event is discarded: Check() returns false and
+ * the overflow counters (see GetNumberOfOverflows() and GetNumberOfDroppedMessages()) are incremented.
+ *
  * @details Follows a configuration example:
  * <pre>
  *       +Events = {
@@ -89,6 +93,7 @@ struct SignalMetadata {
  *           Class = ReferenceContainer
  *           +Event1 = {
  *               Class = EventConditionTrigger
+ *               QueueSize = 64 //Optional. Default = 16 * the number of messages. The maximum number of messages waiting to be sent.
  *               EventTrigger = {
  *                   Command1 = 1
  *                   Signal1 = 2 //Both conditions must be true
@@ -144,7 +149,8 @@ public:
     /**
      * @see ReferenceContainer::Initialise()
      * @details Checks if the block "EventTrigger" is present and stores a link to
-     * \a data.
+     * \a data. Caches the contained Message objects and allocates the queue of QueueSize slots,
+     * which must be at least the number of messages.
      */
     virtual bool Initialise(StructuredDataI &data);
 
@@ -162,11 +168,12 @@ public:
      * @brief Checks if the variable values declared in the "EventTrigger" block configuration
      * match within the \a memory area in input.
      * @details If the variables match, the Message objects contained will be added to a queue that
-     * will be consumed within the Execute() function.
+     * will be consumed within the Execute() function. If the queue cannot hold all the messages, none is added
+     * and the overflow counters are incremented.
      * @param[in] memoryArea is the memory area to be checked.
      * @param[in] metadataIn is the metadata associated to the command that trigger this event.
      * It must be one of the variables declared in "EventTrigger" block.
-     * @return true if the variables match within the \a memory area.
+     * @return true if the variables match within the \a memory area and the messages were added to the queue.
      */
     bool Check(const uint8 * const memoryArea,
                const SignalMetadata * const metadataIn);
@@ -195,6 +202,36 @@ public:
      */
     const ProcessorType& GetCPUMask() const;
 
+    /**
+     * @brief Gets the number of Message objects contained.
+     * @return the number of messages sent when the event is triggered.
+     */
+    uint32 GetNumberOfMessages() const;
+
+    /**
+     * @brief Gets the number of message slots of the queue.
+     * @return the number of message slots of the queue.
+     */
+    uint32 GetQueueSize() const;
+
+    /**
+     * @brief Gets the number of messages waiting to be sent.
+     * @return the number of messages in the queue.
+     */
+    uint32 GetNumberOfQueuedMessages() const;
+
+    /**
+     * @brief Gets the number of triggered events discarded because the queue was full.
+     * @return the number of discarded events.
+     */
+    uint32 GetNumberOfOverflows() const;
+
+    /**
+     * @brief Gets the number of messages discarded because the queue was full.
+     * @return the number of discarded messages.
+     */
+    uint32 GetNumberOfDroppedMessages() const;
+
     /**
      * @brief Holds one of the variables values declared within the "EventTrigger"
      * block of the EventConditionTrigger object configuration.
@@ -240,20 +277,61 @@ protected:
     uint32 numberOfConditions;
 
     /**
-     * A queue that contains the messages to be sent.
+     * The contained Message objects.
+     */
+    ReferenceT<Message> *messages;
+
+    /**
+     * The number of contained Message objects.
+     */
+    uint32 numberOfMessages;
+
+    /**
+     * A queue that contains the indices (in messages) of the messages to be sent.
+     * Volatile so that the slots are written before queueCount is updated.
+     */
+    volatile uint32 *messageQueue;
+
+    /**
+     * The number of slots of messageQueue.
+     */
+    uint32 queueSize;
+
+    /**
+     * The next slot to be written. Only changed by Check().
+     */
+    uint32 queueWriteIndex;
+
+    /**
+     * The next slot to be read. Only changed by the internal thread.
+     */
+    uint32 queueReadIndex;
+
+    /**
+     * The number of messages in the queue.
+     */
+    volatile int32 queueCount;
+
+    /**
+     * Set (to 1) by the internal thread before it looks at queueCount for the last time before waiting on eventSem.
+     * Check() posts eventSem if it finds it set after adding its messages.
+     */
+    volatile int32 senderWaiting;
+
+    /**
+     * The number of triggered events discarded because the queue was full.
      */
-    ReferenceContainer messageQueue;
+    volatile int32 numberOfOverflows;
 
     /**
-     * A spinlock mutex semaphore to synchronise with
-     * the internal thread that sends the messages.
+     * The number of messages discarded because the queue was full.
      */
-    FastPollingMutexSem spinLock;
+    volatile int32 numberOfDroppedMessages;
 
     /**
      * The number of replied messages.
      */
-    uint32 replied;
+    volatile int32 replied;
 
     /**
      * The internal thread executor.
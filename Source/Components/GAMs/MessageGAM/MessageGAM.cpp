@@ -49,6 +49,7 @@ MessageGAM::MessageGAM() :
     signalMetadata = NULL_PTR(SignalMetadata*);
     numberOfCommands = 0u;
     numberOfEvents = 0u;
+    eventConditionTriggers = NULL_PTR(EventConditionTrigger**);
     cntTrigger = NULL_PTR(uint32*);
     currentValue = NULL_PTR(uint8*);
     previousValue = NULL_PTR(uint8*);
@@ -68,6 +69,9 @@ MessageGAM::~MessageGAM() {
     if (commandIndex != NULL_PTR(uint32*)) {
         delete[] commandIndex;
     }
+    if (eventConditionTriggers != NULL_PTR(EventConditionTrigger**)) {
+        delete[] eventConditionTriggers;
+    }
     cntTrigger = NULL_PTR(uint32*);
     currentValue = NULL_PTR(uint8*);
 }
@@ -194,12 +198,19 @@ bool MessageGAM::Setup() {
         ret = events.IsValid();
         if (ret) {
             numberOfEvents = events->Size();
-            for (uint32 i = 0u; i < numberOfEvents; i++) {
+            eventConditionTriggers = new EventConditionTrigger*[numberOfEvents];
+            for (uint32 i = 0u; (i < numberOfEvents) && (ret); i++) {
                 ReferenceT<EventConditionTrigger> eventCondition = events->Get(i);
                 ret = eventCondition.IsValid();
                 if (ret) {
                     ret = eventCondition->SetMetadataConfig(signalMetadata, numberOfFields);
                 }
+                else {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "Events must only contain EventConditionTrigger objects");
+                }
+                if (ret) {
+                    eventConditionTriggers[i] = eventCondition.operator ->();
+                }
             }
         }
 
@@ -275,13 +286,11 @@ bool MessageGAM::Execute() {
             /*lint -e{613} NULL pointer checked.*/
             if (cntTrigger[i] > 0u) {
                 for (uint32 j = 0u; j < numberOfEvents; j++) {
-                    ReferenceT<EventConditionTrigger> eventCondition = events->Get(j);
-                    if (eventCondition.IsValid()) {
-                        uint32 nReplies = eventCondition->Replied(&signalMetadata[commandIndex[i]], cntTrigger[i]);
-                        //TODO: Verify if nReplies can become greater than cntTrigger[i] and have it over-decrement
-                        /*lint -e{613} NULL pointer checked.*/
-                        cntTrigger[i] -= nReplies;
-                    }
+                    /*lint -e{613} NULL pointer checked.*/
+                    uint32 nReplies = eventConditionTriggers[j]->Replied(&signalMetadata[commandIndex[i]], cntTrigger[i]);
+                    //TODO: Verify if nReplies can become greater than cntTrigger[i] and have it over-decrement
+                    /*lint -e{613} NULL pointer checked.*/
+                    cntTrigger[i] -= nReplies;
                 }
             }
 
@@ -303,15 +312,13 @@ bool MessageGAM::Execute() {
             if (trigEvent) {
                 //rising edge, send the message associated to the code
                 for (uint32 j = 0u; j < numberOfEvents; j++) {
-                    ReferenceT<EventConditionTrigger> eventCondition = events->Get(j);
-                    if (eventCondition.IsValid()) {
+                    /*lint -e{613} NULL pointer checked.*/
+                    if (eventConditionTriggers[j]->Check(currentValue, &signalMetadata[commandIndex[i]])) {
                         /*lint -e{613} NULL pointer checked.*/
-                        if (eventCondition->Check(currentValue, &signalMetadata[commandIndex[i]])) {
-                            uint32 nMessages = eventCondition->Size();
-                            //trigger all the messages of that event
-                            /*lint -e{613} NULL pointer checked.*/
-                            cntTrigger[i] += nMessages;
-                        }
+                        uint32 nMessages = eventConditionTriggers[j]->GetNumberOfMessages();
+                        //trigger all the messages of that event
+                        /*lint -e{613} NULL pointer checked.*/
+                        cntTrigger[i] += nMessages;
                     }
                 }
                 /*lint -e{613} NULL pointer checked.*/
@@ -58,6 +58,7 @@ namespace MARTe{
  * - TriggerOnChange disabled: the GAM does not need to see an edge in command value to trigger the message, even across state changes.
  * As the GAM keeps track of sent messages and received replies, if the message sent as a consequence of a triggering event is still awaiting for a reply, no further message will
  * be sent until the reply acknowledgement.
+ * The messages of a triggered event which does not fit in the queue of the EventConditionTrigger are not sent nor counted (see EventConditionTrigger::Check).
  * Constraints:\n
  *   [number of commands] == [number of output signals]
  *   [output signals type] == uint32
@@ -216,6 +217,11 @@ protected:
      */
     ReferenceT<ReferenceContainer> events;
 
+    /**
+     * The EventConditionTrigger objects in events. The references in events keep them alive.
+     */
+    EventConditionTrigger **eventConditionTriggers;
+
     /**
      * The number of commands
      */
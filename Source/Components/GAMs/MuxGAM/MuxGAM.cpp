@@ -39,6 +39,30 @@
 
 namespace {
 
+/**
+ * @brief Copies output[i] = inputs[selector[i]][i] for each element.
+ */
+template<typename T>
+void MuxGAMGather(void * const output, void * const * const inputs, const MARTe::uint32 * const selector, const MARTe::uint32 numberOfElements) {
+    T * const out = static_cast<T *>(output);
+    for (MARTe::uint32 i = 0u; i < numberOfElements; i++) {
+        out[i] = static_cast<const T *>(inputs[selector[i]])[i];
+    }
+}
+
+/**
+ * @brief Copies output[i] = inputs[selector[i]][i] for each element, when the input signals are contiguous in memory
+ * starting at inputs[0]. The addresses are computed from the selector, without loading the input signal pointers.
+ */
+template<typename T>
+void MuxGAMGatherContiguous(void * const output, void * const * const inputs, const MARTe::uint32 * const selector, const MARTe::uint32 numberOfElements) {
+    T * const out = static_cast<T *>(output);
+    const T * const base = static_cast<const T *>(inputs[0]);
+    for (MARTe::uint32 i = 0u; i < numberOfElements; i++) {
+        out[i] = base[(selector[i] * numberOfElements) + i];
+    }
+}
+
 }
 
 /*---------------------------------------------------------------------------*/
@@ -56,7 +80,6 @@ MuxGAM::MuxGAM() :
     numberOfInputs = 0u;
     numberOfInputSignalsG = 0u;
     numberOfElements = 0u;
-    elementIndex = 0u;
     numberOfDimensions = 0u;
     numberOfSamples = 0u;
     outputSignals = NULL_PTR(void **);
@@ -64,6 +87,9 @@ MuxGAM::MuxGAM() :
     maxSelectorValue = 0u;
     numberOfElements = 0u;
     sizeToCopy = 0u;
+    invalidSelectorBehaviour = InvalidSelectorError;
+    validSelectors = NULL_PTR(uint32 *);
+    gatherFunction = NULL_PTR(void (*)(void * const, void * const * const, const uint32 * const, const uint32));
 }
 
 MuxGAM::~MuxGAM() {
@@ -85,9 +111,39 @@ MuxGAM::~MuxGAM() {
         }
         delete[] outputSignals;
     }
+    if (validSelectors != NULL_PTR(uint32 *)) {
+        delete[] validSelectors;
+    }
 }
 bool MuxGAM::Initialise(StructuredDataI &data) {
-    return GAM::Initialise(data);
+    bool ok = GAM::Initialise(data);
+    if (ok) {
+        StreamString invalidSelectorStr;
+        if (data.Read("InvalidSelector", invalidSelectorStr)) {
+            if (invalidSelectorStr == "Error") {
+                invalidSelectorBehaviour = InvalidSelectorError;
+            }
+            else if (invalidSelectorStr == "Clamp") {
+                invalidSelectorBehaviour = InvalidSelectorClamp;
+            }
+            else if (invalidSelectorStr == "Hold") {
+                invalidSelectorBehaviour = InvalidSelectorHold;
+            }
+            else {
+                ok = false;
+            }
+            if (ok) {
+                REPORT_ERROR(ErrorManagement::Information, "InvalidSelector set to %s", invalidSelectorStr.Buffer());
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Unknown InvalidSelector %s. Valid values are Error, Clamp or Hold", invalidSelectorStr.Buffer());
+            }
+        }
+        else {
+            invalidSelectorBehaviour = InvalidSelectorError;
+        }
+    }
+    return ok;
 }
 
 bool MuxGAM::Setup() {
@@ -327,6 +383,31 @@ bool MuxGAM::Setup() {
             outputSignals[i] = GetOutputSignalMemory(i);
         }
     }
+    if (ok) { //clamped or held selectors
+        validSelectors = new uint32[numberOfOutputs * numberOfSelectorElements];
+        for (uint32 i = 0u; i < (numberOfOutputs * numberOfSelectorElements); i++) {
+            validSelectors[i] = 0u;
+        }
+    }
+    if (ok) { //gather kernel for the element size
+        bool contiguous = true;
+        const uint8 * const firstInput = static_cast<const uint8 *>(inputSignals[0]);
+        for (uint32 i = 1u; (i < numberOfInputSignalsG) && (contiguous); i++) {
+            contiguous = (static_cast<const uint8 *>(inputSignals[i]) == &firstInput[i * sizeToCopy]);
+        }
+        if (typeSignals.numberOfBits == 8u) {
+            gatherFunction = contiguous ? &MuxGAMGatherContiguous<uint8> : &MuxGAMGather<uint8>;
+        }
+        else if (typeSignals.numberOfBits == 16u) {
+            gatherFunction = contiguous ? &MuxGAMGatherContiguous<uint16> : &MuxGAMGather<uint16>;
+        }
+        else if (typeSignals.numberOfBits == 32u) {
+            gatherFunction = contiguous ? &MuxGAMGatherContiguous<uint32> : &MuxGAMGather<uint32>;
+        }
+        else {
+            gatherFunction = contiguous ? &MuxGAMGatherContiguous<uint64> : &MuxGAMGather<uint64>;
+        }
+    }
     return ok;
 }
 
@@ -334,24 +415,53 @@ bool MuxGAM::Setup() {
 //MuxGAM::Execute() only is called if the Setup() succeeds and the pointers are initialized.
 bool MuxGAM::Execute() {
     bool ok = true;
-    if (numberOfSelectorElements == 1u) {
-        for (selectorIndex = 0u; (selectorIndex < numberOfOutputs) && ok; selectorIndex++) { //goes throughout each selector signal
-            if (IsValidSelector(selectors[selectorIndex][0])) {
-                ok = MemoryOperationsHelper::Copy(outputSignals[selectorIndex], inputSignals[selectors[selectorIndex][0]], sizeToCopy);
-                if (!ok) {
-                    REPORT_ERROR(ErrorManagement::FatalError, "MemoryOperationsHelper::Copy failed");
+    for (selectorIndex = 0u; (selectorIndex < numberOfOutputs) && ok; selectorIndex++) { //goes throughout each selector signal
+        const uint32 *selector = selectors[selectorIndex];
+        //Single range check of all the selector elements
+        uint32 maxValue = 0u;
+        for (uint32 i = 0u; i < numberOfSelectorElements; i++) {
+            maxValue = (selector[i] > maxValue) ? selector[i] : maxValue;
+        }
+        bool valid = IsValidSelector(maxValue);
+        uint32 * const corrected = &validSelectors[selectorIndex * numberOfSelectorElements];
+        if (invalidSelectorBehaviour == InvalidSelectorHold) {
+            if (valid) {
+                for (uint32 i = 0u; i < numberOfSelectorElements; i++) {
+                    corrected[i] = selector[i];
+                }
+            }
+            else {
+                for (uint32 i = 0u; i < numberOfSelectorElements; i++) {
+                    corrected[i] = IsValidSelector(selector[i]) ? selector[i] : corrected[i];
+                }
+            }
+            selector = corrected;
+        }
+        else if (!valid) {
+            if (invalidSelectorBehaviour == InvalidSelectorClamp) {
+                const uint32 lastInput = maxSelectorValue - 1u;
+                for (uint32 i = 0u; i < numberOfSelectorElements; i++) {
+                    corrected[i] = IsValidSelector(selector[i]) ? selector[i] : lastInput;
                 }
+                selector = corrected;
             }
             else {
-                REPORT_ERROR(ErrorManagement::FatalError,"Invalid selector value. selector value must be lower than %u", maxSelectorValue);
+                REPORT_ERROR(ErrorManagement::FatalError, "Invalid selector value. selector value ( = %u) must be lower than %u", maxValue, maxSelectorValue);
                 ok = false;
             }
         }
-    }
-    else {
-        for (selectorIndex = 0u; (selectorIndex < numberOfOutputs) && ok; selectorIndex++) { //goes throughout each selector signal
-            for (elementIndex = 0u; (elementIndex < numberOfElements) && ok; elementIndex++) {
-                ok = Copy();
+        else {
+            //All the selectors are valid
+        }
+        if (ok) {
+            if (numberOfSelectorElements == 1u) {
+                ok = MemoryOperationsHelper::Copy(outputSignals[selectorIndex], inputSignals[selector[0]], sizeToCopy);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::FatalError, "MemoryOperationsHelper::Copy failed");
+                }
+            }
+            else {
+                gatherFunction(outputSignals[selectorIndex], inputSignals, selector, numberOfElements);
             }
         }
     }
@@ -376,53 +486,6 @@ bool MuxGAM::IsValidType(TypeDescriptor const &typeRef) const {
     delete[] auxBool;
     return retVal;
 }
-//lint -e{613} Possible use of null pointer 'MARTe::MuxGAM::selectors' in left argument to operator '[. Copy() only is used in
-//MuxGAM::Execute() and this function only is called if the Setup() succeeds and the pointers are initialized
-inline bool MuxGAM::Copy() const {
-    bool ret;
-    uint32 selectorValue = selectors[selectorIndex][elementIndex];
-    ret = IsValidSelector(selectorValue);
-    if (!ret) {
-        REPORT_ERROR(ErrorManagement::FatalError, "Invalid selector value. selector value ( = %u) must be lower than %u", selectorValue, maxSelectorValue);
-    }
-    if (ret) {
-        if (typeSignals == Float32Bit) {
-            static_cast<float32 *>(outputSignals[selectorIndex])[elementIndex] = static_cast<float32 *>(inputSignals[selectorValue])[elementIndex];
-        }
-        else if (typeSignals == Float64Bit) {
-            static_cast<float64 *>(outputSignals[selectorIndex])[elementIndex] = static_cast<float64 *>(inputSignals[selectorValue])[elementIndex];
-        }
-        else if (typeSignals == SignedInteger8Bit) {
-            static_cast<int8 *>(outputSignals[selectorIndex])[elementIndex] = static_cast<int8 *>(inputSignals[selectorValue])[elementIndex];
-        }
-        else if (typeSignals == UnsignedInteger8Bit) {
-            static_cast<uint8 *>(outputSignals[selectorIndex])[elementIndex] = static_cast<uint8 *>(inputSignals[selectorValue])[elementIndex];
-        }
-        else if (typeSignals == SignedInteger16Bit) {
-            static_cast<int16 *>(outputSignals[selectorIndex])[elementIndex] = static_cast<int16 *>(inputSignals[selectorValue])[elementIndex];
-        }
-        else if (typeSignals == UnsignedInteger16Bit) {
-            static_cast<uint16 *>(outputSignals[selectorIndex])[elementIndex] = static_cast<uint16 *>(inputSignals[selectorValue])[elementIndex];
-        }
-        else if (typeSignals == SignedInteger32Bit) {
-            static_cast<int32 *>(outputSignals[selectorIndex])[elementIndex] = static_cast<int32 *>(inputSignals[selectorValue])[elementIndex];
-        }
-        else if (typeSignals == UnsignedInteger32Bit) {
-            static_cast<uint32 *>(outputSignals[selectorIndex])[elementIndex] = static_cast<uint32 *>(inputSignals[selectorValue])[elementIndex];
-        }
-        else if (typeSignals == SignedInteger64Bit) {
-            static_cast<int64 *>(outputSignals[selectorIndex])[elementIndex] = static_cast<int64 *>(inputSignals[selectorValue])[elementIndex];
-        }
-        else if (typeSignals == UnsignedInteger64Bit) {
-            static_cast<uint64 *>(outputSignals[selectorIndex])[elementIndex] = static_cast<uint64 *>(inputSignals[selectorValue])[elementIndex];
-        }
-        else {
-            ret = false;
-        }
-    }
-    return ret;
-}
-
 inline bool MuxGAM::IsValidSelector(const uint32 value) const {
     return (value < maxSelectorValue);
 }
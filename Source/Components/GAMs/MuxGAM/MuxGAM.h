@@ -99,11 +99,23 @@ namespace MARTe {
  *  \n
  * As can be observed the same input can be connected to several outputs.
  *
- * If an invalid selector is sent the GAM::Execute() returns an error
- * *The configuration syntax is (names and signal quantity are only given as an example):
+ * The selectors of each output are range checked once per cycle, before any element is copied. What happens
+ * with an invalid selector (i.e. not lower than the number of input signals) depends on the optional parameter InvalidSelector:
+ * <ul>
+ * <li>Error (default): GAM::Execute() returns an error and the output controlled by the invalid selector is not modified.</li>
+ * <li>Clamp: the invalid selector elements are replaced by the last input signal index.</li>
+ * <li>Hold: the invalid selector elements are replaced by the last valid value of the same selector element (0 if none).</li>
+ * </ul>
+ *
+ * When the selectors are arrays, the elements are gathered with a loop specialised for the signal type size. If the
+ * input signals are contiguous in memory (as allocated by the framework) the element address is computed from the
+ * selector value, so that the loop can be vectorised with gather instructions where the target supports them.
+ *
+ * The configuration syntax is (names and signal quantity are only given as an example):
  *<pre>
  * +MuxGAM1 = {
  *     Class = MuxGAM
+ *     InvalidSelector = Clamp //Optional. Error, Clamp or Hold. Default = Error.
  *     InputSignals = {
  *         Selector0 = {
  *             DataSource = "DDB1"
@@ -169,7 +181,6 @@ public:
      * numberOfInputs = 0u\n
      * numberOfInputSignalsG = 0u\n
      * numberOfElements = 0u\n
-     * elementIndex = 0u\n
      * numberOfDimensions = 0u\n
      * numberOfSamples = 0u\n
      * outputSignals = NULL_PTR(void **)\n
@@ -177,6 +188,9 @@ public:
      * maxSelectorValue = 0u\n
      * numberOfElements = 0u\n
      * sizeToCopy = 0u\n
+     * invalidSelectorBehaviour = InvalidSelectorError\n
+     * validSelectors = NULL_PTR(uint32 *)\n
+     * gatherFunction = NULL_PTR\n
      */
     MuxGAM();
 
@@ -188,8 +202,9 @@ public:
     virtual ~MuxGAM();
 
     /**
-     * @brief Calls GAM:Initialise(StructuredDataI &data)
+     * @brief Calls GAM:Initialise(StructuredDataI &data) and reads the InvalidSelector parameter.
      * @param[in] data configuration of the GAM
+     * @return true if GAM::Initialise succeeds and InvalidSelector, if set, is Error, Clamp or Hold.
      */
     virtual bool Initialise(StructuredDataI &data);
 
@@ -202,7 +217,8 @@ public:
 
     /**
      * @brief Copies the selected input signals to the output signals.
-     * @details if selector is an array the input signals are copied element by element.
+     * @details The selectors of each output are checked and, if needed, corrected according to the InvalidSelector
+     * behaviour before copying. If the selector is an array the elements are gathered from the selected input signals.
      * If the selector has one element the input signals are copied as a block.
      * @return true if the copy is successfully done
      */
@@ -252,11 +268,6 @@ private:
      */
     uint32 numberOfElements;
 
-    /**
-     * index to go through the elements array
-     */
-    uint32 elementIndex;
-
     /**
      * All inputs/outputs and selectors (which are inputs) must have the same dimension. numberOfDimensions= 1.
      */
@@ -287,6 +298,39 @@ private:
      */
     uint32 sizeToCopy;
 
+    /**
+     * The possible behaviours when a selector is invalid.
+     */
+    enum InvalidSelectorBehaviour {
+        /**
+         * Execute fails.
+         */
+        InvalidSelectorError = 0,
+        /**
+         * Use the last input signal.
+         */
+        InvalidSelectorClamp = 1,
+        /**
+         * Use the last valid selector value.
+         */
+        InvalidSelectorHold = 2
+    };
+
+    /**
+     * The invalid selector behaviour.
+     */
+    InvalidSelectorBehaviour invalidSelectorBehaviour;
+
+    /**
+     * The clamped or held selectors (numberOfSelectorElements for each output).
+     */
+    uint32 *validSelectors;
+
+    /**
+     * Copies output[i] = inputs[selector[i]][i] for each of the numberOfElements elements.
+     */
+    void (*gatherFunction)(void * const output, void * const * const inputs, const uint32 * const selector, const uint32 numberOfElements);
+
     /**
      * @brief Checks that a give type is a supported type.
      * @details valid types:
@@ -305,13 +349,6 @@ private:
      */
     bool IsValidType(TypeDescriptor const &typeRef) const;
 
-    /**
-     * @brief Copies a preselected input to the output
-     * @details The copy is performed element by element as a function of the selector value
-     * @return true if the copy succeed
-     */
-    inline bool Copy()const;
-
     /**
      * @brief Checks that a given selector is valid.
      * @details a valid selector must be a number smaller than the number of inputs signals
@@ -38,7 +38,25 @@
 /*---------------------------------------------------------------------------*/
 
 namespace {
+/**
+ * Number of PIDs updated by each pass of PIDGAM::ExecuteBlock.
+ */
+const MARTe::uint32 PIDGAM_BLOCK_SIZE = 16u;
+
+/**
+ * Number of parameters which can be defined for each PID (Kp, Ki, Kd, MaxOutput and MinOutput).
+ */
+const MARTe::uint32 PIDGAM_NUMBER_OF_PARAMETERS = 5u;
 
+/**
+ * Names of the parameters which can be defined for each PID.
+ */
+const MARTe::char8 * const PIDGAM_PARAMETER_NAMES[PIDGAM_NUMBER_OF_PARAMETERS] = { "Kp", "Ki", "Kd", "MaxOutput", "MinOutput" };
+
+/**
+ * Number of arrays in the memory of the PID bank.
+ */
+const MARTe::uint32 PIDGAM_NUMBER_OF_CONTROLLER_ARRAYS = 7u;
 }
 
 /*---------------------------------------------------------------------------*/
@@ -49,20 +67,17 @@ namespace MARTe {
 
 PIDGAM::PIDGAM() :
         GAM() {
-    kp = 0.0;
-    proportional = 0.0;
-    ki = 0.0;
-    kid = 0.0;
-    integral = 0.0;
-    kd = 0.0;
-    kdd = 0.0;
-    derivative = 0.0;
     sampleTime = 0.0;
-    maxOutput = MAX_FLOAT64;
-    minOutput = -MAX_FLOAT64;
-    enableIntegral = true;
-    lastInput = 0.0;
-    lastIntegral = 0.0;
+    numberOfParameterElements = 0u;
+    parameters = NULL_PTR(float64 *);
+    controllers = NULL_PTR(float64 *);
+    kp = NULL_PTR(float64 *);
+    kid = NULL_PTR(float64 *);
+    kdd = NULL_PTR(float64 *);
+    maxOutput = NULL_PTR(float64 *);
+    minOutput = NULL_PTR(float64 *);
+    lastInput = NULL_PTR(float64 *);
+    integralState = NULL_PTR(float64 *);
     enableSubstraction = false;
     reference = NULL_PTR(float64 *);
     sizeInputOutput = 0u;
@@ -83,6 +98,12 @@ PIDGAM::PIDGAM() :
 }
 
 PIDGAM::~PIDGAM() {
+    if (parameters != NULL_PTR(float64 *)) {
+        delete[] parameters;
+    }
+    if (controllers != NULL_PTR(float64 *)) {
+        delete[] controllers;
+    }
     reference = NULL_PTR(float64 *);
     measurement = NULL_PTR(float64 *);
     output = NULL_PTR(float64 *);
@@ -91,19 +112,18 @@ PIDGAM::~PIDGAM() {
 bool PIDGAM::Initialise(StructuredDataI &data) {
     bool ok = GAM::Initialise(data);
     if (ok) {
-        ok = data.Read("Kp", kp);
-        bool aux;
-        aux = data.Read("Ki", ki);
-        ok = (ok || aux);
-        aux = data.Read("Kd", kd);
-        ok = (ok || aux);
-        if (!ok) {
-            REPORT_ERROR(ErrorManagement::InitialisationError, "kp, ki and kd missing. At least one parameter must be initialised");
-        }
-        //lint -e{9007} No side effect on the function IsEqual.
-        if (IsEqual(kp, 0.0) && IsEqual(ki, 0.0) && IsEqual(kd, 0.0)) {
-            REPORT_ERROR(ErrorManagement::InitialisationError, "kp = ki = kd = 0.");
-            ok = false;
+        ok = ReadParameters(data);
+    }
+    if (ok) {
+        const float64 * const kpValues = &parameters[0u];
+        const float64 * const kiValues = &parameters[numberOfParameterElements];
+        const float64 * const kdValues = &parameters[2u * numberOfParameterElements];
+        for (uint32 i = 0u; (i < numberOfParameterElements) && (ok); i++) {
+            //lint -e{9007} No side effect on the function IsEqual.
+            if (IsEqual(kpValues[i], 0.0) && IsEqual(kiValues[i], 0.0) && IsEqual(kdValues[i], 0.0)) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "kp = ki = kd = 0. (element %u)", i);
+                ok = false;
+            }
         }
     }
     if (ok) {
@@ -119,30 +139,112 @@ bool PIDGAM::Initialise(StructuredDataI &data) {
         }
     }
     if (ok) {
-        kid = ki * sampleTime;
-        kdd = kd / sampleTime;
+        const float64 * const maxValues = &parameters[3u * numberOfParameterElements];
+        const float64 * const minValues = &parameters[4u * numberOfParameterElements];
+        for (uint32 i = 0u; (i < numberOfParameterElements) && (ok); i++) {
+            if (maxValues[i] < minValues[i]) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "maxOutput < minOutput. maxOutput must be larger than minOutput (element %u)", i);
+                ok = false;
+            }
+            else if (IsEqual(maxValues[i], minValues[i])) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "maxOutput = minOutput. maxOutput must be larger than minOutput (element %u)", i);
+                ok = false;
+            }
+            else {
+                //Valid limits
+            }
+        }
     }
-    if (ok) {
-        ok = data.Read("MaxOutput", maxOutput);
-        if (!ok) {
-            maxOutput = MAX_FLOAT64;
+    return ok;
+}
+
+bool PIDGAM::ReadParameters(StructuredDataI &data) {
+    bool ok = true;
+    bool gainDefined = false;
+    uint32 numberOfElements[PIDGAM_NUMBER_OF_PARAMETERS];
+    numberOfParameterElements = 1u;
+    for (uint32 k = 0u; (k < PIDGAM_NUMBER_OF_PARAMETERS) && (ok); k++) {
+        AnyType parameterType = data.GetType(PIDGAM_PARAMETER_NAMES[k]);
+        numberOfElements[k] = 0u;
+        if (parameterType.GetDataPointer() != NULL) {
+            numberOfElements[k] = parameterType.GetNumberOfElements(0u);
+            ok = (numberOfElements[k] > 0u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "%s must have at least one element", PIDGAM_PARAMETER_NAMES[k]);
+            }
+            if (ok) {
+                if (numberOfElements[k] > 1u) {
+                    if (numberOfParameterElements == 1u) {
+                        numberOfParameterElements = numberOfElements[k];
+                    }
+                    else if (numberOfElements[k] != numberOfParameterElements) {
+                        REPORT_ERROR(ErrorManagement::InitialisationError, "%s has %u elements while a previous parameter has %u elements",
+                                     PIDGAM_PARAMETER_NAMES[k], numberOfElements[k], numberOfParameterElements);
+                        ok = false;
+                    }
+                    else {
+                        //Same number of elements
+                    }
+                }
+            }
+            if (k < 3u) {
+                gainDefined = true;
+            }
         }
-        ok = data.Read("MinOutput", minOutput);
+    }
+    if (ok) {
+        ok = gainDefined;
         if (!ok) {
-            minOutput = -MAX_FLOAT64;
-        }
-        ok = true;
-        if (maxOutput < minOutput) {
-            REPORT_ERROR(ErrorManagement::InitialisationError, "maxOutput < minOutput. maxOutput must be larger than minOutput");
-            ok = false;
+            REPORT_ERROR(ErrorManagement::InitialisationError, "kp, ki and kd missing. At least one parameter must be initialised");
         }
-        if (IsEqual(maxOutput, minOutput)) {
-            REPORT_ERROR(ErrorManagement::InitialisationError, "maxOutput = minOutput. maxOutput must be larger than minOutput");
-            ok = false;
+    }
+    if (ok) {
+        if (parameters != NULL_PTR(float64 *)) {
+            delete[] parameters;
+        }
+        parameters = new float64[PIDGAM_NUMBER_OF_PARAMETERS * numberOfParameterElements];
+        for (uint32 k = 0u; (k < PIDGAM_NUMBER_OF_PARAMETERS) && (ok); k++) {
+            float64 * const values = &parameters[k * numberOfParameterElements];
+            float64 value = 0.0;
+            if (k == 3u) {
+                value = MAX_FLOAT64;
+            }
+            else if (k == 4u) {
+                value = -MAX_FLOAT64;
+            }
+            else {
+                value = 0.0;
+            }
+            if (numberOfElements[k] == 1u) {
+                AnyType parameterType = data.GetType(PIDGAM_PARAMETER_NAMES[k]);
+                if (parameterType.GetNumberOfDimensions() == 0u) {
+                    ok = data.Read(PIDGAM_PARAMETER_NAMES[k], value);
+                }
+                else {
+                    Vector<float64> valueVector(&value, 1u);
+                    ok = data.Read(PIDGAM_PARAMETER_NAMES[k], valueVector);
+                }
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "Error reading %s", PIDGAM_PARAMETER_NAMES[k]);
+                }
+            }
+            if (numberOfElements[k] > 1u) {
+                Vector<float64> valuesVector(values, numberOfParameterElements);
+                ok = data.Read(PIDGAM_PARAMETER_NAMES[k], valuesVector);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "Error reading %s", PIDGAM_PARAMETER_NAMES[k]);
+                }
+            }
+            else {
+                for (uint32 i = 0u; i < numberOfParameterElements; i++) {
+                    values[i] = value;
+                }
+            }
         }
     }
     return ok;
 }
+
 bool PIDGAM::Setup() {
     bool ok = true;
     nOfInputSignals = GetNumberOfInputSignals();
@@ -173,9 +275,8 @@ bool PIDGAM::Setup() {
             REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalNumberOfElements returned an error for numberOfInputElementsReference");
         }
         if (ok) {
-            if (numberOfInputElementsReference != 1u) {
-                REPORT_ERROR(ErrorManagement::InitialisationError, "The numberOfInputElementsReference value must be one. The crrent value is %u",
-                             numberOfInputElementsReference);
+            if (numberOfInputElementsReference == 0u) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The numberOfInputElementsReference value must be positive");
                 ok = false;
             }
         }
@@ -207,6 +308,13 @@ bool PIDGAM::Setup() {
                 ok = false;
             }
         }
+        if (ok) {
+            if ((numberOfParameterElements != 1u) && (numberOfParameterElements != numberOfOutputElements)) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The gains and saturation limits must be scalars or have %u elements. They have %u elements",
+                             numberOfOutputElements, numberOfParameterElements);
+                ok = false;
+            }
+        }
     }
 
     if (ok) {
@@ -315,59 +423,93 @@ bool PIDGAM::Setup() {
         }
         output = static_cast<float64 *>(GetOutputSignalMemory(0u));
     }
+    if (ok) {
+        if (controllers != NULL_PTR(float64 *)) {
+            delete[] controllers;
+        }
+        controllers = new float64[PIDGAM_NUMBER_OF_CONTROLLER_ARRAYS * numberOfOutputElements];
+        kp = &controllers[0u];
+        kid = &controllers[numberOfOutputElements];
+        kdd = &controllers[2u * numberOfOutputElements];
+        maxOutput = &controllers[3u * numberOfOutputElements];
+        minOutput = &controllers[4u * numberOfOutputElements];
+        lastInput = &controllers[5u * numberOfOutputElements];
+        integralState = &controllers[6u * numberOfOutputElements];
+        const uint32 parameterStep = (numberOfParameterElements == 1u) ? 0u : 1u;
+        for (uint32 i = 0u; i < numberOfOutputElements; i++) {
+            const uint32 j = i * parameterStep;
+            kp[i] = parameters[j];
+            kid[i] = parameters[numberOfParameterElements + j] * sampleTime;
+            kdd[i] = parameters[(2u * numberOfParameterElements) + j] / sampleTime;
+            maxOutput[i] = parameters[(3u * numberOfParameterElements) + j];
+            minOutput[i] = parameters[(4u * numberOfParameterElements) + j];
+            lastInput[i] = 0.0;
+            integralState[i] = 0.0;
+        }
+    }
 
     return ok;
 }
 bool PIDGAM::Execute() {
-    GetValue();
-    Saturation();
+    for (uint32 first = 0u; first < numberOfOutputElements; first += PIDGAM_BLOCK_SIZE) {
+        uint32 size = numberOfOutputElements - first;
+        if (size > PIDGAM_BLOCK_SIZE) {
+            size = PIDGAM_BLOCK_SIZE;
+        }
+        ExecuteBlock(first, size);
+    }
     return true;
 }
 
 //lint -e{613} The Setup() function guarantee that the pointers are not NULL.
-void PIDGAM::GetValue() {
+void PIDGAM::ExecuteBlock(const uint32 first,
+                          const uint32 size) {
+    //The block is computed in local arrays and written back at the end, so that the compute loop only reads
+    //through the member pointers and is vectorised without run-time aliasing checks.
+    float64 errorBlock[PIDGAM_BLOCK_SIZE];
+    float64 integralBlock[PIDGAM_BLOCK_SIZE];
+    float64 outputBlock[PIDGAM_BLOCK_SIZE];
+    const float64 * const referenceBlock = &reference[first];
     if (enableSubstraction) {
-        float64 error;
-        error = *reference - *measurement;
-        proportional = kp * error;
-        if (enableIntegral) {
-            integral = (error * kid) + lastIntegral;
-        }
-        else {
-            integral = error * kid;
+        const float64 * const measurementBlock = &measurement[first];
+        for (uint32 j = 0u; j < size; j++) {
+            errorBlock[j] = referenceBlock[j] - measurementBlock[j];
         }
-        derivative = (error - lastInput) * kdd;
-        lastInput = error;
     }
     else {
-        proportional = kp * *reference;
-        if (enableIntegral) {
-            integral = ((*reference * kid) + lastIntegral);
+        for (uint32 j = 0u; j < size; j++) {
+            errorBlock[j] = referenceBlock[j];
         }
-        else {
-            integral = *reference * kid;
-        }
-        derivative = (*reference - lastInput) * kdd;
-        lastInput = *reference;
-    }
-    output[0] = proportional + integral + derivative;
-    lastIntegral = integral;
-}
-
-//lint -e{613} The Setup() function guarantee that the pointers are not NULL.
-void PIDGAM::Saturation() {
-    if (output[0] > maxOutput) {
-        output[0] = maxOutput;
-        enableIntegral = false;
     }
-    else if (output[0] < minOutput) {
-        output[0] = minOutput;
-        enableIntegral = false;
+    const float64 * const kpBlock = &kp[first];
+    const float64 * const kidBlock = &kid[first];
+    const float64 * const kddBlock = &kdd[first];
+    const float64 * const maxBlock = &maxOutput[first];
+    const float64 * const minBlock = &minOutput[first];
+    const float64 * const lastInputBlock = &lastInput[first];
+    const float64 * const integralStateBlock = &integralState[first];
+    for (uint32 j = 0u; j < size; j++) {
+        const float64 error = errorBlock[j];
+        const float64 integral = (error * kidBlock[j]) + integralStateBlock[j];
+        const float64 value = ((kpBlock[j] * error) + integral) + ((error - lastInputBlock[j]) * kddBlock[j]);
+        //Both limits are loaded and compared for every element, so that the selects are free of branches.
+        const float64 maxValue = maxBlock[j];
+        const float64 minValue = minBlock[j];
+        const bool saturated = (value > maxValue) || (value < minValue);
+        const float64 upperLimited = (value > maxValue) ? maxValue : value;
+        outputBlock[j] = (upperLimited < minValue) ? minValue : upperLimited;
+        integralBlock[j] = saturated ? 0.0 : integral;
     }
-    else {
-        enableIntegral = true;
+    float64 * const outputDestination = &output[first];
+    float64 * const lastInputDestination = &lastInput[first];
+    float64 * const integralStateDestination = &integralState[first];
+    for (uint32 j = 0u; j < size; j++) {
+        outputDestination[j] = outputBlock[j];
+        lastInputDestination[j] = errorBlock[j];
+        integralStateDestination[j] = integralBlock[j];
     }
 }
+
 CLASS_REGISTER(PIDGAM, "1.0")
 }
 
@@ -71,6 +71,15 @@ namespace MARTe {
  * \f$ \n
  * Notice that the lastIntegral is not added to the output.\n
  *
+ * The signals may be arrays of N elements (reference, measurement and output must have the same number of elements).
+ * In this case the GAM implements a bank of N independent PIDs, where the element i of the output is computed from
+ * the element i of the inputs. Each of Kp, Ki, Kd, MaxOutput and MinOutput can be either a scalar, which is used by all the PIDs,
+ * or an array of N elements with the value for each PID. The anti-windup acts independently on each PID.\n
+ * The gains, the saturation limits and the state (last error and integral term) of the PIDs are kept in contiguous arrays and
+ * the whole bank is updated in a single pass over blocks of elements, without branches, so that the compiler can vectorise it.
+ * The integral term carried to the next cycle is set to zero when the output of the PID is saturated, which is
+ * equivalent to not adding the lastIntegral.
+ *
  *
  *The configuration syntax is (names and signal quantity are only given as an example):
  *
@@ -111,6 +120,38 @@ namespace MARTe {
  * }
  * </pre>
  *
+ * A bank of three PIDs with the same Ki and Kd and different Kp and saturation limits:
+ * <pre>
+ * +PIDBank = {
+ *     Class = PIDGAM
+ *     Kp = {10.0 20.0 5.0}
+ *     Ki = 1.0
+ *     Kd = 0.0
+ *     SampleTime = 0.001
+ *     MaxOutput = {500.0 100.0 50.0}
+ *     MinOutput = -500.0
+ *     InputSignals = {
+ *         Reference = {
+ *             DataSource = "DDB1"
+ *             Type = float64
+ *             NumberOfElements = 3
+ *         }
+ *         Measurement = {
+ *             DataSource = "DDB1"
+ *             Type = float64
+ *             NumberOfElements = 3
+ *         }
+ *     }
+ *     OutputSignals = {
+ *         Output = {
+ *             DataSource = "DDB1"
+ *             Type = float64
+ *             NumberOfElements = 3
+ *         }
+ *     }
+ * }
+ * </pre>
+ *
  */
 class PIDGAM: public GAM {
 public:
@@ -118,20 +159,11 @@ public:
     /**
      * @brief Default constructor
      * @post
-     * kp = 0.0\n
-     * proportional = 0.0\n
-     * ki = 0.0\n
-     * kid = 0.0\n
-     * integral = 0.0\n
-     * kd = 0.0\n
-     * kdd = 0.0\n
-     * derivative = 0.0\n
      * sampleTime = 0.0\n
-     * maxOutput = MAX_FLOAT64\n
-     * minOutput = -MAX_FLOAT64\n
-     * enableIntegral = true\n
-     * lastInput = 0.0\n
-     * lastIntegral = 0.0
+     * numberOfParameterElements = 0u\n
+     * parameters = NULL_PTR(float64 *)\n
+     * controllers = NULL_PTR(float64 *)\n
+     * kp = kid = kdd = maxOutput = minOutput = lastInput = integralState = NULL_PTR(float64 *)\n
      * enableSubstraction = false\n
      * reference = NULL_PTR(float64 *)\n
      * sizeInputOutput = 0u\n
@@ -152,7 +184,7 @@ public:
 PIDGAM    ();
 
     /**
-     * @brief Default constructor.
+     * @brief Destructor. Frees the parameters and the state of the PIDs.
      * @post
      * reference = NULL_PTR(float64 *)\n
      * measurement = NULL_PTR(float64 *)\n
@@ -164,16 +196,17 @@ PIDGAM    ();
      * @brief Initialise the parameters of the GAM according to the configuration file
      * @param[in] data GAM configuration
      * @details Load the following parameters from a predefined configuration \n
-     * kp\n
-     * ki\n
-     * kd\n
-     * sampleTime\n
-     * maxOutput (optional)\n
-     * minOutput (optional)\n
+     * Kp\n
+     * Ki\n
+     * Kd\n
+     * SampleTime\n
+     * MaxOutput (optional)\n
+     * MinOutput (optional)\n
+     * Kp, Ki, Kd, MaxOutput and MinOutput can be scalars or arrays. All the arrays must have the same number of elements.
      * @post
-     * kp != 0.0 || ki != 0.0 || kd != 0.0\n
+     * for each PID: kp != 0.0 || ki != 0.0 || kd != 0.0\n
      * sampleTime > 0.0\n
-     * maxOutpt > minOutput\n
+     * for each PID: maxOutput > minOutput\n
      * @return true if all postconditions are met
      */
     virtual bool Initialise(StructuredDataI &data);
@@ -182,12 +215,15 @@ PIDGAM    ();
      * @brief Setup the input/output variables.
      * @details Initialise the input and output pointers and verify the number of elements, number
      * of samples and dimension. Moreover, a flag is set to 1 if the error must be calculated internally.
+     * The gains and the saturation limits of each PID are copied (scalars are replicated) to the contiguous
+     * arrays used by Execute() and the state of the PIDs is reset.
      * @post
      * nOfInputSignals = 1 || nOfInputSignals = 2\n
      * nOfOutputSignals = 1\n
-     * numberOfInputElementsReference = 1\n
-     * numberOfInputElementsMeasurement = 1\n
-     * numberOfOutputElements = 1\n
+     * numberOfInputElementsReference > 0\n
+     * numberOfInputElementsMeasurement = numberOfInputElementsReference\n
+     * numberOfOutputElements = numberOfInputElementsReference\n
+     * numberOfParameterElements = 1 || numberOfParameterElements = numberOfOutputElements\n
      * numberOfInputSamplesReference = 1\n
      * numberOfInputSamplesMeasurement = 1\n
      * numberOfOuputSamples = 1\n
@@ -203,82 +239,83 @@ PIDGAM    ();
 
     /**
      * @brief Implements the PID.
-     * @details First computes the PID, then saturates the output if needed. If the output
-     * is saturated a flag prevents the integral term to continuing growing.
+     * @details For each element, first computes the PID, then saturates the output if needed. If the output
+     * is saturated the integral term carried to the next cycle is zeroed, which prevents it from continuing growing.
      * @return true.
      */
     virtual bool Execute();
 private:
 
     /**
-     * proportional coefficient in the time domain in the time domain
-     */
-    float64 kp;
-
-    /**
-     * contribution of the proportional term
+     * @brief Reads Kp, Ki, Kd, MaxOutput and MinOutput as scalars or arrays.
+     * @param[in] data GAM configuration.
+     * @return true if at least one of Kp, Ki and Kd is defined and all the arrays have the same number of elements.
      */
-    float64 proportional;
+    bool ReadParameters(StructuredDataI &data);
 
     /**
-     * integral coefficient in the time domain
+     * @brief Updates the PIDs from \a first to \a first + size - 1.
+     * @param[in] first the index of the first PID.
+     * @param[in] size the number of PIDs, not larger than the block size.
      */
-    float64 ki;
+    inline void ExecuteBlock(const uint32 first,
+                             const uint32 size);
 
     /**
-     * Integral coefficient in the discrete domain. kid = kid * sampleTime. It is used to speed up the operations
+     * Indicates the time between samples.
      */
-    float64 kid;
+    float64 sampleTime;
 
     /**
-     * contribution of the integral term
+     * Number of elements of the Kp, Ki, Kd, MaxOutput and MinOutput arrays. 1 if they are all scalars.
      */
-    float64 integral;
+    uint32 numberOfParameterElements;
 
     /**
-     * Derivative coefficient in the time domain
+     * Kp, Ki, Kd, MaxOutput and MinOutput as read from the configuration, numberOfParameterElements each.
      */
-    float64 kd;
+    float64 *parameters;
 
     /**
-     * Derivative coefficient in the discrete domain. kdd= kd/sampleTime. It is used to speed up the operations
+     * Memory of the PID bank: kp, kid, kdd, maxOutput, minOutput, lastInput and integralState,
+     * numberOfOutputElements each.
      */
-    float64 kdd;
+    float64 *controllers;
 
     /**
-     * Contribution of the derivative term.
+     * Proportional coefficient of each PID.
      */
-    float64 derivative;
+    float64 *kp;
 
     /**
-     * Indicates the time between samples.
+     * Integral coefficient of each PID in the discrete domain. kid = ki * sampleTime. It is used to speed up the operations
      */
-    float64 sampleTime;
+    float64 *kid;
 
     /**
-     * upper limit saturation
+     * Derivative coefficient of each PID in the discrete domain. kdd = kd / sampleTime. It is used to speed up the operations
      */
-    float64 maxOutput;
+    float64 *kdd;
 
     /**
-     * lower limit saturation
+     * Upper saturation limit of each PID.
      */
-    float64 minOutput;
+    float64 *maxOutput;
 
     /**
-     * Enables/disable the integral term when saturation is acting (anti-windup function)
+     * Lower saturation limit of each PID.
      */
-    bool enableIntegral;
+    float64 *minOutput;
 
     /**
-     * Save the last input value
+     * Last input (error) value of each PID.
      */
-    float64 lastInput;
+    float64 *lastInput;
 
     /**
-     * Save the last integrated term
+     * Integral term of each PID to be accumulated in the next cycle. It is zero when the output was saturated (anti-windup function).
      */
-    float64 lastIntegral;
+    float64 *integralState;
 
     /**
      * When enableSubstraction is 1 the GAM expects two inputs: reference value and the feedback value (the actual measurement).
@@ -361,16 +398,6 @@ private:
      */
     uint32 outputDimension;
 
-    /**
-     * @brief Implements the PID
-     */
-    inline void GetValue();
-
-    /**
-     * Saturates the output of the PID if needed.
-     */
-    inline void Saturation();
-
 };
 
 }
@@ -38,7 +38,31 @@
 /*---------------------------------------------------------------------------*/
 
 namespace {
+/**
+ * The columns of the coefficients are padded to a multiple of this number of elements (one 64 byte cache line).
+ */
+const MARTe::uint32 SSMGAM_COEFFICIENTS_ALIGNMENT = 8u;
 
+/**
+ * With MatrixStorage = Auto the sparse coefficients are used if at most one every SSMGAM_SPARSE_DENSITY_RATIO coefficients is non-zero.
+ */
+const MARTe::uint32 SSMGAM_SPARSE_DENSITY_RATIO = 10u;
+
+/**
+ * @brief Counts the non-zero elements of a row-major block.
+ */
+MARTe::uint32 CountNonZeros(const MARTe::float64 * const values,
+                            const MARTe::uint32 numberOfValues) {
+    MARTe::uint32 count = 0u;
+    if (values != NULL_PTR(const MARTe::float64 *)) {
+        for (MARTe::uint32 i = 0u; i < numberOfValues; i++) {
+            if (values[i] != 0.0) {
+                count++;
+            }
+        }
+    }
+    return count;
+}
 }
 
 /*---------------------------------------------------------------------------*/
@@ -49,26 +73,21 @@ namespace MARTe {
 
 SSMGAM::SSMGAM() :
         GAM() {
-    stateMatrixPointer = NULL_PTR(float64 **);
-    intermediateState1Pointer = NULL_PTR(float64 **);
-    intermediateState2Pointer = NULL_PTR(float64 **);
-    stateMatrixNumberOfRows = 0u;
-    stateMatrixNumberOfColumns = 0u;
-
+    stateMatrixPointer = NULL_PTR(float64 *);
     stateMatrixNumberOfRows = 0u;
     stateMatrixNumberOfColumns = 0u;
     sizeStateVector = 0u;
     sizeDerivativeStateVector = 0u;
 
-    inputMatrixPointer = NULL_PTR(float64 **);
+    inputMatrixPointer = NULL_PTR(float64 *);
     inputMatrixNumberOfRows = 0u;
     inputMatrixNumberOfColumns = 0u;
 
-    outputMatrixPointer = NULL_PTR(float64 **);
+    outputMatrixPointer = NULL_PTR(float64 *);
     outputMatrixNumberOfRows = 0u;
     outputMatrixNumberOfColumns = 0u;
 
-    feedthroughMatrixPointer = NULL_PTR(float64 **);
+    feedthroughMatrixPointer = NULL_PTR(float64 *);
     feedthroughMatrixNumberOfRows = 0u;
     feedthroughMatrixNumberOfColumns = 0u;
 
@@ -85,10 +104,18 @@ SSMGAM::SSMGAM() :
 
     inputVectorPointer = NULL_PTR(float64 **);
     outputVectorPointer = NULL_PTR(float64 **);
-    intermediateOutput1Pointer = NULL_PTR(float64 **);
-    intermediateOutput2Pointer = NULL_PTR(float64 **);
     stateVectorPointer = NULL_PTR(float64 **);
-    derivativeStateVectorPointer = NULL_PTR(float64 **);
+    coefficients = NULL_PTR(float64 *);
+    coefficientsStride = 0u;
+    stateBuffers = NULL_PTR(float64 *);
+    currentState = NULL_PTR(float64 *);
+    nextState = NULL_PTR(float64 *);
+    inputValues = NULL_PTR(float64 *);
+    inputProducts = NULL_PTR(float64 *);
+    sparseValues = NULL_PTR(float64 *);
+    sparseColumnIndices = NULL_PTR(uint32 *);
+    sparseRowPointers = NULL_PTR(uint32 *);
+    matrixStorage = MatrixStorageAuto;
     sampleFrequency = 0.0;
 
     enableFeedthroughMatrix = false;
@@ -97,145 +124,75 @@ SSMGAM::SSMGAM() :
 
 //lint -e{1551} Function may throw exception --> The exceptions are not managed
 SSMGAM::~SSMGAM() {
-    if (stateMatrixPointer != NULL_PTR(float64 **)) {
-        for (uint32 row = 0u; row < stateMatrixNumberOfRows; row++) {
-            if (stateMatrixPointer[row] != NULL_PTR(float64 *)) {
-                delete stateMatrixPointer[row];
-                stateMatrixPointer[row] = NULL_PTR(float64 *);
-            }
-        }
+    if (stateMatrixPointer != NULL_PTR(float64 *)) {
         delete[] stateMatrixPointer;
-        stateMatrixPointer = NULL_PTR(float64 **);
+        stateMatrixPointer = NULL_PTR(float64 *);
     }
-    if (inputMatrixPointer != NULL_PTR(float64 **)) {
-        for (uint32 row = 0u; row < inputMatrixNumberOfRows; row++) {
-            if (inputMatrixPointer[row] != NULL_PTR(float64 *)) {
-                delete inputMatrixPointer[row];
-                inputMatrixPointer[row] = NULL_PTR(float64 *);
-            }
-        }
+    if (inputMatrixPointer != NULL_PTR(float64 *)) {
         delete[] inputMatrixPointer;
-        inputMatrixPointer = NULL_PTR(float64 **);
+        inputMatrixPointer = NULL_PTR(float64 *);
     }
-    if (outputMatrixPointer != NULL_PTR(float64 **)) {
-        for (uint32 row = 0u; row < outputMatrixNumberOfRows; row++) {
-            if (outputMatrixPointer[row] != NULL_PTR(float64 *)) {
-                delete outputMatrixPointer[row];
-                outputMatrixPointer[row] = NULL_PTR(float64 *);
-            }
-        }
+    if (outputMatrixPointer != NULL_PTR(float64 *)) {
         delete[] outputMatrixPointer;
-        outputMatrixPointer = NULL_PTR(float64 **);
+        outputMatrixPointer = NULL_PTR(float64 *);
     }
-    if (feedthroughMatrixPointer != NULL_PTR(float64 **)) {
-        for (uint32 row = 0u; row < feedthroughMatrixNumberOfRows; row++) {
-            if (feedthroughMatrixPointer[row] != NULL_PTR(float64 *)) {
-                delete feedthroughMatrixPointer[row];
-                feedthroughMatrixPointer[row] = NULL_PTR(float64 *);
-            }
-        }
+    if (feedthroughMatrixPointer != NULL_PTR(float64 *)) {
         delete[] feedthroughMatrixPointer;
-        feedthroughMatrixPointer = NULL_PTR(float64 **);
+        feedthroughMatrixPointer = NULL_PTR(float64 *);
     }
     if (inputVectorPointer != NULL_PTR(float64 **)) {
-        for (uint32 row = 0u; row < numberOfInputSignalsGAM; row++) {
-            if (inputVectorPointer[row] != NULL_PTR(float64 *)) {
-                inputVectorPointer[row] = NULL_PTR(float64 *);
-            }
-        }
         delete[] inputVectorPointer;
         inputVectorPointer = NULL_PTR(float64 **);
     }
     if (outputVectorPointer != NULL_PTR(float64 **)) {
-        for (uint32 row = 0u; row < sizeOutputVector; row++) {
-            if (outputVectorPointer[row] != NULL_PTR(float64 *)) {
-                outputVectorPointer[row] = NULL_PTR(float64 *);
-            }
-        }
         delete[] outputVectorPointer;
         outputVectorPointer = NULL_PTR(float64 **);
     }
     if (stateVectorPointer != NULL_PTR(float64 **)) {
-        for (uint32 row = 0u; row < sizeStateVector; row++) {
-            if (stateVectorPointer[row] != NULL_PTR(float64 *)) {
-                stateVectorPointer[row] = NULL_PTR(float64 *);
-            }
-        }
         delete[] stateVectorPointer;
         stateVectorPointer = NULL_PTR(float64 **);
     }
-    if (derivativeStateVectorPointer != NULL_PTR(float64 **)) {
-        for (uint32 row = 0u; row < sizeDerivativeStateVector; row++) {
-            if (derivativeStateVectorPointer[row] != NULL_PTR(float64 *)) {
-                delete[] derivativeStateVectorPointer[row];
-            }
-        }
-        delete[] derivativeStateVectorPointer;
-        derivativeStateVectorPointer = NULL_PTR(float64 **);
+    if (coefficients != NULL_PTR(float64 *)) {
+        delete[] coefficients;
+        coefficients = NULL_PTR(float64 *);
     }
-    if (intermediateOutput1Pointer != NULL_PTR(float64 **)) {
-        for (uint32 row = 0u; row < sizeOutputVector; row++) {
-            if (intermediateOutput1Pointer[row] != NULL_PTR(float64 *)) {
-                delete[] intermediateOutput1Pointer[row];
-                intermediateOutput1Pointer[row] = NULL_PTR(float64 *);
-            }
-        }
-        delete[] intermediateOutput1Pointer;
-        intermediateOutput1Pointer = NULL_PTR(float64 **);
+    if (stateBuffers != NULL_PTR(float64 *)) {
+        delete[] stateBuffers;
+        stateBuffers = NULL_PTR(float64 *);
     }
-    if (intermediateOutput2Pointer != NULL_PTR(float64 **)) {
-        for (uint32 row = 0u; row < sizeOutputVector; row++) {
-            if (intermediateOutput2Pointer[row] != NULL_PTR(float64 *)) {
-                delete[] intermediateOutput2Pointer[row];
-                intermediateOutput2Pointer[row] = NULL_PTR(float64 *);
-            }
-        }
-        delete[] intermediateOutput2Pointer;
-        intermediateOutput2Pointer = NULL_PTR(float64 **);
+    if (sparseValues != NULL_PTR(float64 *)) {
+        delete[] sparseValues;
+        sparseValues = NULL_PTR(float64 *);
     }
-    if (intermediateState1Pointer != NULL_PTR(float64 **)) {
-        for (uint32 row = 0u; row < stateMatrixNumberOfRows; row++) {
-            if (intermediateState1Pointer[row] != NULL_PTR(float64 *)) {
-                delete[] intermediateState1Pointer[row];
-                intermediateState1Pointer[row] = NULL_PTR(float64 *);
-            }
-        }
-        delete[] intermediateState1Pointer;
-        intermediateState1Pointer = NULL_PTR(float64 **);
+    if (sparseColumnIndices != NULL_PTR(uint32 *)) {
+        delete[] sparseColumnIndices;
+        sparseColumnIndices = NULL_PTR(uint32 *);
     }
-    if (intermediateState2Pointer != NULL_PTR(float64 **)) {
-        for (uint32 row = 0u; row < stateMatrixNumberOfRows; row++) {
-            if (intermediateState2Pointer[row] != NULL_PTR(float64 *)) {
-                delete[] intermediateState2Pointer[row];
-                intermediateState2Pointer[row] = NULL_PTR(float64 *);
-            }
-        }
-        delete[] intermediateState2Pointer;
-        intermediateState2Pointer = NULL_PTR(float64 **);
+    if (sparseRowPointers != NULL_PTR(uint32 *)) {
+        delete[] sparseRowPointers;
+        sparseRowPointers = NULL_PTR(uint32 *);
     }
+    currentState = NULL_PTR(float64 *);
+    nextState = NULL_PTR(float64 *);
+    inputValues = NULL_PTR(float64 *);
+    inputProducts = NULL_PTR(float64 *);
 }
 
 bool SSMGAM::Initialise(StructuredDataI &data) {
     bool ok = GAM::Initialise(data);
 
     if (ok) { //load state matrix
-        AnyType functionsMatrix;
-        functionsMatrix = data.GetType("StateMatrix");
-        ok = (functionsMatrix.GetDataPointer() != NULL);
+        ok = GetMatrixDimensions(data, "StateMatrix", stateMatrixNumberOfRows, stateMatrixNumberOfColumns);
         if (!ok) {
             REPORT_ERROR(ErrorManagement::InitialisationError, "Error getting type for StateMatrix");
         }
         if (ok) {
-            //0u are columns
-            stateMatrixNumberOfColumns = functionsMatrix.GetNumberOfElements(0u);
             ok = (stateMatrixNumberOfColumns > 0u);
             if (!ok) {
                 REPORT_ERROR(ErrorManagement::InitialisationError, "The number of state matrix columns must be positive");
             }
         }
         if (ok) {
-            //1u are rows...
-            stateMatrixNumberOfRows = functionsMatrix.GetNumberOfElements(1u);
             ok = (stateMatrixNumberOfRows == stateMatrixNumberOfColumns);
             if (!ok) {
                 REPORT_ERROR(ErrorManagement::InitialisationError, "The number of rows and columns of the state matrix must be the same. stateMatrixNumberOfRows = %u stateMatrixNumberOfColumns = %u",stateMatrixNumberOfRows, stateMatrixNumberOfColumns);
@@ -243,22 +200,9 @@ bool SSMGAM::Initialise(StructuredDataI &data) {
         }
 
         if (ok) { // allocate state matrix memory and read matrix coefficients
-            stateMatrixPointer = new float64 *[stateMatrixNumberOfRows];
-            intermediateState1Pointer = new float64 *[stateMatrixNumberOfRows];
-            intermediateState2Pointer = new float64 *[stateMatrixNumberOfRows];
-            //lint -e{613} Possible use of null pointer--> If new fails the program crashes.
-            for (uint32 i = 0u; (i < stateMatrixNumberOfRows) && ok; i++) {
-                stateMatrixPointer[i] = new float64[stateMatrixNumberOfColumns];
-                intermediateState1Pointer[i] = new float64[1u];
-                intermediateState2Pointer[i] = new float64[1u];
-            }
-            if (ok) {
-                Matrix<float64> matrix(stateMatrixPointer, stateMatrixNumberOfRows, stateMatrixNumberOfColumns);
-                ok = (data.Read("StateMatrix", matrix));
-                if (!ok) { //since data.GetType("StateMatrix") does not fail data.Read("StateMatrix", matrix) cannot fail.
-                    REPORT_ERROR(ErrorManagement::InitialisationError, "Error reading StateMatrix");
-                }
-            }
+            stateMatrixPointer = ReadMatrix(data, "StateMatrix", stateMatrixNumberOfRows, stateMatrixNumberOfColumns);
+            //since data.GetType("StateMatrix") does not fail data.Read("StateMatrix", matrix) cannot fail.
+            ok = (stateMatrixPointer != NULL_PTR(float64 *));
         }
         if (ok) {
             sizeStateVector = stateMatrixNumberOfRows;
@@ -266,23 +210,17 @@ bool SSMGAM::Initialise(StructuredDataI &data) {
         }
     }
     if (ok) { //load input matrix
-        AnyType functionsMatrix;
-        functionsMatrix = data.GetType("InputMatrix");
-        ok = (functionsMatrix.GetDataPointer() != NULL);
+        ok = GetMatrixDimensions(data, "InputMatrix", inputMatrixNumberOfRows, inputMatrixNumberOfColumns);
         if (!ok) {
             REPORT_ERROR(ErrorManagement::InitialisationError, "Error getting type for InputMatrix");
         }
         if (ok) {
-            //0u are columns
-            inputMatrixNumberOfColumns = functionsMatrix.GetNumberOfElements(0u);
             ok = (inputMatrixNumberOfColumns > 0u);
             if (!ok) {
                 REPORT_ERROR(ErrorManagement::InitialisationError, "The number of input matrix columns must be positive");
             }
         }
         if (ok) {
-            //1u are rows...
-            inputMatrixNumberOfRows = functionsMatrix.GetNumberOfElements(1u);
             ok = (inputMatrixNumberOfRows == stateMatrixNumberOfRows);
             if (!ok) {
                 REPORT_ERROR(ErrorManagement::InitialisationError,"the number of input matrix rows must be the same than the number of state matrix rows. inputMatrixNumberOfRows = %u stateMatrixNumberOfRows = %u",inputMatrixNumberOfRows, stateMatrixNumberOfRows);
@@ -291,40 +229,24 @@ bool SSMGAM::Initialise(StructuredDataI &data) {
         }
 
         if (ok) { // allocate input matrix memory and read matrix coefficients
-            inputMatrixPointer = new float64 *[inputMatrixNumberOfRows];
-            //lint -e{613} Possible use of null pointer--> If new fails the program crashes.
-            for (uint32 i = 0u; (i < inputMatrixNumberOfRows) && ok; i++) {
-                inputMatrixPointer[i] = new float64[inputMatrixNumberOfColumns];
-            }
-            if (ok) {
-                Matrix<float64> matrix(inputMatrixPointer, inputMatrixNumberOfRows, inputMatrixNumberOfColumns);
-                ok = (data.Read("InputMatrix", matrix));
-                if (!ok) {
-                    REPORT_ERROR(ErrorManagement::InitialisationError, "Error reading InputMatrix");
-                }
-            }
+            inputMatrixPointer = ReadMatrix(data, "InputMatrix", inputMatrixNumberOfRows, inputMatrixNumberOfColumns);
+            ok = (inputMatrixPointer != NULL_PTR(float64 *));
         }
 
     }
 
     if (ok) { //load output matrix
-        AnyType functionsMatrix;
-        functionsMatrix = data.GetType("OutputMatrix");
-        ok = (functionsMatrix.GetDataPointer() != NULL);
+        ok = GetMatrixDimensions(data, "OutputMatrix", outputMatrixNumberOfRows, outputMatrixNumberOfColumns);
         if (!ok) {
             REPORT_ERROR(ErrorManagement::InitialisationError, "Error getting type for OutputMatrix");
         }
         if (ok) {
-            //0u are columns
-            outputMatrixNumberOfColumns = functionsMatrix.GetNumberOfElements(0u);
             ok = (outputMatrixNumberOfColumns == stateMatrixNumberOfColumns);
             if (!ok) {
                 REPORT_ERROR(ErrorManagement::InitialisationError, "The number of output matrix columns must be equal than the number of state matrix columns");
             }
         }
         if (ok) {
-            //1u are rows...
-            outputMatrixNumberOfRows = functionsMatrix.GetNumberOfElements(1u);
             ok = (outputMatrixNumberOfRows > 0u);
             if (!ok) {
                 REPORT_ERROR(ErrorManagement::InitialisationError, "the number of output matrix rows must be positive");
@@ -332,39 +254,38 @@ bool SSMGAM::Initialise(StructuredDataI &data) {
         }
 
         if (ok) { // allocate output matrix memory and read matrix coefficients
-            outputMatrixPointer = new float64 *[outputMatrixNumberOfRows];
-            //lint -e{613} Possible use of null pointer--> If new fails the computer crashes
-            for (uint32 i = 0u; (i < outputMatrixNumberOfRows) && ok; i++) {
-                outputMatrixPointer[i] = new float64[outputMatrixNumberOfColumns];
-            }
-            //lint -e{613} Possible use of null pointer--> Pointers previously checked.
-            if (ok) {
-                Matrix<float64> outputMatrix1(outputMatrixPointer, outputMatrixNumberOfRows, outputMatrixNumberOfColumns);
-                ok = (data.Read("OutputMatrix", outputMatrix1));
-                if (!ok) {
-                    REPORT_ERROR(ErrorManagement::InitialisationError, "Error reading outputMatrix");
-                }
-            }
+            outputMatrixPointer = ReadMatrix(data, "OutputMatrix", outputMatrixNumberOfRows, outputMatrixNumberOfColumns);
+            ok = (outputMatrixPointer != NULL_PTR(float64 *));
         }
     }
 
     if (ok) { //load feedthrough matrix
-        AnyType functionsMatrix;
-        functionsMatrix = data.GetType("FeedthroughMatrix");
-        bool warning = (functionsMatrix.GetDataPointer() == NULL);
-        if (warning) {
+        //the feedthrough matrix is optional, but if it is defined (dense or CSR) it must be valid
+        bool defined = data.MoveRelative("FeedthroughMatrix");
+        if (defined) {
+            ok = data.MoveToAncestor(1u);
+        }
+        else {
+            AnyType functionsMatrix = data.GetType("FeedthroughMatrix");
+            defined = (functionsMatrix.GetDataPointer() != NULL);
+        }
+        if (!defined) {
             REPORT_ERROR(ErrorManagement::Warning, "Error getting type for FeedthroughMatrix. Matrix not defined");
         }
         else {
-            //0u are columns
-            feedthroughMatrixNumberOfColumns = functionsMatrix.GetNumberOfElements(0u);
-            ok = (feedthroughMatrixNumberOfColumns == inputMatrixNumberOfColumns);
-            if (!ok) {
-                REPORT_ERROR(ErrorManagement::InitialisationError, "The number of feedthrough matrix columns must be equal than the number of input matrix columns");
+            if (ok) {
+                ok = GetMatrixDimensions(data, "FeedthroughMatrix", feedthroughMatrixNumberOfRows, feedthroughMatrixNumberOfColumns);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "Error getting type for FeedthroughMatrix");
+                }
+            }
+            if (ok) {
+                ok = (feedthroughMatrixNumberOfColumns == inputMatrixNumberOfColumns);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "The number of feedthrough matrix columns must be equal than the number of input matrix columns");
+                }
             }
             if (ok) {
-                //1u are rows...
-                feedthroughMatrixNumberOfRows = functionsMatrix.GetNumberOfElements(1u);
                 ok = (feedthroughMatrixNumberOfRows == outputMatrixNumberOfRows);
                 if (!ok) {
                     REPORT_ERROR(ErrorManagement::InitialisationError, "the number of feedthough matrix rows must be equal than the number of output matrix rows");
@@ -372,18 +293,8 @@ bool SSMGAM::Initialise(StructuredDataI &data) {
             }
 
             if (ok) { // allocate feedthrough matrix memory and read matrix coefficients
-                feedthroughMatrixPointer = new float64 *[feedthroughMatrixNumberOfRows];
-                //lint -e{613} Possible use of null pointer--> If new fails the program crashes.
-                for (uint32 i = 0u; (i < feedthroughMatrixNumberOfRows) && ok; i++) {
-                    feedthroughMatrixPointer[i] = new float64[feedthroughMatrixNumberOfColumns];
-                }
-                if (ok) {
-                    Matrix<float64> matrix(feedthroughMatrixPointer, feedthroughMatrixNumberOfRows, feedthroughMatrixNumberOfColumns);
-                    ok = (data.Read("FeedthroughMatrix", matrix));
-                }
-                if (!ok) {
-                    REPORT_ERROR(ErrorManagement::InitialisationError, "Error reading feedthroughMatrix");
-                }
+                feedthroughMatrixPointer = ReadMatrix(data, "FeedthroughMatrix", feedthroughMatrixNumberOfRows, feedthroughMatrixNumberOfColumns);
+                ok = (feedthroughMatrixPointer != NULL_PTR(float64 *));
             }
         }
 
@@ -407,9 +318,254 @@ bool SSMGAM::Initialise(StructuredDataI &data) {
             }
         }
     }
+    if (ok) {
+        StreamString matrixStorageStr;
+        if (data.Read("MatrixStorage", matrixStorageStr)) {
+            if (matrixStorageStr == "Auto") {
+                matrixStorage = MatrixStorageAuto;
+            }
+            else if (matrixStorageStr == "Dense") {
+                matrixStorage = MatrixStorageDense;
+            }
+            else if (matrixStorageStr == "Sparse") {
+                matrixStorage = MatrixStorageSparse;
+            }
+            else {
+                ok = false;
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Unknown MatrixStorage %s. Valid values are Auto, Dense or Sparse", matrixStorageStr.Buffer());
+            }
+        }
+        else {
+            matrixStorage = MatrixStorageAuto;
+        }
+    }
+    return ok;
+}
+
+bool SSMGAM::GetMatrixDimensions(StructuredDataI &data,
+                                 const char8 * const name,
+                                 uint32 &numberOfRows,
+                                 uint32 &numberOfColumns) {
+    bool ok;
+    if (data.MoveRelative(name)) { //CSR form
+        ok = data.Read("NumberOfRows", numberOfRows);
+        if (ok) {
+            ok = data.Read("NumberOfColumns", numberOfColumns);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "NumberOfRows and NumberOfColumns must be specified for %s", name);
+        }
+        if (!data.MoveToAncestor(1u)) {
+            ok = false;
+        }
+    }
+    else {
+        AnyType functionsMatrix;
+        functionsMatrix = data.GetType(name);
+        ok = (functionsMatrix.GetDataPointer() != NULL);
+        if (ok) {
+            //0u are columns, 1u are rows
+            numberOfColumns = functionsMatrix.GetNumberOfElements(0u);
+            numberOfRows = functionsMatrix.GetNumberOfElements(1u);
+        }
+    }
+    return ok;
+}
+
+float64 *SSMGAM::ReadMatrix(StructuredDataI &data,
+                            const char8 * const name,
+                            const uint32 numberOfRows,
+                            const uint32 numberOfColumns) {
+    float64 *matrixValues = new float64[numberOfRows * numberOfColumns];
+    bool ok;
+    if (data.MoveRelative(name)) {
+        ok = ReadSparseMatrix(data, name, matrixValues, numberOfRows, numberOfColumns);
+        if (!data.MoveToAncestor(1u)) {
+            ok = false;
+        }
+    }
+    else {
+        Matrix<float64> matrix(matrixValues, numberOfRows, numberOfColumns);
+        ok = data.Read(name, matrix);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Error reading %s", name);
+        }
+    }
+    if (!ok) {
+        delete[] matrixValues;
+        matrixValues = NULL_PTR(float64 *);
+    }
+    return matrixValues;
+}
+
+bool SSMGAM::ReadSparseMatrix(StructuredDataI &data,
+                              const char8 * const name,
+                              float64 * const matrixValues,
+                              const uint32 numberOfRows,
+                              const uint32 numberOfColumns) {
+    uint32 *rowPointers = new uint32[numberOfRows + 1u];
+    Vector<uint32> rowPointersVector(rowPointers, numberOfRows + 1u);
+    AnyType functionsArray = data.GetType("RowPointers");
+    bool ok = (functionsArray.GetDataPointer() != NULL);
+    if (ok) {
+        ok = (functionsArray.GetNumberOfElements(0u) == (numberOfRows + 1u));
+    }
+    if (ok) {
+        ok = data.Read("RowPointers", rowPointersVector);
+    }
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "The RowPointers of %s must have NumberOfRows + 1 elements", name);
+    }
+    if (ok) {
+        ok = (rowPointers[0u] == 0u);
+        for (uint32 i = 0u; (i < numberOfRows) && (ok); i++) {
+            ok = (rowPointers[i] <= rowPointers[i + 1u]);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The RowPointers of %s must start with 0 and be non-decreasing", name);
+        }
+    }
+    for (uint32 i = 0u; i < (numberOfRows * numberOfColumns); i++) {
+        matrixValues[i] = 0.0;
+    }
+    const uint32 numberOfValues = (ok) ? (rowPointers[numberOfRows]) : (0u);
+    if (numberOfValues > 0u) {
+        float64 *values = new float64[numberOfValues];
+        uint32 *columnIndices = new uint32[numberOfValues];
+        functionsArray = data.GetType("Values");
+        ok = (functionsArray.GetDataPointer() != NULL);
+        if (ok) {
+            ok = (functionsArray.GetNumberOfElements(0u) == numberOfValues);
+        }
+        if (ok) {
+            functionsArray = data.GetType("ColumnIndices");
+            ok = (functionsArray.GetDataPointer() != NULL);
+        }
+        if (ok) {
+            ok = (functionsArray.GetNumberOfElements(0u) == numberOfValues);
+        }
+        if (ok) {
+            Vector<float64> valuesVector(values, numberOfValues);
+            ok = data.Read("Values", valuesVector);
+        }
+        if (ok) {
+            Vector<uint32> columnIndicesVector(columnIndices, numberOfValues);
+            ok = data.Read("ColumnIndices", columnIndicesVector);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The Values and ColumnIndices of %s must have RowPointers[NumberOfRows] elements", name);
+        }
+        for (uint32 i = 0u; (i < numberOfRows) && (ok); i++) {
+            for (uint32 e = rowPointers[i]; (e < rowPointers[i + 1u]) && (ok); e++) {
+                ok = (columnIndices[e] < numberOfColumns);
+                if (ok) {
+                    matrixValues[(i * numberOfColumns) + columnIndices[e]] += values[e];
+                }
+                else {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "The ColumnIndices of %s must be lower than NumberOfColumns", name);
+                }
+            }
+        }
+        delete[] values;
+        delete[] columnIndices;
+    }
+    delete[] rowPointers;
     return ok;
 }
 
+/*lint -e{613} Initialise() guarantees that the A, B and C matrices are not NULL.*/
+void SSMGAM::BuildCoefficients() {
+    const uint32 numberOfCoefficientColumns = stateMatrixNumberOfColumns + inputMatrixNumberOfColumns;
+    if (coefficients != NULL_PTR(float64 *)) {
+        delete[] coefficients;
+    }
+    coefficients = new float64[coefficientsStride * numberOfCoefficientColumns];
+    for (uint32 k = 0u; k < (coefficientsStride * numberOfCoefficientColumns); k++) {
+        coefficients[k] = 0.0;
+    }
+    for (uint32 j = 0u; j < stateMatrixNumberOfColumns; j++) {
+        float64 * const column = &coefficients[j * coefficientsStride];
+        for (uint32 i = 0u; i < outputMatrixNumberOfRows; i++) {
+            column[i] = outputMatrixPointer[(i * outputMatrixNumberOfColumns) + j];
+        }
+        for (uint32 i = 0u; i < stateMatrixNumberOfRows; i++) {
+            column[outputMatrixNumberOfRows + i] = stateMatrixPointer[(i * stateMatrixNumberOfColumns) + j];
+        }
+    }
+    for (uint32 j = 0u; j < inputMatrixNumberOfColumns; j++) {
+        float64 * const column = &coefficients[(stateMatrixNumberOfColumns + j) * coefficientsStride];
+        if (feedthroughMatrixPointer != NULL_PTR(float64 *)) {
+            for (uint32 i = 0u; i < feedthroughMatrixNumberOfRows; i++) {
+                column[i] = feedthroughMatrixPointer[(i * feedthroughMatrixNumberOfColumns) + j];
+            }
+        }
+        for (uint32 i = 0u; i < inputMatrixNumberOfRows; i++) {
+            column[outputMatrixNumberOfRows + i] = inputMatrixPointer[(i * inputMatrixNumberOfColumns) + j];
+        }
+    }
+}
+
+/*lint -e{613} Initialise() guarantees that the A, B and C matrices are not NULL.*/
+void SSMGAM::BuildSparseCoefficients() {
+    const uint32 numberOfCoefficientRows = outputMatrixNumberOfRows + stateMatrixNumberOfRows;
+    const uint32 numberOfValues = GetNumberOfNonZeroCoefficients();
+    if (sparseValues != NULL_PTR(float64 *)) {
+        delete[] sparseValues;
+    }
+    if (sparseColumnIndices != NULL_PTR(uint32 *)) {
+        delete[] sparseColumnIndices;
+    }
+    if (sparseRowPointers != NULL_PTR(uint32 *)) {
+        delete[] sparseRowPointers;
+    }
+    sparseValues = new float64[numberOfValues];
+    sparseColumnIndices = new uint32[numberOfValues];
+    sparseRowPointers = new uint32[(2u * numberOfCoefficientRows) + 1u];
+    uint32 e = 0u;
+    for (uint32 i = 0u; i < numberOfCoefficientRows; i++) {
+        const float64 *stateRow;
+        const float64 *inputRow;
+        if (i < outputMatrixNumberOfRows) {
+            stateRow = &outputMatrixPointer[i * outputMatrixNumberOfColumns];
+            inputRow = NULL_PTR(const float64 *);
+            if (feedthroughMatrixPointer != NULL_PTR(float64 *)) {
+                inputRow = &feedthroughMatrixPointer[i * feedthroughMatrixNumberOfColumns];
+            }
+        }
+        else {
+            stateRow = &stateMatrixPointer[(i - outputMatrixNumberOfRows) * stateMatrixNumberOfColumns];
+            inputRow = &inputMatrixPointer[(i - outputMatrixNumberOfRows) * inputMatrixNumberOfColumns];
+        }
+        sparseRowPointers[2u * i] = e;
+        for (uint32 j = 0u; j < stateMatrixNumberOfColumns; j++) {
+            if (stateRow[j] != 0.0) {
+                sparseValues[e] = stateRow[j];
+                sparseColumnIndices[e] = j;
+                e++;
+            }
+        }
+        sparseRowPointers[(2u * i) + 1u] = e;
+        if (inputRow != NULL_PTR(const float64 *)) {
+            for (uint32 j = 0u; j < inputMatrixNumberOfColumns; j++) {
+                if (inputRow[j] != 0.0) {
+                    sparseValues[e] = inputRow[j];
+                    sparseColumnIndices[e] = j;
+                    e++;
+                }
+            }
+        }
+    }
+    sparseRowPointers[2u * numberOfCoefficientRows] = e;
+}
+
+uint32 SSMGAM::GetNumberOfNonZeroCoefficients() const {
+    uint32 count = CountNonZeros(stateMatrixPointer, stateMatrixNumberOfRows * stateMatrixNumberOfColumns);
+    count += CountNonZeros(inputMatrixPointer, inputMatrixNumberOfRows * inputMatrixNumberOfColumns);
+    count += CountNonZeros(outputMatrixPointer, outputMatrixNumberOfRows * outputMatrixNumberOfColumns);
+    count += CountNonZeros(feedthroughMatrixPointer, feedthroughMatrixNumberOfRows * feedthroughMatrixNumberOfColumns);
+    return count;
+}
+
 bool SSMGAM::Setup() {
     bool ok;
     numberOfInputSignalsGAM = GetNumberOfInputSignals();
@@ -542,16 +698,16 @@ bool SSMGAM::Setup() {
                 REPORT_ERROR(ErrorManagement::ParametersError, "Error reading the number of input samples for signal %u", auxIdx);
             }
             if (ok) {
-                ok = (auxSamples == 1u);
+                if (i == 0u) {
+                    numberOfInputSamples = auxSamples;
+                }
+                ok = ((auxSamples > 0u) && (auxSamples == numberOfInputSamples));
                 if (!ok) {
                     uint32 auxIdx = i;
-                    REPORT_ERROR(ErrorManagement::ParametersError, "the number of samples for the input %u must be 1", auxIdx);
+                    REPORT_ERROR(ErrorManagement::ParametersError, "the number of samples for the input %u must be positive and the same for all the inputs", auxIdx);
                 }
             }
         }
-        if (ok) {
-            numberOfInputSamples = auxSamples;
-        }
     }
 
     if (ok) { //output samples
@@ -563,10 +719,10 @@ bool SSMGAM::Setup() {
                 REPORT_ERROR(ErrorManagement::ParametersError, "Error reading the number of output samples for signal %u", auxIdx);
             }
             if (ok) {
-                ok = (auxSamples == 1u);
+                ok = (auxSamples == numberOfInputSamples);
                 if (!ok) {
                     uint32 auxIdx = i;
-                    REPORT_ERROR(ErrorManagement::ParametersError, "the number of samples for the output %u must be 1", auxIdx);
+                    REPORT_ERROR(ErrorManagement::ParametersError, "the number of samples for the output %u must be the same as the number of samples of the inputs", auxIdx);
                 }
             }
         }
@@ -576,7 +732,7 @@ bool SSMGAM::Setup() {
     }
     if (ok) {
         inputVectorPointer = new float64 *[numberOfInputSignalsGAM];
-        for (uint32 i = 0u; i < numberOfInputSignalsGAM; i++) {
+        for (uint32 i = 0u; (i < numberOfInputSignalsGAM) && (ok); i++) {
             inputVectorPointer[i] = static_cast<float64 *>(GetInputSignalMemory(i));
             ok = (inputVectorPointer[i] != NULL_PTR(float64 *));
             if (!ok) {
@@ -585,23 +741,23 @@ bool SSMGAM::Setup() {
             }
 
         }
+    }
+    if (ok) {
         outputVectorPointer = new float64 *[sizeOutputVector];
-        intermediateOutput1Pointer = new float64 *[sizeOutputVector];
-        intermediateOutput2Pointer = new float64 *[sizeOutputVector];
         //lint -e{613} Possible use of null pointer--> If new fails the program crashes.
-        for (uint32 i = 0u; (i < sizeOutputVector); i++) {
+        for (uint32 i = 0u; (i < sizeOutputVector) && (ok); i++) {
             outputVectorPointer[i] = static_cast<float64 *>(GetOutputSignalMemory(i));
             ok = (outputVectorPointer[i] != NULL_PTR(float64 *));
             if (!ok) {
                 uint32 auxIdx = i;
                 REPORT_ERROR(ErrorManagement::ParametersError, "GetOutputSignalMemory(%u) returned a null pointer", auxIdx);
             }
-            intermediateOutput1Pointer[i] = new float64[1u];
-            intermediateOutput2Pointer[i] = new float64[1u];
         }
+    }
+    if (ok) {
         stateVectorPointer = new float64 *[sizeStateVector];
         uint32 auxIdx = 0u;
-        for (uint32 i = sizeOutputVector; (i < (sizeOutputVector + sizeStateVector)); i++) {
+        for (uint32 i = sizeOutputVector; (i < (sizeOutputVector + sizeStateVector)) && (ok); i++) {
             stateVectorPointer[auxIdx] = static_cast<float64 *>(GetOutputSignalMemory(i));
             ok = (stateVectorPointer[auxIdx] != NULL_PTR(float64 *));
             if (!ok) {
@@ -610,61 +766,119 @@ bool SSMGAM::Setup() {
             }
             auxIdx++;
         }
-        derivativeStateVectorPointer = new float64 *[sizeDerivativeStateVector];
-        for (uint32 i = 0u; (i < sizeDerivativeStateVector); i++) {
-            derivativeStateVectorPointer[i] = new float64 [1u];
-        }
-        if (ok) {
-            stateMatrix = Matrix<float64>(stateMatrixPointer, stateMatrixNumberOfRows, stateMatrixNumberOfColumns);
-            intermediateState1 = Matrix<float64>(intermediateState1Pointer, stateMatrixNumberOfRows, 1u);
-            intermediateState2 = Matrix<float64>(intermediateState2Pointer, stateMatrixNumberOfRows, 1u);
-            outputMatrix = Matrix<float64>(outputMatrixPointer, outputMatrixNumberOfRows, outputMatrixNumberOfColumns);
-            if (feedthroughMatrixPointer != NULL_PTR(float64 **)) {
-                feedthroughMatrix = Matrix<float64>(feedthroughMatrixPointer, feedthroughMatrixNumberOfRows, feedthroughMatrixNumberOfColumns);
-                enableFeedthroughMatrix = true;
+    }
+    if (ok) {
+        const uint32 numberOfCoefficientRows = outputMatrixNumberOfRows + stateMatrixNumberOfRows;
+        coefficientsStride = ((numberOfCoefficientRows + SSMGAM_COEFFICIENTS_ALIGNMENT) - 1u) / SSMGAM_COEFFICIENTS_ALIGNMENT;
+        coefficientsStride *= SSMGAM_COEFFICIENTS_ALIGNMENT;
+        if (matrixStorage == MatrixStorageAuto) {
+            const uint32 numberOfCoefficients = numberOfCoefficientRows * (stateMatrixNumberOfColumns + inputMatrixNumberOfColumns);
+            if ((GetNumberOfNonZeroCoefficients() * SSMGAM_SPARSE_DENSITY_RATIO) <= numberOfCoefficients) {
+                matrixStorage = MatrixStorageSparse;
             }
             else {
-                enableFeedthroughMatrix = false;
+                matrixStorage = MatrixStorageDense;
             }
-
-            stateVector = Matrix<float64>(stateVectorPointer, sizeStateVector, 1u);
-            outputVector = Matrix<float64>(outputVectorPointer, outputMatrixNumberOfRows, 1u);
-            inputMatrix = Matrix<float64>(inputMatrixPointer, inputMatrixNumberOfRows, inputMatrixNumberOfColumns);
-            inputVector = Matrix<float64>(inputVectorPointer, inputMatrixNumberOfColumns, 1u);
-            intermediateOutput1 = Matrix<float64>(intermediateOutput1Pointer, outputMatrixNumberOfRows, 1u);
-            intermediateOutput2 = Matrix<float64>(intermediateOutput2Pointer, outputMatrixNumberOfRows, 1u);
-            derivativeStateVector = Matrix<float64>(derivativeStateVectorPointer, sizeDerivativeStateVector, 1u);
         }
+        if (matrixStorage == MatrixStorageSparse) {
+            BuildSparseCoefficients();
+        }
+        else {
+            BuildCoefficients();
+        }
+        enableFeedthroughMatrix = (feedthroughMatrixPointer != NULL_PTR(float64 *));
+        //Two state buffers, the contiguous copy of the inputs and the input products
+        const uint32 stateBuffersSize = (3u * coefficientsStride) + numberOfInputSignalsGAM;
+        if (stateBuffers != NULL_PTR(float64 *)) {
+            delete[] stateBuffers;
+        }
+        stateBuffers = new float64[stateBuffersSize];
+        for (uint32 i = 0u; i < stateBuffersSize; i++) {
+            stateBuffers[i] = 0.0;
+        }
+        currentState = &stateBuffers[0u];
+        nextState = &stateBuffers[coefficientsStride];
+        inputProducts = &stateBuffers[2u * coefficientsStride];
+        inputValues = &stateBuffers[3u * coefficientsStride];
     }
     return ok;
 }
 
+//lint -e{613} Setup() guarantees that the pointers are not NULL.
 bool SSMGAM::Execute() {
-    bool ok = stateVector.Copy(derivativeStateVector);
-    if (ok) {
-        ok = outputMatrix.Product(stateVector, intermediateOutput1);
-    }
-    if (ok && enableFeedthroughMatrix) {
-        ok = feedthroughMatrix.Product(inputVector, intermediateOutput2);
-    }
-    if (ok) {
+    for (uint32 s = 0u; s < numberOfInputSamples; s++) {
+        for (uint32 i = 0u; i < numberOfInputSignalsGAM; i++) {
+            inputValues[i] = inputVectorPointer[i][s];
+        }
+        const float64 * const state = &currentState[sizeOutputVector];
+        for (uint32 i = 0u; i < sizeStateVector; i++) {
+            stateVectorPointer[i][s] = state[i];
+        }
+        if (matrixStorage == MatrixStorageSparse) {
+            StepSparse();
+        }
+        else {
+            Step();
+        }
         if (enableFeedthroughMatrix) {
-            ok = intermediateOutput1.Sum(intermediateOutput2, outputVector);
+            for (uint32 i = 0u; i < sizeOutputVector; i++) {
+                outputVectorPointer[i][s] = nextState[i] + inputProducts[i];
+            }
         }
         else {
-            ok = outputVector.Copy(intermediateOutput1);
+            for (uint32 i = 0u; i < sizeOutputVector; i++) {
+                outputVectorPointer[i][s] = nextState[i];
+            }
         }
+        for (uint32 i = sizeOutputVector; i < (sizeOutputVector + sizeStateVector); i++) {
+            nextState[i] += inputProducts[i];
+        }
+        float64 * const swap = currentState;
+        currentState = nextState;
+        nextState = swap;
     }
-    if (ok) {
-        ok = stateMatrix.Product(stateVector, intermediateState1);
+    return true;
+}
+
+//lint -e{613} Setup() guarantees that the pointers are not NULL.
+void SSMGAM::Step() {
+    const float64 * const state = &currentState[sizeOutputVector];
+    for (uint32 i = 0u; i < coefficientsStride; i++) {
+        nextState[i] = 0.0;
+        inputProducts[i] = 0.0;
     }
-    if (ok) {
-        ok = inputMatrix.Product(inputVector, intermediateState2);
+    for (uint32 k = 0u; k < sizeStateVector; k++) {
+        const float64 * const column = &coefficients[k * coefficientsStride];
+        const float64 value = state[k];
+        for (uint32 i = 0u; i < coefficientsStride; i++) {
+            nextState[i] += column[i] * value;
+        }
     }
-    if (ok) {
-        ok = intermediateState1.Sum(intermediateState2, derivativeStateVector);
+    for (uint32 k = 0u; k < numberOfInputSignalsGAM; k++) {
+        const float64 * const column = &coefficients[(sizeStateVector + k) * coefficientsStride];
+        const float64 value = inputValues[k];
+        for (uint32 i = 0u; i < coefficientsStride; i++) {
+            inputProducts[i] += column[i] * value;
+        }
+    }
+}
+
+//lint -e{613} Setup() guarantees that the pointers are not NULL.
+void SSMGAM::StepSparse() {
+    const float64 * const state = &currentState[sizeOutputVector];
+    const uint32 numberOfCoefficientRows = sizeOutputVector + sizeStateVector;
+    for (uint32 i = 0u; i < numberOfCoefficientRows; i++) {
+        float64 stateProduct = 0.0;
+        for (uint32 e = sparseRowPointers[2u * i]; e < sparseRowPointers[(2u * i) + 1u]; e++) {
+            stateProduct += sparseValues[e] * state[sparseColumnIndices[e]];
+        }
+        nextState[i] = stateProduct;
+        float64 inputProduct = 0.0;
+        for (uint32 e = sparseRowPointers[(2u * i) + 1u]; e < sparseRowPointers[(2u * i) + 2u]; e++) {
+            inputProduct += sparseValues[e] * inputValues[sparseColumnIndices[e]];
+        }
+        inputProducts[i] = inputProduct;
     }
-    return ok;
 }
 
 bool SSMGAM::PrepareNextState(const char8 * const currentStateName,
@@ -672,16 +886,13 @@ bool SSMGAM::PrepareNextState(const char8 * const currentStateName,
     bool ret = true;
 
     if (resetInEachState) {
-        bool cond1 = (stateVector.GetDataPointer() != NULL_PTR(float64 **));
-        bool cond2 = (derivativeStateVector.GetDataPointer() != NULL_PTR(float64 **));
+        bool cond1 = (stateVectorPointer != NULL_PTR(float64 **));
+        bool cond2 = (currentState != NULL_PTR(float64 *));
         if (cond1 && cond2) {
-            for (uint32 i = 0u; i < sizeStateVector; i++) {
-                stateVector(i, 0u) = 0.0;
-                derivativeStateVector(i, 0u) = 0.0;
-            }
+            ResetState();
         }
         else {
-            REPORT_ERROR(ErrorManagement::ParametersError, "stateVector or derivativeStateVector = NULL ");
+            REPORT_ERROR(ErrorManagement::ParametersError, "stateVector or state buffers = NULL ");
             ret = false;
         }
 
@@ -689,16 +900,13 @@ bool SSMGAM::PrepareNextState(const char8 * const currentStateName,
     else {
         //If the currentStateName and lastStateExecuted are different-> rest values
         if (lastStateExecuted != currentStateName) {
-            bool cond1 = (stateVector.GetDataPointer() != NULL_PTR(float64 **));
-            bool cond2 = (derivativeStateVector.GetDataPointer() != NULL_PTR(float64 **));
+            bool cond1 = (stateVectorPointer != NULL_PTR(float64 **));
+            bool cond2 = (currentState != NULL_PTR(float64 *));
             if (cond1 && cond2) {
-                for (uint32 i = 0u; i < sizeStateVector; i++) {
-                    stateVector(i, 0u) = 0.0;
-                    derivativeStateVector(i, 0u) = 0.0;
-                }
+                ResetState();
             }
             else {
-                REPORT_ERROR(ErrorManagement::ParametersError, "stateVector or derivativeStateVector = NULL ");
+                REPORT_ERROR(ErrorManagement::ParametersError, "stateVector or state buffers = NULL ");
                 ret = false;
             }
         }
@@ -707,6 +915,16 @@ bool SSMGAM::PrepareNextState(const char8 * const currentStateName,
 
     return ret;
 }
+//lint -e{613} PrepareNextState() checks that the pointers are not NULL.
+void SSMGAM::ResetState() {
+    for (uint32 i = 0u; i < sizeStateVector; i++) {
+        for (uint32 s = 0u; s < numberOfOutputSamples; s++) {
+            stateVectorPointer[i][s] = 0.0;
+        }
+        currentState[sizeOutputVector + i] = 0.0;
+    }
+}
+
 CLASS_REGISTER(SSMGAM, "1.0")
 }
 
@@ -65,7 +65,11 @@ namespace MARTe {
  * state vector. Consequently the number of outputs of the GAM are the sum
  * of the sizes of theses two vectors.\n
  *
- * The number of elements and the number of samples must be one. The dimensions could be 0 or 1.
+ * The number of elements must be one. The dimensions could be 0 or 1.
+ * The number of samples (N) must be the same for all the inputs and outputs. With N > 1 the model is stepped N times
+ * in each Execute(): the sample s of the outputs and of the state signals is computed from the sample s of the inputs
+ * and from the state left by the sample s - 1 (i.e. the state signals hold x[k], ..., x[k+N-1]). This allows running the model
+ * at N times the rate of the real-time thread, fed by a multi-sample DataSource.
  *
  * The state matrix, the input matrix and the output matrix must be specified, however the feedthrough matrix
  * may or may not be specified. While configuring, the following considerations must be applied:
@@ -87,6 +91,27 @@ namespace MARTe {
  * </li>
  * </ul>
  *
+ * Any of the matrices can also be given in compressed sparse row (CSR) form, which is convenient for large models with few
+ * non-zero coefficients (e.g. discretised physics or block-diagonal decoupled subsystems):
+ * <pre>
+ *     StateMatrix = {
+ *         NumberOfRows = 3
+ *         NumberOfColumns = 3
+ *         Values = {0.5 0.2 1.0 0.7} //Non-zero coefficients, row after row. Not needed if all the coefficients are zero.
+ *         ColumnIndices = {0 2 0 2} //Column of each value. Not needed if all the coefficients are zero.
+ *         RowPointers = {0 2 3 4} //NumberOfRows + 1 elements. The values of the row i are Values[RowPointers[i]..RowPointers[i+1]-1].
+ *     }
+ * </pre>
+ * The values of repeated (row, column) pairs are added.
+ *
+ * The optional parameter MatrixStorage selects how the coefficients are stored and multiplied by Execute():
+ * <ul>
+ * <li>Dense: all the coefficients, including the zeros, are multiplied with vectorisable loops.</li>
+ * <li>Sparse: only the non-zero coefficients are stored (CSR) and multiplied, so that the cost scales with the number of non-zeros.</li>
+ * <li>Auto (default): Setup() selects Sparse if at most one every SSMGAM_SPARSE_DENSITY_RATIO (10) coefficients of the matrices is non-zero, Dense otherwise.</li>
+ * </ul>
+ * The storage is independent of the form in which the matrices were configured and does not change the result of the products.
+ *
  * The configuration syntax is (names and signal quantity are only given as an example):
  *
  * <pre>
@@ -97,6 +122,7 @@ namespace MARTe {
  *     OutputMatrix = {{1 0}} //Compulsory
  *     FeedthroughMatrix = {{0 1}} //Optional
  *     ResetInEachState = 0//Compulsory. 1--> reset in each state, 0--> reset if the previous state is different from the next state
+ *     MatrixStorage = Auto //Optional. Auto, Dense or Sparse. Default = Auto.
  *     SampleFrequency = 0.0001 // Currently optional and not used.
  *     InputSignals = {
  *         InputSignal1 = { //input of the SS
@@ -104,7 +130,7 @@ namespace MARTe {
  *             Type = float64 //Only supported type.
  *             NumberOfElements = 1
  *             NumberOfDimensions = 1 // or 0
- *             Samples = 1
+ *             Samples = 1 //Or N > 1, the same for all the inputs and outputs
  *         }
  *         InputSignal2 = {
  *             DataSource = "DDB1"
@@ -143,22 +169,18 @@ public:
     CLASS_REGISTER_DECLARATION()
     /** @brief Default constructor
      * @post
-     * stateMatrixPointer = NULL_PTR(float64 **)\n
-     * intermediateState1Pointer = NULL_PTR(float64 **)\n
-     * intermediateState2Pointer = NULL_PTR(float64 **)\n
-     * stateMatrixNumberOfRows = 0u\n
-     * stateMatrixNumberOfColumns = 0u\n
+     * stateMatrixPointer = NULL_PTR(float64 *)\n
      * stateMatrixNumberOfRows = 0u\n
      * stateMatrixNumberOfColumns = 0u\n
      * sizeStateVector = 0u\n
      * sizeDerivativeStateVector = 0u\n
-     * inputMatrixPointer = NULL_PTR(float64 **)\n
+     * inputMatrixPointer = NULL_PTR(float64 *)\n
      * inputMatrixNumberOfRows = 0u\n
      * inputMatrixNumberOfColumns = 0u\n
-     * outputMatrixPointer = NULL_PTR(float64 **)\n
+     * outputMatrixPointer = NULL_PTR(float64 *)\n
      * outputMatrixNumberOfRows = 0u\n
      * outputMatrixNumberOfColumns = 0u\n
-     * feedthroughMatrixPointer = NULL_PTR(float64 **)\n
+     * feedthroughMatrixPointer = NULL_PTR(float64 *)\n
      * feedthroughMatrixNumberOfRows = 0u\n
      * feedthroughMatrixNumberOfColumns = 0u\n
      * numberOfInputSignalsGAM = 0u\n
@@ -172,10 +194,18 @@ public:
      * numberOfOutputSamples = 0u\n
      * inputVectorPointer = NULL_PTR(float64 **)\n
      * outputVectorPointer = NULL_PTR(float64 **)\n
-     * intermediateOutput1Pointer = NULL_PTR(float64 **)\n
-     * intermediateOutput2Pointer = NULL_PTR(float64 **)\n
      * stateVectorPointer = NULL_PTR(float64 **)\n
-     * derivativeStateVectorPointer = NULL_PTR(float64 **)\n
+     * coefficients = NULL_PTR(float64 *)\n
+     * coefficientsStride = 0u\n
+     * stateBuffers = NULL_PTR(float64 *)\n
+     * currentState = NULL_PTR(float64 *)\n
+     * nextState = NULL_PTR(float64 *)\n
+     * inputValues = NULL_PTR(float64 *)\n
+     * inputProducts = NULL_PTR(float64 *)\n
+     * sparseValues = NULL_PTR(float64 *)\n
+     * sparseColumnIndices = NULL_PTR(uint32 *)\n
+     * sparseRowPointers = NULL_PTR(uint32 *)\n
+     * matrixStorage = MatrixStorageAuto\n
      * sampleFrequency = 0.0\n
      * enableFeedthroughMatrix = false\n
      * resetInEachState = false\n
@@ -186,24 +216,25 @@ public:
      * @brief Destructor
      * @details Frees the memory allocated by the GAM if necessary
      * @post
-     * stateMatrixPointer = NULL_PTR(float64 **)\n
-     * intermediateState1Pointer = NULL_PTR(float64 **)\n
-     * intermediateState2Pointer = NULL_PTR(float64 **)\n
-     * inputMatrixPointer = NULL_PTR(float64 **)\n
-     * outputMatrixPointer = NULL_PTR(float64 **)\n
-     * feedthroughMatrixPointer = NULL_PTR(float64 **)\n
+     * stateMatrixPointer = NULL_PTR(float64 *)\n
+     * inputMatrixPointer = NULL_PTR(float64 *)\n
+     * outputMatrixPointer = NULL_PTR(float64 *)\n
+     * feedthroughMatrixPointer = NULL_PTR(float64 *)\n
      * inputVectorPointer = NULL_PTR(float64 **)\n
      * outputVectorPointer = NULL_PTR(float64 **)\n
-     * intermediateOutput1Pointer = NULL_PTR(float64 **)\n
-     * intermediateOutput2Pointer = NULL_PTR(float64 **)\n
      * stateVectorPointer = NULL_PTR(float64 **)\n
-     * derivativeStateVectorPointer = NULL_PTR(float64 **)\n
+     * coefficients = NULL_PTR(float64 *)\n
+     * stateBuffers = NULL_PTR(float64 *)\n
+     * sparseValues = NULL_PTR(float64 *)\n
+     * sparseColumnIndices = NULL_PTR(uint32 *)\n
+     * sparseRowPointers = NULL_PTR(uint32 *)\n
      */
     virtual ~SSMGAM();
 
     /**
      * @brief Initialise the parameters from a configuration file.
-     * @details Initialise the SS matrices, the resetInEachState and cross-check consistencies.
+     * @details Initialise the SS matrices, the resetInEachState, the MatrixStorage and cross-check consistencies.
+     * Each matrix, either dense or in CSR form, is stored as a contiguous row-major block.
      * @param[in] data is the configuration file previously defined.
      * @return true if the initialisation succeeds.
      */
@@ -212,7 +243,8 @@ public:
     /**
      * @brief Initialise the inputs and the output of the GAM.
      * @details Allocate memory for the inputs and outputs, get the input and output pointers
-     * and initialise the class Matrix for use their operations.
+     * and allocate the two state buffers used by Execute(). The matrices are packed in the dense
+     * (see BuildCoefficients()) or sparse (see BuildSparseCoefficients()) coefficients, according to the MatrixStorage.
      * @return true if the dimension matrices are consistent.
      */
     virtual bool Setup();
@@ -227,6 +259,10 @@ public:
      * \f$
      * y[k] = Cx[k]+Du[k]
      * \f$\n
+     * Both equations are computed in a single pass over the coefficients (see Step() and StepSparse()),
+     * once for each of the samples of the signals.
+     * The next state is written to the state buffer which is not being read and the two buffers
+     * are then swapped, so that the state vector is never copied.
      *
      * @return true if the operation can be performed.
      */
@@ -251,35 +287,94 @@ public:
                                   const char8 * const nextStateName);
 
 private:
+
+    /**
+     * @brief Gets the dimensions of a matrix defined either as a dense matrix or in CSR form.
+     * @param[in] data the configuration.
+     * @param[in] name the name of the matrix.
+     * @param[out] numberOfRows the number of rows of the matrix.
+     * @param[out] numberOfColumns the number of columns of the matrix.
+     * @return true if the matrix is defined.
+     */
+    bool GetMatrixDimensions(StructuredDataI &data,
+                             const char8 * const name,
+                             uint32 &numberOfRows,
+                             uint32 &numberOfColumns);
+
+    /**
+     * @brief Reads a matrix from the configuration into a contiguous row-major block.
+     * @details The matrix can be defined either as a dense matrix or in CSR form.
+     * @param[in] data the configuration.
+     * @param[in] name the name of the matrix.
+     * @param[in] numberOfRows the number of rows of the matrix.
+     * @param[in] numberOfColumns the number of columns of the matrix.
+     * @return the matrix or NULL_PTR(float64 *) if it cannot be read.
+     */
+    float64 *ReadMatrix(StructuredDataI &data,
+                        const char8 * const name,
+                        const uint32 numberOfRows,
+                        const uint32 numberOfColumns);
+
+    /**
+     * @brief Reads the Values, ColumnIndices and RowPointers of the current node into a row-major block.
+     * @param[in] data the configuration, moved to the node of the matrix.
+     * @param[in] name the name of the matrix.
+     * @param[out] matrixValues the row-major block with numberOfRows x numberOfColumns elements.
+     * @param[in] numberOfRows the number of rows of the matrix.
+     * @param[in] numberOfColumns the number of columns of the matrix.
+     * @return true if the CSR arrays are consistent with the dimensions of the matrix.
+     */
+    bool ReadSparseMatrix(StructuredDataI &data,
+                          const char8 * const name,
+                          float64 * const matrixValues,
+                          const uint32 numberOfRows,
+                          const uint32 numberOfColumns);
+
+    /**
+     * @brief Packs the C, D, A and B matrices in the coefficients.
+     * @details The coefficients are the column-major storage of the matrix\n
+     * | C D |\n
+     * | A B |\n
+     * whose columns are padded to coefficientsStride elements. A zero block replaces D if it was not defined.
+     */
+    void BuildCoefficients();
+
     /**
-     * state matrix pointer. In standard naming convention, it corresponds to A matrix.
+     * @brief Packs the non-zero coefficients of the C, D, A and B matrices in the sparse coefficients.
+     * @details The row i of [C; A] is followed by the row i of [D; B] (see sparseRowPointers).
      */
-    float64 **stateMatrixPointer;
+    void BuildSparseCoefficients();
 
     /**
-     * State matrix initialised using stateMatrixPointer.
+     * @brief Counts the non-zero coefficients of the A, B, C and D matrices.
+     * @return the number of non-zero coefficients.
      */
-    Matrix<float64> stateMatrix;
+    uint32 GetNumberOfNonZeroCoefficients() const;
 
     /**
-     * Holds an intermediate result.
+     * @brief Computes Cx[k] and Ax[k] in nextState, and Du[k] and Bu[k] in inputProducts.
+     * @details The coefficients are accumulated one column at a time, so that the inner loop runs over
+     * contiguous rows and can be vectorised. The terms of each product are added in the same
+     * order as in a row by column product.
      */
-    float64 **intermediateState1Pointer;
+    void Step();
 
     /**
-     * Holds an intermediate result. It is initialised with the intermediateState1Pointer
+     * @brief Computes the same products as Step() with the sparse coefficients.
+     * @details Each row is computed as a row by column product of its non-zero coefficients, in
+     * increasing column order, so that the result is the same as the one of Step().
      */
-    Matrix<float64> intermediateState1;
+    void StepSparse();
 
     /**
-     * Holds an intermediate result.
+     * @brief Sets to zero the state vector and all the samples of the state signals.
      */
-    float64 **intermediateState2Pointer;
+    void ResetState();
 
     /**
-     * Holds an intermediate result. It is initialised with the intermediateState2Pointer
+     * State matrix (A) as a contiguous row-major block.
      */
-    Matrix<float64> intermediateState2;
+    float64 *stateMatrixPointer;
 
     /**
      * number of rows of the state matrix.
@@ -302,14 +397,9 @@ private:
     uint32 sizeDerivativeStateVector;
 
     /**
-     * input matrix pointer. In standard naming convention, it corresponds to B matrix.
+     * Input matrix (B) as a contiguous row-major block.
      */
-    float64 **inputMatrixPointer;
-
-    /**
-     * Input matrix. It is initialised with inputMatrixPointer
-     */
-    Matrix<float64> inputMatrix;
+    float64 *inputMatrixPointer;
 
     /**
      * number of rows of the input matrix.
@@ -322,14 +412,9 @@ private:
     uint32 inputMatrixNumberOfColumns;
 
     /**
-     * Output matrix pointer. In standard naming convention, it corresponds to C matrix.
-     */
-    float64 **outputMatrixPointer;
-
-    /**
-     * Output matrix. It is initialised with outputMatrixPointer
+     * Output matrix (C) as a contiguous row-major block.
      */
-    Matrix<float64> outputMatrix;
+    float64 *outputMatrixPointer;
 
     /**
      * Number of rows of the output matrix
@@ -342,14 +427,9 @@ private:
     uint32 outputMatrixNumberOfColumns;
 
     /**
-     * Feedthrough matrix pointer. In standard naming convention, it corresponds to D matrix.
+     * Feedthrough matrix (D) as a contiguous row-major block. NULL if not defined.
      */
-    float64 **feedthroughMatrixPointer;
-
-    /**
-     * Feedthrough matrix. It is initialised with feedthroughMatrixPointer
-     */
-    Matrix<float64> feedthroughMatrix;
+    float64 *feedthroughMatrixPointer;
 
     /**
      * Number of rows of the feedthrough matrix
@@ -372,7 +452,7 @@ private:
     uint32 numberOfOutputSignalsGAM;
 
     /**
-     * Number of elements of the output vector. numberOfOutputSignals = sizeOutputVector + sizeStateVector + sizeDerivativeStateVector
+     * Number of elements of the output vector. numberOfOutputSignals = sizeOutputVector + sizeStateVector
      */
     uint32 sizeOutputVector;
 
@@ -407,64 +487,95 @@ private:
     uint32 numberOfOutputSamples;
 
     /**
-     * This is the input signal of the system (usually called U). It is the excitation of the system.
+     * Memory of the input signals of the system (usually called U). It is the excitation of the system.
      */
     float64 **inputVectorPointer;
 
     /**
-     * Input vector. It is initialised with inputVectorPointer
+     * Memory of the output signals of the system (usually this vector is represented by a Y).
      */
-    Matrix<float64> inputVector;
+    float64 **outputVectorPointer;
 
     /**
-     * Output of the system (usually this vector is represented by a Y).
+     * Memory of the state signals (usually it is represented by a X). The state vector is an output of the GAM.
      */
-    float64 **outputVectorPointer;
+    float64 **stateVectorPointer;
 
     /**
-     * Output vector. It is initialised with outputVectorPointer
+     * The matrix [C D; A B] in column-major order (see BuildCoefficients()).
      */
-    Matrix<float64> outputVector;
+    float64 *coefficients;
 
     /**
-     * Holds an intermediate value.
+     * Distance between two columns of the coefficients. It is the number of outputs plus the number of states
+     * rounded up to a multiple of a cache line.
      */
-    float64 **intermediateOutput1Pointer;
+    uint32 coefficientsStride;
 
     /**
-     * Holds an intermediate value. It is initialised with intermediateOutput1Pointer
+     * Memory of the two state buffers, coefficientsStride elements each.
      */
-    Matrix<float64> intermediateOutput1;
+    float64 *stateBuffers;
 
     /**
-     * Holds an intermediate value.
+     * The state buffer holding x[k] (from the element sizeOutputVector), as computed in the previous Execute().
      */
-    float64 **intermediateOutput2Pointer;
+    float64 *currentState;
 
     /**
-     * Holds an intermediate value. It is initialised with intermediateOutput2Pointer
+     * The state buffer where Step() accumulates Cx[k] (first sizeOutputVector elements) and Ax[k] (following sizeStateVector elements).
      */
-    Matrix<float64> intermediateOutput2;
+    float64 *nextState;
 
     /**
-     * State vector pointer(usually it is represented by a X). This vector is an output of the GAM.
+     * Copy of u[k], contiguous.
      */
-    float64 **stateVectorPointer;
+    float64 *inputValues;
+
+    /**
+     * Du[k] (first sizeOutputVector elements) and Bu[k] (following sizeStateVector elements).
+     */
+    float64 *inputProducts;
+
+    /**
+     * The non-zero coefficients of [C D; A B], row after row.
+     */
+    float64 *sparseValues;
+
+    /**
+     * The column of each of the sparseValues, relative to the first column of [C; A] or of [D; B].
+     */
+    uint32 *sparseColumnIndices;
 
     /**
-     * State vector. It is initialised with stateVectorPointer
+     * 2 x (sizeOutputVector + sizeStateVector) + 1 elements. The coefficients of the row i of [C; A] are
+     * sparseValues[sparseRowPointers[2i]..sparseRowPointers[2i+1]-1] and the ones of the row i of [D; B] are
+     * sparseValues[sparseRowPointers[2i+1]..sparseRowPointers[2i+2]-1].
      */
-    Matrix<float64> stateVector;
+    uint32 *sparseRowPointers;
 
     /**
-     * It is the derivative of the state vector. This vector is also an ouput of the GAM.
+     * Possible storages of the coefficients.
      */
-    float64 **derivativeStateVectorPointer;
+    enum MatrixStorage {
+        /**
+         * Selected by Setup() according to the number of non-zero coefficients.
+         */
+        MatrixStorageAuto = 0,
+        /**
+         * All the coefficients (see BuildCoefficients()).
+         */
+        MatrixStorageDense = 1,
+        /**
+         * Only the non-zero coefficients (see BuildSparseCoefficients()).
+         */
+        MatrixStorageSparse = 2
+    };
 
     /**
-     * It is the derivative of the state vector. It is initialised with stateVectorPointer
+     * The storage of the coefficients. After Setup() it is either MatrixStorageDense or MatrixStorageSparse.
      */
-    Matrix<float64> derivativeStateVector;
+    MatrixStorage matrixStorage;
 
     /**
      * sample frequency in which the matrix parameters are given. It will be used for verification
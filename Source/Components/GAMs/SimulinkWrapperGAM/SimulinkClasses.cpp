@@ -27,6 +27,11 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+/*lint -estring(829, *emmintrin.h*) compiler intrinsics*/
+#if defined(__x86_64__) && defined(__SSE2__)
+#define SIMULINKWRAPPERGAM_SSE2
+#include <emmintrin.h>
+#endif
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
@@ -37,6 +42,118 @@
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
 
+namespace {
+
+/**
+ * Side, in elements, of the square tiles in which the matrices are transposed.
+ * A 32x32 tile of 8-byte elements and its destination (16 KB) fit in the L1 data cache.
+ */
+const MARTe::uint32 SIMULINK_TRANSPOSE_TILE_SIZE = 32u;
+
+/**
+ * @brief Transposes one tile element by element.
+ * @details destination[c + numberOfColumns * r] = source[r + numberOfRows * c]
+ * for r in [rowBegin, rowEnd) and c in [columnBegin, columnEnd).
+ */
+template<typename T>
+void TransposeTileScalar(T * const destination, const T * const source, const MARTe::uint32 numberOfRows, const MARTe::uint32 numberOfColumns,
+                         const MARTe::uint32 rowBegin, const MARTe::uint32 rowEnd, const MARTe::uint32 columnBegin, const MARTe::uint32 columnEnd) {
+    for (MARTe::uint32 rowIdx = rowBegin; rowIdx < rowEnd; rowIdx++) {
+        for (MARTe::uint32 colIdx = columnBegin; colIdx < columnEnd; colIdx++) {
+            destination[colIdx + (numberOfColumns * rowIdx)] = source[rowIdx + (numberOfRows * colIdx)];
+        }
+    }
+}
+
+/**
+ * @brief Transposes one tile. The generic version is element by element, the 4 and 8 bytes
+ * specialisations use in-register transposes of 4x4 and 2x2 blocks when SSE2 is available.
+ */
+template<typename T>
+void TransposeTile(T * const destination, const T * const source, const MARTe::uint32 numberOfRows, const MARTe::uint32 numberOfColumns,
+                   const MARTe::uint32 rowBegin, const MARTe::uint32 rowEnd, const MARTe::uint32 columnBegin, const MARTe::uint32 columnEnd) {
+    TransposeTileScalar<T>(destination, source, numberOfRows, numberOfColumns, rowBegin, rowEnd, columnBegin, columnEnd);
+}
+
+#ifdef SIMULINKWRAPPERGAM_SSE2
+template<>
+void TransposeTile<MARTe::uint32>(MARTe::uint32 * const destination, const MARTe::uint32 * const source, const MARTe::uint32 numberOfRows,
+                                  const MARTe::uint32 numberOfColumns, const MARTe::uint32 rowBegin, const MARTe::uint32 rowEnd,
+                                  const MARTe::uint32 columnBegin, const MARTe::uint32 columnEnd) {
+    /*lint --e{826, 927, 928, 9176} the SSE loads and stores only move the bits of the elements*/
+    MARTe::uint32 rowIdx = rowBegin;
+    for (; (rowIdx + 4u) <= rowEnd; rowIdx += 4u) {
+        MARTe::uint32 colIdx = columnBegin;
+        for (; (colIdx + 4u) <= columnEnd; colIdx += 4u) {
+            // Four source columns (rows rowIdx..rowIdx+3) become four destination rows
+            __m128 col0 = _mm_loadu_ps(reinterpret_cast<const float *>(&source[rowIdx + (numberOfRows * colIdx)]));
+            __m128 col1 = _mm_loadu_ps(reinterpret_cast<const float *>(&source[rowIdx + (numberOfRows * (colIdx + 1u))]));
+            __m128 col2 = _mm_loadu_ps(reinterpret_cast<const float *>(&source[rowIdx + (numberOfRows * (colIdx + 2u))]));
+            __m128 col3 = _mm_loadu_ps(reinterpret_cast<const float *>(&source[rowIdx + (numberOfRows * (colIdx + 3u))]));
+            _MM_TRANSPOSE4_PS(col0, col1, col2, col3);
+            _mm_storeu_ps(reinterpret_cast<float *>(&destination[colIdx + (numberOfColumns * rowIdx)]), col0);
+            _mm_storeu_ps(reinterpret_cast<float *>(&destination[colIdx + (numberOfColumns * (rowIdx + 1u))]), col1);
+            _mm_storeu_ps(reinterpret_cast<float *>(&destination[colIdx + (numberOfColumns * (rowIdx + 2u))]), col2);
+            _mm_storeu_ps(reinterpret_cast<float *>(&destination[colIdx + (numberOfColumns * (rowIdx + 3u))]), col3);
+        }
+        TransposeTileScalar<MARTe::uint32>(destination, source, numberOfRows, numberOfColumns, rowIdx, rowIdx + 4u, colIdx, columnEnd);
+    }
+    TransposeTileScalar<MARTe::uint32>(destination, source, numberOfRows, numberOfColumns, rowIdx, rowEnd, columnBegin, columnEnd);
+}
+
+template<>
+void TransposeTile<MARTe::uint64>(MARTe::uint64 * const destination, const MARTe::uint64 * const source, const MARTe::uint32 numberOfRows,
+                                  const MARTe::uint32 numberOfColumns, const MARTe::uint32 rowBegin, const MARTe::uint32 rowEnd,
+                                  const MARTe::uint32 columnBegin, const MARTe::uint32 columnEnd) {
+    /*lint --e{826, 927, 928, 9176} the SSE loads and stores only move the bits of the elements*/
+    MARTe::uint32 rowIdx = rowBegin;
+    for (; (rowIdx + 2u) <= rowEnd; rowIdx += 2u) {
+        MARTe::uint32 colIdx = columnBegin;
+        for (; (colIdx + 2u) <= columnEnd; colIdx += 2u) {
+            __m128d col0 = _mm_loadu_pd(reinterpret_cast<const double *>(&source[rowIdx + (numberOfRows * colIdx)]));
+            __m128d col1 = _mm_loadu_pd(reinterpret_cast<const double *>(&source[rowIdx + (numberOfRows * (colIdx + 1u))]));
+            _mm_storeu_pd(reinterpret_cast<double *>(&destination[colIdx + (numberOfColumns * rowIdx)]), _mm_unpacklo_pd(col0, col1));
+            _mm_storeu_pd(reinterpret_cast<double *>(&destination[colIdx + (numberOfColumns * (rowIdx + 1u))]), _mm_unpackhi_pd(col0, col1));
+        }
+        TransposeTileScalar<MARTe::uint64>(destination, source, numberOfRows, numberOfColumns, rowIdx, rowIdx + 2u, colIdx, columnEnd);
+    }
+    TransposeTileScalar<MARTe::uint64>(destination, source, numberOfRows, numberOfColumns, rowIdx, rowEnd, columnBegin, columnEnd);
+}
+#endif
+
+/**
+ * @brief Transposes a numberOfRows x numberOfColumns matrix tile by tile.
+ * @details destination[c + numberOfColumns * r] = source[r + numberOfRows * c].
+ * Only the size of T matters: the elements are moved, not converted.
+ */
+template<typename T>
+void TransposeBlocked(void * const destination, const void * const source, const MARTe::uint32 numberOfRows, const MARTe::uint32 numberOfColumns) {
+    T * const destinationT = static_cast<T *>(destination);
+    const T * const sourceT = static_cast<const T *>(source);
+    for (MARTe::uint32 rowTile = 0u; rowTile < numberOfRows; rowTile += SIMULINK_TRANSPOSE_TILE_SIZE) {
+        MARTe::uint32 rowEnd = ((numberOfRows - rowTile) > SIMULINK_TRANSPOSE_TILE_SIZE) ? (rowTile + SIMULINK_TRANSPOSE_TILE_SIZE) : numberOfRows;
+        for (MARTe::uint32 columnTile = 0u; columnTile < numberOfColumns; columnTile += SIMULINK_TRANSPOSE_TILE_SIZE) {
+            MARTe::uint32 columnEnd = ((numberOfColumns - columnTile) > SIMULINK_TRANSPOSE_TILE_SIZE) ? (columnTile + SIMULINK_TRANSPOSE_TILE_SIZE) : numberOfColumns;
+            TransposeTile<T>(destinationT, sourceT, numberOfRows, numberOfColumns, rowTile, rowEnd, columnTile, columnEnd);
+        }
+    }
+}
+
+/**
+ * @brief Copies a scalar or a vector, which has the same layout in both orientations.
+ */
+template<typename T>
+void CopyVector(void * const destination, const void * const source, const MARTe::uint32 numberOfRows, const MARTe::uint32 numberOfColumns) {
+    T * const destinationT = static_cast<T *>(destination);
+    const T * const sourceT = static_cast<const T *>(source);
+    const MARTe::uint32 numberOfElements = numberOfRows * numberOfColumns;
+    for (MARTe::uint32 elementIdx = 0u; elementIdx < numberOfElements; elementIdx++) {
+        destinationT[elementIdx] = sourceT[elementIdx];
+    }
+}
+
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -72,6 +189,8 @@ SimulinkDataI::SimulinkDataI() {
     address = NULL_PTR(void*);
     
     verbosity = 1u;
+    
+    transposeFunction = NULL_PTR(TransposeFunction);
 }
 
 SimulinkDataI::~SimulinkDataI() {
@@ -105,10 +224,12 @@ void SimulinkDataI::PrintData(const uint64 maxNameLength /* = 0u */, StreamStrin
 /*                            SimulinkParameter                              */
 /*---------------------------------------------------------------------------*/
 
-bool SimulinkParameter::Actualise(const AnyType& sourceParameter) {
+bool SimulinkParameter::Actualise(const AnyType& sourceParameter, void* const destination) {
     
     bool ok;
     
+    void* target = (destination != NULL) ? destination : address;
+    
     // Type coherence check
     TypeDescriptor slkType = type;
     TypeDescriptor extType = sourceParameter.GetTypeDescriptor();
@@ -246,23 +367,23 @@ bool SimulinkParameter::Actualise(const AnyType& sourceParameter) {
         if (numberOfDimensions <= 1u) {
             
             // Scalars and vectors have no orientation and can be copied as they are.
-            ok = MemoryOperationsHelper::Copy(address, sourceParameter.GetDataPointer(), sourceParameter.GetDataSize());
+            ok = MemoryOperationsHelper::Copy(target, sourceParameter.GetDataPointer(), sourceParameter.GetDataSize());
             
         }
         else if (numberOfDimensions == 2u) {
             
             // For 2D matrices we handle the case in which model has column-major parameters.
             if (orientation == rtwCAPI_MATRIX_ROW_MAJOR) {
-                ok = MemoryOperationsHelper::Copy(address, sourceParameter.GetDataPointer(), sourceParameter.GetDataSize());
+                ok = MemoryOperationsHelper::Copy(target, sourceParameter.GetDataPointer(), sourceParameter.GetDataSize());
             }
             else {
-                ok = TransposeAndCopy(address, sourceParameter.GetDataPointer());
+                ok = TransposeAndCopy(target, sourceParameter.GetDataPointer());
             }
         }
         else {
             
             // Also 3D matrices are memcopied, since handling all possible combinations of cases is not feasible
-            ok = MemoryOperationsHelper::Copy(address, sourceParameter.GetDataPointer(), sourceParameter.GetDataSize());
+            ok = MemoryOperationsHelper::Copy(target, sourceParameter.GetDataPointer(), sourceParameter.GetDataSize());
             REPORT_ERROR_STATIC(ErrorManagement::Warning, "3D matrix used. The GAM does not check data orientation of 3D matrices, carefully check results.");
         }
         
@@ -271,75 +392,66 @@ bool SimulinkParameter::Actualise(const AnyType& sourceParameter) {
     return ok;
 }
 
-bool SimulinkDataI::TransposeAndCopy(void *const destination, const void *const source) {
+bool SimulinkDataI::SetupTransposition() {
     
-    bool ok = false;
+    bool ok = true;
+    uint32 elementSize = 0u;
     
-    if (type==UnsignedInteger8Bit) {
-        
-        ok = TransposeAndCopyT<uint8>(destination, source);
-        
-    } else if (type==UnsignedInteger16Bit) {
-        
-        ok = TransposeAndCopyT<uint16>(destination, source);
-        
-    } else if (type==UnsignedInteger32Bit) {
-        
-        ok = TransposeAndCopyT<uint32>(destination, source);
-        
-    } else if (type==UnsignedInteger64Bit) {
-        
-        ok = TransposeAndCopyT<uint64>(destination, source);
-        
-    } else if (type==SignedInteger8Bit) {
-        
-        ok = TransposeAndCopyT<int8>(destination, source);
-        
-    } else if (type==SignedInteger16Bit) {
-        
-        ok = TransposeAndCopyT<int16>(destination, source);
-        
-    } else if (type==SignedInteger32Bit) {
+    if ( (type == UnsignedInteger8Bit) || (type == SignedInteger8Bit) ) {
         
-        ok = TransposeAndCopyT<int32>(destination, source);
+        elementSize = 1u;
         
-    } else if (type==SignedInteger64Bit) {
+    } else if ( (type == UnsignedInteger16Bit) || (type == SignedInteger16Bit) ) {
         
-        ok = TransposeAndCopyT<int64>(destination, source);
+        elementSize = 2u;
         
-    } else if (type==Float32Bit) {
+    } else if ( (type == UnsignedInteger32Bit) || (type == SignedInteger32Bit) || (type == Float32Bit) ) {
         
-        ok = TransposeAndCopyT<float32>(destination, source);
+        elementSize = 4u;
         
-    } else if (type==Float64Bit) {
+    } else if ( (type == UnsignedInteger64Bit) || (type == SignedInteger64Bit) || (type == Float64Bit) ) {
         
-        ok = TransposeAndCopyT<float64>(destination, source);
+        elementSize = 8u;
         
     } else {
         
         REPORT_ERROR_STATIC(ErrorManagement::Exception,
                      "Unsupported type %s", TypeDescriptor::GetTypeNameFromTypeDescriptor(type));
+        ok = false;
+    }
+    
+    if (ok) {
+        // The elements are only moved, so the kernels are selected on the size of the type
+        bool isVector = ( (numberOfElements[0u] == 1u) || (numberOfElements[1u] == 1u) );
+        if (elementSize == 1u) {
+            transposeFunction = isVector ? &CopyVector<uint8> : &TransposeBlocked<uint8>;
+        }
+        else if (elementSize == 2u) {
+            transposeFunction = isVector ? &CopyVector<uint16> : &TransposeBlocked<uint16>;
+        }
+        else if (elementSize == 4u) {
+            transposeFunction = isVector ? &CopyVector<uint32> : &TransposeBlocked<uint32>;
+        }
+        else {
+            transposeFunction = isVector ? &CopyVector<uint64> : &TransposeBlocked<uint64>;
+        }
     }
     
     return ok;
 }
 
-template<typename T>
-bool SimulinkDataI::TransposeAndCopyT(void *const destination, const void *const source) {
+bool SimulinkDataI::TransposeAndCopy(void *const destination, const void *const source) {
     
-    uint32 numberOfRows    = numberOfElements[0u];
-    uint32 numberOfColumns = numberOfElements[1u];
+    bool ok = true;
     
-    for (uint32 rowIdx = 0u; rowIdx < numberOfRows; rowIdx++) {
-        
-        for (uint32 colIdx = 0u; colIdx < numberOfColumns; colIdx++) {
-            
-            *( (T*) destination + colIdx + numberOfColumns*rowIdx ) = *( (T*) source + rowIdx + numberOfRows*colIdx );
-            
-        }
+    if (transposeFunction == NULL_PTR(TransposeFunction)) {
+        ok = SetupTransposition();
+    }
+    if (ok) {
+        (*transposeFunction)(destination, source, numberOfElements[0u], numberOfElements[1u]);
     }
     
-    return true;
+    return ok;
 }
 
 /*---------------------------------------------------------------------------*/
@@ -125,6 +125,19 @@ public:
      */
     void PrintData(const uint64 maxNameLength = 0u, StreamString additionalText = "");
     
+    /**
+     * @brief   Selects the transposition kernel used by TransposeAndCopy().
+     * @details The kernel only depends on the size of the data type and
+     *          on the shape of the data, so it is chosen once (e.g. during
+     *          the GAM Setup()) and not at every copy. Matrices are transposed
+     *          in square tiles that fit in the L1 cache; on x86-64 the tiles
+     *          of 4 and 8 bytes elements are further transposed
+     *          in registers in blocks of 4x4 and 2x2 elements (SSE2).
+     *          Scalars and vectors are copied as they are.
+     * @return  `true` if #type is one of the supported numeric types.
+     */
+    bool SetupTransposition();
+    
 protected:
 
     /**
@@ -137,14 +150,20 @@ protected:
      *          orientation to store data, while MARTe2 uses row-major
      *          orientation. Thus, when actualising matrix parameters
      *          or copying matrix signals often transposition is required.
+     *          The kernel selected by SetupTransposition() is used (the
+     *          method is called here if it was not called before).
      */
     bool TransposeAndCopy(void *const destination, const void *const source); 
     
+private:
+    
     /**
-     * @brief Templated version of TransposeAndCopy().
+     * @brief Transposes a numberOfRows x numberOfColumns column-major matrix
+     *        from source into a row-major matrix in destination.
      */
-    template<typename T>
-    bool TransposeAndCopyT(void *const destination, const void *const source);
+    typedef void (*TransposeFunction)(void * const destination, const void * const source, const uint32 numberOfRows, const uint32 numberOfColumns);
+    
+    TransposeFunction transposeFunction;    //!< Kernel selected by SetupTransposition(), NULL if not yet selected.
 };
 
 /*---------------------------------------------------------------------------*/
@@ -190,9 +209,12 @@ public:
      * @param[in] sourceParameter a reference to the AnyType pointing to the
      *                            parameter value that will be used to update the
      *                            model parameter.
+     * @param[in] destination     where the value is written, in the model
+     *                            layout. If NULL the value is written
+     *                            directly in the model memory (#address).
      * 
      */
-    bool Actualise(const AnyType& sourceParameter);
+    bool Actualise(const AnyType& sourceParameter, void* const destination = NULL_PTR(void*));
 
 };
 
@@ -32,6 +32,7 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "CLASSMETHODREGISTER.h"
 #include "LoadableLibrary.h"
 #include "StructuredDataI.h"
 #include "SimulinkWrapperGAM.h"
@@ -281,6 +282,33 @@ SimulinkWrapperGAM::SimulinkWrapperGAM()
 
     nonVirtualBusMode             = ByteArrayBusMode;
     enforceModelSignalCoverage    = false;
+
+    mergeContiguousCopies         = false;
+    copyBlocks                    = NULL_PTR(SimulinkCopyBlock*);
+    numberOfInputCopyBlocks       = 0u;
+    numberOfOutputCopyBlocks      = 0u;
+    transposedPorts               = NULL_PTR(SimulinkPort**);
+    numberOfInputTransposedPorts  = 0u;
+    numberOfOutputTransposedPorts = 0u;
+
+    parameterUpdatesEnabled     = false;
+    parameterSets[0u]           = NULL_PTR(uint8*);
+    parameterSets[1u]           = NULL_PTR(uint8*);
+    parameterSetSize            = 0u;
+    parameterSetOffsets         = NULL_PTR(uint32*);
+    parameterCopyBlocks         = NULL_PTR(SimulinkCopyBlock*);
+    numberOfParameterCopyBlocks = 0u;
+    publishedParameterSet       = 0u;
+    parameterSetPending         = 0;
+    parameterSetSem.Create();
+    parameterUpdateSem.Create();
+
+    filter = ReferenceT<RegisteredMethodsMessageFilter>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    filter->SetDestination(this);
+    ErrorManagement::ErrorType ret = MessageI::InstallMessageFilter(filter);
+    if (!ret.ErrorsCleared()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Failed to install message filters");
+    }
 }
 
 /*lint -e{1551} memory must be freed and functions called in the destructor are expected not to throw exceptions */
@@ -317,6 +345,29 @@ SimulinkWrapperGAM::~SimulinkWrapperGAM() {
     
     currentPort = NULL_PTR(SimulinkPort*);
     
+    if (copyBlocks != NULL) {
+        delete[] copyBlocks;
+        copyBlocks = NULL_PTR(SimulinkCopyBlock*);
+    }
+    if (transposedPorts != NULL) {
+        delete[] transposedPorts;
+        transposedPorts = NULL_PTR(SimulinkPort**);
+    }
+    for (uint32 setIdx = 0u; setIdx < 2u; setIdx++) {
+        if (parameterSets[setIdx] != NULL) {
+            delete[] parameterSets[setIdx];
+            parameterSets[setIdx] = NULL_PTR(uint8*);
+        }
+    }
+    if (parameterSetOffsets != NULL) {
+        delete[] parameterSetOffsets;
+        parameterSetOffsets = NULL_PTR(uint32*);
+    }
+    if (parameterCopyBlocks != NULL) {
+        delete[] parameterCopyBlocks;
+        parameterCopyBlocks = NULL_PTR(SimulinkCopyBlock*);
+    }
+    
     // Deallocate all SimulinkClasses objects
     uint32 parameterSize = modelParameters.GetSize();
     for (uint32 paramIdx = 0U; paramIdx < parameterSize; paramIdx++) {
@@ -441,6 +492,30 @@ bool SimulinkWrapperGAM::Initialise(StructuredDataI &data) {
                      enforceModelSignalCoverage?"must":"has not to");
     }
 
+    if (status) {
+        uint32 tempMergeCopies = 0u;
+        if (data.Read("MergeContiguousCopies", tempMergeCopies)) {
+            mergeContiguousCopies = (tempMergeCopies > 0u);
+        }
+        else {
+            mergeContiguousCopies = false;
+        }
+
+        REPORT_ERROR(ErrorManagement::Information, "MergeContiguousCopies set to %u", mergeContiguousCopies ? 1u : 0u);
+    }
+
+    if (status) {
+        uint32 tempParameterUpdates = 0u;
+        if (data.Read("EnableParameterUpdates", tempParameterUpdates)) {
+            parameterUpdatesEnabled = (tempParameterUpdates > 0u);
+        }
+        else {
+            parameterUpdatesEnabled = false;
+        }
+
+        REPORT_ERROR(ErrorManagement::Information, "EnableParameterUpdates set to %u", parameterUpdatesEnabled ? 1u : 0u);
+    }
+
     /// 2. Opening of model code shared object library.
     
     if (status) {
@@ -647,6 +722,14 @@ bool SimulinkWrapperGAM::Setup() {
         ok = !foundDisconnected;
     }
 
+    if (ok && mergeContiguousCopies) {
+        ok = BuildCopyPlan();
+    }
+
+    if (ok && parameterUpdatesEnabled) {
+        ok = BuildParameterSets();
+    }
+
     // Simulink initFunction call, init of the Simulink model
     if (ok) {
         (*initFunction)(states);
@@ -1087,8 +1170,20 @@ bool SimulinkWrapperGAM::Execute() {
     bool status = (states != NULL);
 
     // Inputs update
-    for (portIdx = 0u; (portIdx < modelNumOfInputs) && status; portIdx++) {
-        status = modelPorts[portIdx]->CopyData(nonVirtualBusMode);
+    if (mergeContiguousCopies) {
+        if (status) {
+            status = ExecuteCopyPlan(InputSignals);
+        }
+    }
+    else {
+        for (portIdx = 0u; (portIdx < modelNumOfInputs) && status; portIdx++) {
+            status = modelPorts[portIdx]->CopyData(nonVirtualBusMode);
+        }
+    }
+    
+    // Parameter set staged by UpdateParameters()
+    if ( (parameterSetPending != 0) && status) {
+        status = ApplyParameterSet();
     }
     
     // Model step
@@ -1097,13 +1192,323 @@ bool SimulinkWrapperGAM::Execute() {
     }
 
     // Ouputs update
-    for (portIdx = modelNumOfInputs; ( portIdx < (modelNumOfInputs + modelNumOfOutputs) ) && status; portIdx++) {
-        status = modelPorts[portIdx]->CopyData(nonVirtualBusMode);
+    if (mergeContiguousCopies) {
+        if (status) {
+            status = ExecuteCopyPlan(OutputSignals);
+        }
+    }
+    else {
+        for (portIdx = modelNumOfInputs; ( portIdx < (modelNumOfInputs + modelNumOfOutputs) ) && status; portIdx++) {
+            status = modelPorts[portIdx]->CopyData(nonVirtualBusMode);
+        }
     }
     
     return status;
 }
 
+/*lint -e{613} NULL pointers are checked beforehand.*/
+bool SimulinkWrapperGAM::ExecuteCopyPlan(const SignalDirection direction) {
+    
+    bool status = true;
+    
+    uint32 firstBlockIdx  = 0u;
+    uint32 endBlockIdx    = numberOfInputCopyBlocks;
+    uint32 firstPortIdx   = 0u;
+    uint32 endPortIdx     = numberOfInputTransposedPorts;
+    if (direction == OutputSignals) {
+        firstBlockIdx = numberOfInputCopyBlocks;
+        endBlockIdx   = numberOfInputCopyBlocks + numberOfOutputCopyBlocks;
+        firstPortIdx  = numberOfInputTransposedPorts;
+        endPortIdx    = numberOfInputTransposedPorts + numberOfOutputTransposedPorts;
+    }
+    
+    for (uint32 blockIdx = firstBlockIdx; (blockIdx < endBlockIdx) && status; blockIdx++) {
+        status = MemoryOperationsHelper::Copy(copyBlocks[blockIdx].destination, copyBlocks[blockIdx].source, copyBlocks[blockIdx].size);
+    }
+    
+    for (uint32 portIdx = firstPortIdx; (portIdx < endPortIdx) && status; portIdx++) {
+        status = transposedPorts[portIdx]->CopyData(nonVirtualBusMode);
+    }
+    
+    return status;
+}
+
+/*lint -e{613} NULL pointers are checked beforehand.*/
+bool SimulinkWrapperGAM::BuildCopyPlan() {
+    /*lint --e{ 923, 9016, 9091 } pointer arithmetic in this method looks safe. However, that part should probably be refactored */
+    
+    uint32 numberOfPorts = modelNumOfInputs + modelNumOfOutputs;
+    
+    // Each port contributes at most one block per carried signal (or one block if copied as a whole)
+    uint32 maxNumberOfBlocks = 0u;
+    for (uint32 portIdx = 0u; portIdx < numberOfPorts; portIdx++) {
+        uint32 signalsInThisPort = modelPorts[portIdx]->carriedSignals.GetSize();
+        maxNumberOfBlocks += (signalsInThisPort > 0u) ? signalsInThisPort : 1u;
+    }
+    
+    if (copyBlocks != NULL) {
+        delete[] copyBlocks;
+    }
+    if (transposedPorts != NULL) {
+        delete[] transposedPorts;
+    }
+    copyBlocks      = new SimulinkCopyBlock[maxNumberOfBlocks];
+    transposedPorts = new SimulinkPort*[numberOfPorts];
+    
+    numberOfInputCopyBlocks       = 0u;
+    numberOfOutputCopyBlocks      = 0u;
+    numberOfInputTransposedPorts  = 0u;
+    numberOfOutputTransposedPorts = 0u;
+    
+    for (uint32 portIdx = 0u; portIdx < numberOfPorts; portIdx++) {
+        
+        SimulinkPort* port = modelPorts[portIdx];
+        bool isInput = (portIdx < modelNumOfInputs);
+        uint32 firstBlockIdx = isInput ? 0u : numberOfInputCopyBlocks;
+        uint32 &numberOfBlocks = isInput ? numberOfInputCopyBlocks : numberOfOutputCopyBlocks;
+        
+        if (port->requiresTransposition) {
+            transposedPorts[numberOfInputTransposedPorts + numberOfOutputTransposedPorts] = port;
+            if (isInput) {
+                numberOfInputTransposedPorts++;
+            }
+            else {
+                numberOfOutputTransposedPorts++;
+            }
+        }
+        else if ( (nonVirtualBusMode == StructuredBusMode) && (port->isStructured) ) {
+            
+            uint32 signalsInThisPort = port->carriedSignals.GetSize();
+            for (uint32 signalIdx = 0u; signalIdx < signalsInThisPort; signalIdx++) {
+                SimulinkSignal* signal = port->carriedSignals[signalIdx];
+                if (signal->MARTeAddress != NULL) {
+                    if (isInput) {
+                        AddCopyBlock(firstBlockIdx, numberOfBlocks, signal->address, signal->MARTeAddress, signal->byteSize);
+                    }
+                    else {
+                        AddCopyBlock(firstBlockIdx, numberOfBlocks, signal->MARTeAddress, signal->address, signal->byteSize);
+                    }
+                }
+            }
+        }
+        else {
+            if (port->MARTeAddress != NULL) {
+                if (isInput) {
+                    AddCopyBlock(firstBlockIdx, numberOfBlocks, port->address, port->MARTeAddress, port->CAPISize);
+                }
+                else {
+                    AddCopyBlock(firstBlockIdx, numberOfBlocks, port->MARTeAddress, port->address, port->CAPISize);
+                }
+            }
+        }
+    }
+    
+    if (verbosityLevel > 0u) {
+        REPORT_ERROR(ErrorManagement::Information,
+            "Copy plan: %u input and %u output blocks, %u input and %u output ports with transposition.",
+            numberOfInputCopyBlocks, numberOfOutputCopyBlocks, numberOfInputTransposedPorts, numberOfOutputTransposedPorts);
+    }
+    
+    return true;
+}
+
+/*lint -e{613} NULL pointers are checked beforehand.*/
+void SimulinkWrapperGAM::AddCopyBlock(const uint32 firstBlockIdx, uint32 &numberOfBlocks, void* const destination, const void* const source, const uint32 size) {
+    /*lint --e{ 923, 9016, 9091 } pointer arithmetic in this method looks safe. However, that part should probably be refactored */
+    
+    bool merged = false;
+    if (numberOfBlocks > 0u) {
+        SimulinkCopyBlock &lastBlock = copyBlocks[firstBlockIdx + numberOfBlocks - 1u];
+        bool destinationFollows = ( (static_cast<uint8*>(lastBlock.destination) + lastBlock.size) == static_cast<uint8*>(destination) );
+        bool sourceFollows      = ( (static_cast<const uint8*>(lastBlock.source) + lastBlock.size) == static_cast<const uint8*>(source) );
+        if (destinationFollows && sourceFollows) {
+            lastBlock.size += size;
+            merged = true;
+        }
+    }
+    if (!merged) {
+        SimulinkCopyBlock &newBlock = copyBlocks[firstBlockIdx + numberOfBlocks];
+        newBlock.destination = destination;
+        newBlock.source      = source;
+        newBlock.size        = size;
+        numberOfBlocks++;
+    }
+}
+
+/*lint -e{613} NULL pointers are checked beforehand.*/
+bool SimulinkWrapperGAM::BuildParameterSets() {
+    /*lint --e{ 923, 9016, 9091 } pointer arithmetic in this method looks safe. However, that part should probably be refactored */
+    
+    uint32 numberOfParameters = modelParameters.GetSize();
+    
+    for (uint32 setIdx = 0u; setIdx < 2u; setIdx++) {
+        if (parameterSets[setIdx] != NULL) {
+            delete[] parameterSets[setIdx];
+            parameterSets[setIdx] = NULL_PTR(uint8*);
+        }
+    }
+    if (parameterSetOffsets != NULL) {
+        delete[] parameterSetOffsets;
+    }
+    if (parameterCopyBlocks != NULL) {
+        delete[] parameterCopyBlocks;
+    }
+    parameterSetOffsets         = new uint32[(numberOfParameters > 0u) ? numberOfParameters : 1u];
+    parameterCopyBlocks         = new SimulinkCopyBlock[(numberOfParameters > 0u) ? (2u * numberOfParameters) : 1u];
+    numberOfParameterCopyBlocks = 0u;
+    
+    // Parameters which are contiguous in the model memory are contiguous also in the sets,
+    // the others start at an offset aligned to 8 bytes, so that the sets have the same alignment as the model.
+    parameterSetSize = 0u;
+    const uint8* lastParameterEnd = NULL_PTR(const uint8*);
+    for (uint32 paramIdx = 0u; paramIdx < numberOfParameters; paramIdx++) {
+        SimulinkParameter* parameter = modelParameters[paramIdx];
+        uint8* parameterAddress = static_cast<uint8*>(parameter->address);
+        bool followsLast = ( (lastParameterEnd != NULL) && (lastParameterEnd == parameterAddress) );
+        if (!followsLast) {
+            parameterSetSize = (parameterSetSize + 7u) & ~7u;
+        }
+        parameterSetOffsets[paramIdx] = parameterSetSize;
+        parameterSetSize += parameter->byteSize;
+        lastParameterEnd = &parameterAddress[parameter->byteSize];
+        
+        if (followsLast && (numberOfParameterCopyBlocks > 0u)) {
+            parameterCopyBlocks[numberOfParameterCopyBlocks - 1u].size += parameter->byteSize;
+        }
+        else {
+            SimulinkCopyBlock &newBlock = parameterCopyBlocks[numberOfParameterCopyBlocks];
+            newBlock.destination = parameter->address;
+            newBlock.source      = NULL_PTR(const void*);
+            newBlock.size        = parameter->byteSize;
+            numberOfParameterCopyBlocks++;
+        }
+    }
+    
+    uint32 allocatedSize = (parameterSetSize > 0u) ? parameterSetSize : 1u;
+    parameterSets[0u] = new uint8[allocatedSize];
+    parameterSets[1u] = new uint8[allocatedSize];
+    
+    // Sources of the blocks: set 0 first, set 1 follows
+    uint32 blockIdx = 0u;
+    for (uint32 paramIdx = 0u; paramIdx < numberOfParameters; paramIdx++) {
+        if ( (blockIdx < numberOfParameterCopyBlocks) && (parameterCopyBlocks[blockIdx].destination == modelParameters[paramIdx]->address) ) {
+            uint32 offset = parameterSetOffsets[paramIdx];
+            parameterCopyBlocks[blockIdx].source = &(parameterSets[0u][offset]);
+            parameterCopyBlocks[numberOfParameterCopyBlocks + blockIdx].destination = parameterCopyBlocks[blockIdx].destination;
+            parameterCopyBlocks[numberOfParameterCopyBlocks + blockIdx].source      = &(parameterSets[1u][offset]);
+            parameterCopyBlocks[numberOfParameterCopyBlocks + blockIdx].size        = parameterCopyBlocks[blockIdx].size;
+            blockIdx++;
+        }
+    }
+    
+    // Set 0 holds the actualised values
+    bool ok = true;
+    for (uint32 paramIdx = 0u; (paramIdx < numberOfParameters) && ok; paramIdx++) {
+        ok = MemoryOperationsHelper::Copy(&(parameterSets[0u][parameterSetOffsets[paramIdx]]), modelParameters[paramIdx]->address, modelParameters[paramIdx]->byteSize);
+    }
+    publishedParameterSet = 0u;
+    parameterSetPending   = 0;
+    
+    if (verbosityLevel > 0u) {
+        REPORT_ERROR(ErrorManagement::Information,
+            "Parameter sets: %u bytes, %u copies.", parameterSetSize, numberOfParameterCopyBlocks);
+    }
+    
+    return ok;
+}
+
+/*lint -e{613} NULL pointers are checked beforehand.*/
+bool SimulinkWrapperGAM::ApplyParameterSet() {
+    
+    bool status = true;
+    
+    if (parameterSetSem.FastTryLock()) {
+        if (parameterSetPending != 0) {
+            uint32 firstBlockIdx = publishedParameterSet * numberOfParameterCopyBlocks;
+            for (uint32 blockIdx = firstBlockIdx; (blockIdx < (firstBlockIdx + numberOfParameterCopyBlocks)) && status; blockIdx++) {
+                status = MemoryOperationsHelper::Copy(parameterCopyBlocks[blockIdx].destination, parameterCopyBlocks[blockIdx].source, parameterCopyBlocks[blockIdx].size);
+            }
+            parameterSetPending = 0;
+        }
+        parameterSetSem.FastUnLock();
+    }
+    
+    return status;
+}
+
+/*lint -e{613} NULL pointers are checked beforehand.*/
+ErrorManagement::ErrorType SimulinkWrapperGAM::UpdateParameters() {
+    
+    bool ok = ( parameterUpdatesEnabled && (parameterSets[0u] != NULL) );
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::IllegalOperation, "Parameter updates are not enabled (EnableParameterUpdates = 0 or Setup() not called).");
+    }
+    
+    if (ok) {
+        ok = (parameterUpdateSem.FastLock() == ErrorManagement::NoError);
+    }
+    
+    if (ok) {
+        // Only this method changes publishedParameterSet, so the other set is not read by Execute()
+        uint32 stagingParameterSet = 1u - publishedParameterSet;
+        uint8* stagingSet = parameterSets[stagingParameterSet];
+        
+        // Parameters which are not found keep the value of the last set
+        ok = MemoryOperationsHelper::Copy(stagingSet, parameterSets[publishedParameterSet], parameterSetSize);
+        
+        for (uint32 paramIdx = 0u; (paramIdx < modelParameters.GetSize()) && ok; paramIdx++) {
+            
+            StreamString parameterPathInObjDatabase;
+            const char8* currentParamName = (modelParameters[paramIdx]->fullName).Buffer();
+            
+            bool isLoaded = cfgParameterDatabase.Read(currentParamName, parameterPathInObjDatabase);
+            if (!isLoaded) {
+                isLoaded = externalParameterDatabase.Read(currentParamName, parameterPathInObjDatabase);
+            }
+            
+            if (isLoaded) {
+                ReferenceT<AnyObject> sourceParameterPtr = ObjectRegistryDatabase::Instance()->Find(parameterPathInObjDatabase.Buffer());
+                if (sourceParameterPtr.IsValid()) {
+                    AnyType sourceParameter = sourceParameterPtr->GetType();
+                    if (sourceParameter.IsStaticDeclared()) {
+                        bool isActualised = modelParameters[paramIdx]->Actualise(sourceParameter, &stagingSet[parameterSetOffsets[paramIdx]]);
+                        if (!isActualised) {
+                            if (skipInvalidTunableParams) {
+                                REPORT_ERROR(ErrorManagement::Warning,
+                                    "Parameter %s cannot be actualized, keeping the current value", currentParamName);
+                            }
+                            else {
+                                REPORT_ERROR(ErrorManagement::ParametersError,
+                                    "SkipInvalidTunableParams is false and parameter %s cannot be actualized, discarding the new parameter set", currentParamName);
+                                ok = false;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        
+        // Hand over the staged set
+        if (ok) {
+            ok = (parameterSetSem.FastLock() == ErrorManagement::NoError);
+            if (ok) {
+                publishedParameterSet = stagingParameterSet;
+                parameterSetPending   = 1;
+                parameterSetSem.FastUnLock();
+            }
+        }
+        
+        parameterUpdateSem.FastUnLock();
+    }
+    
+    if (ok && (verbosityLevel > 0u)) {
+        REPORT_ERROR(ErrorManagement::Information, "New parameter set staged, applied before the next model step.");
+    }
+    
+    ErrorManagement::ErrorType ret(ok);
+    return ret;
+}
+
 /*lint -e{613} NULL pointers are checked beforehand.*/
 bool SimulinkWrapperGAM::ScanTunableParameters(const rtwCAPI_ModelMappingInfo* const mmi)
 {
@@ -2291,7 +2696,8 @@ bool SimulinkWrapperGAM::MapPorts(const SignalDirection direction) {
                         if (modelPorts[portIdx]->carriedSignals[signalInPortIdx]->orientation != rtwCAPI_MATRIX_ROW_MAJOR) {
                             
                             modelPorts[portIdx]->requiresTransposition = true;
-                            if (verbosityLevel > 0u) {
+                            ok = modelPorts[portIdx]->SetupTransposition();
+                            if ((verbosityLevel > 0u) && ok) {
                                 REPORT_ERROR(ErrorManagement::Warning,
                                     "%s signal %s orientation is column-major. Supported, but requires real-time transposition and may result in performance loss.",
                                     directionName.Buffer(), GAMSignalName.Buffer());
@@ -2375,6 +2781,7 @@ bool SimulinkWrapperGAM::MapPorts(const SignalDirection direction) {
 }
 
 CLASS_REGISTER(SimulinkWrapperGAM, "1.0")
+CLASS_METHOD_REGISTER(SimulinkWrapperGAM, UpdateParameters)
 
 } /* namespace MARTe */
 
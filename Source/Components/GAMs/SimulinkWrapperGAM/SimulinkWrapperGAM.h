@@ -35,10 +35,12 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "ConfigurationDatabase.h"
+#include "FastPollingMutexSem.h"
 #include "GAM.h"
 #include "LoadableLibrary.h"
 #include "MessageI.h"
 #include "ReferenceT.h"
+#include "RegisteredMethodsMessageFilter.h"
 #include "SimulinkClasses.h"
 #include "StreamString.h"
 
@@ -113,6 +115,7 @@ namespace MARTe {
  *     EnforceModelSignalCoverage  = ( 0 | 1 )                      // Optional. Default: 1
  *     TunableParamExternalSource  = "ExternalSourceName"           // Optional.
  *     NonVirtualBusMode           = ( "ByteArray" | "Structured" ) // Optional. Default: "ByteArray"
+ *     MergeContiguousCopies       = ( 0 | 1 )                      // Optional. Default: 0
  * 
  *     InputSignals  = {                                // As appropriate based on the Simulink(r) generated structure
  *         InSignal1 = {
@@ -194,6 +197,17 @@ namespace MARTe {
  *      can be omitted in the configuration file and their value will not be stored.
  *      Valid only when `NonVirtualBusMode == "Structured"`.
  *      Default value: `1`.
+ *    - *MergeContiguousCopies*: can be 0 or 1. When set to 1, Setup() builds
+ *      a copy plan for the ports which do not require transposition: the
+ *      copies of consecutive ports and signals which are contiguous both in the
+ *      GAM signal memory and in the model memory are merged into a single copy
+ *      (e.g. all the signals of a nonvirtual bus in `Structured` mode, when the bus
+ *      has no padding). Ports with column-major matrix signals are still copied
+ *      port by port. Default value: 0
+ *    - *EnableParameterUpdates*: can be 0 or 1. When set to 1 the tunable
+ *      parameters can be updated at run-time with the `UpdateParameters` RPC.
+ *      See [Run-time parameter updates](#run-time-parameter-updates).
+ *      Default value: 0
  *    - *Parameters*: local list of parameters. See
  *      [Model parameters](#model-parameters) section for details.
  * 
@@ -353,6 +367,38 @@ namespace MARTe {
  *    the value pointed by the input AnyType.
  * 
  * 
+ * Run-time parameter updates                    {#run-time-parameter-updates}
+ * ----------------------------------------------------------------------------
+ * 
+ * If `EnableParameterUpdates = 1`, Setup() allocates two copies (sets) of the
+ * tunable parameters, in the same layout as the model memory, and the GAM
+ * registers the `UpdateParameters` RPC (see RegisteredMethodsMessageFilter):
+ * 
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * +UpdateSimulinkParameters = {
+ *     Class = Message
+ *     Destination = "App.Functions.GAMSimulink"
+ *     Function = "UpdateParameters"
+ *     Mode = ExpectsReply
+ * }
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * 
+ * The RPC, executed by the thread that sends the message, looks for the
+ * parameters in the `Parameters` node and in the external parameter
+ * source, as Setup() does (so the external source is expected to have been
+ * reloaded before the message is sent), and actualises them in the set
+ * which is not in use by the real-time thread. Parameters which are not found
+ * keep their current value. If a parameter cannot be actualised the RPC fails
+ * and the new set is discarded, unless `SkipInvalidTunableParams = 1`, in which
+ * case the parameter keeps its current value.
+ * When all the parameters are staged the set is handed over to the real-time
+ * thread, which copies it in the model memory at the beginning of the next
+ * Execute(), before the model step. The copy is a few memory block copies
+ * (contiguous parameters are merged) and a model step never sees
+ * a partially updated set. The real-time thread never waits for the RPC:
+ * if a set is being handed over while Execute() runs, the update is applied
+ * at the next cycle.
+ * 
  * 
  * Input and output signals                          {#input-and-output-signals}
  * =============================================================================
@@ -739,9 +785,6 @@ namespace MARTe {
  *       export such signals as [u]fix64, which is currently incompatible
  *       with the GAM.
  * 
- * @todo Develop a more efficient transposition algorithm for column-major
- *       matrix signals. 
- * 
  */
 class SimulinkWrapperGAM: public GAM, public MessageI {
 
@@ -799,6 +842,19 @@ public:
      *         3. stepFunction != `NULL`
      */
     virtual bool Execute();
+    
+    /**
+     * @brief   Stages a new set of tunable parameters.
+     * @details Registered as an RPC. Actualises the tunable parameters, from the
+     *          `Parameters` node and from the external parameter source, in the
+     *          parameter set which is not in use by Execute() and hands it over
+     *          to Execute(), which copies it into the model memory before the next step.
+     *          See [Run-time parameter updates](#run-time-parameter-updates).
+     * @return  ErrorManagement::NoError if the new set was handed over to Execute().
+     *          An error if `EnableParameterUpdates` is not set, if Setup() was not
+     *          called or if a parameter could not be actualised.
+     */
+    ErrorManagement::ErrorType UpdateParameters();
 
 protected:
     
@@ -1000,6 +1056,50 @@ private:
      */
     bool ScanSignal(const uint16 sigIdx, const uint32 depth, const SignalMode mode, void* const startAddress, StreamString baseName, const uint64 baseOffset, StreamString spacer);
     
+    /**
+     * @brief   Builds the copy plan used by Execute() when #mergeContiguousCopies is `true`.
+     * @details Ports which require transposition are added to #transposedPorts, the others are
+     *          added to #copyBlocks, merging the copies which are contiguous both in the GAM and in
+     *          the model memory. Inputs come first, outputs follow.
+     * @returns `true` if the plan was built.
+     * @pre     MapPorts() == `true` for both directions.
+     */
+    bool BuildCopyPlan();
+
+    /**
+     * @brief          Adds a copy to the copy plan, merging it with the last block of the same direction if contiguous.
+     * @param[in]      firstBlockIdx index of the first block of this direction in #copyBlocks.
+     * @param[in, out] numberOfBlocks number of blocks of this direction, incremented if a block is added.
+     * @param[in]      destination the copy destination.
+     * @param[in]      source the copy source.
+     * @param[in]      size the number of bytes to copy.
+     */
+    void AddCopyBlock(const uint32 firstBlockIdx, uint32 &numberOfBlocks, void* const destination, const void* const source, const uint32 size);
+
+    /**
+     * @brief     Executes the copy plan of one direction.
+     * @param[in] direction InputSignals (GAM to model) or OutputSignals (model to GAM).
+     * @returns   `true` if all the copies succeed.
+     */
+    bool ExecuteCopyPlan(const SignalDirection direction);
+
+    /**
+     * @brief   Allocates the parameter sets used by UpdateParameters().
+     * @details Assigns each tunable parameter an offset in the sets, builds #parameterCopyBlocks
+     *          (merging the parameters which are contiguous in the model memory) and initialises
+     *          the first set with the current value of the parameters.
+     * @returns `true` if the sets were allocated.
+     * @pre     The tunable parameters have been actualised.
+     */
+    bool BuildParameterSets();
+
+    /**
+     * @brief Copies the parameter set handed over by UpdateParameters() into the model memory.
+     * @details Does not wait: if #parameterSetSem is locked the set is applied at the next call.
+     * @returns `true` if all the copies succeed.
+     */
+    bool ApplyParameterSet();
+
     /**
      * @brief     Check coherence between model ports and GAM signals and map them.
      * @param[in] direction specifies if the method will map input or outpus
@@ -1079,6 +1179,62 @@ private:
      */
     bool enforceModelSignalCoverage;
 
+    /**
+     * @brief A block of memory copied with a single MemoryOperationsHelper::Copy().
+     */
+    struct SimulinkCopyBlock {
+        void*       destination;
+        const void* source;
+        uint32      size;
+    };
+
+    /**
+     * @brief When enabled, Execute() uses the copy plan built by BuildCopyPlan().
+     */
+    bool mergeContiguousCopies;
+
+    /**
+     * @name    Copy plan
+     * @brief   Copies executed by Execute() when #mergeContiguousCopies is `true`.
+     * @details The input entries come first, the output entries follow.
+     */
+    //@{
+    SimulinkCopyBlock* copyBlocks;              //!< Merged copies of the ports which do not require transposition.
+    uint32 numberOfInputCopyBlocks;             //!< Number of input entries of #copyBlocks.
+    uint32 numberOfOutputCopyBlocks;            //!< Number of output entries of #copyBlocks.
+    SimulinkPort** transposedPorts;             //!< Ports which require transposition, copied with SimulinkPort::CopyData().
+    uint32 numberOfInputTransposedPorts;        //!< Number of input entries of #transposedPorts.
+    uint32 numberOfOutputTransposedPorts;       //!< Number of output entries of #transposedPorts.
+    //@}
+
+    /**
+     * @brief When enabled, the tunable parameters can be updated with UpdateParameters().
+     */
+    bool parameterUpdatesEnabled;
+
+    /**
+     * @name    Parameter sets
+     * @brief   Double buffer used by UpdateParameters() to stage the tunable parameters.
+     * @details #publishedParameterSet is only written by UpdateParameters() while holding
+     *          #parameterSetSem, so the other set can be staged while Execute() reads the published one.
+     */
+    //@{
+    uint8* parameterSets[2];                    //!< The two parameter sets, in the model memory layout.
+    uint32 parameterSetSize;                    //!< Size in bytes of each parameter set.
+    uint32* parameterSetOffsets;                //!< Offset of each entry of #modelParameters in the sets.
+    SimulinkCopyBlock* parameterCopyBlocks;     //!< Copies from each set into the model memory (set 0 first, set 1 follows).
+    uint32 numberOfParameterCopyBlocks;         //!< Number of copies per set.
+    uint32 publishedParameterSet;               //!< Index of the set which was last handed over to Execute().
+    volatile int32 parameterSetPending;         //!< 1 if the published set has yet to be copied into the model memory.
+    FastPollingMutexSem parameterSetSem;        //!< Protects the hand-over of a parameter set.
+    FastPollingMutexSem parameterUpdateSem;     //!< Serialises the UpdateParameters() calls.
+    //@}
+
+    /**
+     * @brief Filter to receive the UpdateParameters RPC.
+     */
+    ReferenceT<RegisteredMethodsMessageFilter> filter;
+
 };
 
 
@@ -0,0 +1,778 @@
+/**
+ * @file StatisticsArrayHelperT.h
+ * @brief Header file for class StatisticsArrayHelperT
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class StatisticsArrayHelperT
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef STATISTICSARRAYHELPERT_H_
+#define STATISTICSARRAYHELPERT_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+/*lint -efile(766,StatisticsArrayHelperT.h) FastMath.h and <limits> are used in this file*/
+#include <limits>
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "FastMath.h"
+#include "MemoryOperationsHelper.h"
+#include "StatisticsHelperT.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief The class provides templated statistics computation over an array of
+ * independent elements.
+ * @details Computes the same statistics as StatisticsHelperT (average, standard deviation,
+ * root mean square, minimum and maximum over a moving time window) for numberOfElements
+ * elements at once, e.g. all the elements of an array signal, or of several signals.
+ *
+ * All the state is kept in structure of arrays form, i.e. one contiguous array per attribute
+ * indexed by the element:
+ *  - the moving window of samples (and of squared samples) is stored as size rows of
+ *    numberOfElements values, so that PushSamples() reads the oldest row and overwrites it
+ *    with the new samples;
+ *  - the cumulative sums, minimum and maximum are arrays of numberOfElements values.
+ *
+ * The update of the sums is a single branch-free loop over contiguous arrays, which the
+ * compiler is able to vectorise. The minimum and maximum of each element are tracked with
+ * monotonic deques (wedges), as in StatisticsHelperT, stored in the same row layout.
+ *
+ * As in StatisticsHelperT, the accumulators have the signal type, the sums of the floating point
+ * types are compensated and periodically re-based, any window size is supported (bit shift or
+ * reciprocal multiply for integer types) and the average is only exact after the window has been
+ * fully populated once.
+ */
+/*lint -e{1712} the implementation does not provide default constructor*/
+/*lint -e{1733} the implementation does not provide a copy constructor*/
+/*lint -esym(9107, MARTe::StatisticsArrayHelperT*) [MISRA C++ Rule 3-1-1] required for template implementation*/
+template<typename Type> class StatisticsArrayHelperT {
+public:
+
+    /**
+     * @brief Constructor.
+     * @details Allocates the memory buffers for nOfElements elements. A windowSize of 0
+     * is considered as 1 for integer types.
+     * @param[in] windowSize the size of the moving window.
+     * @param[in] nOfElements the number of elements.
+     */
+    StatisticsArrayHelperT(const uint32 windowSize,
+                           const uint32 nOfElements);
+
+    /**
+     * @brief Destructor. Frees allocated memory buffers.
+     */
+    virtual ~StatisticsArrayHelperT();
+
+    /**
+     * @brief Initialiser. Clears out sample buffers and initialises accumulators.
+     * @return true if the buffers were allocated.
+     */
+    bool Reset();
+
+    /**
+     * @brief Inserts a new sample of each element in the moving time window.
+     * @details See StatisticsHelperT::PushSample.
+     * @param[in] samples the numberOfElements new samples.
+     * @param[in] infiniteMaxMin if true the minimum and maximum are the absolute ones since the last Reset().
+     * @return true if the buffers were allocated and samples is not NULL.
+     */
+    bool PushSamples(const Type * const samples,
+                     const bool infiniteMaxMin = false);
+
+    /**
+     * @brief Accessor. Returns the window size.
+     * @return actual window size.
+     */
+    uint32 GetSize() const;
+
+    /**
+     * @brief Accessor. Returns the number of elements.
+     * @return the number of elements.
+     */
+    uint32 GetNumberOfElements() const;
+
+    /**
+     * @brief Accessor. Returns the number of samples inserted in the buffer.
+     * @return number of samples.
+     */
+    uint32 GetCounter() const;
+
+    /**
+     * @brief Average of the elements [firstElement, firstElement + nOfElements[.
+     * @param[out] output where to write the nOfElements values.
+     * @param[in] firstElement the first element.
+     * @param[in] nOfElements the number of elements.
+     * @return true if the elements are in range.
+     */
+    bool GetAvg(Type * const output,
+                const uint32 firstElement,
+                const uint32 nOfElements) const;
+
+    /**
+     * @brief Standard deviation of the elements [firstElement, firstElement + nOfElements[.
+     * @see GetAvg
+     */
+    bool GetStd(Type * const output,
+                const uint32 firstElement,
+                const uint32 nOfElements) const;
+
+    /**
+     * @brief Root mean square of the elements [firstElement, firstElement + nOfElements[.
+     * @see GetAvg
+     */
+    bool GetRms(Type * const output,
+                const uint32 firstElement,
+                const uint32 nOfElements) const;
+
+    /**
+     * @brief Minimum of the elements [firstElement, firstElement + nOfElements[.
+     * @see GetAvg
+     */
+    bool GetMin(Type * const output,
+                const uint32 firstElement,
+                const uint32 nOfElements) const;
+
+    /**
+     * @brief Maximum of the elements [firstElement, firstElement + nOfElements[.
+     * @see GetAvg
+     */
+    bool GetMax(Type * const output,
+                const uint32 firstElement,
+                const uint32 nOfElements) const;
+
+    /**
+     * @brief Sum over the moving window of the elements [firstElement, firstElement + nOfElements[.
+     * @see GetAvg
+     */
+    bool GetSum(Type * const output,
+                const uint32 firstElement,
+                const uint32 nOfElements) const;
+
+private:
+
+    /**
+     * Window size
+     */
+    uint32 size;
+
+    /**
+     * Number of elements
+     */
+    uint32 numberOfElements;
+
+    /**
+     * Number of samples inserted
+     */
+    uint32 counter;
+
+    /**
+     * Row of the oldest samples in the window
+     */
+    uint32 position;
+
+    /**
+     * Sequence number of the latest samples (wraps around)
+     */
+    uint32 sequence;
+
+    /**
+     * Pre-computed division shifter (integer types) or 1.0 / size (floating point types)
+     */
+    Type div;
+
+    /**
+     * Pre-computed 1.0 / size, for integer types with a window size which is not a power of 2
+     */
+    float64 reciprocal;
+
+    /**
+     * True if the window size is a power of 2
+     */
+    bool isPow2;
+
+    /**
+     * Number of samples pushed since the last re-base
+     */
+    uint32 rebaseCounter;
+
+    /**
+     * Sample buffer (size rows of numberOfElements)
+     */
+    Type *window;
+
+    /**
+     * Sample buffer, squared (size rows of numberOfElements)
+     */
+    Type *windowSq;
+
+    /**
+     * Sum of the samples in the window of each element
+     */
+    Type *sum;
+
+    /**
+     * Sum of the squared samples in the window of each element
+     */
+    Type *sumSq;
+
+    /**
+     * Compensation of the sum of each element (floating point types)
+     */
+    Type *sumC;
+
+    /**
+     * Compensation of the sum of squares of each element (floating point types)
+     */
+    Type *sumSqC;
+
+    /**
+     * Sum of the samples pushed since the last re-base, followed by its compensation (2 x numberOfElements)
+     */
+    Type *rebase;
+
+    /**
+     * Sum of the squared samples pushed since the last re-base, followed by its compensation (2 x numberOfElements)
+     */
+    Type *rebaseSq;
+
+    /**
+     * Maximum of each element
+     */
+    Type *max;
+
+    /**
+     * Minimum of each element
+     */
+    Type *min;
+
+    /**
+     * Values of the maximum wedges (size rows of numberOfElements)
+     */
+    Type *maxWedge;
+
+    /**
+     * Sequence number of the values in the maximum wedges
+     */
+    uint32 *maxWedgeSeq;
+
+    /**
+     * Front row of the maximum wedge of each element
+     */
+    uint32 *maxWedgeHead;
+
+    /**
+     * Number of values in the maximum wedge of each element
+     */
+    uint32 *maxWedgeCount;
+
+    /**
+     * Values of the minimum wedges (size rows of numberOfElements)
+     */
+    Type *minWedge;
+
+    /**
+     * Sequence number of the values in the minimum wedges
+     */
+    uint32 *minWedgeSeq;
+
+    /**
+     * Front row of the minimum wedge of each element
+     */
+    uint32 *minWedgeHead;
+
+    /**
+     * Number of values in the minimum wedge of each element
+     */
+    uint32 *minWedgeCount;
+
+    /**
+     * @brief Allocates all the buffers.
+     */
+    void Allocate();
+
+    /**
+     * @brief Divides an accumulator by the window size (bit shift or reciprocal multiply for integer types).
+     * @param[in] accumulator the value to divide.
+     * @param[in] compensation the compensation of the accumulator (floating point types).
+     * @return (accumulator + compensation) / size, rounded towards minus infinity for integer types.
+     */
+    inline Type Scale(const Type accumulator,
+                      const Type compensation) const;
+
+    /**
+     * @brief Sets the maximum (minimum) of all the elements to the lowest (highest) value of the type.
+     */
+    void ResetMaxMin();
+
+    /**
+     * @brief Wraps a row index of the window or wedges.
+     * @param[in] index the index to wrap, which must be < 2 * size.
+     * @return index modulo size.
+     */
+    inline uint32 WrapRow(const uint32 index) const;
+
+    /**
+     * @brief Checks that [firstElement, firstElement + nOfElements[ is in range.
+     */
+    inline bool CheckRange(const Type * const output,
+                           const uint32 firstElement,
+                           const uint32 nOfElements) const;
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+template<typename Type> inline uint32 StatisticsArrayHelperT<Type>::WrapRow(const uint32 index) const {
+    return (index >= size) ? (index - size) : (index);
+}
+
+/*lint -e{715} the compensation is not used by the integer types*/
+/*lint -e{9117} [MISRA C++ Rule 5-0-4] signedness ignored in template method to avoid specializing for all integer types*/
+template<typename Type> inline Type StatisticsArrayHelperT<Type>::Scale(const Type accumulator,
+                                                                        const Type compensation) const {
+    Type result;
+    if (isPow2) {
+        result = accumulator >> div;
+    }
+    else if (std::numeric_limits<Type>::is_signed) {
+        result = static_cast<Type>(StatisticsFloorDivide(static_cast<int64>(accumulator), static_cast<uint64>(size), reciprocal));
+    }
+    else {
+        result = static_cast<Type>(StatisticsFloorDivide(static_cast<uint64>(accumulator), static_cast<uint64>(size), reciprocal));
+    }
+    return result;
+}
+
+template<> inline float32 StatisticsArrayHelperT<float32>::Scale(const float32 accumulator,
+                                                                 const float32 compensation) const {
+    return (accumulator + compensation) * div;
+}
+
+template<> inline float64 StatisticsArrayHelperT<float64>::Scale(const float64 accumulator,
+                                                                 const float64 compensation) const {
+    return (accumulator + compensation) * div;
+}
+
+template<typename Type> void StatisticsArrayHelperT<Type>::ResetMaxMin() {
+    for (uint32 e = 0u; e < numberOfElements; e++) {
+        max[e] = std::numeric_limits<Type>::min();
+        min[e] = std::numeric_limits<Type>::max();
+    }
+}
+
+template<> inline void StatisticsArrayHelperT<float32>::ResetMaxMin() {
+    for (uint32 e = 0u; e < numberOfElements; e++) {
+        max[e] = -1.0F * std::numeric_limits<float32>::max();
+        min[e] = std::numeric_limits<float32>::max();
+    }
+}
+
+template<> inline void StatisticsArrayHelperT<float64>::ResetMaxMin() {
+    for (uint32 e = 0u; e < numberOfElements; e++) {
+        max[e] = -1.0 * std::numeric_limits<float64>::max();
+        min[e] = std::numeric_limits<float64>::max();
+    }
+}
+
+template<typename Type> void StatisticsArrayHelperT<Type>::Allocate() {
+    uint32 nOfValues = size * numberOfElements;
+    window = new Type[nOfValues];
+    windowSq = new Type[nOfValues];
+    sum = new Type[numberOfElements];
+    sumSq = new Type[numberOfElements];
+    sumC = new Type[numberOfElements];
+    sumSqC = new Type[numberOfElements];
+    rebase = new Type[2u * numberOfElements];
+    rebaseSq = new Type[2u * numberOfElements];
+    max = new Type[numberOfElements];
+    min = new Type[numberOfElements];
+    /* Each sample in the time window is at most once in each wedge */
+    maxWedge = new Type[nOfValues];
+    maxWedgeSeq = new uint32[nOfValues];
+    maxWedgeHead = new uint32[numberOfElements];
+    maxWedgeCount = new uint32[numberOfElements];
+    minWedge = new Type[nOfValues];
+    minWedgeSeq = new uint32[nOfValues];
+    minWedgeHead = new uint32[numberOfElements];
+    minWedgeCount = new uint32[numberOfElements];
+}
+
+template<typename Type> bool StatisticsArrayHelperT<Type>::Reset() {
+
+    counter = 0u;
+    position = 0u;
+    sequence = 0u;
+    rebaseCounter = 0u;
+
+    bool ok = (window != NULL_PTR(Type *));
+    if (ok) {
+        uint32 windowBytes = static_cast<uint32>(size * numberOfElements * sizeof(Type));
+        uint32 elementBytes = static_cast<uint32>(numberOfElements * sizeof(Type));
+        uint32 countBytes = static_cast<uint32>(numberOfElements * sizeof(uint32));
+        ok = MemoryOperationsHelper::Set(window, '\0', windowBytes);
+        if (ok) {
+            ok = MemoryOperationsHelper::Set(windowSq, '\0', windowBytes);
+        }
+        if (ok) {
+            ok = MemoryOperationsHelper::Set(sum, '\0', elementBytes);
+        }
+        if (ok) {
+            ok = MemoryOperationsHelper::Set(sumSq, '\0', elementBytes);
+        }
+        if (ok) {
+            ok = MemoryOperationsHelper::Set(sumC, '\0', elementBytes);
+        }
+        if (ok) {
+            ok = MemoryOperationsHelper::Set(sumSqC, '\0', elementBytes);
+        }
+        if (ok) {
+            ok = MemoryOperationsHelper::Set(rebase, '\0', 2u * elementBytes);
+        }
+        if (ok) {
+            ok = MemoryOperationsHelper::Set(rebaseSq, '\0', 2u * elementBytes);
+        }
+        if (ok) {
+            ok = MemoryOperationsHelper::Set(maxWedgeHead, '\0', countBytes);
+        }
+        if (ok) {
+            ok = MemoryOperationsHelper::Set(maxWedgeCount, '\0', countBytes);
+        }
+        if (ok) {
+            ok = MemoryOperationsHelper::Set(minWedgeHead, '\0', countBytes);
+        }
+        if (ok) {
+            ok = MemoryOperationsHelper::Set(minWedgeCount, '\0', countBytes);
+        }
+    }
+    if (ok) {
+        ResetMaxMin();
+    }
+
+    return ok;
+}
+
+/*lint -e{1566} initialisation of the attributes in the Reset() method*/
+/*lint -e{9117} [MISRA C++ Rule 5-0-4] signedness of 0 and 1 ignored in template method to avoid specialising for all integer types*/
+template<typename Type> StatisticsArrayHelperT<Type>::StatisticsArrayHelperT(const uint32 windowSize,
+                                                                             const uint32 nOfElements) {
+
+    size = (windowSize > 0u) ? (windowSize) : (1u);
+    div = 0;
+    reciprocal = 1.0 / static_cast<float64>(size);
+    numberOfElements = nOfElements;
+
+    uint32 tmp = size;
+
+    while (tmp > 1u) {
+        tmp >>= 1u;
+        div += 1;
+    }
+
+    isPow2 = ((size & (size - 1u)) == 0u);
+
+    Allocate();
+
+    if (!Reset()) {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Unable to Reset instance");
+    }
+}
+
+/**
+ * @brief float32 implementation of StatisticsArrayHelperT<>::StatisticsArrayHelperT()
+ */
+/*lint -e{1566} initialisation of the attributes in the Reset() method*/
+template<> inline StatisticsArrayHelperT<float32>::StatisticsArrayHelperT(const uint32 windowSize,
+                                                                          const uint32 nOfElements) {
+
+    size = windowSize;
+    div = 1.0F / static_cast<float32>(size);
+    reciprocal = static_cast<float64>(div);
+    isPow2 = false;
+    numberOfElements = nOfElements;
+
+    Allocate();
+
+    if (!Reset()) {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Unable to Reset instance");
+    }
+}
+
+/**
+ * @brief float64 implementation of StatisticsArrayHelperT<>::StatisticsArrayHelperT()
+ */
+/*lint -e{1566} initialisation of the attributes in the Reset() method*/
+template<> inline StatisticsArrayHelperT<float64>::StatisticsArrayHelperT(const uint32 windowSize,
+                                                                          const uint32 nOfElements) {
+
+    size = windowSize;
+    div = 1.0 / static_cast<float64>(size);
+    reciprocal = div;
+    isPow2 = false;
+    numberOfElements = nOfElements;
+
+    Allocate();
+
+    if (!Reset()) {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Unable to Reset instance");
+    }
+}
+
+/*lint -e{1551} no exception thrown deleting the buffers*/
+template<typename Type> StatisticsArrayHelperT<Type>::~StatisticsArrayHelperT() {
+    delete[] window;
+    delete[] windowSq;
+    delete[] sum;
+    delete[] sumSq;
+    delete[] sumC;
+    delete[] sumSqC;
+    delete[] rebase;
+    delete[] rebaseSq;
+    delete[] max;
+    delete[] min;
+    delete[] maxWedge;
+    delete[] maxWedgeSeq;
+    delete[] maxWedgeHead;
+    delete[] maxWedgeCount;
+    delete[] minWedge;
+    delete[] minWedgeSeq;
+    delete[] minWedgeHead;
+    delete[] minWedgeCount;
+}
+
+template<typename Type> bool StatisticsArrayHelperT<Type>::PushSamples(const Type * const samples,
+                                                                       const bool infiniteMaxMin) {
+
+    bool ok = ((window != NULL_PTR(Type *)) && (samples != NULL_PTR(const Type *)) && (size > 0u));
+
+    if (ok) {
+        if (counter < size) {
+            counter++;
+        }
+
+        /* Replace the oldest row of the window and update the sums (no branches for the integer types) */
+        uint32 rowOffset = position * numberOfElements;
+        Type *oldest = &window[rowOffset];
+        Type *oldestSq = &windowSq[rowOffset];
+        Type *rebaseC = &rebase[numberOfElements];
+        Type *rebaseSqC = &rebaseSq[numberOfElements];
+        for (uint32 e = 0u; e < numberOfElements; e++) {
+            Type sample = samples[e];
+            Type sampleSq = sample * sample;
+            StatisticsCompensatedSum<Type>(sum[e], sumC[e], sample, oldest[e]);
+            StatisticsCompensatedSum<Type>(rebase[e], rebaseC[e], sample, static_cast<Type>(0));
+            StatisticsCompensatedSum<Type>(sumSq[e], sumSqC[e], sampleSq, oldestSq[e]);
+            StatisticsCompensatedSum<Type>(rebaseSq[e], rebaseSqC[e], sampleSq, static_cast<Type>(0));
+            oldest[e] = sample;
+            oldestSq[e] = sampleSq;
+        }
+        position = WrapRow(position + 1u);
+        sequence++;
+
+        /* The window has been completely renewed since the last re-base: the fresh sums replace the running ones */
+        rebaseCounter++;
+        if (rebaseCounter >= size) {
+            uint32 elementBytes = static_cast<uint32>(numberOfElements * sizeof(Type));
+            ok = MemoryOperationsHelper::Copy(sum, rebase, elementBytes);
+            if (ok) {
+                ok = MemoryOperationsHelper::Copy(sumC, rebaseC, elementBytes);
+            }
+            if (ok) {
+                ok = MemoryOperationsHelper::Copy(sumSq, rebaseSq, elementBytes);
+            }
+            if (ok) {
+                ok = MemoryOperationsHelper::Copy(sumSqC, rebaseSqC, elementBytes);
+            }
+            if (ok) {
+                ok = MemoryOperationsHelper::Set(rebase, '\0', 2u * elementBytes);
+            }
+            if (ok) {
+                ok = MemoryOperationsHelper::Set(rebaseSq, '\0', 2u * elementBytes);
+            }
+            rebaseCounter = 0u;
+        }
+
+        /* Update the max/min wedges of each element */
+        for (uint32 e = 0u; e < numberOfElements; e++) {
+            Type sample = samples[e];
+
+            if (maxWedgeCount[e] > 0u) {
+                if ((sequence - maxWedgeSeq[(maxWedgeHead[e] * numberOfElements) + e]) >= size) {
+                    maxWedgeHead[e] = WrapRow(maxWedgeHead[e] + 1u);
+                    maxWedgeCount[e]--;
+                }
+            }
+            bool dominated = true;
+            while ((maxWedgeCount[e] > 0u) && (dominated)) {
+                uint32 back = WrapRow((maxWedgeHead[e] + maxWedgeCount[e]) - 1u);
+                dominated = (maxWedge[(back * numberOfElements) + e] <= sample);
+                if (dominated) {
+                    maxWedgeCount[e]--;
+                }
+            }
+            uint32 tail = (WrapRow(maxWedgeHead[e] + maxWedgeCount[e]) * numberOfElements) + e;
+            maxWedge[tail] = sample;
+            maxWedgeSeq[tail] = sequence;
+            maxWedgeCount[e]++;
+
+            if (minWedgeCount[e] > 0u) {
+                if ((sequence - minWedgeSeq[(minWedgeHead[e] * numberOfElements) + e]) >= size) {
+                    minWedgeHead[e] = WrapRow(minWedgeHead[e] + 1u);
+                    minWedgeCount[e]--;
+                }
+            }
+            dominated = true;
+            while ((minWedgeCount[e] > 0u) && (dominated)) {
+                uint32 back = WrapRow((minWedgeHead[e] + minWedgeCount[e]) - 1u);
+                dominated = (minWedge[(back * numberOfElements) + e] >= sample);
+                if (dominated) {
+                    minWedgeCount[e]--;
+                }
+            }
+            tail = (WrapRow(minWedgeHead[e] + minWedgeCount[e]) * numberOfElements) + e;
+            minWedge[tail] = sample;
+            minWedgeSeq[tail] = sequence;
+            minWedgeCount[e]++;
+
+            if (infiniteMaxMin) {
+                if (sample > max[e]) {
+                    max[e] = sample;
+                }
+                if (sample < min[e]) {
+                    min[e] = sample;
+                }
+            }
+            else {
+                max[e] = maxWedge[(maxWedgeHead[e] * numberOfElements) + e];
+                min[e] = minWedge[(minWedgeHead[e] * numberOfElements) + e];
+            }
+        }
+    }
+
+    return ok;
+}
+
+template<typename Type> uint32 StatisticsArrayHelperT<Type>::GetSize() const {
+    return size;
+}
+
+template<typename Type> uint32 StatisticsArrayHelperT<Type>::GetNumberOfElements() const {
+    return numberOfElements;
+}
+
+template<typename Type> uint32 StatisticsArrayHelperT<Type>::GetCounter() const {
+    return counter;
+}
+
+template<typename Type> inline bool StatisticsArrayHelperT<Type>::CheckRange(const Type * const output,
+                                                                             const uint32 firstElement,
+                                                                             const uint32 nOfElements) const {
+    return ((output != NULL_PTR(Type *)) && (firstElement <= numberOfElements) && (nOfElements <= (numberOfElements - firstElement)));
+}
+
+template<typename Type> bool StatisticsArrayHelperT<Type>::GetAvg(Type * const output,
+                                                                  const uint32 firstElement,
+                                                                  const uint32 nOfElements) const {
+    bool ok = CheckRange(output, firstElement, nOfElements);
+    if (ok) {
+        const Type *acc = &sum[firstElement];
+        const Type *accC = &sumC[firstElement];
+        for (uint32 e = 0u; e < nOfElements; e++) {
+            output[e] = Scale(acc[e], accC[e]);
+        }
+    }
+    return ok;
+}
+
+template<typename Type> bool StatisticsArrayHelperT<Type>::GetStd(Type * const output,
+                                                                  const uint32 firstElement,
+                                                                  const uint32 nOfElements) const {
+    bool ok = CheckRange(output, firstElement, nOfElements);
+    if (ok) {
+        const Type *acc = &sum[firstElement];
+        const Type *accC = &sumC[firstElement];
+        const Type *accSq = &sumSq[firstElement];
+        const Type *accSqC = &sumSqC[firstElement];
+        for (uint32 e = 0u; e < nOfElements; e++) {
+            Type avg = Scale(acc[e], accC[e]);
+            Type avg_sq = avg * avg;
+            Type rms_sq = Scale(accSq[e], accSqC[e]);
+            output[e] = ((rms_sq - avg_sq) > 0) ? (FastMath::SquareRoot<Type>(rms_sq - avg_sq)) : (0);
+        }
+    }
+    return ok;
+}
+
+template<typename Type> bool StatisticsArrayHelperT<Type>::GetRms(Type * const output,
+                                                                  const uint32 firstElement,
+                                                                  const uint32 nOfElements) const {
+    bool ok = CheckRange(output, firstElement, nOfElements);
+    if (ok) {
+        const Type *accSq = &sumSq[firstElement];
+        const Type *accSqC = &sumSqC[firstElement];
+        for (uint32 e = 0u; e < nOfElements; e++) {
+            Type rms_sq = Scale(accSq[e], accSqC[e]);
+            output[e] = (rms_sq > 0) ? (FastMath::SquareRoot<Type>(rms_sq)) : (0);
+        }
+    }
+    return ok;
+}
+
+template<typename Type> bool StatisticsArrayHelperT<Type>::GetMin(Type * const output,
+                                                                  const uint32 firstElement,
+                                                                  const uint32 nOfElements) const {
+    bool ok = CheckRange(output, firstElement, nOfElements);
+    if (ok) {
+        ok = MemoryOperationsHelper::Copy(output, &min[firstElement], static_cast<uint32>(nOfElements * sizeof(Type)));
+    }
+    return ok;
+}
+
+template<typename Type> bool StatisticsArrayHelperT<Type>::GetMax(Type * const output,
+                                                                  const uint32 firstElement,
+                                                                  const uint32 nOfElements) const {
+    bool ok = CheckRange(output, firstElement, nOfElements);
+    if (ok) {
+        ok = MemoryOperationsHelper::Copy(output, &max[firstElement], static_cast<uint32>(nOfElements * sizeof(Type)));
+    }
+    return ok;
+}
+
+template<typename Type> bool StatisticsArrayHelperT<Type>::GetSum(Type * const output,
+                                                                  const uint32 firstElement,
+                                                                  const uint32 nOfElements) const {
+    bool ok = CheckRange(output, firstElement, nOfElements);
+    for (uint32 e = 0u; (e < nOfElements) && (ok); e++) {
+        output[e] = sum[firstElement + e] + sumC[firstElement + e];
+    }
+    return ok;
+}
+
+} /* namespace MARTe */
+
+#endif /* STATISTICSARRAYHELPERT_H_ */
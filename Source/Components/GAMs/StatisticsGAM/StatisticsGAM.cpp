@@ -30,7 +30,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "AdvancedErrorManagement.h"
-#include "StatisticsHelperT.h"
+#include "StatisticsArrayHelperT.h"
 #include "StatisticsGAM.h"
 
 /*---------------------------------------------------------------------------*/
@@ -52,64 +52,69 @@ StatisticsGAM::StatisticsGAM() :
     startCycleNumber = 0u;
     cycleCounter = 0u;
     infiniteMaxMin = false;
+    numberOfStatistics = 0u;
+    totalNumberOfElements = 0u;
+    inputOffset = NULL_PTR(uint32 *);
+    inputNumberOfElements = NULL_PTR(uint32 *);
+    inputBuffer = NULL_PTR(uint8 *);
 }
 
-/*lint -e{1551} no exception thrown deleting the StatisticsHelperT<> instance*/
+/*lint -e{1551} no exception thrown deleting the StatisticsArrayHelperT<> instance*/
 StatisticsGAM::~StatisticsGAM() {
 
     bool ok = (stats != NULL_PTR(void *));
 
-    /* Delete StatisticsHelperT class */
+    /* Delete StatisticsArrayHelperT class */
 
     if (ok) {
 
         if (signalType == SignedInteger8Bit) {
-            StatisticsHelperT<int8> * ref = static_cast<StatisticsHelperT<int8> *>(stats);
+            StatisticsArrayHelperT<int8> * ref = static_cast<StatisticsArrayHelperT<int8> *>(stats);
             delete ref;
         }
 
         if (signalType == SignedInteger16Bit) {
-            StatisticsHelperT<int16> * ref = static_cast<StatisticsHelperT<int16> *>(stats);
+            StatisticsArrayHelperT<int16> * ref = static_cast<StatisticsArrayHelperT<int16> *>(stats);
             delete ref;
         }
 
         if (signalType == SignedInteger32Bit) {
-            StatisticsHelperT<int32> * ref = static_cast<StatisticsHelperT<int32> *>(stats);
+            StatisticsArrayHelperT<int32> * ref = static_cast<StatisticsArrayHelperT<int32> *>(stats);
             delete ref;
         }
 
         if (signalType == SignedInteger64Bit) {
-            StatisticsHelperT<int64> * ref = static_cast<StatisticsHelperT<int64> *>(stats);
+            StatisticsArrayHelperT<int64> * ref = static_cast<StatisticsArrayHelperT<int64> *>(stats);
             delete ref;
         }
 
         if (signalType == UnsignedInteger8Bit) {
-            StatisticsHelperT<uint8> * ref = static_cast<StatisticsHelperT<uint8> *>(stats);
+            StatisticsArrayHelperT<uint8> * ref = static_cast<StatisticsArrayHelperT<uint8> *>(stats);
             delete ref;
         }
 
         if (signalType == UnsignedInteger16Bit) {
-            StatisticsHelperT<uint16> * ref = static_cast<StatisticsHelperT<uint16> *>(stats);
+            StatisticsArrayHelperT<uint16> * ref = static_cast<StatisticsArrayHelperT<uint16> *>(stats);
             delete ref;
         }
 
         if (signalType == UnsignedInteger32Bit) {
-            StatisticsHelperT<uint32> * ref = static_cast<StatisticsHelperT<uint32> *>(stats);
+            StatisticsArrayHelperT<uint32> * ref = static_cast<StatisticsArrayHelperT<uint32> *>(stats);
             delete ref;
         }
 
         if (signalType == UnsignedInteger64Bit) {
-            StatisticsHelperT<uint64> * ref = static_cast<StatisticsHelperT<uint64> *>(stats);
+            StatisticsArrayHelperT<uint64> * ref = static_cast<StatisticsArrayHelperT<uint64> *>(stats);
             delete ref;
         }
 
         if (signalType == Float32Bit) {
-            StatisticsHelperT<float32> * ref = static_cast<StatisticsHelperT<float32> *>(stats);
+            StatisticsArrayHelperT<float32> * ref = static_cast<StatisticsArrayHelperT<float32> *>(stats);
             delete ref;
         }
 
         if (signalType == Float64Bit) {
-            StatisticsHelperT<float64> * ref = static_cast<StatisticsHelperT<float64> *>(stats);
+            StatisticsArrayHelperT<float64> * ref = static_cast<StatisticsArrayHelperT<float64> *>(stats);
             delete ref;
         }
 
@@ -117,6 +122,18 @@ StatisticsGAM::~StatisticsGAM() {
 
     stats = NULL_PTR(void *);
 
+    if (inputOffset != NULL_PTR(uint32 *)) {
+        delete[] inputOffset;
+    }
+    if (inputNumberOfElements != NULL_PTR(uint32 *)) {
+        delete[] inputNumberOfElements;
+    }
+    if (inputBuffer != NULL_PTR(uint8 *)) {
+        delete[] inputBuffer;
+    }
+    inputOffset = NULL_PTR(uint32 *);
+    inputNumberOfElements = NULL_PTR(uint32 *);
+    inputBuffer = NULL_PTR(uint8 *);
 }
 
 bool StatisticsGAM::Initialise(StructuredDataI & data) {
@@ -152,91 +169,144 @@ bool StatisticsGAM::Initialise(StructuredDataI & data) {
 
 bool StatisticsGAM::Setup() {
 
+    uint32 numberOfInputSignals = GetNumberOfInputSignals();
+    uint32 numberOfOutputSignals = GetNumberOfOutputSignals();
+
     /*lint -e{9007} side effect of the '&&' operator is acceptable since the evaluation of the second part
      of the expression is only necessary when the first is verified to be true*/
-    bool ret = ((GetNumberOfInputSignals() != 0u) && (GetNumberOfOutputSignals() != 0u));
+    bool ret = ((numberOfInputSignals != 0u) && (numberOfOutputSignals != 0u));
 
     if (!ret) {
         REPORT_ERROR(ErrorManagement::InitialisationError, "(GetNumberOfInputSignals() == 0u) || (GetNumberOfOutputSignals() == 0u)");
     }
 
+    /* The output signals are grouped by input signal, i.e. avg[, std[, min[, max]]] of each input signal */
     if (ret) {
-        ret = (GetSignalType(InputSignals, 0u) == GetSignalType(OutputSignals, 0u));
-    }
-
-    if (!ret) {
-        REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalType(InputSignals, 0u) != GetSignalType(OutputSignals, 0u)");
-    }
-
-    if (ret) {
-        signalType = GetSignalType(InputSignals, 0u);
-    }
-
-    uint32 signalNumberOfDimensions = 0u;
-
-    if (ret) {
-        ret = GetSignalNumberOfDimensions(InputSignals, 0u, signalNumberOfDimensions);
+        numberOfStatistics = numberOfOutputSignals / numberOfInputSignals;
+        ret = ((numberOfStatistics * numberOfInputSignals) == numberOfOutputSignals);
+        if (ret) {
+            ret = ((numberOfStatistics > 0u) && (numberOfStatistics <= 4u));
+        }
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The number of output signals (%u) shall be 1, 2, 3 or 4 times the number of input signals (%u)",
+                         numberOfOutputSignals, numberOfInputSignals);
+        }
     }
 
     if (ret) {
-        ret = (signalNumberOfDimensions == 0u);
+        ret = (GetSignalType(InputSignals, 0u) == GetSignalType(OutputSignals, 0u));
     }
 
     if (!ret) {
-        REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalNumberOfDimensions(InputSignals, 0u) != 0u");
+        REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalType(InputSignals, 0u) != GetSignalType(OutputSignals, 0u)");
     }
 
-    uint32 signalNumberOfElements = 0u;
-
     if (ret) {
-        ret = GetSignalNumberOfElements(InputSignals, 0u, signalNumberOfElements);
+        signalType = GetSignalType(InputSignals, 0u);
+        ret = ((inputOffset == NULL_PTR(uint32 *)) && (inputNumberOfElements == NULL_PTR(uint32 *)));
     }
 
     if (ret) {
-        ret = (signalNumberOfElements == 1u);
-    }
-
-    if (!ret) {
-        REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalNumberOfElements(InputSignals, 0u) != 1u");
+        inputOffset = new uint32[numberOfInputSignals];
+        inputNumberOfElements = new uint32[numberOfInputSignals];
+        totalNumberOfElements = 0u;
     }
 
     uint32 signalIndex;
 
     /*lint -e{850} no modification of the loop index inside the body of the loop (constness issue with the variadic macro ?)*/
-    for (signalIndex = 0u; (signalIndex < GetNumberOfOutputSignals()) && (ret); signalIndex++) {
+    for (signalIndex = 0u; (signalIndex < numberOfInputSignals) && (ret); signalIndex++) {
 
-        ret = (signalType == GetSignalType(OutputSignals, signalIndex));
+        ret = (signalType == GetSignalType(InputSignals, signalIndex));
 
         if (!ret) {
-            REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalType(OutputSignals, %u) != signalType", signalIndex);
+            REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalType(InputSignals, %u) != signalType", signalIndex);
         }
 
+        uint32 signalNumberOfDimensions = 0u;
+
         if (ret) {
-            ret = GetSignalNumberOfDimensions(OutputSignals, signalIndex, signalNumberOfDimensions);
+            ret = GetSignalNumberOfDimensions(InputSignals, signalIndex, signalNumberOfDimensions);
         }
 
         if (ret) {
-            ret = (signalNumberOfDimensions == 0u);
+            ret = (signalNumberOfDimensions <= 1u);
         }
 
         if (!ret) {
-            REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalNumberOfDimensions(OutputSignals, %u) != 0u", signalIndex);
+            REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalNumberOfDimensions(InputSignals, %u) > 1u", signalIndex);
         }
 
+        uint32 signalNumberOfElements = 0u;
+
         if (ret) {
-            ret = GetSignalNumberOfElements(OutputSignals, signalIndex, signalNumberOfElements);
+            ret = GetSignalNumberOfElements(InputSignals, signalIndex, signalNumberOfElements);
         }
 
         if (ret) {
-            ret = (signalNumberOfElements == 1u);
+            ret = (signalNumberOfElements > 0u);
         }
 
         if (!ret) {
-            REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalNumberOfElements(OutputSignals, %u) != 1u", signalIndex);
+            REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalNumberOfElements(InputSignals, %u) == 0u", signalIndex);
+        }
+
+        if (ret) {
+            inputOffset[signalIndex] = totalNumberOfElements;
+            inputNumberOfElements[signalIndex] = signalNumberOfElements;
+            totalNumberOfElements += signalNumberOfElements;
+        }
+
+        uint32 statisticIndex;
+
+        for (statisticIndex = 0u; (statisticIndex < numberOfStatistics) && (ret); statisticIndex++) {
+
+            uint32 outputIndex = (signalIndex * numberOfStatistics) + statisticIndex;
+
+            ret = (signalType == GetSignalType(OutputSignals, outputIndex));
+
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalType(OutputSignals, %u) != signalType", outputIndex);
+            }
+
+            if (ret) {
+                ret = GetSignalNumberOfDimensions(OutputSignals, outputIndex, signalNumberOfDimensions);
+            }
+
+            if (ret) {
+                ret = (signalNumberOfDimensions <= 1u);
+            }
+
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalNumberOfDimensions(OutputSignals, %u) > 1u", outputIndex);
+            }
+
+            uint32 outputNumberOfElements = 0u;
+
+            if (ret) {
+                ret = GetSignalNumberOfElements(OutputSignals, outputIndex, outputNumberOfElements);
+            }
+
+            if (ret) {
+                ret = (outputNumberOfElements == signalNumberOfElements);
+            }
+
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalNumberOfElements(OutputSignals, %u) != GetSignalNumberOfElements(InputSignals, %u)",
+                             outputIndex, signalIndex);
+            }
         }
 
     }
 
+    /* The samples of several input signals are gathered in a contiguous buffer */
+    if ((ret) && (numberOfInputSignals > 1u)) {
+        ret = (inputBuffer == NULL_PTR(uint8 *));
+        if (ret) {
+            inputBuffer = new uint8[(totalNumberOfElements * static_cast<uint32>(signalType.numberOfBits)) / 8u];
+        }
+    }
+
     /* Instantiate Statistics class */
 
     if (ret) {
@@ -246,34 +316,34 @@ bool StatisticsGAM::Setup() {
     /*lint -e{423} no leak as assignment of stats is exclusively done*/
     if (ret) {
         if (signalType == SignedInteger8Bit) {
-            stats = static_cast<void *>(new StatisticsHelperT<int8>(windowSize));
+            stats = static_cast<void *>(new StatisticsArrayHelperT<int8>(windowSize, totalNumberOfElements));
         }
         else if (signalType == SignedInteger16Bit) {
-            stats = static_cast<void *>(new StatisticsHelperT<int16>(windowSize));
+            stats = static_cast<void *>(new StatisticsArrayHelperT<int16>(windowSize, totalNumberOfElements));
         }
         else if (signalType == SignedInteger32Bit) {
-            stats = static_cast<void *>(new StatisticsHelperT<int32>(windowSize));
+            stats = static_cast<void *>(new StatisticsArrayHelperT<int32>(windowSize, totalNumberOfElements));
         }
         else if (signalType == SignedInteger64Bit) {
-            stats = static_cast<void *>(new StatisticsHelperT<int64>(windowSize));
+            stats = static_cast<void *>(new StatisticsArrayHelperT<int64>(windowSize, totalNumberOfElements));
         }
         else if (signalType == UnsignedInteger8Bit) {
-            stats = static_cast<void *>(new StatisticsHelperT<uint8>(windowSize));
+            stats = static_cast<void *>(new StatisticsArrayHelperT<uint8>(windowSize, totalNumberOfElements));
         }
         else if (signalType == UnsignedInteger16Bit) {
-            stats = static_cast<void *>(new StatisticsHelperT<uint16>(windowSize));
+            stats = static_cast<void *>(new StatisticsArrayHelperT<uint16>(windowSize, totalNumberOfElements));
         }
         else if (signalType == UnsignedInteger32Bit) {
-            stats = static_cast<void *>(new StatisticsHelperT<uint32>(windowSize));
+            stats = static_cast<void *>(new StatisticsArrayHelperT<uint32>(windowSize, totalNumberOfElements));
         }
         else if (signalType == UnsignedInteger64Bit) {
-            stats = static_cast<void *>(new StatisticsHelperT<uint64>(windowSize));
+            stats = static_cast<void *>(new StatisticsArrayHelperT<uint64>(windowSize, totalNumberOfElements));
         }
         else if (signalType == Float32Bit) {
-            stats = static_cast<void *>(new StatisticsHelperT<float32>(windowSize));
+            stats = static_cast<void *>(new StatisticsArrayHelperT<float32>(windowSize, totalNumberOfElements));
         }
         else if (signalType == Float64Bit) {
-            stats = static_cast<void *>(new StatisticsHelperT<float64>(windowSize));
+            stats = static_cast<void *>(new StatisticsArrayHelperT<float64>(windowSize, totalNumberOfElements));
         }
         else { //NOOP
         }
@@ -283,7 +353,7 @@ bool StatisticsGAM::Setup() {
             REPORT_ERROR(ErrorManagement::InitialisationError, "Unsupported type");
         }
         else {
-            REPORT_ERROR(ErrorManagement::Information, "Instantiate StatisticsHelperT<> class");
+            REPORT_ERROR(ErrorManagement::Information, "Instantiate StatisticsArrayHelperT<> class");
         }
 
     }
@@ -341,39 +411,52 @@ bool StatisticsGAM::Execute() {
 template<class Type> bool StatisticsGAM::ExecuteT() {
 
     /*lint -e{665} [MISRA C++ Rule 16-0-6] templated type passed as argument to MACRO*/
-    StatisticsHelperT<Type> * ref = NULL_PTR(StatisticsHelperT<Type> *);
-    Type input = (Type) 0;
-    Type output = (Type) 0;
+    StatisticsArrayHelperT<Type> * ref = NULL_PTR(StatisticsArrayHelperT<Type> *);
+    uint32 numberOfInputSignals = GetNumberOfInputSignals();
 
-    bool ret = MemoryOperationsHelper::Copy(&input, GetInputSignalMemory(0u), sizeof(Type));
+    bool ret = (stats != NULL_PTR(void *));
 
+    /* A single input signal is used in place, otherwise the signals are gathered in the input buffer */
+    const Type *samples = NULL_PTR(const Type *);
     if (ret) {
-        ret = (stats != NULL_PTR(void *));
+        if (numberOfInputSignals == 1u) {
+            samples = static_cast<const Type *>(GetInputSignalMemory(0u));
+        }
+        else {
+            Type *buffer = reinterpret_cast<Type *>(inputBuffer);
+            uint32 signalIndex;
+            for (signalIndex = 0u; (signalIndex < numberOfInputSignals) && (ret); signalIndex++) {
+                ret = MemoryOperationsHelper::Copy(&buffer[inputOffset[signalIndex]], GetInputSignalMemory(signalIndex),
+                                                   static_cast<uint32>(inputNumberOfElements[signalIndex] * sizeof(Type)));
+            }
+            samples = buffer;
+        }
     }
 
     if (ret) {
-        ref = static_cast<StatisticsHelperT<Type> *>(stats);
-        ret = ref->PushSample(input, infiniteMaxMin);
+        ref = static_cast<StatisticsArrayHelperT<Type> *>(stats);
+        ret = ref->PushSamples(samples, infiniteMaxMin);
     }
 
-    if (ret) {
-        output = ref->GetAvg();
-        ret = MemoryOperationsHelper::Copy(GetOutputSignalMemory(0u), &output, sizeof(Type));
-    }
+    uint32 signalIndex;
+    for (signalIndex = 0u; (signalIndex < numberOfInputSignals) && (ret); signalIndex++) {
+        uint32 outputIndex = signalIndex * numberOfStatistics;
+        uint32 first = inputOffset[signalIndex];
+        uint32 nOfElements = inputNumberOfElements[signalIndex];
 
-    if ((ret) && (GetNumberOfOutputSignals() > 1u)) {
-        output = ref->GetStd();
-        ret = MemoryOperationsHelper::Copy(GetOutputSignalMemory(1u), &output, sizeof(Type));
-    }
+        ret = ref->GetAvg(static_cast<Type *>(GetOutputSignalMemory(outputIndex)), first, nOfElements);
 
-    if ((ret) && (GetNumberOfOutputSignals() > 2u)) {
-        output = ref->GetMin();
-        ret = MemoryOperationsHelper::Copy(GetOutputSignalMemory(2u), &output, sizeof(Type));
-    }
+        if ((ret) && (numberOfStatistics > 1u)) {
+            ret = ref->GetStd(static_cast<Type *>(GetOutputSignalMemory(outputIndex + 1u)), first, nOfElements);
+        }
+
+        if ((ret) && (numberOfStatistics > 2u)) {
+            ret = ref->GetMin(static_cast<Type *>(GetOutputSignalMemory(outputIndex + 2u)), first, nOfElements);
+        }
 
-    if ((ret) && (GetNumberOfOutputSignals() > 3u)) {
-        output = ref->GetMax();
-        ret = MemoryOperationsHelper::Copy(GetOutputSignalMemory(3u), &output, sizeof(Type));
+        if ((ret) && (numberOfStatistics > 3u)) {
+            ret = ref->GetMax(static_cast<Type *>(GetOutputSignalMemory(outputIndex + 3u)), first, nOfElements);
+        }
     }
 
     return ret;
@@ -391,59 +474,59 @@ bool StatisticsGAM::PrepareNextState(const char8 * const currentStateName,
     if (ret) {
 
         if (signalType == SignedInteger8Bit) {
-            StatisticsHelperT<int8> * ref = static_cast<StatisticsHelperT<int8> *>(stats);
+            StatisticsArrayHelperT<int8> * ref = static_cast<StatisticsArrayHelperT<int8> *>(stats);
             ret = ref->Reset();
         }
 
         if (signalType == SignedInteger16Bit) {
-            StatisticsHelperT<int16> * ref = static_cast<StatisticsHelperT<int16> *>(stats);
+            StatisticsArrayHelperT<int16> * ref = static_cast<StatisticsArrayHelperT<int16> *>(stats);
             ret = ref->Reset();
         }
 
         if (signalType == SignedInteger32Bit) {
-            StatisticsHelperT<int32> * ref = static_cast<StatisticsHelperT<int32> *>(stats);
+            StatisticsArrayHelperT<int32> * ref = static_cast<StatisticsArrayHelperT<int32> *>(stats);
             ret = ref->Reset();
         }
 
         if (signalType == SignedInteger64Bit) {
-            StatisticsHelperT<int64> * ref = static_cast<StatisticsHelperT<int64> *>(stats);
+            StatisticsArrayHelperT<int64> * ref = static_cast<StatisticsArrayHelperT<int64> *>(stats);
             ret = ref->Reset();
         }
 
         if (signalType == UnsignedInteger8Bit) {
-            StatisticsHelperT<uint8> * ref = static_cast<StatisticsHelperT<uint8> *>(stats);
+            StatisticsArrayHelperT<uint8> * ref = static_cast<StatisticsArrayHelperT<uint8> *>(stats);
             ret = ref->Reset();
         }
 
         if (signalType == UnsignedInteger16Bit) {
-            StatisticsHelperT<uint16> * ref = static_cast<StatisticsHelperT<uint16> *>(stats);
+            StatisticsArrayHelperT<uint16> * ref = static_cast<StatisticsArrayHelperT<uint16> *>(stats);
             ret = ref->Reset();
         }
 
         if (signalType == UnsignedInteger32Bit) {
-            StatisticsHelperT<uint32> * ref = static_cast<StatisticsHelperT<uint32> *>(stats);
+            StatisticsArrayHelperT<uint32> * ref = static_cast<StatisticsArrayHelperT<uint32> *>(stats);
             ret = ref->Reset();
         }
 
         if (signalType == UnsignedInteger64Bit) {
-            StatisticsHelperT<uint64> * ref = static_cast<StatisticsHelperT<uint64> *>(stats);
+            StatisticsArrayHelperT<uint64> * ref = static_cast<StatisticsArrayHelperT<uint64> *>(stats);
             ret = ref->Reset();
         }
 
         if (signalType == Float32Bit) {
-            StatisticsHelperT<float32> * ref = static_cast<StatisticsHelperT<float32> *>(stats);
+            StatisticsArrayHelperT<float32> * ref = static_cast<StatisticsArrayHelperT<float32> *>(stats);
             ret = ref->Reset();
         }
 
         if (signalType == Float64Bit) {
-            StatisticsHelperT<float64> * ref = static_cast<StatisticsHelperT<float64> *>(stats);
+            StatisticsArrayHelperT<float64> * ref = static_cast<StatisticsArrayHelperT<float64> *>(stats);
             ret = ref->Reset();
         }
 
     }
 
     if (ret) {
-        REPORT_ERROR(ErrorManagement::Information, "Reset StatisticsHelperT<> instance");
+        REPORT_ERROR(ErrorManagement::Information, "Reset StatisticsArrayHelperT<> instance");
     }
 
     return ret;
@@ -42,21 +42,30 @@ namespace MARTe {
 
 /**
  * @brief GAM which provides average, standard deviation, minimum and maximum of
- * its input signal over a moving time window.
+ * its input signals over a moving time window.
  * @details This GAM provides the average, standard deviation, minimum and maximum
- * of its input signal over a moving time window. 
- * The GAM accepts any type of scalar
- * input signal, i.e. (u)int8, (u)int16, (uint32), (u)int64, float32 and float64, and
+ * of its input signals over a moving time window. 
+ * The GAM accepts any type of scalar or array
+ * input signals, i.e. (u)int8, (u)int16, (uint32), (u)int64, float32 and float64, and
  * produces the statistics computation in the same native type. As such, the output
- * signals are required to conform to the type of the input signal.
+ * signals are required to conform to the type of the input signals.
+ *
+ * The statistics are computed independently for each element of each input signal. The output
+ * signals are grouped by input signal, i.e. for N input signals the number of output signals
+ * shall be N, 2N, 3N or 4N, and the outputs (i * K) ... (i * K + K - 1) (with K = 1, 2, 3 or 4)
+ * are respectively the average[, standard deviation[, minimum[, maximum]]] of the input signal i.
+ * Each output signal shall have the same number of elements as its input signal. All the
+ * signals shall have the same type.
+ *
+ * All the elements of all the input signals share a single StatisticsArrayHelperT, which keeps
+ * the moving windows in structure of arrays form and updates them in one pass per cycle.
  *
  * The configuration syntax is (names and signal quantity are only given as an example):
  * <pre>
  * +Statistics = {
  *     Class = StatisticsGAM
- *     WindowSize = 1000 // Optional - Defaults to 1024, the window size for integer types is limited to power
- *                          of 2, e.g. 64, 1024, etc. In case a different window size is specified, the
- *                          highest power of 2 smaller than the specified size is being considered.
+ *     WindowSize = 1000 // Optional - Defaults to 1024. Any size is supported, for integer types the average
+ *                          is rounded towards minus infinity (exact bit shift for powers of 2, e.g. 64, 1024).
  *     StartCycleNumber = 0u // Optional - Defaults to 0. GAM cycles to skip before starting the accumulation.
  *     InfiniteMaxMin = 0u // Optional - Defaults to 0 (false). If true, Max and Min are referred to the GAM lifecycle (until reset).
  *                            If false, Max and Min are referred only to the Sliding Window.
@@ -88,6 +97,20 @@ namespace MARTe {
  * }
  * </pre>
  *
+ * Example with an array and a scalar input signal (averages and standard deviations only):
+ * <pre>
+ *     InputSignals = {
+ *         Currents = { DataSource = "DDB" Type = float32 NumberOfElements = 128 }
+ *         Voltage = { DataSource = "DDB" Type = float32 }
+ *     }
+ *     OutputSignals = {
+ *         Currents_avg = { DataSource = "DDB" Type = float32 NumberOfElements = 128 }
+ *         Currents_std = { DataSource = "DDB" Type = float32 NumberOfElements = 128 }
+ *         Voltage_avg = { DataSource = "DDB" Type = float32 }
+ *         Voltage_std = { DataSource = "DDB" Type = float32 }
+ *     }
+ * </pre>
+ *
  * \b TODO Receive inputs signal depth in lieu of storing history internally.
  *
  * \b TODO Since the RMS is the native computed value being the STD, it can be promoted
@@ -123,14 +146,16 @@ public:
     virtual bool Initialise(StructuredDataI & data);
 
     /**
-     * @brief Verifies all signals have the same scalar type.
+     * @brief Verifies all signals have the same type and the output signals match the input signals.
      * @return if the pre-conditions are met.
      * @pre
      *   SetConfiguredDatabase() && GetNumberOfInputSignals() > 0 &&
-     *   GetNumberOfOutputSignals() > 0 &&
-     *   All signals are scalar and share the same type.
+     *   GetNumberOfOutputSignals() == K * GetNumberOfInputSignals() with K = 1, 2, 3 or 4 &&
+     *   All signals share the same type &&
+     *   All signals are scalars or vectors &&
+     *   The output signals (i * K) ... (i * K + K - 1) have the same number of elements as the input signal i.
      * @post 
-     *   stats = (void*) new StatisticsHelperT<signalType> (windowSize);
+     *   stats = (void*) new StatisticsArrayHelperT<signalType> (windowSize, total number of input elements);
      */
     virtual bool Setup();
 
@@ -152,9 +177,9 @@ public:
   private:
     /**
      * @brief The reference to the statistics computation templated class.
-     * @details The void * stores the reference to the StatisticsHelperT<>
+     * @details The void * stores the reference to the StatisticsArrayHelperT<>
      * instance which is created with the Setup() method. This attribute
-     * requires a static_cast<StatisticsHelperT<signalType> *> before use.
+     * requires a static_cast<StatisticsArrayHelperT<signalType> *> before use.
      */
     void * stats;
 
@@ -189,6 +214,31 @@ public:
      */
     bool infiniteMaxMin;
 
+    /**
+     * Number of output signals per input signal.
+     */
+    uint32 numberOfStatistics;
+
+    /**
+     * Total number of elements of the input signals.
+     */
+    uint32 totalNumberOfElements;
+
+    /**
+     * Index of the first element of each input signal in the StatisticsArrayHelperT.
+     */
+    uint32 *inputOffset;
+
+    /**
+     * Number of elements of each input signal.
+     */
+    uint32 *inputNumberOfElements;
+
+    /**
+     * Contiguous copy of the input signals (only allocated for more than one input signal).
+     */
+    uint8 *inputBuffer;
+
 };
 
 }
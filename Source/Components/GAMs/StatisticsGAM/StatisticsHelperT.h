@@ -49,18 +49,26 @@ namespace MARTe {
  * @details The class allocates circular buffers to store values of samples and
  * computes average, standard deviation, minimum and maximum over a moving time
  * window. As such, the sum of samples and sum of squares is computed upon calling
- * the PushSample() method in a way to minimise operations. The minimum or maximum
- * over the historical buffer are re-computed only when needed, i.e. in case the
- * oldest sample being pushed out of the moving time window is equal to the stored
- * minimum or maximum.
- * The implementation does not perform division, rather uses bit shift operation
- * for integer types, and pre-computes 1.0 / size for floating point types. As such,
- * the computation of average and standard deviation is only exact after the window
- * has been fully populated once with samples.
- * Consequent to that above, the window size for integer types is limited to power
- * of 2, e.g. 64, 1024, etc. In case a different window size is specified, the
- * highest power of 2 smaller than the specified size is being considered. No
- * limitation for floating point types.
+ * the PushSample() method in a way to minimise operations. The minimum and maximum
+ * over the moving time window are tracked with two monotonic deques (wedges) holding
+ * the candidate extremes, i.e. the samples which are not dominated by a newer one.
+ * Each sample is inserted and removed at most once from each wedge, so that the cost
+ * of PushSample() is O(1) amortised, and O(size) in the worst case for a single call,
+ * independently of the signal shape (the buffer is never re-scanned).
+ * The implementation does not perform division. For integer types it uses a bit shift
+ * operation when the window size is a power of 2 and otherwise multiplies by the
+ * pre-computed reciprocal 1.0 / size, followed by an exact integer correction, so that
+ * the result is floor(sum / size) for any window size (i.e. the same rounding as the shift).
+ * For floating point types it pre-computes 1.0 / size. As such, the computation of average
+ * and standard deviation is only exact after the window has been fully populated once with samples.
+ *
+ * The sums of samples and of squared samples of the floating point types are
+ * compensated (Neumaier summation), so that the subtraction of the oldest sample
+ * and the addition of the new one do not accumulate rounding errors. Moreover, a second,
+ * fresh, sum of the samples pushed since the last re-base is kept and replaces the running
+ * sum each time the window has been completely renewed. The rounding error of the running
+ * sum is therefore bounded by that of a single window, independently of the time the instance
+ * has been running, at O(1) cost per sample and without any Reset().
  */
 
 /*lint -e{1712} the implementation does not provide default constructor*/
@@ -72,8 +80,7 @@ public:
     /**
      * @brief Constructor.
      * @details Allocates memory buffers to store samples, and squares of, in a moving
-     * time window. In case of integer types, the actual window size will be the highest
-     * power of 2 smaller or equal to the specified size.
+     * time window. A windowSize of 0 is considered as 1 for integer types.
      */
     StatisticsHelperT(const uint32 windowSize);
 
@@ -93,10 +100,11 @@ public:
      * @details The method inserts the sample in the historical buffer and re-computes the
      * sum of samples over the time window with two operations, i.e. to remove the oldest
      * sample leaving the buffer from the cumulative sum before adding the new one.
-     * The minimum and maximum sample attributes are changed if the newly inserted sample
-     * is respectively smaller or higher than the currently stored minimum or maximum. The
-     * historical buffer is fully parsed in case the oldest sample leaving the buffer is
-     * equal to the recorded minimum or maximum.
+     * The new sample is appended to the maximum (minimum) wedge after discarding all the
+     * samples smaller (higher) or equal to it, and the sample leaving the time window is
+     * discarded from the front of the wedges. The minimum and maximum are then the front
+     * of the respective wedge. If infiniteMaxMin is true the minimum and maximum are
+     * instead the absolute ones since the last Reset() (the wedges are still updated).
      * The new sample is also squared and inserted into a second buffer, with similar sum
      * management.
      * The average, root mean square, and standard deviation are only computed when the
@@ -198,10 +206,20 @@ private:
     Type Xavg;
 
     /**
-     * Pre-computed division shifter
+     * Pre-computed division shifter (integer types) or 1.0 / size (floating point types)
      */
     Type Xdiv;
 
+    /**
+     * Pre-computed 1.0 / size, for integer types with a window size which is not a power of 2
+     */
+    float64 Xrcp;
+
+    /**
+     * True if the window size is a power of 2
+     */
+    bool XisPow2;
+
     /**
      * Maximum value
      */
@@ -227,6 +245,41 @@ private:
      */
     Type Xstd;
 
+    /**
+     * Compensation of the sum of samples (floating point types)
+     */
+    Type XavgC;
+
+    /**
+     * Compensation of the sum of squared samples (floating point types)
+     */
+    Type XrmsC;
+
+    /**
+     * Sum of the samples pushed since the last re-base
+     */
+    Type Xrebase;
+
+    /**
+     * Compensation of Xrebase
+     */
+    Type XrebaseC;
+
+    /**
+     * Sum of the squared samples pushed since the last re-base
+     */
+    Type XrebaseSq;
+
+    /**
+     * Compensation of XrebaseSq
+     */
+    Type XrebaseSqC;
+
+    /**
+     * Number of samples pushed since the last re-base
+     */
+    uint32 rebaseCounter;
+
     /**
      * Sample buffer
      */
@@ -237,6 +290,51 @@ private:
      */
     CircularStaticList<Type> * Xsq;
 
+    /**
+     * Values of the maximum wedge (decreasing from the front to the back)
+     */
+    Type * XmaxWedge;
+
+    /**
+     * Sequence number of the samples in the maximum wedge
+     */
+    uint32 * XmaxWedgeSeq;
+
+    /**
+     * Index of the front of the maximum wedge
+     */
+    uint32 XmaxWedgeHead;
+
+    /**
+     * Number of elements in the maximum wedge
+     */
+    uint32 XmaxWedgeCount;
+
+    /**
+     * Values of the minimum wedge (increasing from the front to the back)
+     */
+    Type * XminWedge;
+
+    /**
+     * Sequence number of the samples in the minimum wedge
+     */
+    uint32 * XminWedgeSeq;
+
+    /**
+     * Index of the front of the minimum wedge
+     */
+    uint32 XminWedgeHead;
+
+    /**
+     * Number of elements in the minimum wedge
+     */
+    uint32 XminWedgeCount;
+
+    /**
+     * Sequence number of the latest sample (wraps around)
+     */
+    uint32 Xseq;
+
     /**
      * @brief Average of squared samples over the moving window.
      * @return average of sample squares.
@@ -244,22 +342,184 @@ private:
     Type GetRmsSq(void) const;
 
     /**
-     * @brief Finds the maximum of samples in the sample buffer.
-     * @return maximum.
+     * @brief Allocates the minimum and maximum wedges.
      */
-    Type FindMax(void) const;
+    void AllocateWedges(void);
 
     /**
-     * @brief Finds the minimum of samples in the sample buffer.
-     * @return maximum.
+     * @brief Empties the minimum and maximum wedges.
+     */
+    void ResetWedges(void);
+
+    /**
+     * @brief Sets the compensations and the re-base sums to zero.
+     */
+    void ResetAccumulators(void);
+
+    /**
+     * @brief Divides an accumulator by the window size (integer types).
+     * @param[in] accumulator the value to divide.
+     * @return floor(accumulator / size).
      */
-    Type FindMin(void) const;
+    Type Divide(const Type accumulator) const;
+
+    /**
+     * @brief Inserts the latest sample (Xspl, Xseq) in the maximum wedge and discards the expired front.
+     * @return the maximum over the time window.
+     */
+    Type UpdateMaxWedge(void);
+
+    /**
+     * @brief Inserts the latest sample (Xspl, Xseq) in the minimum wedge and discards the expired front.
+     * @return the minimum over the time window.
+     */
+    Type UpdateMinWedge(void);
+
+    /**
+     * @brief Wraps an index of the wedges.
+     * @param[in] index the index to wrap, which must be < 2 * size.
+     * @return index modulo size.
+     */
+    inline uint32 WrapWedgeIndex(const uint32 index) const;
 };
 
 /*---------------------------------------------------------------------------*/
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
 
+/**
+ * @brief Removes a value from and adds a value to a running sum.
+ * @details The generic implementation (integer types) is exact and does not use the compensation.
+ * @param[in,out] sum the running sum.
+ * @param[in,out] compensation the running compensation (floating point types).
+ * @param[in] add the value to add.
+ * @param[in] subtract the value to subtract.
+ */
+template<typename Type> inline void StatisticsCompensatedSum(Type &sum,
+                                                             Type &compensation,
+                                                             const Type add,
+                                                             const Type subtract) {
+    sum -= subtract;
+    sum += add;
+}
+
+/**
+ * @brief float32 implementation of StatisticsCompensatedSum (Neumaier summation).
+ */
+template<> inline void StatisticsCompensatedSum<float32>(float32 &sum,
+                                                         float32 &compensation,
+                                                         const float32 add,
+                                                         const float32 subtract) {
+    float32 values[2] = { -subtract, add };
+    for (uint32 i = 0u; i < 2u; i++) {
+        float32 t = sum + values[i];
+        float32 absSum = (sum >= 0.0F) ? (sum) : (-sum);
+        float32 absValue = (values[i] >= 0.0F) ? (values[i]) : (-values[i]);
+        compensation += (absSum >= absValue) ? ((sum - t) + values[i]) : ((values[i] - t) + sum);
+        sum = t;
+    }
+}
+
+/**
+ * @brief float64 implementation of StatisticsCompensatedSum (Neumaier summation).
+ */
+template<> inline void StatisticsCompensatedSum<float64>(float64 &sum,
+                                                         float64 &compensation,
+                                                         const float64 add,
+                                                         const float64 subtract) {
+    float64 values[2] = { -subtract, add };
+    for (uint32 i = 0u; i < 2u; i++) {
+        float64 t = sum + values[i];
+        float64 absSum = (sum >= 0.0) ? (sum) : (-sum);
+        float64 absValue = (values[i] >= 0.0) ? (values[i]) : (-values[i]);
+        compensation += (absSum >= absValue) ? ((sum - t) + values[i]) : ((values[i] - t) + sum);
+        sum = t;
+    }
+}
+
+/**
+ * Relative margin applied to the first estimate of StatisticsFloorDivide (1 - 2^-50).
+ */
+const float64 STATISTICS_RECIPROCAL_MARGIN = 1.0 - 8.8817841970012523e-16;
+
+/**
+ * @brief Computes floor(dividend / divisor) without a division.
+ * @details Multiplies by the pre-computed reciprocal and corrects the estimate with integer
+ * arithmetic until 0 <= dividend - quotient * divisor < divisor.
+ * @param[in] dividend the dividend.
+ * @param[in] divisor the divisor (> 0).
+ * @param[in] reciprocal 1.0 / divisor.
+ * @return floor(dividend / divisor).
+ */
+inline uint64 StatisticsFloorDivide(const uint64 dividend,
+                                    const uint64 divisor,
+                                    const float64 reciprocal) {
+    /* The first estimate is slightly reduced so that quotient * divisor does not overflow */
+    uint64 quotient = static_cast<uint64>((static_cast<float64>(dividend) * reciprocal) * STATISTICS_RECIPROCAL_MARGIN);
+    uint64 product = quotient * divisor;
+    /* The steps are under-estimated by one so that the correction never overshoots */
+    while (product > dividend) {
+        uint64 step = static_cast<uint64>(static_cast<float64>(product - dividend) * reciprocal);
+        quotient -= (step > 1u) ? (step - 1u) : (1u);
+        product = quotient * divisor;
+    }
+    while ((dividend - product) >= divisor) {
+        uint64 step = static_cast<uint64>(static_cast<float64>(dividend - product) * reciprocal);
+        quotient += (step > 1u) ? (step - 1u) : (1u);
+        product = quotient * divisor;
+    }
+    return quotient;
+}
+
+/**
+ * @brief Signed version of StatisticsFloorDivide (rounds towards minus infinity, as an arithmetic shift).
+ */
+inline int64 StatisticsFloorDivide(const int64 dividend,
+                                   const uint64 divisor,
+                                   const float64 reciprocal) {
+    int64 quotient;
+    if (dividend >= 0) {
+        quotient = static_cast<int64>(StatisticsFloorDivide(static_cast<uint64>(dividend), divisor, reciprocal));
+    }
+    else {
+        /* floor(-(m + 1) / d) = -floor(m / d) - 1 */
+        uint64 magnitude = static_cast<uint64>(-(dividend + 1));
+        quotient = -static_cast<int64>(StatisticsFloorDivide(magnitude, divisor, reciprocal)) - 1;
+    }
+    return quotient;
+}
+
+template<typename Type> inline uint32 StatisticsHelperT<Type>::WrapWedgeIndex(const uint32 index) const {
+    return (index >= size) ? (index - size) : (index);
+}
+
+template<typename Type> void StatisticsHelperT<Type>::AllocateWedges() {
+    /* Each sample in the time window is at most once in each wedge */
+    XmaxWedge = new Type[size];
+    XmaxWedgeSeq = new uint32[size];
+    XminWedge = new Type[size];
+    XminWedgeSeq = new uint32[size];
+}
+
+/*lint -e{9117} [MISRA C++ Rule 5-0-4] signedness of 0 ignored in template method to avoid specializing for all integer types*/
+template<typename Type> void StatisticsHelperT<Type>::ResetAccumulators() {
+    XavgC = static_cast<Type>(0);
+    XrmsC = static_cast<Type>(0);
+    Xrebase = static_cast<Type>(0);
+    XrebaseC = static_cast<Type>(0);
+    XrebaseSq = static_cast<Type>(0);
+    XrebaseSqC = static_cast<Type>(0);
+    rebaseCounter = 0u;
+}
+
+template<typename Type> void StatisticsHelperT<Type>::ResetWedges() {
+    XmaxWedgeHead = 0u;
+    XmaxWedgeCount = 0u;
+    XminWedgeHead = 0u;
+    XminWedgeCount = 0u;
+    Xseq = 0u;
+}
+
 /*lint -e{9117} [MISRA C++ Rule 5-0-4] signedness of 0 ignored in template method to avoid specializing for all integer types*/
 template<typename Type> bool StatisticsHelperT<Type>::Reset() {
 
@@ -273,6 +533,9 @@ template<typename Type> bool StatisticsHelperT<Type>::Reset() {
     Xrms = 0;
     Xstd = 0;
 
+    ResetWedges();
+    ResetAccumulators();
+
     /* Reset sample buffers */
     bool ok = true;
     uint32 i;
@@ -303,6 +566,9 @@ template<> inline bool StatisticsHelperT<float32>::Reset() { // Must be declared
     Xrms = 0.0F;
     Xstd = 0.0F;
 
+    ResetWedges();
+    ResetAccumulators();
+
     /* Reset sample buffers */
     bool ok = true;
     uint32 i;
@@ -332,6 +598,9 @@ template<> inline bool StatisticsHelperT<float64>::Reset() { // Must be declared
     Xrms = 0.0;
     Xstd = 0.0;
 
+    ResetWedges();
+    ResetAccumulators();
+
     /* Reset sample buffers */
     bool ok = true;
     uint32 i;
@@ -352,20 +621,23 @@ template<> inline bool StatisticsHelperT<float64>::Reset() { // Must be declared
 /*lint -e{1733} no assignment ever used */
 template<typename Type> StatisticsHelperT<Type>::StatisticsHelperT(const uint32 windowSize) {
 
-    size = 1u;
+    size = (windowSize > 0u) ? (windowSize) : (1u);
     Xdiv = 0;
+    Xrcp = 1.0 / static_cast<float64>(size);
 
-    uint32 tmp = windowSize;
+    uint32 tmp = size;
 
     while (tmp > 1u) {
         tmp >>= 1u;
-        size <<= 1u;
         Xdiv += 1;
     }
 
+    XisPow2 = ((size & (size - 1u)) == 0u);
+
     /* Instantiate sample buffers */
     Xwin = new CircularStaticList<Type>(size);
     Xsq = new CircularStaticList<Type>(size);
+    AllocateWedges();
 
     if (!Reset()) {
         REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Unable to Reset instance");
@@ -400,10 +672,13 @@ template<> inline StatisticsHelperT<float32>::StatisticsHelperT(const uint32 win
 
     size = windowSize;
     Xdiv = 1.0F / static_cast<float32>(size);
+    Xrcp = static_cast<float64>(Xdiv);
+    XisPow2 = false;
 
     /* Instantiate sample buffers */
     Xwin = new CircularStaticList<float32>(size);
     Xsq = new CircularStaticList<float32>(size);
+    AllocateWedges();
 
     if (!Reset()) {
         REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Unable to Reset instance");
@@ -421,10 +696,13 @@ template<> inline StatisticsHelperT<float64>::StatisticsHelperT(const uint32 win
 
     size = windowSize;
     Xdiv = 1.0 / static_cast<float64>(size);
+    Xrcp = Xdiv;
+    XisPow2 = false;
 
     /* Instantiate sample buffers */
     Xwin = new CircularStaticList<float64>(size);
     Xsq = new CircularStaticList<float64>(size);
+    AllocateWedges();
 
     if (!Reset()) {
         REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Unable to Reset instance");
@@ -446,89 +724,82 @@ template<typename Type> StatisticsHelperT<Type>::~StatisticsHelperT() {
         Xsq = NULL_PTR(CircularStaticList<Type> *);
     }
 
-}
-
-/*lint -e{534} ignore return value of GetData since initialisation error would have been caught earlier*/
-template<typename Type> Type StatisticsHelperT<Type>::FindMax() const {
-
-    Type max = std::numeric_limits<Type>::min();
-
-    uint32 index;
-
-    for (index = 0u; index < size; index++) {
+    if (XmaxWedge != NULL_PTR(Type *)) {
+        delete[] XmaxWedge;
+        XmaxWedge = NULL_PTR(Type *);
+    }
 
-        Type sample;
+    if (XmaxWedgeSeq != NULL_PTR(uint32 *)) {
+        delete[] XmaxWedgeSeq;
+        XmaxWedgeSeq = NULL_PTR(uint32 *);
+    }
 
-        /*lint -e{534} ignore return value of GetData since an initialisation error would make that this method is not called*/
-        Xwin->Peek(index, sample);
+    if (XminWedge != NULL_PTR(Type *)) {
+        delete[] XminWedge;
+        XminWedge = NULL_PTR(Type *);
+    }
 
-        if (sample > max) {
-            max = sample;
-        }
+    if (XminWedgeSeq != NULL_PTR(uint32 *)) {
+        delete[] XminWedgeSeq;
+        XminWedgeSeq = NULL_PTR(uint32 *);
     }
 
-    return max;
 }
 
-template<> inline float32 StatisticsHelperT<float32>::FindMax() const { // Must be declared/defined before use
-
-    float32 max = -1.0F * std::numeric_limits<float32>::max();
-
-    uint32 index;
-
-    for (index = 0u; index < size; index++) {
+template<typename Type> Type StatisticsHelperT<Type>::UpdateMaxWedge() {
 
-        float32 sample;
-        /*lint -e{534} ignore return value of GetData since an initialisation error would make that this method is not called*/
-        Xwin->Peek(index, sample);
-
-        if (sample > max) {
-            max = sample;
+    /* Discard the front if it has left the time window */
+    if (XmaxWedgeCount > 0u) {
+        if ((Xseq - XmaxWedgeSeq[XmaxWedgeHead]) >= size) {
+            XmaxWedgeHead = WrapWedgeIndex(XmaxWedgeHead + 1u);
+            XmaxWedgeCount--;
         }
     }
 
-    return max;
-}
-
-template<> inline float64 StatisticsHelperT<float64>::FindMax() const { // Must be declared/defined before use
-
-    float64 max = -1.0 * std::numeric_limits<float64>::max();
-
-    uint32 index;
-
-    for (index = 0u; index < size; index++) {
-
-        float64 sample;
-
-        /*lint -e{534} ignore return value of GetData since an initialisation error would make that this method is not called*/
-        Xwin->Peek(index, sample);
-
-        if (sample > max) {
-            max = sample;
+    /* Discard from the back the samples which can no longer be the maximum */
+    bool dominated = true;
+    while ((XmaxWedgeCount > 0u) && (dominated)) {
+        uint32 back = WrapWedgeIndex(XmaxWedgeHead + XmaxWedgeCount - 1u);
+        dominated = (XmaxWedge[back] <= Xspl);
+        if (dominated) {
+            XmaxWedgeCount--;
         }
     }
 
-    return max;
-}
-
-template<typename Type> Type StatisticsHelperT<Type>::FindMin() const {
-
-    Type min = std::numeric_limits<Type>::max();
+    uint32 tail = WrapWedgeIndex(XmaxWedgeHead + XmaxWedgeCount);
+    XmaxWedge[tail] = Xspl;
+    XmaxWedgeSeq[tail] = Xseq;
+    XmaxWedgeCount++;
 
-    uint32 index;
+    return XmaxWedge[XmaxWedgeHead];
+}
 
-    for (index = 0u; index < size; index++) {
+template<typename Type> Type StatisticsHelperT<Type>::UpdateMinWedge() {
 
-        Type sample;
-        /*lint -e{534} ignore return value of GetData since an initialisation error would make that this method is not called*/
-        Xwin->Peek(index, sample);
+    /* Discard the front if it has left the time window */
+    if (XminWedgeCount > 0u) {
+        if ((Xseq - XminWedgeSeq[XminWedgeHead]) >= size) {
+            XminWedgeHead = WrapWedgeIndex(XminWedgeHead + 1u);
+            XminWedgeCount--;
+        }
+    }
 
-        if (sample < min) {
-            min = sample;
+    /* Discard from the back the samples which can no longer be the minimum */
+    bool dominated = true;
+    while ((XminWedgeCount > 0u) && (dominated)) {
+        uint32 back = WrapWedgeIndex(XminWedgeHead + XminWedgeCount - 1u);
+        dominated = (XminWedge[back] >= Xspl);
+        if (dominated) {
+            XminWedgeCount--;
         }
     }
 
-    return min;
+    uint32 tail = WrapWedgeIndex(XminWedgeHead + XminWedgeCount);
+    XminWedge[tail] = Xspl;
+    XminWedgeSeq[tail] = Xseq;
+    XminWedgeCount++;
+
+    return XminWedge[XminWedgeHead];
 }
 
 template<typename Type> bool StatisticsHelperT<Type>::PushSample(Type sample,
@@ -551,26 +822,27 @@ template<typename Type> bool StatisticsHelperT<Type>::PushSample(Type sample,
 
     if (ok) {
         /* Compute average */
-        Xavg -= oldest; /* Remove oldest sample from the accumulator */
-        Xavg += Xspl; /* Sum of all sample in time window */
-
-        /* Update max/min, if necessary */
-        if (Xspl > Xmax) {
-            Xmax = Xspl;
-        }
-
-        if (Xspl < Xmin) {
-            Xmin = Xspl;
-        }
-
-        if(!infiniteMaxMin) {
-            if (oldest == Xmax) { /* The removed sample was the max over the time window */
-                Xmax = FindMax();
+        /* Remove oldest sample from the accumulator and add the new one, i.e. sum of all samples in time window */
+        StatisticsCompensatedSum<Type>(Xavg, XavgC, Xspl, oldest);
+        StatisticsCompensatedSum<Type>(Xrebase, XrebaseC, Xspl, static_cast<Type>(0));
+
+        /* Update max/min wedges */
+        Xseq++;
+        Type wedgeMax = UpdateMaxWedge();
+        Type wedgeMin = UpdateMinWedge();
+
+        if (infiniteMaxMin) {
+            if (Xspl > Xmax) {
+                Xmax = Xspl;
             }
-            if (oldest == Xmin) { /* The removed sample was the min over the time window */
-                Xmin = FindMin();
+            if (Xspl < Xmin) {
+                Xmin = Xspl;
             }
         }
+        else {
+            Xmax = wedgeMax;
+            Xmin = wedgeMin;
+        }
     }
 
     Type Xspl_sq = Xspl * Xspl; /* Square of the sample */
@@ -582,8 +854,23 @@ template<typename Type> bool StatisticsHelperT<Type>::PushSample(Type sample,
 
     if (ok) {
         /* Compute root mean square */
-        Xrms -= oldest; /* Remove oldest sample from the accumulator */
-        Xrms += Xspl_sq; /* Sum of squares of all samples in time window */
+        /* Remove oldest sample from the accumulator and add the new one, i.e. sum of squares of all samples in time window */
+        StatisticsCompensatedSum<Type>(Xrms, XrmsC, Xspl_sq, oldest);
+        StatisticsCompensatedSum<Type>(XrebaseSq, XrebaseSqC, Xspl_sq, static_cast<Type>(0));
+
+        /* The window has been completely renewed since the last re-base: the fresh sums replace the running ones */
+        rebaseCounter++;
+        if (rebaseCounter >= size) {
+            Xavg = Xrebase;
+            XavgC = XrebaseC;
+            Xrms = XrebaseSq;
+            XrmsC = XrebaseSqC;
+            Xrebase = static_cast<Type>(0);
+            XrebaseC = static_cast<Type>(0);
+            XrebaseSq = static_cast<Type>(0);
+            XrebaseSqC = static_cast<Type>(0);
+            rebaseCounter = 0u;
+        }
     }
 
     return ok;
@@ -613,9 +900,24 @@ template<typename Type> uint32 StatisticsHelperT<Type>::GetCounter() const {
     return counter;
 }
 
+/*lint -e{9117} [MISRA C++ Rule 5-0-4] signedness ignored in template method to avoid specializing for all integer types*/
+template<typename Type> Type StatisticsHelperT<Type>::Divide(const Type accumulator) const {
+    Type result;
+    if (XisPow2) {
+        result = accumulator >> Xdiv;
+    }
+    else if (std::numeric_limits<Type>::is_signed) {
+        result = static_cast<Type>(StatisticsFloorDivide(static_cast<int64>(accumulator), static_cast<uint64>(size), Xrcp));
+    }
+    else {
+        result = static_cast<Type>(StatisticsFloorDivide(static_cast<uint64>(accumulator), static_cast<uint64>(size), Xrcp));
+    }
+    return result;
+}
+
 template<typename Type> Type StatisticsHelperT<Type>::GetAvg() const {
 
-    Type avg = Xavg >> Xdiv;
+    Type avg = Divide(Xavg);
 
     return avg;
 }
@@ -625,7 +927,7 @@ template<typename Type> Type StatisticsHelperT<Type>::GetAvg() const {
  */
 template<> inline float32 StatisticsHelperT<float32>::GetAvg() const {
 
-    float32 avg = Xavg * Xdiv;
+    float32 avg = (Xavg + XavgC) * Xdiv;
 
     return avg;
 }
@@ -635,28 +937,28 @@ template<> inline float32 StatisticsHelperT<float32>::GetAvg() const {
  */
 template<> inline float64 StatisticsHelperT<float64>::GetAvg() const {
 
-    float64 avg = Xavg * Xdiv;
+    float64 avg = (Xavg + XavgC) * Xdiv;
 
     return avg;
 }
 
 template<typename Type> Type StatisticsHelperT<Type>::GetRmsSq() const {
 
-    Type rms_sq = Xrms >> Xdiv;
+    Type rms_sq = Divide(Xrms);
 
     return rms_sq;
 }
 
 template<> inline float32 StatisticsHelperT<float32>::GetRmsSq() const {
 
-    float32 rms_sq = Xrms * Xdiv;
+    float32 rms_sq = (Xrms + XrmsC) * Xdiv;
 
     return rms_sq;
 }
 
 template<> inline float64 StatisticsHelperT<float64>::GetRmsSq() const {
 
-    float64 rms_sq = Xrms * Xdiv;
+    float64 rms_sq = (Xrms + XrmsC) * Xdiv;
 
     return rms_sq;
 }
@@ -683,7 +985,7 @@ template<typename Type> Type StatisticsHelperT<Type>::GetStd() const {
 }
 
 template<typename Type> Type StatisticsHelperT<Type>::GetSum() const {
-    return Xavg;
+    return Xavg + XavgC;
 }
 
 template<typename Type> Type StatisticsHelperT<Type>::GetMax() const {
@@ -51,6 +51,10 @@ TimeCorrectionGAM::TimeCorrectionGAM() :
     inputTime = NULL_PTR(uint64 *);
     correctedTime = NULL_PTR(uint64 *);
     corrected = NULL_PTR(uint8 *);
+    numberOfCorrections = NULL_PTR(uint32 *);
+    numberOfTimeSamples = 0u;
+    deltaGain = 0.;
+    estimationGain = 0.;
     lastValidTime = 0ull;
     iterationCounter = 0u;
 }
@@ -59,6 +63,7 @@ TimeCorrectionGAM::~TimeCorrectionGAM() {
     inputTime = NULL_PTR(uint64 *);
     correctedTime = NULL_PTR(uint64 *);
     corrected = NULL_PTR(uint8 *);
+    numberOfCorrections = NULL_PTR(uint32 *);
 }
 
 bool TimeCorrectionGAM::Initialise(StructuredDataI & data) {
@@ -96,11 +101,10 @@ bool TimeCorrectionGAM::Setup() {
     bool ret = (GetNumberOfInputSignals() == 1u);
 
     if (ret) {
-        uint32 nOfInputSignals = GetNumberOfOutputSignals();
         uint32 nOfOutputSignals = GetNumberOfOutputSignals();
-        ret = ((nOfInputSignals > 0u) && (nOfOutputSignals <= 2u));
-        if (ret) {
-            REPORT_ERROR(ErrorManagement::FatalError, "This Function allows only one or two output signals");
+        ret = ((nOfOutputSignals > 0u) && (nOfOutputSignals <= 3u));
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::FatalError, "This Function allows only one, two or three output signals");
         }
 
     }
@@ -112,14 +116,14 @@ bool TimeCorrectionGAM::Setup() {
     if (ret) {
         TypeDescriptor td = GetSignalType(InputSignals, 0u);
         ret = (td == UnsignedInteger64Bit);
-        if (ret) {
+        if (!ret) {
             REPORT_ERROR(ErrorManagement::FatalError, "The input time signal type must be uint64");
         }
     }
     if (ret) {
         TypeDescriptor td = GetSignalType(OutputSignals, 0u);
         ret = (td == UnsignedInteger64Bit);
-        if (ret) {
+        if (!ret) {
             REPORT_ERROR(ErrorManagement::FatalError, "The corrected time signal (0) type must be uint64");
         }
     }
@@ -128,43 +132,62 @@ bool TimeCorrectionGAM::Setup() {
         if (GetNumberOfOutputSignals() > 1u) {
             TypeDescriptor td = GetSignalType(OutputSignals, 1u);
             ret = (td == UnsignedInteger8Bit);
-            if (ret) {
+            if (!ret) {
                 REPORT_ERROR(ErrorManagement::FatalError, "The corrected flag signal (1) type must be uint8");
             }
         }
     }
 
-    //check that the number of elements is 1
     if (ret) {
-        uint32 numberOfElements = 0u;
-        ret = GetSignalNumberOfElements(InputSignals, 0u, numberOfElements);
+        if (GetNumberOfOutputSignals() > 2u) {
+            TypeDescriptor td = GetSignalType(OutputSignals, 2u);
+            ret = (td == UnsignedInteger32Bit);
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::FatalError, "The number of corrections signal (2) type must be uint32");
+            }
+        }
+    }
+
+    //check that the time signals and the flags have the same number of time-stamps
+    if (ret) {
+        ret = GetSignalNumberOfTimeStamps(InputSignals, 0u, numberOfTimeSamples);
         if (ret) {
-            ret = (numberOfElements == 1u);
-            if (ret) {
-                REPORT_ERROR(ErrorManagement::FatalError, "The input signal type must be scalar");
+            ret = (numberOfTimeSamples > 0u);
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::FatalError, "The input signal must have at least one time-stamp");
             }
         }
     }
     if (ret) {
-
-        uint32 numberOfElements = 0u;
-        ret = GetSignalNumberOfElements(OutputSignals, 0u, numberOfElements);
+        uint32 numberOfOutputTimeSamples = 0u;
+        ret = GetSignalNumberOfTimeStamps(OutputSignals, 0u, numberOfOutputTimeSamples);
         if (ret) {
-            ret = (numberOfElements == 1u);
-            if (ret) {
-                REPORT_ERROR(ErrorManagement::FatalError, "The corrected time signal (0) must be scalar");
+            ret = (numberOfOutputTimeSamples == numberOfTimeSamples);
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::FatalError, "The corrected time signal (0) must have the same number of elements and samples as the input signal");
             }
         }
     }
     if (ret) {
         if (GetNumberOfOutputSignals() > 1u) {
-
-            uint32 numberOfElements = 0u;
-            ret = GetSignalNumberOfElements(OutputSignals, 1u, numberOfElements);
+            uint32 numberOfOutputTimeSamples = 0u;
+            ret = GetSignalNumberOfTimeStamps(OutputSignals, 1u, numberOfOutputTimeSamples);
             if (ret) {
-                ret = (numberOfElements == 1u);
-                if (ret) {
-                    REPORT_ERROR(ErrorManagement::FatalError, "The corrected flag signal (1) must be scalar");
+                ret = (numberOfOutputTimeSamples == numberOfTimeSamples);
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::FatalError, "The corrected flag signal (1) must have the same number of elements and samples as the input signal");
+                }
+            }
+        }
+    }
+    if (ret) {
+        if (GetNumberOfOutputSignals() > 2u) {
+            uint32 numberOfOutputTimeSamples = 0u;
+            ret = GetSignalNumberOfTimeStamps(OutputSignals, 2u, numberOfOutputTimeSamples);
+            if (ret) {
+                ret = (numberOfOutputTimeSamples == 1u);
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::FatalError, "The number of corrections signal (2) must be scalar");
                 }
             }
         }
@@ -175,43 +198,72 @@ bool TimeCorrectionGAM::Setup() {
         if (GetNumberOfOutputSignals() > 1u) {
             corrected = reinterpret_cast<uint8 *>(GetOutputSignalMemory(1u));
         }
+        if (GetNumberOfOutputSignals() > 2u) {
+            numberOfCorrections = reinterpret_cast<uint32 *>(GetOutputSignalMemory(2u));
+        }
         estimatedDelta = static_cast<float64>(expectedDelta);
+        deltaGain = static_cast<float64>(filterGain);
+        estimationGain = 1.0 - deltaGain;
+    }
+    return ret;
+}
+
+bool TimeCorrectionGAM::GetSignalNumberOfTimeStamps(const SignalDirection direction,
+                                                    const uint32 signalIdx,
+                                                    uint32 &numberOfTimeStamps) {
+    uint32 numberOfElements = 0u;
+    uint32 numberOfSamples = 0u;
+    bool ret = GetSignalNumberOfElements(direction, signalIdx, numberOfElements);
+    if (ret) {
+        ret = GetSignalNumberOfSamples(direction, signalIdx, numberOfSamples);
+    }
+    if (ret) {
+        numberOfTimeStamps = numberOfElements * numberOfSamples;
     }
     return ret;
 }
 
 /*lint -e{613} pointer checked before during the Setup*/
 bool TimeCorrectionGAM::Execute() {
-    //a good value
-    if (iterationCounter > 0u) {
-        uint64 delta = (*inputTime) - lastValidTime;
+    uint32 first = 0u;
+    if (iterationCounter == 0u) {
+        //delta cannot be computed for the first time-stamp
+        correctedTime[0u] = inputTime[0u];
+        lastValidTime = inputTime[0u];
+        if (corrected != NULL_PTR(uint8*)) {
+            corrected[0u] = 0u;
+        }
+        iterationCounter++;
+        first = 1u;
+    }
+    uint32 nOfCorrections = 0u;
+    for (uint32 i = first; i < numberOfTimeSamples; i++) {
+        uint64 delta = inputTime[i] - lastValidTime;
+        uint8 isCorrected;
+        //a good value
         if (((delta - expectedDelta) < deltaTolerance) || ((expectedDelta - delta) < deltaTolerance)) {
-            estimatedDelta = static_cast<float64>(((1.0 - static_cast<float64>(filterGain)) * estimatedDelta) + (static_cast<float64>(filterGain) * static_cast<float64>(delta)));
-            (*correctedTime) = (*inputTime);
-            if (corrected != NULL_PTR(uint8*)) {
-                (*corrected = 0u);
-            }
+            estimatedDelta = (estimationGain * estimatedDelta) + (deltaGain * static_cast<float64>(delta));
+            correctedTime[i] = inputTime[i];
+            isCorrected = 0u;
         }
         //something wrong... correct the value
         else {
             float64 lastValidTimeF = static_cast<float64>(lastValidTime) + estimatedDelta;
-            (*correctedTime) = static_cast<uint64>(lastValidTimeF);
+            correctedTime[i] = static_cast<uint64>(lastValidTimeF);
             if ((estimatedDelta - static_cast<float64>(static_cast<uint64>(estimatedDelta))) > 0.5) {
-                (*correctedTime)++;
-            }
-
-            if (corrected != NULL_PTR(uint8*)) {
-                (*corrected = 1u);
+                correctedTime[i]++;
             }
+            isCorrected = 1u;
+            nOfCorrections++;
+        }
+        lastValidTime = correctedTime[i];
+        if (corrected != NULL_PTR(uint8*)) {
+            corrected[i] = isCorrected;
         }
-        lastValidTime = (*correctedTime);
     }
-    else {
-        (*correctedTime) = (*inputTime);
-        lastValidTime = (*inputTime);
-        iterationCounter++;
+    if (numberOfCorrections != NULL_PTR(uint32*)) {
+        *numberOfCorrections = nOfCorrections;
     }
-    //REPORT_ERROR(ErrorManagement::FatalError, "estimated delta = %f", estimatedDelta);
 
     return true;
 }
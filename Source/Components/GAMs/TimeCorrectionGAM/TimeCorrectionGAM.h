@@ -59,7 +59,12 @@ namespace MARTe{
  *
  * @details This GAM accepts only one uint64 as the input signal, containing the acquired time-stamp. In the output, the first uint64 signal must be
  * the corrected time-stamp and, optionally, a uint8 signal can be used to check if the GAM has corrected (=1) or not (=0) the time_stamp
- * in the current cycle.
+ * in the current cycle. A third, optional, uint32 scalar signal holds the number of time-stamps corrected in the current cycle.
+ *
+ * @details The input signal can hold a block of time-stamps (NumberOfElements and/or Samples greater than one), e.g. when a data acquisition
+ * DataSource delivers many samples per cycle. The time-stamps are then corrected in a single pass over the block, in order, as if they were
+ * received in consecutive cycles. The corrected time-stamp signal and the corrected flag signal (which becomes a per time-stamp mask)
+ * must have the same number of elements times samples as the input signal.
  *
  * @details The configuration syntax is (names and signal quantity are only given as an example):
  * <pre>
@@ -84,6 +89,10 @@ namespace MARTe{
  *              DataSource = DDB
  *              Type = uint8
  *          }
+ *          NumberOfCorrections = { //Optional
+ *              DataSource = DDB
+ *              Type = uint32
+ *          }
  *      }
  *  }
  * </pre>
@@ -119,23 +128,36 @@ public:
 
     /**
      * @see GAM::Setup
-     * @brief Checks if the input signal (acquired time-stamp) is unique, scalar and if it is uint64 type. Checks that the first output signal
-     * (corrected time-stamp) is scalar and uint64 type and that the second signal (is corrected flag) is scalar and uint8 type.
+     * @brief Checks if the input signal (acquired time-stamps) is unique and if it is uint64 type. Checks that the first output signal
+     * (corrected time-stamps) is uint64 type, that the second signal (is corrected flags) is uint8 type and that both have as many time-stamps
+     * (elements times samples) as the input signal. Checks that the third signal (number of corrections) is scalar and uint32 type.
+     * @details The gains of the delta estimation filter are computed here.
      * @return true if all the checks succeeds, false otherwise.
      */
     virtual bool Setup();
 
     /**
-     * @brief If necessary, corrects the input time-stamp.
-     * @details If the input time-stamp is valid (namely it belongs to the range defined by the user in the configuration), the time-stamp is exactly copied to
+     * @brief If necessary, corrects the input time-stamps.
+     * @details If an input time-stamp is valid (namely it belongs to the range defined by the user in the configuration), the time-stamp is exactly copied to
      * the output and the delta difference with the previous time-stamp is used to compute the estimation of the delta. If the time-stamp is wrong,
-     * the corrected time-stamp is computed as the last time-stamp output plus the estimated delta.
+     * the corrected time-stamp is computed as the last time-stamp output plus the estimated delta. The time-stamps of the block are processed in order.
      * @return true.
      */
     virtual bool Execute();
 
 protected:
 
+    /**
+     * @brief Gets the number of time-stamps of a signal.
+     * @param[in] direction the signal direction.
+     * @param[in] signalIdx the signal index.
+     * @param[out] numberOfTimeStamps the number of elements times the number of samples of the signal.
+     * @return true if the number of elements and samples of the signal can be read.
+     */
+    bool GetSignalNumberOfTimeStamps(const SignalDirection direction,
+                                     const uint32 signalIdx,
+                                     uint32 &numberOfTimeStamps);
+
     /**
      * The expected delta difference between two consecutive
      * time-stamps in input
@@ -170,10 +192,30 @@ protected:
     uint64 *correctedTime;
 
     /**
-     * Accelerator to the memory of the output "is corrected" flag
+     * Accelerator to the memory of the output "is corrected" flags
      */
     uint8* corrected;
 
+    /**
+     * Accelerator to the memory of the output number of corrections
+     */
+    uint32* numberOfCorrections;
+
+    /**
+     * The number of time-stamps processed in each cycle
+     */
+    uint32 numberOfTimeSamples;
+
+    /**
+     * The weight of the current delta in the filter (FilterGain), computed in Setup
+     */
+    float64 deltaGain;
+
+    /**
+     * The weight of the previous estimation in the filter (1 - FilterGain), computed in Setup
+     */
+    float64 estimationGain;
+
     /**
      * Used to store the last time-stamp output
      */
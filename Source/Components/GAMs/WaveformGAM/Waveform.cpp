@@ -68,6 +68,7 @@ Waveform::Waveform() :
     indexOutputSignal = 0u;
     triggersEnable = false;
     lastTime = 0.0;
+    generator = WaveformGeneratorDirect;
 }
 
 Waveform::~Waveform() {
@@ -483,6 +484,32 @@ void Waveform::TriggerMechanism() {
     return;
 }
 
+bool Waveform::ReadGenerator(StructuredDataI &data) {
+    bool ok = true;
+    StreamString generatorStr;
+    if (data.Read("Generator", generatorStr)) {
+        if (generatorStr == "Direct") {
+            generator = WaveformGeneratorDirect;
+        }
+        else if (generatorStr == "Recursive") {
+            generator = WaveformGeneratorRecursive;
+        }
+        else {
+            ok = false;
+        }
+        if (ok) {
+            REPORT_ERROR(ErrorManagement::Information, "Generator set to %s", generatorStr.Buffer());
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Unknown Generator %s. Valid values are Direct or Recursive", generatorStr.Buffer());
+        }
+    }
+    else {
+        generator = WaveformGeneratorDirect;
+    }
+    return ok;
+}
+
 bool Waveform::ValidateTimeTriggers() const {
     bool ret = true;
     if (numberOfStopTriggers > 0u) {
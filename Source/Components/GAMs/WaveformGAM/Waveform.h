@@ -80,6 +80,7 @@ public:
      * time1 = 0u;
      * timeIncrement = 0.0;
      * timeState = 0u;
+     * generator = WaveformGeneratorDirect;
      */
     Waveform();
 
@@ -186,6 +187,20 @@ public:
 
 protected:
 
+    /**
+     * Algorithms to compute the samples of the trigonometric waveforms.
+     */
+    enum WaveformGenerator {
+        /**
+         * sin() is called for every output sample.
+         */
+        WaveformGeneratorDirect,
+        /**
+         * sin() and cos() are called once per cycle and the following samples are obtained with RotatePhasor().
+         */
+        WaveformGeneratorRecursive
+    };
+
     /**
      * @brief Accelerates (if needed) the calculation of the waveform so that when many output signals share the same waveform this only has to be performed once.
      * This design should be revisited... This function is called by the Execute method before calling any of the Get*Value() functions.
@@ -260,6 +275,36 @@ protected:
      * @details This function decides if the triggersON is enabled allowing to output the waveform generated.
      */
     void TriggerMechanism();
+
+    /**
+     * @brief Reads the Generator parameter.
+     * @details Generator = "Direct" (default if not specified) or "Recursive".
+     * @param[in] data is the GAM configuration file
+     * @return true if Generator is not specified or is one of the values above.
+     * @post
+     *   generator is set accordingly.
+     */
+    bool ReadGenerator(StructuredDataI &data);
+
+    /**
+     * @brief Rotates a phasor and corrects its modulus.
+     * @details Computes (phasorCos + j phasorSin) * (rotationCos + j rotationSin) and multiplies the
+     * result by (3 - |p|^2) / 2, the first order approximation of 1 / |p|. The correction is applied at
+     * every rotation so that the modulus stays within a few eps of 1 instead of drifting with the number of rotations.
+     * @param[in,out] phasorCos the real part of the phasor.
+     * @param[in,out] phasorSin the imaginary part of the phasor.
+     * @param[in] rotationCos the cosine of the rotation angle.
+     * @param[in] rotationSin the sine of the rotation angle.
+     */
+    static inline void RotatePhasor(float64 &phasorCos,
+                                    float64 &phasorSin,
+                                    const float64 rotationCos,
+                                    const float64 rotationSin);
+
+    /**
+     * The algorithm used to compute the trigonometric waveforms.
+     */
+    WaveformGenerator generator;
 private:
 
     /**
@@ -379,6 +424,20 @@ private:
 /*---------------------------------------------------------------------------*/
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+void Waveform::RotatePhasor(float64 &phasorCos,
+                            float64 &phasorSin,
+                            const float64 rotationCos,
+                            const float64 rotationSin) {
+    const float64 auxCos = (phasorCos * rotationCos) - (phasorSin * rotationSin);
+    const float64 auxSin = (phasorSin * rotationCos) + (phasorCos * rotationSin);
+    const float64 gain = 1.5 - (0.5 * ((auxCos * auxCos) + (auxSin * auxSin)));
+    phasorCos = auxCos * gain;
+    phasorSin = auxSin * gain;
+}
+
+}
 
 #endif /* WAVEFORM_H_ */
 
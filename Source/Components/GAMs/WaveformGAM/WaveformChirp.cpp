@@ -127,11 +127,24 @@ bool WaveformChirp::Initialise(StructuredDataI &data) {
     if (ok) {
         cD2 = chirpDuration * 2.0;
     }
+    if (ok) {
+        ok = ReadGenerator(data);
+    }
 
     return ok;
 }
 
 bool WaveformChirp::PrecomputeValues() {
+    if (generator == WaveformGeneratorRecursive) {
+        PrecomputeRecursiveValues();
+    }
+    else {
+        PrecomputeDirectValues();
+    }
+    return true;
+}
+
+void WaveformChirp::PrecomputeDirectValues() {
     for (uint32 i = 0u; i < numberOfOutputElements; i++) {
         TriggerMechanism();
         if (signalOn && triggersOn) {
@@ -144,7 +157,32 @@ bool WaveformChirp::PrecomputeValues() {
         }
         currentTime += timeIncrement;
     }
-    return true;
+}
+
+void WaveformChirp::PrecomputeRecursiveValues() {
+    //theta(t) = w1 * t + w12 * t^2 / cD2 + phase. With t = t0 + n * dt the phase step
+    //theta(t + dt) - theta(t) = w1 * dt + w12 * (2 * t * dt + dt^2) / cD2 grows by 2 * w12 * dt^2 / cD2 every sample.
+    const float64 angle = ((w1 * currentTime) + ((w12 * currentTime * currentTime) / cD2)) + phase;
+    float64 phasorCos = cos(angle);
+    float64 phasorSin = sin(angle);
+    const float64 stepAngle = (w1 * timeIncrement) + ((w12 * ((2.0 * currentTime * timeIncrement) + (timeIncrement * timeIncrement))) / cD2);
+    float64 stepCos = cos(stepAngle);
+    float64 stepSin = sin(stepAngle);
+    const float64 chirpAngle = (2.0 * w12 * timeIncrement * timeIncrement) / cD2;
+    const float64 chirpCos = cos(chirpAngle);
+    const float64 chirpSin = sin(chirpAngle);
+    for (uint32 i = 0u; i < numberOfOutputElements; i++) {
+        TriggerMechanism();
+        if (signalOn && triggersOn) {
+            outputFloat64[i] = (amplitude * phasorSin) + offset;
+        }
+        else {
+            outputFloat64[i] = 0.0;
+        }
+        RotatePhasor(phasorCos, phasorSin, stepCos, stepSin);
+        RotatePhasor(stepCos, stepSin, chirpCos, chirpSin);
+        currentTime += timeIncrement;
+    }
 }
 
 bool WaveformChirp::TimeIncrementValidation() {
@@ -54,6 +54,21 @@ namespace MARTe {
  * frequency1 initial frequency\n
  * frequency2 final frequency \n
  *
+ * The optional parameter Generator selects how the samples of each cycle are computed:
+ * - Direct (default): sin() is called for every sample;
+ * - Recursive: the phase is updated incrementally. The phasor (cos, sin) of the signal is rotated at every sample by the phasor of the
+ *  phase increment between consecutive samples, which in turn is rotated by the constant angle 2 * w12 * timeIncrement^2 / cD2 (the
+ *  instantaneous frequency grows linearly). Both phasors are initialised with sin() and cos() at the first sample of each cycle.
+ *
+ * With Generator = Recursive the error of the n-th sample of a cycle (n = 0 for the first sample) with respect to the exact chirp is bounded by
+ *
+ * \f$
+ * |error[n]| <= Amplitude * (e0 + 8 * n * eps + 4 * n^2 * eps)
+ * \f$
+ *
+ * where eps = 2^-52 and e0 is the error of the first sample, which is the same as with Generator = Direct. The quadratic term is due to the
+ * rounding errors of the phase increment, which are accumulated in the phase. The error does not accumulate across cycles.
+ *
  *The configuration syntax is (names and signal quantity are only given as an example):
  *<pre>
  * +waveformChirp1 = {
@@ -63,6 +78,7 @@ namespace MARTe {
  *     Frequency2 = 3.0
  *     Phase = 0.0
  *     Offset = 1.1
+ *     Generator = Recursive //Optional. Direct or Recursive. Default Direct.
  *     StartTriggerTime = {0.1 0.3 0.5 1.8}
  *     StopTriggerTime = {0.2 0.4 0.6} //the StopTriggerTime has one time less, it means that after the sequence of output on and off, the GAM will remain on forever
  *     Time = {
@@ -126,7 +142,7 @@ WaveformChirp    ();
      * w1\n
      * w12\n
      * cD2\n
-     * Moreover it checks that the parameters are correct and consistent.
+     * Moreover it checks that the parameters are correct and consistent and reads the optional Generator.
      *
      * @return true if the parameters are loaded correctly and the the verifications are positive.
      */
@@ -224,6 +240,20 @@ protected:
 
 private:
 
+    /**
+     * @brief Computes the chirp calling sin() for every sample (Generator = Direct).
+     */
+    void PrecomputeDirectValues();
+
+    /**
+     * @brief Computes the chirp with two phasors (Generator = Recursive).
+     * @details The first phasor holds the phase of the signal and is rotated by the second one, which holds the phase
+     * increment between consecutive samples. Since the phase is quadratic in time the phase increment grows by the constant
+     * 2 * w12 * timeIncrement^2 / cD2, i.e. the second phasor is in turn rotated by a fixed phasor.
+     * Both are initialised with cos() and sin() at the first sample of each cycle.
+     */
+    void PrecomputeRecursiveValues();
+
     /**
      * @brief Cast the chirp signal to the specified type.
      * @details Template method which cast the chirp signal saved in #MARTe#Waveform::outputFloat64
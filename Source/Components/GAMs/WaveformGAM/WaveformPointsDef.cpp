@@ -38,7 +38,10 @@
 /*---------------------------------------------------------------------------*/
 
 namespace {
-
+/**
+ * Maximum number of segments which are skipped one by one before falling back to a binary search.
+ */
+const MARTe::uint32 WAVEFORM_POINTS_DEF_MAX_LINEAR_STEPS = 4u;
 }
 
 /*---------------------------------------------------------------------------*/
@@ -51,6 +54,7 @@ WaveformPointsDef::WaveformPointsDef() :
         Waveform() {
     points = NULL_PTR(float64 *);
     times = NULL_PTR(float64 *);
+    slopes = NULL_PTR(float64 *);
     numberOfPointsElements = 0u;
     numberOfTimesElements = 0u;
     lastOutputValue = 0.0;
@@ -58,9 +62,7 @@ WaveformPointsDef::WaveformPointsDef() :
     beginningSequence = true;
     lastTimeValue = 0.0;
     pointRef1 = 0.0;
-    pointRef2 = 0.0;
     timeRef1 = 0.0;
-    timeRef2 = 0.0;
     slope = 0.0;
     remindTime = 0.0;
 
@@ -75,6 +77,10 @@ WaveformPointsDef::~WaveformPointsDef() {
         delete[] times;
         times = NULL_PTR(float64 *);
     }
+    if (slopes != NULL_PTR(float64 *)) {
+        delete[] slopes;
+        slopes = NULL_PTR(float64 *);
+    }
 }
 bool WaveformPointsDef::Initialise(StructuredDataI &data) {
     bool ok = Waveform::Initialise(data);
@@ -141,8 +147,10 @@ bool WaveformPointsDef::Initialise(StructuredDataI &data) {
         //If is due to MISRA are worried about null pointer...
         if (times != NULL_PTR(float64 *)) {
             lastTimeValue = times[numberOfTimesElements - 1u];
-            // numberOfSlopeElements = numberOfTimesElements - 1u;
         }
+        slopes = new float64[numberOfTimesElements];
+        slopes[0u] = 0.0;
+        ComputeSlopes();
     }
     return ok;
 }
@@ -151,7 +159,6 @@ bool WaveformPointsDef::PrecomputeValues() {
     for (uint32 i = 0u; (i < numberOfOutputElements); i++) {
         TriggerMechanism();
         FindNearestPoints();
-        Slope();
         if (signalOn && triggersOn) {
             if (outputFloat64 != NULL_PTR(float64 *)) {
                 //outputFloat64[i] = refVal + ((currentTime - timeRefVal) * slopes[indexSlopes]);
@@ -250,27 +257,34 @@ bool WaveformPointsDef::SearchIndex(const float64 preq, const float64 * const p,
 }
 
 //lint -e{613} Possible use of a null pointer. It is not possible due to this function only is called inside Execute() and Execute() only is called if Setup() and initialise() succeed.
-void WaveformPointsDef::FindNearestPoints() {
+bool WaveformPointsDef::FindSegment() {
     bool found;
-    uint32 i = 0u;
-    found = SearchIndex(currentTime, times, numberOfTimesElements, i);
-    if (found) {
-        if (i > 0u) {
-            uint32 auxIndex = i - 1u;
-            pointRef1 = points[auxIndex];
-            pointRef2 = points[i];
-            timeRef1 = times[auxIndex];
-            timeRef2 = times[i];
+    if ((indexSlopes > 0u) && (times[indexSlopes - 1u] > currentTime)) {
+        //The time went backwards
+        found = SearchIndex(currentTime, times, numberOfTimesElements, indexSlopes);
+    }
+    else {
+        //Usually currentTime is still in the same segment or in one of the next ones
+        uint32 steps = 0u;
+        while ((indexSlopes < numberOfTimesElements) && (steps < WAVEFORM_POINTS_DEF_MAX_LINEAR_STEPS) && (times[indexSlopes] <= currentTime)) {
+            indexSlopes++;
+            steps++;
         }
-        else {
-            uint32 auxIdx = numberOfPointsElements - 1u;
-            pointRef1 = points[auxIdx];
-            pointRef2 = points[i];
-            timeRef1 = remindTime;
-            timeRef2 = times[i];
+        if ((indexSlopes < numberOfTimesElements) && (times[indexSlopes] <= currentTime)) {
+            //All the times before indexSlopes are <= currentTime
+            uint32 auxIndex = 0u;
+            (void) SearchIndex(currentTime, &times[indexSlopes], numberOfTimesElements - indexSlopes, auxIndex);
+            indexSlopes += auxIndex;
         }
+        found = (indexSlopes < numberOfTimesElements);
     }
-    else {
+    return found;
+}
+
+//lint -e{613} Possible use of a null pointer. It is not possible due to this function only is called inside Execute() and Execute() only is called if Setup() and initialise() succeed.
+void WaveformPointsDef::FindNearestPoints() {
+    bool found = FindSegment();
+    if (!found) {
         uint32 auxIdx2 = numberOfTimesElements - 1u;
         remindTime = times[auxIdx2];
         for (uint32 m = 0u; m < numberOfTimesElements; m++) { //update times
@@ -278,30 +292,33 @@ void WaveformPointsDef::FindNearestPoints() {
                 times[m] = times[m] + lastTimeValue + timeIncrement;
             }
         }
-        i = 0u;
-        found = SearchIndex(currentTime, times, numberOfTimesElements, i);
-        if (found) {
-            if (i == 0u) {
-                uint32 auxIdx = numberOfPointsElements - 1u;
-                pointRef1 = points[auxIdx];
-                pointRef2 = points[i];
-                timeRef1 = remindTime;
-                timeRef2 = times[i];
-            }
-            else {
-                uint32 auxIndex = i - 1u;
-                pointRef1 = points[auxIndex];
-                pointRef2 = points[i];
-                timeRef1 = times[auxIndex];
-                timeRef2 = times[i];
-            }
+        ComputeSlopes();
+        found = SearchIndex(currentTime, times, numberOfTimesElements, indexSlopes);
+    }
+    if (found) {
+        if (indexSlopes > 0u) {
+            uint32 auxIndex = indexSlopes - 1u;
+            pointRef1 = points[auxIndex];
+            timeRef1 = times[auxIndex];
+            slope = slopes[indexSlopes];
+        }
+        else {
+            //From the last point of the previous sequence to the first point
+            uint32 auxIdx = numberOfPointsElements - 1u;
+            pointRef1 = points[auxIdx];
+            timeRef1 = remindTime;
+            slope = (points[0u] - pointRef1) / (times[0u] - timeRef1);
         }
     }
     return;
 }
 
-void WaveformPointsDef::Slope() {
-    slope = (pointRef2 - pointRef1) / (timeRef2 - timeRef1);
+//lint -e{613} Possible use of a null pointer. This function only will be called if times, points and slopes are initialised.
+void WaveformPointsDef::ComputeSlopes() {
+    for (uint32 i = 1u; i < numberOfTimesElements; i++) {
+        uint32 auxIndex = i - 1u;
+        slopes[i] = (points[i] - points[auxIndex]) / (times[i] - times[auxIndex]);
+    }
     return;
 }
 
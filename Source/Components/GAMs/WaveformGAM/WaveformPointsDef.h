@@ -81,6 +81,7 @@ public:CLASS_REGISTER_DECLARATION()
      * @post
      * points = NULL_PTR(float64 *)\n
      * times = NULL_PTR(float64 *)\n
+     * slopes = NULL_PTR(float64 *)\n
      * numberOfPointsElements = 0u\n
      * numberOfTimesElements = 0u\n
      * lastOutputValue = 0.0\n
@@ -97,6 +98,7 @@ public:CLASS_REGISTER_DECLARATION()
      * @post
      *  points = NULL_PTR(float64 *)\n
      *  times = NULL_PTR(float64 *)\n
+     *  slopes = NULL_PTR(float64 *)\n
      */
     virtual ~WaveformPointsDef();
 
@@ -229,7 +231,14 @@ private:
     float64 *times;
 
     /**
-     * Indicates the current applied slope
+     * Slope of each segment: slopes[i] = (points[i] - points[i - 1]) / (times[i] - times[i - 1]), for i > 0.
+     * Computed in Initialise() and every time that times is moved to the next repetition of the sequence.
+     */
+    float64 *slopes;
+
+    /**
+     * Indicates the current applied slope, i.e. the index of the first times element greater than currentTime.
+     * Advances with currentTime so that the segment is found without searching the whole times array.
      */
     uint32 indexSlopes;
 
@@ -263,23 +272,13 @@ private:
      */
     float64 pointRef1;
 
-    /**
-     * Used to interpolate
-     */
-    float64 pointRef2;
-
     /**
      * Used to interpolate
      */
     float64 timeRef1;
 
     /**
-     * Used to interpolate
-     */
-    float64 timeRef2;
-
-    /**
-     * Used to interpolate. slope = (pointRef2 - pointRef1)/(timeRef2 - timeRef1)
+     * Used to interpolate. The slope of the current segment
      */
     float64 slope;
 
@@ -295,16 +294,26 @@ private:
 
     /**
      * @brief Using the time decides between which points the interpolation must be done.
-     * @details given the times array looks the nearest points to currentTime. If currentTime is beyond
-     * the array the function updates times for the next interval and tries to find again.
+     * @details given the times array looks the nearest points to currentTime (see FindSegment()) and sets pointRef1, timeRef1 and slope.
+     * If currentTime is beyond the array the function updates times (and slopes) for the next interval and tries to find again with a binary search.
      */
     void FindNearestPoints();
 
     /**
-     * @brief computes the slope to be applied.
-     * @details slope = (pointRef2 - pointRef1)/(timeRef2 - timeRef1);
+     * @brief Updates indexSlopes to the first times element greater than currentTime.
+     * @details Starting from the previous indexSlopes, up to WAVEFORM_POINTS_DEF_MAX_LINEAR_STEPS segments are skipped one by one and,
+     * if currentTime is still beyond, the rest of the times array is binary searched. If currentTime is before the previous segment
+     * (e.g. a time jump) the whole times array is binary searched. Hence the cost per sample does not depend on the number of points
+     * when currentTime advances by less than a few segments per sample.
+     * @return true if currentTime is before the last times element.
+     */
+    bool FindSegment();
+
+    /**
+     * @brief Computes the slopes of the segments for the current times.
+     * @details slopes[i] = (points[i] - points[i - 1]) / (times[i] - times[i - 1]);
      */
-    void Slope();
+    void ComputeSlopes();
 
 };
 
@@ -101,10 +101,23 @@ bool WaveformSin::Initialise(StructuredDataI& data) {
             REPORT_ERROR(ErrorManagement::InitialisationError, "Error reading offset");
         }
     }
+    if (ok) {
+        ok = ReadGenerator(data);
+    }
     return ok;
 }
 
 bool WaveformSin::PrecomputeValues() {
+    if (generator == WaveformGeneratorRecursive) {
+        PrecomputeRecursiveValues();
+    }
+    else {
+        PrecomputeDirectValues();
+    }
+    return true;
+}
+
+void WaveformSin::PrecomputeDirectValues() {
     for (uint32 i = 0u; i < numberOfOutputElements; i++) {
         TriggerMechanism();
         if (signalOn && triggersOn) {
@@ -117,7 +130,27 @@ bool WaveformSin::PrecomputeValues() {
         }
         currentTime += timeIncrement;
     }
-    return true;
+}
+
+void WaveformSin::PrecomputeRecursiveValues() {
+    //The phasor starts at the phase of the first sample of the cycle and is rotated by w * timeIncrement for each sample.
+    const float64 angle = (w * currentTime) + phase;
+    float64 phasorCos = cos(angle);
+    float64 phasorSin = sin(angle);
+    const float64 stepAngle = w * timeIncrement;
+    const float64 stepCos = cos(stepAngle);
+    const float64 stepSin = sin(stepAngle);
+    for (uint32 i = 0u; i < numberOfOutputElements; i++) {
+        TriggerMechanism();
+        if (signalOn && triggersOn) {
+            outputFloat64[i] = ((amplitude * phasorSin) + offset);
+        }
+        else {
+            outputFloat64[i] = 0.0;
+        }
+        RotatePhasor(phasorCos, phasorSin, stepCos, stepSin);
+        currentTime += timeIncrement;
+    }
 }
 
 bool WaveformSin::TimeIncrementValidation() {
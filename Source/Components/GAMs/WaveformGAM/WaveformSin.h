@@ -71,6 +71,23 @@ namespace MARTe {
  * two arrays are not consistent (i.e. start time is later than stop time) a warning is launched, the trigger mechanism is disabled,
  * but the GAM still operates in normal conditions (i.e. always on).
  *
+ * The optional parameter Generator selects how the samples of each cycle are computed:
+ * - Direct (default): sin() is called for every sample;
+ * - Recursive: sin() and cos() are called for the first sample of the cycle and the following samples are obtained by rotating the
+ *  phasor (cos, sin) by w * timeIncrement (see Waveform::RotatePhasor), i.e. four multiplications and two additions per sample, plus
+ *  three multiplications for the correction of the modulus.
+ *
+ * With Generator = Recursive the phase of the n-th sample of a cycle (n = 0 for the first sample) is affected by the rounding errors of the
+ * n rotations. The error with respect to the exact waveform is bounded by
+ *
+ * \f$
+ * |error[n]| <= Amplitude * (e0 + 8 * n * eps)
+ * \f$
+ *
+ * where eps = 2^-52 and e0 is the error of the first sample, which is the same as with Generator = Direct (dominated by the rounding of w * time + phase).
+ * Since the phasor is initialised again at every cycle the error does not accumulate across cycles. Note that with Generator = Direct the time of each sample
+ * is accumulated (time += timeIncrement), so that in practice the Recursive generator is not less accurate for the typical number of samples per cycle.
+ *
  * The configuration syntax is (names and signal quantities are only given as an example):
  *<pre>
  * +waveformSin1 = {
@@ -79,6 +96,7 @@ namespace MARTe {
  *     Frequency = 1.0
  *     Phase = 0.0
  *     Offset = 1.1
+ *     Generator = Recursive //Optional. Direct or Recursive. Default Direct.
  *     StartTriggerTime = {0.1 0.3 0.5 1.8}
  *     StopTriggerTime = {0.2 0.4 0.6} //the StopTriggerTime has one time value less. It means that after the sequence of output on and off, the GAM will remain on forever
  *     InputSignals = {
@@ -214,6 +232,17 @@ protected:
 
 private:
 
+    /**
+     * @brief Computes the sin wave calling sin() for every sample (Generator = Direct).
+     */
+    void PrecomputeDirectValues();
+
+    /**
+     * @brief Computes the sin wave rotating a phasor by w * timeIncrement for every sample (Generator = Recursive).
+     * @details The phasor is initialised with cos() and sin() of the phase of the first sample of each cycle.
+     */
+    void PrecomputeRecursiveValues();
+
     /**
      * @brief Cast the sin in the specified type.
      * @details Template method which cast the sin wave computed with GetFloat64OutputValues()
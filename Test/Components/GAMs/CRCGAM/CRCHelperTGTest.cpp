@@ -68,3 +68,38 @@ TEST(CRCHelperTGTest,TestCompute) {
     CRCHelperTTest test;
     ASSERT_TRUE(test.TestCompute());
 }
+
+TEST(CRCHelperTGTest,TestComputeSlicingUint8) {
+    CRCHelperTTest test;
+    ASSERT_TRUE(test.TestComputeSlicingUint8());
+}
+
+TEST(CRCHelperTGTest,TestComputeSlicingUint16) {
+    CRCHelperTTest test;
+    ASSERT_TRUE(test.TestComputeSlicingUint16());
+}
+
+TEST(CRCHelperTGTest,TestComputeSlicingUint32) {
+    CRCHelperTTest test;
+    ASSERT_TRUE(test.TestComputeSlicingUint32());
+}
+
+TEST(CRCHelperTGTest,TestComputeHardwareUint32) {
+    CRCHelperTTest test;
+    ASSERT_TRUE(test.TestComputeHardwareUint32());
+}
+
+TEST(CRCHelperTGTest,TestComputeHardwareCRC32C) {
+    CRCHelperTTest test;
+    ASSERT_TRUE(test.TestComputeHardwareCRC32C());
+}
+
+TEST(CRCHelperTGTest,TestBenchmarkUint16) {
+    CRCHelperTTest test;
+    ASSERT_TRUE(test.TestBenchmarkUint16());
+}
+
+TEST(CRCHelperTGTest,TestBenchmarkUint32) {
+    CRCHelperTTest test;
+    ASSERT_TRUE(test.TestBenchmarkUint32());
+}
@@ -26,18 +26,64 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#if defined(__x86_64__) && (defined(__clang__) || (defined(__GNUC__) && ((__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 9)))))
+#define CRCHELPERTTEST_CPUID
+#include <cpuid.h>
+#endif
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 
+#include "AdvancedErrorManagement.h"
 #include "CRCHelperT.h"
 #include "CRCHelperTTest.h"
+#include "HighResolutionTimer.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
 
+/**
+ * @brief Fills a buffer with pseudo-random bytes.
+ */
+static void CRCHelperTTestFill(MARTe::uint8 * const buffer, const MARTe::uint32 size) {
+    MARTe::uint32 seed = 1u;
+    for (MARTe::uint32 i = 0u; i < size; i++) {
+        seed = (seed * 1103515245u) + 12345u;
+        buffer[i] = static_cast<MARTe::uint8>(seed >> 16u);
+    }
+}
+
+/**
+ * @brief Reads from cpuid the features required by the hardware CRCs (false if cpuid is not available).
+ */
+static void CRCHelperTTestFeatures(bool &sse42, bool &pclmul) {
+    sse42 = false;
+    pclmul = false;
+#ifdef CRCHELPERTTEST_CPUID
+    unsigned int eax = 0u;
+    unsigned int ebx = 0u;
+    unsigned int ecx = 0u;
+    unsigned int edx = 0u;
+    if (__get_cpuid(1u, &eax, &ebx, &ecx, &edx) != 0) {
+        bool ssse3 = ((ecx & (1u << 9u)) != 0u);
+        sse42 = (ssse3 && ((ecx & (1u << 20u)) != 0u));
+        pclmul = (ssse3 && ((ecx & (1u << 1u)) != 0u));
+    }
+#endif
+}
+
+/**
+ * @brief Checks the implementation selected by a hardware accelerated CRCHelperT<uint32>.
+ */
+static bool CRCHelperTTestImplementation(const MARTe::uint32 polynomial, const MARTe::char8 * const implementation) {
+    MARTe::uint32 pol = polynomial;
+    MARTe::CRCHelperT<MARTe::uint32> test(true);
+    test.ComputeTable(&pol);
+    return (MARTe::StringHelper::Compare(test.GetImplementation(), implementation) == 0);
+}
+
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -127,3 +173,144 @@ bool CRCHelperTTest::TestCompute() {
     return ok;
 }
 	
+
+template <typename T>
+bool CRCHelperTTest::TestComputeFast(const T polynomial, const bool hardwareAcceleration) {
+    const uint32 bufferSize = 4096u;
+    uint8 *buffer = new uint8[bufferSize];
+    CRCHelperTTestFill(buffer, bufferSize);
+    T pol = polynomial;
+    CRC<T> reference;
+    reference.ComputeTable(pol);
+    CRCHelperT<T> test(hardwareAcceleration);
+    test.ComputeTable(&pol);
+    bool ok = (StringHelper::Compare(test.GetImplementation(), "table") != 0);
+    if ((ok) && (!hardwareAcceleration)) {
+        ok = (StringHelper::Compare(test.GetImplementation(), "slicing-by-8") == 0);
+    }
+    //All the sizes up to 300 bytes, then sizes up to the buffer size, at different offsets
+    for (uint32 size = 0u; (size < bufferSize) && (ok); size += ((size < 300u) ? 1u : 97u)) {
+        uint32 offset = (size % 16u);
+        if ((offset + size) > bufferSize) {
+            offset = 0u;
+        }
+        T init = static_cast<T>(size * 2654435761u);
+        T expected = reference.Compute(&buffer[offset], static_cast<int32>(size), init, false);
+        T crcValue = 0u;
+        test.Compute(&buffer[offset], static_cast<int32>(size), &init, false, &crcValue);
+        ok = (crcValue == expected);
+        if ((ok) && (size > 0u)) {
+            //Inverted: data[0], data[-1], ... data[-size + 1]
+            const uint8 * const last = &buffer[offset + size - 1u];
+            expected = reference.Compute(last, static_cast<int32>(size), init, true);
+            test.Compute(last, static_cast<int32>(size), &init, true, &crcValue);
+            ok = (crcValue == expected);
+        }
+    }
+    delete[] buffer;
+    return ok;
+}
+
+bool CRCHelperTTest::TestComputeSlicingUint8() {
+    return TestComputeFast<uint8>(0x7u, false);
+}
+
+bool CRCHelperTTest::TestComputeSlicingUint16() {
+    return TestComputeFast<uint16>(0x1021u, false);
+}
+
+bool CRCHelperTTest::TestComputeSlicingUint32() {
+    return TestComputeFast<uint32>(0x4C11DB7u, false);
+}
+
+bool CRCHelperTTest::TestComputeHardwareUint32() {
+    bool sse42;
+    bool pclmul;
+    CRCHelperTTestFeatures(sse42, pclmul);
+    //Without PCLMULQDQ the hardware implementation is not available and slicing-by-8 is used
+    const char8 * const implementation = (pclmul) ? ("pclmul") : ("slicing-by-8");
+    bool ok = CRCHelperTTestImplementation(0x4C11DB7u, implementation);
+    if (ok) {
+        ok = CRCHelperTTestImplementation(0x814141ABu, implementation);
+    }
+    if (ok) {
+        ok = TestComputeFast<uint32>(0x4C11DB7u, true);
+    }
+    if (ok) {
+        ok = TestComputeFast<uint32>(0x814141ABu, true);
+    }
+    return ok;
+}
+
+bool CRCHelperTTest::TestComputeHardwareCRC32C() {
+    bool sse42;
+    bool pclmul;
+    CRCHelperTTestFeatures(sse42, pclmul);
+    const char8 *implementation = "slicing-by-8";
+    if (sse42) {
+        implementation = "crc32c";
+    }
+    else if (pclmul) {
+        implementation = "pclmul";
+    }
+    else {
+        //NOOP
+    }
+    bool ok = CRCHelperTTestImplementation(0x1EDC6F41u, implementation);
+    if (ok) {
+        ok = TestComputeFast<uint32>(0x1EDC6F41u, true);
+    }
+    return ok;
+}
+
+template <typename T>
+bool CRCHelperTTest::TestBenchmark(const T polynomial, const bool hardwareAcceleration) {
+    const uint32 frameSize = 65536u;
+    const uint32 nOfFrames = 200u;
+    uint8 *frame = new uint8[frameSize];
+    CRCHelperTTestFill(frame, frameSize);
+    T pol = polynomial;
+    CRC<T> reference;
+    reference.ComputeTable(pol);
+    CRCHelperT<T> test(hardwareAcceleration);
+    test.ComputeTable(&pol);
+    T init = 0u;
+    T expected = 0u;
+    uint64 start = HighResolutionTimer::Counter();
+    for (uint32 n = 0u; n < nOfFrames; n++) {
+        expected = reference.Compute(frame, static_cast<int32>(frameSize), static_cast<T>(expected ^ init), false);
+    }
+    uint64 referenceTicks = HighResolutionTimer::Counter() - start;
+    T crcValue = 0u;
+    start = HighResolutionTimer::Counter();
+    for (uint32 n = 0u; n < nOfFrames; n++) {
+        T nextInit = static_cast<T>(crcValue ^ init);
+        test.Compute(frame, static_cast<int32>(frameSize), &nextInit, false, &crcValue);
+    }
+    uint64 ticks = HighResolutionTimer::Counter() - start;
+    bool ok = (crcValue == expected);
+    if (ok) {
+        const float64 nOfBytes = static_cast<float64>(frameSize) * static_cast<float64>(nOfFrames);
+        float64 referenceRate = nOfBytes / (static_cast<float64>(referenceTicks) * HighResolutionTimer::Period() * 1e9);
+        float64 rate = nOfBytes / (static_cast<float64>(ticks) * HighResolutionTimer::Period() * 1e9);
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "CRC-%d of %d byte frames: table %f GB/s, %s %f GB/s", static_cast<uint32>(sizeof(T) * 8u),
+                            frameSize, referenceRate, test.GetImplementation(), rate);
+    }
+    delete[] frame;
+    return ok;
+}
+
+bool CRCHelperTTest::TestBenchmarkUint16() {
+    return TestBenchmark<uint16>(0x1021u, true);
+}
+
+bool CRCHelperTTest::TestBenchmarkUint32() {
+    bool ok = TestBenchmark<uint32>(0x4C11DB7u, false);
+    if (ok) {
+        ok = TestBenchmark<uint32>(0x4C11DB7u, true);
+    }
+    if (ok) {
+        ok = TestBenchmark<uint32>(0x1EDC6F41u, true);
+    }
+    return ok;
+}
@@ -74,6 +74,57 @@ public:
      */
     bool TestCompute();
 
+    /**
+     * @brief Generic test of the slicing-by-8 and hardware implementations against CRC<T>::Compute,
+     * for all sizes up to 300 bytes, larger sizes, unaligned data and inverted input.
+     */
+    template <typename T>
+    bool TestComputeFast(const T polynomial, const bool hardwareAcceleration);
+
+    /**
+     * @brief TestComputeFast with type = uint8 and no hardware acceleration
+     */
+    bool TestComputeSlicingUint8();
+
+    /**
+     * @brief TestComputeFast with type = uint16 and no hardware acceleration
+     */
+    bool TestComputeSlicingUint16();
+
+    /**
+     * @brief TestComputeFast with type = uint32 and no hardware acceleration
+     */
+    bool TestComputeSlicingUint32();
+
+    /**
+     * @brief TestComputeFast with type = uint32, hardware acceleration and polynomials other than CRC-32C.
+     * Checks that the pclmul implementation is used if cpuid reports PCLMULQDQ.
+     */
+    bool TestComputeHardwareUint32();
+
+    /**
+     * @brief TestComputeFast with type = uint32, hardware acceleration and the CRC-32C polynomial.
+     * Checks that the crc32c (or pclmul) implementation is used if cpuid reports SSE4.2 (or PCLMULQDQ).
+     */
+    bool TestComputeHardwareCRC32C();
+
+    /**
+     * @brief Measures and reports the throughput (GB/s) of CRC<T>::Compute and of CRCHelperT::Compute
+     * on 64 KB frames and checks that the two CRCs are equal.
+     */
+    template <typename T>
+    bool TestBenchmark(const T polynomial, const bool hardwareAcceleration);
+
+    /**
+     * @brief TestBenchmark with type = uint16
+     */
+    bool TestBenchmarkUint16();
+
+    /**
+     * @brief TestBenchmark with type = uint32, with and without hardware acceleration
+     */
+    bool TestBenchmarkUint32();
+
 };
 
 
@@ -89,3 +89,48 @@ TEST(ConversionHelperTGTest,TestSetNumberOfSamples) {
 
 
 	
+
+TEST(ConversionHelperTGTest,TestLoadOffset) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestLoadOffset());
+}
+
+TEST(ConversionHelperTGTest,TestLoadSaturate) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestLoadSaturate());
+}
+
+TEST(ConversionHelperTGTest,TestConvert_Cast) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestConvert_Cast());
+}
+
+TEST(ConversionHelperTGTest,TestConvert_Gain) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestConvert_Gain());
+}
+
+TEST(ConversionHelperTGTest,TestConvert_SaturateInteger) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestConvert_SaturateInteger());
+}
+
+TEST(ConversionHelperTGTest,TestConvert_SaturateFloat) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestConvert_SaturateFloat());
+}
+
+TEST(ConversionHelperTGTest,TestConvert_SaturateFloat64ToFloat32) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestConvert_SaturateFloat64ToFloat32());
+}
+
+TEST(ConversionHelperTGTest,TestConvert_GainOffset) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestConvert_GainOffset());
+}
+
+TEST(ConversionHelperTGTest,TestConvert_GainOffsetInteger) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestConvert_GainOffsetInteger());
+}
@@ -24,6 +24,7 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#include <limits>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
@@ -65,6 +66,234 @@ bool ConversionHelperTTest::TestLoadGain() {
     return ok;
 }
 
+bool ConversionHelperTTest::TestLoadOffset() {
+    using namespace MARTe;
+    ConversionHelperT<int16, float32> test(NULL, NULL);
+    ConfigurationDatabase cdb;
+    bool ok = !test.LoadOffset(cdb);
+    cdb.Write("Offset", -2.5);
+    if (ok) {
+        ok = test.LoadOffset(cdb);
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestLoadSaturate() {
+    using namespace MARTe;
+    ConversionHelperT<int16, int8> test(NULL, NULL);
+    ConfigurationDatabase cdb;
+    bool ok = !test.LoadSaturate(cdb);
+    if (ok) {
+        cdb.Write("Saturate", 0);
+        ok = !test.LoadSaturate(cdb);
+    }
+    if (ok) {
+        cdb.Write("Saturate", 1);
+        ok = test.LoadSaturate(cdb);
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestConvert_Cast() {
+    using namespace MARTe;
+    uint16 input[4] = { 0u, 127u, 255u, 0xffffu };
+    int8 output[4];
+    ConversionHelperT<uint16, int8> test(&input[0], &output[0]);
+    test.SetNumberOfElements(2u);
+    test.SetNumberOfSamples(2u);
+    test.Convert();
+    bool ok = (output[0] == 0);
+    if (ok) {
+        ok = (output[1] == 127);
+    }
+    if (ok) {
+        ok = (output[2] == -1);
+    }
+    if (ok) {
+        ok = (output[3] == -1);
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestConvert_Gain() {
+    using namespace MARTe;
+    const uint32 numberOfValues = 37u;
+    int32 input[numberOfValues];
+    float64 output[numberOfValues];
+    uint32 i;
+    for (i = 0u; i < numberOfValues; i++) {
+        input[i] = static_cast<int32>(i) - 18;
+    }
+    ConversionHelperT<int32, float64> test(&input[0], &output[0]);
+    test.SetNumberOfElements(1u);
+    test.SetNumberOfSamples(numberOfValues);
+    ConfigurationDatabase cdb;
+    cdb.Write("Gain", 0.5);
+    bool ok = test.LoadGain(cdb);
+    if (ok) {
+        test.Convert();
+    }
+    for (i = 0u; (i < numberOfValues) && (ok); i++) {
+        ok = (output[i] == (static_cast<float64>(input[i]) * 0.5));
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestConvert_SaturateInteger() {
+    using namespace MARTe;
+    int32 input[6] = { -200, -128, 0, 127, 200, 0x7fffffff };
+    int8 output[6];
+    uint8 outputU[6];
+    uint32 inputU[2] = { 0xffffffffu, 5u };
+    int16 outputS[2];
+    ConversionHelperT<int32, int8> test(&input[0], &output[0]);
+    ConversionHelperT<int32, uint8> testU(&input[0], &outputU[0]);
+    ConversionHelperT<uint32, int16> testS(&inputU[0], &outputS[0]);
+    test.SetNumberOfElements(6u);
+    test.SetNumberOfSamples(1u);
+    testU.SetNumberOfElements(6u);
+    testU.SetNumberOfSamples(1u);
+    testS.SetNumberOfElements(2u);
+    testS.SetNumberOfSamples(1u);
+    ConfigurationDatabase cdb;
+    cdb.Write("Saturate", 1);
+    bool ok = test.LoadSaturate(cdb);
+    if (ok) {
+        ok = testU.LoadSaturate(cdb);
+    }
+    if (ok) {
+        ok = testS.LoadSaturate(cdb);
+    }
+    if (ok) {
+        test.Convert();
+        testU.Convert();
+        testS.Convert();
+        const int8 expected[6] = { -128, -128, 0, 127, 127, 127 };
+        const uint8 expectedU[6] = { 0u, 0u, 0u, 127u, 200u, 255u };
+        for (uint32 i = 0u; (i < 6u) && (ok); i++) {
+            ok = (output[i] == expected[i]);
+            if (ok) {
+                ok = (outputU[i] == expectedU[i]);
+            }
+        }
+    }
+    if (ok) {
+        ok = (outputS[0] == 32767);
+    }
+    if (ok) {
+        ok = (outputS[1] == 5);
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestConvert_SaturateFloat() {
+    using namespace MARTe;
+    float32 input[6] = { -1e10F, -32768.9F, -1.5F, 1.5F, 3e9F, 0.F };
+    input[5] = input[5] / input[5];
+    int16 output[6];
+    int32 output32[6];
+    ConversionHelperT<float32, int16> test(&input[0], &output[0]);
+    ConversionHelperT<float32, int32> test32(&input[0], &output32[0]);
+    test.SetNumberOfElements(3u);
+    test.SetNumberOfSamples(2u);
+    test32.SetNumberOfElements(3u);
+    test32.SetNumberOfSamples(2u);
+    ConfigurationDatabase cdb;
+    cdb.Write("Saturate", 1);
+    bool ok = test.LoadSaturate(cdb);
+    if (ok) {
+        ok = test32.LoadSaturate(cdb);
+    }
+    if (ok) {
+        test.Convert();
+        test32.Convert();
+        const int16 expected[6] = { -32768, -32768, -1, 1, 32767, 0 };
+        const int32 expected32[6] = { -2147483647 - 1, -32768, -1, 1, 2147483647, 0 };
+        for (uint32 i = 0u; (i < 6u) && (ok); i++) {
+            ok = (output[i] == expected[i]);
+            if (ok) {
+                ok = (output32[i] == expected32[i]);
+            }
+        }
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestConvert_SaturateFloat64ToFloat32() {
+    using namespace MARTe;
+    float64 input[3] = { -1e300, 1.25, 1e300 };
+    float32 output[3];
+    ConversionHelperT<float64, float32> test(&input[0], &output[0]);
+    test.SetNumberOfElements(3u);
+    test.SetNumberOfSamples(1u);
+    ConfigurationDatabase cdb;
+    cdb.Write("Saturate", 1);
+    bool ok = test.LoadSaturate(cdb);
+    if (ok) {
+        test.Convert();
+        ok = (output[0] == -std::numeric_limits<float32>::max());
+    }
+    if (ok) {
+        ok = (output[1] == 1.25F);
+    }
+    if (ok) {
+        ok = (output[2] == std::numeric_limits<float32>::max());
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestConvert_GainOffset() {
+    using namespace MARTe;
+    const uint32 numberOfValues = 21u;
+    int16 input[numberOfValues];
+    float32 output[numberOfValues];
+    uint32 i;
+    for (i = 0u; i < numberOfValues; i++) {
+        input[i] = static_cast<int16>(static_cast<int32>(i * 3000u) - 32768);
+    }
+    ConversionHelperT<int16, float32> test(&input[0], &output[0]);
+    test.SetNumberOfElements(7u);
+    test.SetNumberOfSamples(3u);
+    ConfigurationDatabase cdb;
+    cdb.Write("Gain", 0.25);
+    cdb.Write("Offset", -3.0);
+    bool ok = test.LoadGain(cdb);
+    if (ok) {
+        ok = test.LoadOffset(cdb);
+    }
+    if (ok) {
+        test.Convert();
+    }
+    for (i = 0u; (i < numberOfValues) && (ok); i++) {
+        ok = (output[i] == ((static_cast<float32>(input[i]) * 0.25F) - 3.0F));
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestConvert_GainOffsetInteger() {
+    using namespace MARTe;
+    float32 input[5] = { -20.F, -10.F, 0.F, 10.F, 20.F };
+    int16 output[5];
+    ConversionHelperT<float32, int16> test(&input[0], &output[0]);
+    test.SetNumberOfElements(5u);
+    test.SetNumberOfSamples(1u);
+    ConfigurationDatabase cdb;
+    cdb.Write("Gain", 3276.8);
+    cdb.Write("Offset", 100.0);
+    bool ok = test.LoadGain(cdb);
+    if (ok) {
+        ok = test.LoadOffset(cdb);
+    }
+    if (ok) {
+        test.Convert();
+        const int16 expected[5] = { -32768, -32668, 100, 32767, 32767 };
+        for (uint32 i = 0u; (i < 5u) && (ok); i++) {
+            ok = (output[i] == expected[i]);
+        }
+    }
+    return ok;
+}
+
 bool ConversionHelperTTest::TestGetInputMemory() {
     using namespace MARTe;
     ConversionHelperT<uint32, float32> test(NULL, NULL);
@@ -56,6 +56,51 @@ public:
      */
     bool TestLoadGain();
 
+    /**
+     * @brief Tests the LoadOffset method.
+     */
+    bool TestLoadOffset();
+
+    /**
+     * @brief Tests the LoadSaturate method.
+     */
+    bool TestLoadSaturate();
+
+    /**
+     * @brief Tests that the Convert method without Saturate wraps the integer values (legacy behaviour).
+     */
+    bool TestConvert_Cast();
+
+    /**
+     * @brief Tests that the Convert method with Gain converts all the elements and samples.
+     */
+    bool TestConvert_Gain();
+
+    /**
+     * @brief Tests that the Convert method with Saturate clamps the narrowing integer conversions.
+     */
+    bool TestConvert_SaturateInteger();
+
+    /**
+     * @brief Tests that the Convert method with Saturate clamps the float to integer conversions (NaN to 0).
+     */
+    bool TestConvert_SaturateFloat();
+
+    /**
+     * @brief Tests that the Convert method with Saturate clamps the float64 to float32 conversions.
+     */
+    bool TestConvert_SaturateFloat64ToFloat32();
+
+    /**
+     * @brief Tests the Convert method with Gain and Offset from int16 to float32.
+     */
+    bool TestConvert_GainOffset();
+
+    /**
+     * @brief Tests the Convert method with Gain and Offset from float32 to int16, which always saturates.
+     */
+    bool TestConvert_GainOffsetInteger();
+
     /**
      * @brief Tests the GetInputMemory method.
      */
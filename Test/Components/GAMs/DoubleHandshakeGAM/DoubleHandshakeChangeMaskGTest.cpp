@@ -0,0 +1,90 @@
+/**
+ * @file DoubleHandshakeChangeMaskGTest.cpp
+ * @brief Source file for class DoubleHandshakeChangeMaskGTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class DoubleHandshakeChangeMaskGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "DoubleHandshakeChangeMaskTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(DoubleHandshakeChangeMaskGTest,TestConstructor) {
+    DoubleHandshakeChangeMaskTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(DoubleHandshakeChangeMaskGTest,TestInitialise) {
+    DoubleHandshakeChangeMaskTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(DoubleHandshakeChangeMaskGTest,TestInitialise_False_Twice) {
+    DoubleHandshakeChangeMaskTest test;
+    ASSERT_TRUE(test.TestInitialise_False_Twice());
+}
+
+TEST(DoubleHandshakeChangeMaskGTest,TestAddChangeRange) {
+    DoubleHandshakeChangeMaskTest test;
+    ASSERT_TRUE(test.TestAddChangeRange());
+}
+
+TEST(DoubleHandshakeChangeMaskGTest,TestAddChangeRange_False_OutOfBounds) {
+    DoubleHandshakeChangeMaskTest test;
+    ASSERT_TRUE(test.TestAddChangeRange_False_OutOfBounds());
+}
+
+TEST(DoubleHandshakeChangeMaskGTest,TestAddChangeRange_SharedWord) {
+    DoubleHandshakeChangeMaskTest test;
+    ASSERT_TRUE(test.TestAddChangeRange_SharedWord());
+}
+
+TEST(DoubleHandshakeChangeMaskGTest,TestAddChangeRange_PartialWord) {
+    DoubleHandshakeChangeMaskTest test;
+    ASSERT_TRUE(test.TestAddChangeRange_PartialWord());
+}
+
+TEST(DoubleHandshakeChangeMaskGTest,TestAddNonZeroRange) {
+    DoubleHandshakeChangeMaskTest test;
+    ASSERT_TRUE(test.TestAddNonZeroRange());
+}
+
+TEST(DoubleHandshakeChangeMaskGTest,TestSetActive) {
+    DoubleHandshakeChangeMaskTest test;
+    ASSERT_TRUE(test.TestSetActive());
+}
+
+TEST(DoubleHandshakeChangeMaskGTest,TestGetNextChannel_ManyChannels) {
+    DoubleHandshakeChangeMaskTest test;
+    ASSERT_TRUE(test.TestGetNextChannel_ManyChannels());
+}
@@ -0,0 +1,333 @@
+/**
+ * @file DoubleHandshakeChangeMaskTest.cpp
+ * @brief Source file for class DoubleHandshakeChangeMaskTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class DoubleHandshakeChangeMaskTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "DoubleHandshakeChangeMaskTest.h"
+#include "MemoryOperationsHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * Checks that GetNextChannel returns exactly the channels in \a expected (in increasing order).
+ */
+static bool DoubleHandshakeChangeMaskTestCheck(DoubleHandshakeChangeMask &test,
+                                               const uint32 * const expected,
+                                               const uint32 numberOfExpected) {
+    bool ok = true;
+    uint32 n = 0u;
+    uint32 channel = 0u;
+    while ((ok) && (test.GetNextChannel(channel))) {
+        ok = (n < numberOfExpected);
+        if (ok) {
+            ok = (channel == expected[n]);
+        }
+        n++;
+    }
+    if (ok) {
+        ok = (n == numberOfExpected);
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool DoubleHandshakeChangeMaskTest::TestConstructor() {
+    DoubleHandshakeChangeMask test;
+    uint32 channel = 0u;
+    test.Update(NULL_PTR(uint8*), NULL_PTR(uint8*));
+    return !test.GetNextChannel(channel);
+}
+
+bool DoubleHandshakeChangeMaskTest::TestInitialise() {
+    DoubleHandshakeChangeMask test;
+    uint64 current[2] = { 0u, 0u };
+    uint64 previous[2] = { 0u, 0u };
+    bool ok = test.Initialise(3u, 16u);
+    if (ok) {
+        test.Update(reinterpret_cast<uint8*>(&current[0]), reinterpret_cast<uint8*>(&previous[0]));
+        const uint32 expected[] = { 0u, 1u, 2u };
+        ok = DoubleHandshakeChangeMaskTestCheck(test, &expected[0], 3u);
+    }
+    return ok;
+}
+
+bool DoubleHandshakeChangeMaskTest::TestInitialise_False_Twice() {
+    DoubleHandshakeChangeMask test;
+    bool ok = test.Initialise(3u, 16u);
+    if (ok) {
+        ok = !test.Initialise(3u, 16u);
+    }
+    return ok;
+}
+
+bool DoubleHandshakeChangeMaskTest::TestAddChangeRange() {
+    DoubleHandshakeChangeMask test;
+    uint64 current[4] = { 0u, 0u, 0u, 0u };
+    uint64 previous[4] = { 0u, 0u, 0u, 0u };
+    uint8 *currentBytes = reinterpret_cast<uint8*>(&current[0]);
+    uint8 *previousBytes = reinterpret_cast<uint8*>(&previous[0]);
+    bool ok = test.Initialise(3u, 32u);
+    if (ok) {
+        ok = test.AddChangeRange(0u, 0u, 8u);
+    }
+    if (ok) {
+        ok = test.AddChangeRange(1u, 8u, 12u);
+    }
+    if (ok) {
+        ok = test.AddChangeRange(2u, 20u, 4u);
+    }
+    for (uint32 i = 0u; i < 3u; i++) {
+        test.SetActive(i, false);
+    }
+    if (ok) {
+        test.Update(currentBytes, previousBytes);
+        ok = DoubleHandshakeChangeMaskTestCheck(test, NULL_PTR(uint32*), 0u);
+    }
+    if (ok) {
+        currentBytes[10] = 1u;
+        test.Update(currentBytes, previousBytes);
+        const uint32 expected[] = { 1u };
+        ok = DoubleHandshakeChangeMaskTestCheck(test, &expected[0], 1u);
+    }
+    if (ok) {
+        previousBytes[10] = 1u;
+        //outside of all the ranges
+        currentBytes[28] = 1u;
+        test.Update(currentBytes, previousBytes);
+        ok = DoubleHandshakeChangeMaskTestCheck(test, NULL_PTR(uint32*), 0u);
+    }
+    if (ok) {
+        previousBytes[0] = 5u;
+        test.Update(currentBytes, previousBytes);
+        const uint32 expected[] = { 0u };
+        ok = DoubleHandshakeChangeMaskTestCheck(test, &expected[0], 1u);
+    }
+    return ok;
+}
+
+bool DoubleHandshakeChangeMaskTest::TestAddChangeRange_False_OutOfBounds() {
+    DoubleHandshakeChangeMask test;
+    bool ok = !test.AddChangeRange(0u, 0u, 4u);
+    if (ok) {
+        ok = test.Initialise(2u, 16u);
+    }
+    if (ok) {
+        ok = !test.AddChangeRange(2u, 0u, 4u);
+    }
+    if (ok) {
+        ok = !test.AddChangeRange(0u, 12u, 8u);
+    }
+    if (ok) {
+        ok = !test.AddChangeRange(0u, 20u, 0u);
+    }
+    if (ok) {
+        ok = !test.AddNonZeroRange(1u, 0xFFFFFFFFu, 2u);
+    }
+    if (ok) {
+        ok = test.AddChangeRange(1u, 12u, 4u);
+    }
+    return ok;
+}
+
+bool DoubleHandshakeChangeMaskTest::TestAddChangeRange_SharedWord() {
+    DoubleHandshakeChangeMask test;
+    uint64 current[1] = { 0u };
+    uint64 previous[1] = { 0u };
+    uint8 *currentBytes = reinterpret_cast<uint8*>(&current[0]);
+    uint8 *previousBytes = reinterpret_cast<uint8*>(&previous[0]);
+    bool ok = test.Initialise(4u, 8u);
+    for (uint32 i = 0u; (i < 4u) && (ok); i++) {
+        ok = test.AddChangeRange(i, 2u * i, 2u);
+        test.SetActive(i, false);
+    }
+    if (ok) {
+        currentBytes[5] = 1u;
+        test.Update(currentBytes, previousBytes);
+        uint32 channel = 0u;
+        bool found = false;
+        //the channels sharing the word may be selected as well, but the changed one must be
+        while (test.GetNextChannel(channel)) {
+            ok = (channel < 4u);
+            if (channel == 2u) {
+                found = true;
+            }
+        }
+        if (ok) {
+            ok = found;
+        }
+    }
+    if (ok) {
+        previousBytes[5] = 1u;
+        test.Update(currentBytes, previousBytes);
+        ok = DoubleHandshakeChangeMaskTestCheck(test, NULL_PTR(uint32*), 0u);
+    }
+    return ok;
+}
+
+bool DoubleHandshakeChangeMaskTest::TestAddChangeRange_PartialWord() {
+    DoubleHandshakeChangeMask test;
+    //the buffers are 11 bytes: the last word only has 3 bytes
+    uint64 current[2] = { 0u, 0u };
+    uint64 previous[2] = { 0u, 0u };
+    uint8 *currentBytes = reinterpret_cast<uint8*>(&current[0]);
+    uint8 *previousBytes = reinterpret_cast<uint8*>(&previous[0]);
+    bool ok = test.Initialise(2u, 11u);
+    if (ok) {
+        ok = test.AddChangeRange(0u, 0u, 8u);
+    }
+    if (ok) {
+        ok = test.AddChangeRange(1u, 8u, 3u);
+    }
+    test.SetActive(0u, false);
+    test.SetActive(1u, false);
+    if (ok) {
+        //beyond the end of the buffers
+        currentBytes[12] = 1u;
+        test.Update(currentBytes, previousBytes);
+        ok = DoubleHandshakeChangeMaskTestCheck(test, NULL_PTR(uint32*), 0u);
+    }
+    if (ok) {
+        currentBytes[10] = 1u;
+        test.Update(currentBytes, previousBytes);
+        const uint32 expected[] = { 1u };
+        ok = DoubleHandshakeChangeMaskTestCheck(test, &expected[0], 1u);
+    }
+    return ok;
+}
+
+bool DoubleHandshakeChangeMaskTest::TestAddNonZeroRange() {
+    DoubleHandshakeChangeMask test;
+    uint64 current[4] = { 0u, 0u, 0u, 0u };
+    uint64 previous[4] = { 0u, 0u, 0u, 0u };
+    uint8 *currentBytes = reinterpret_cast<uint8*>(&current[0]);
+    uint8 *previousBytes = reinterpret_cast<uint8*>(&previous[0]);
+    bool ok = test.Initialise(2u, 32u);
+    if (ok) {
+        ok = test.AddChangeRange(0u, 0u, 4u);
+    }
+    if (ok) {
+        ok = test.AddChangeRange(1u, 8u, 4u);
+    }
+    if (ok) {
+        ok = test.AddNonZeroRange(0u, 16u, 4u);
+    }
+    if (ok) {
+        ok = test.AddNonZeroRange(1u, 24u, 4u);
+    }
+    test.SetActive(0u, false);
+    test.SetActive(1u, false);
+    if (ok) {
+        currentBytes[25] = 2u;
+        previousBytes[25] = 2u;
+        test.Update(currentBytes, previousBytes);
+        const uint32 expected[] = { 1u };
+        ok = DoubleHandshakeChangeMaskTestCheck(test, &expected[0], 1u);
+    }
+    if (ok) {
+        currentBytes[25] = 0u;
+        test.Update(currentBytes, previousBytes);
+        ok = DoubleHandshakeChangeMaskTestCheck(test, NULL_PTR(uint32*), 0u);
+    }
+    return ok;
+}
+
+bool DoubleHandshakeChangeMaskTest::TestSetActive() {
+    DoubleHandshakeChangeMask test;
+    uint64 current[1] = { 0u };
+    uint64 previous[1] = { 0u };
+    uint8 *currentBytes = reinterpret_cast<uint8*>(&current[0]);
+    uint8 *previousBytes = reinterpret_cast<uint8*>(&previous[0]);
+    bool ok = test.Initialise(3u, 8u);
+    for (uint32 i = 0u; (i < 3u) && (ok); i++) {
+        ok = test.AddChangeRange(i, i, 1u);
+    }
+    test.SetActive(0u, false);
+    test.SetActive(2u, false);
+    //out of bounds, ignored
+    test.SetActive(3u, true);
+    if (ok) {
+        test.Update(currentBytes, previousBytes);
+        const uint32 expected[] = { 1u };
+        ok = DoubleHandshakeChangeMaskTestCheck(test, &expected[0], 1u);
+    }
+    if (ok) {
+        test.Update(currentBytes, previousBytes);
+        const uint32 expected[] = { 1u };
+        ok = DoubleHandshakeChangeMaskTestCheck(test, &expected[0], 1u);
+    }
+    if (ok) {
+        test.SetActive(1u, false);
+        test.SetActive(2u, true);
+        test.Update(currentBytes, previousBytes);
+        const uint32 expected[] = { 2u };
+        ok = DoubleHandshakeChangeMaskTestCheck(test, &expected[0], 1u);
+    }
+    return ok;
+}
+
+bool DoubleHandshakeChangeMaskTest::TestGetNextChannel_ManyChannels() {
+    const uint32 numberOfChannels = 100u;
+    DoubleHandshakeChangeMask test;
+    uint64 current[numberOfChannels];
+    uint64 previous[numberOfChannels];
+    uint8 *currentBytes = reinterpret_cast<uint8*>(&current[0]);
+    uint8 *previousBytes = reinterpret_cast<uint8*>(&previous[0]);
+    (void) MemoryOperationsHelper::Set(currentBytes, '\0', static_cast<uint32>(sizeof(current)));
+    (void) MemoryOperationsHelper::Set(previousBytes, '\0', static_cast<uint32>(sizeof(previous)));
+    bool ok = test.Initialise(numberOfChannels, static_cast<uint32>(sizeof(current)));
+    for (uint32 i = 0u; (i < numberOfChannels) && (ok); i++) {
+        ok = test.AddChangeRange(i, i * static_cast<uint32>(sizeof(uint64)), static_cast<uint32>(sizeof(uint64)));
+    }
+    if (ok) {
+        test.Update(currentBytes, previousBytes);
+        uint32 channel = 0u;
+        uint32 n = 0u;
+        while ((ok) && (test.GetNextChannel(channel))) {
+            ok = (channel == n);
+            test.SetActive(channel, false);
+            n++;
+        }
+        if (ok) {
+            ok = (n == numberOfChannels);
+        }
+    }
+    if (ok) {
+        current[31] = 1u;
+        current[32] = 1u;
+        current[99] = 1u;
+        test.Update(currentBytes, previousBytes);
+        const uint32 expected[] = { 31u, 32u, 99u };
+        ok = DoubleHandshakeChangeMaskTestCheck(test, &expected[0], 3u);
+    }
+    return ok;
+}
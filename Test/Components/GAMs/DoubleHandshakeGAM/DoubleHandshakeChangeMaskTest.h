@@ -0,0 +1,101 @@
+/**
+ * @file DoubleHandshakeChangeMaskTest.h
+ * @brief Header file for class DoubleHandshakeChangeMaskTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class DoubleHandshakeChangeMaskTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef TEST_COMPONENTS_GAMS_DOUBLEHANDSHAKEGAM_DOUBLEHANDSHAKECHANGEMASKTEST_H_
+#define TEST_COMPONENTS_GAMS_DOUBLEHANDSHAKEGAM_DOUBLEHANDSHAKECHANGEMASKTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "DoubleHandshakeChangeMask.h"
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests the DoubleHandshakeChangeMask public methods.
+ */
+class DoubleHandshakeChangeMaskTest {
+public:
+    /**
+    * @brief Tests the constructor
+    */
+    bool TestConstructor();
+
+    /**
+    * @brief Tests that Initialise selects all the channels in the first cycle
+    */
+    bool TestInitialise();
+
+    /**
+    * @brief Tests that Initialise fails if called twice
+    */
+    bool TestInitialise_False_Twice();
+
+    /**
+    * @brief Tests that a change of a range selects only its channel
+    */
+    bool TestAddChangeRange();
+
+    /**
+    * @brief Tests that AddChangeRange fails with an invalid channel or range
+    */
+    bool TestAddChangeRange_False_OutOfBounds();
+
+    /**
+    * @brief Tests the ranges of different channels sharing the same word
+    */
+    bool TestAddChangeRange_SharedWord();
+
+    /**
+    * @brief Tests a range in the last partial word of the buffers
+    */
+    bool TestAddChangeRange_PartialWord();
+
+    /**
+    * @brief Tests that a non-zero range selects its channel
+    */
+    bool TestAddNonZeroRange();
+
+    /**
+    * @brief Tests that the active channels are selected at each cycle
+    */
+    bool TestSetActive();
+
+    /**
+    * @brief Tests GetNextChannel with more channels than the bits of a mask word
+    */
+    bool TestGetNextChannel_ManyChannels();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* TEST_COMPONENTS_GAMS_DOUBLEHANDSHAKEGAM_DOUBLEHANDSHAKECHANGEMASKTEST_H_ */
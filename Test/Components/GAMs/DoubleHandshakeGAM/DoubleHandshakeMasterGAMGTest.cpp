@@ -156,6 +156,21 @@ TEST(DoubleHandshakeMasterGAMGTest,TestExecute_DoubleCycle) {
     ASSERT_TRUE(test.TestExecute_DoubleCycle());
 }
 
+TEST(DoubleHandshakeMasterGAMGTest,TestExecute_Benchmark10) {
+    DoubleHandshakeMasterGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Benchmark10());
+}
+
+TEST(DoubleHandshakeMasterGAMGTest,TestExecute_Benchmark100) {
+    DoubleHandshakeMasterGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Benchmark100());
+}
+
+TEST(DoubleHandshakeMasterGAMGTest,TestExecute_Benchmark2000) {
+    DoubleHandshakeMasterGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Benchmark2000());
+}
+
 /*
 TEST(DoubleHandshakeMasterGAMGTest,TestExecute_Interactive) {
     DoubleHandshakeMasterGAMTest test;
@@ -5574,6 +5574,156 @@ bool DoubleHandshakeMasterGAMTest::TestExecute_InteractiveManual() {
     return ret;
 }
 
+bool DoubleHandshakeMasterGAMTest::TestExecute_Benchmark(const uint32 numberOfCommands) {
+    const char8 *configTemplate = ""
+            "$Application = {"
+            "   Class = RealTimeApplication"
+            "   +Functions = {"
+            "       Class = ReferenceContainer"
+            "       +FC2PLC = {"
+            "           Class = DoubleHandShakeMasterGAMTestGAM"
+            "           InputSignals = {"
+            "               CommandIn = {"
+            "                   Type = uint32"
+            "                   NumberOfElements = %u"
+            "               }"
+            "               AckIn = {"
+            "                   Type = uint32"
+            "                   NumberOfElements = %u"
+            "               }"
+            "               ClearIn = {"
+            "                   Type = uint32"
+            "                   NumberOfElements = %u"
+            "               }"
+            "           }"
+            "           OutputSignals = {"
+            "               CommandOut = {"
+            "                   Type = uint32"
+            "                   NumberOfElements = %u"
+            "               }"
+            "               InternalState = {"
+            "                   Type = uint8"
+            "                   NumberOfElements = %u"
+            "               }"
+            "           }"
+            "       }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "            AllowNoProducers = 1"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Idle = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = { FC2PLC }"
+            "                }"
+            "            }"
+            "         }"
+            "     }"
+            "     +Scheduler = {"
+            "         Class = GAMScheduler"
+            "         TimingDataSource = Timings"
+            "     }"
+            "}";
+    StreamString config;
+    bool ret = config.Printf(configTemplate, numberOfCommands, numberOfCommands, numberOfCommands, numberOfCommands, numberOfCommands);
+    if (ret) {
+        ret = InitialiseMemoryMapInputBrokerEnviroment(config.Buffer());
+    }
+    ReferenceT<DoubleHandShakeMasterGAMTestGAM> dhGAM;
+    if (ret) {
+        dhGAM = ObjectRegistryDatabase::Instance()->Find("Application.Functions.FC2PLC");
+        ret = dhGAM.IsValid();
+    }
+    uint32 *commandIn = NULL_PTR(uint32*);
+    uint32 *ackIn = NULL_PTR(uint32*);
+    uint32 *commandOut = NULL_PTR(uint32*);
+    uint8 *internalState = NULL_PTR(uint8*);
+    if (ret) {
+        commandIn = reinterpret_cast<uint32*>(dhGAM->GetInputMemoryX());
+        ackIn = &commandIn[numberOfCommands];
+        (void) MemoryOperationsHelper::Set(commandIn, '\0', 3u * numberOfCommands * sizeof(uint32));
+        commandOut = reinterpret_cast<uint32*>(dhGAM->GetOutputMemoryX());
+        internalState = reinterpret_cast<uint8*>(&commandOut[numberOfCommands]);
+    }
+
+    //one command at a time goes through the handshake while all the others are idle
+    const uint32 numberOfRounds = 20u;
+    const uint32 maxCyclesPerRound = 10u;
+    const uint32 numberOfIdleCycles = 1000u;
+    uint64 handshakeTicks = 0ull;
+    uint32 numberOfHandshakeCycles = 0u;
+    for (uint32 r = 0u; (r < numberOfRounds) && (ret); r++) {
+        uint32 channel = ((r * 7u) % numberOfCommands);
+        commandIn[channel] = (r + 1u);
+        bool ready = false;
+        for (uint32 c = 0u; (c < maxCyclesPerRound) && (ret) && (!ready); c++) {
+            uint64 start = HighResolutionTimer::Counter();
+            ret = dhGAM->Execute();
+            handshakeTicks += (HighResolutionTimer::Counter() - start);
+            numberOfHandshakeCycles++;
+            //the PLC acks the commands on the next cycle
+            (void) MemoryOperationsHelper::Copy(ackIn, commandOut, numberOfCommands * sizeof(uint32));
+            ready = (c > 0u);
+            for (uint32 i = 0u; (i < numberOfCommands) && (ready); i++) {
+                ready = (internalState[i] == 0u);
+            }
+        }
+        if (ret) {
+            ret = ready;
+        }
+        if (ret) {
+            commandIn[channel] = 0u;
+            ret = dhGAM->Execute();
+        }
+    }
+
+    uint64 idleTicks = 0ull;
+    if (ret) {
+        uint64 start = HighResolutionTimer::Counter();
+        for (uint32 c = 0u; (c < numberOfIdleCycles) && (ret); c++) {
+            ret = dhGAM->Execute();
+        }
+        idleTicks = (HighResolutionTimer::Counter() - start);
+    }
+    for (uint32 i = 0u; (i < numberOfCommands) && (ret); i++) {
+        ret = (internalState[i] == 0u);
+    }
+    if (ret) {
+        float64 handshakeUs = (static_cast<float64>(handshakeTicks) * HighResolutionTimer::Period() * 1e6) / static_cast<float64>(numberOfHandshakeCycles);
+        float64 idleUs = (static_cast<float64>(idleTicks) * HighResolutionTimer::Period() * 1e6) / static_cast<float64>(numberOfIdleCycles);
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "DoubleHandshakeMasterGAM with %d commands: %f us per cycle with one handshake, %f us per idle cycle",
+                            numberOfCommands, handshakeUs, idleUs);
+    }
+
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool DoubleHandshakeMasterGAMTest::TestExecute_Benchmark10() {
+    return TestExecute_Benchmark(10u);
+}
+
+bool DoubleHandshakeMasterGAMTest::TestExecute_Benchmark100() {
+    return TestExecute_Benchmark(100u);
+}
+
+bool DoubleHandshakeMasterGAMTest::TestExecute_Benchmark2000() {
+    return TestExecute_Benchmark(2000u);
+}
+
 bool DoubleHandshakeMasterGAMTest::TestInitialise() {
     return TestExecute();
 }
@@ -170,6 +170,27 @@ public:
     */
     bool TestExecute_InteractiveManual();
 
+    /**
+    * @brief Measures the time of the execution with \a numberOfCommands commands, where all but one command are idle,
+    * and checks that all the handshakes complete.
+    */
+    bool TestExecute_Benchmark(const uint32 numberOfCommands);
+
+    /**
+    * @brief TestExecute_Benchmark with 10 commands
+    */
+    bool TestExecute_Benchmark10();
+
+    /**
+    * @brief TestExecute_Benchmark with 100 commands
+    */
+    bool TestExecute_Benchmark100();
+
+    /**
+    * @brief TestExecute_Benchmark with 2000 commands
+    */
+    bool TestExecute_Benchmark2000();
+
     /**
     * @brief Same as TestExecute() where the Initialise function is called
     */
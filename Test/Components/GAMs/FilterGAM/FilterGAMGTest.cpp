@@ -309,6 +309,96 @@ TEST(FilterGAMGTest,TestResetOnlyWhenRequiredMemoryNotInit) {
     ASSERT_TRUE(test.TestResetOnlyWhenRequiredMemoryNotInit());
 }
 
+TEST(FilterGAMGTest,TestInitialiseSOS) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseSOS());
+}
+
+TEST(FilterGAMGTest,TestInitialiseSOSOneSection) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseSOSOneSection());
+}
+
+TEST(FilterGAMGTest,TestInitialiseWrongStructure) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseWrongStructure());
+}
+
+TEST(FilterGAMGTest,TestInitialiseSOSNoSOS) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseSOSNoSOS());
+}
+
+TEST(FilterGAMGTest,TestInitialiseSOSWrongNumberOfCoefficients) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseSOSWrongNumberOfCoefficients());
+}
+
+TEST(FilterGAMGTest,TestInitialiseSOSA0Zero) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseSOSA0Zero());
+}
+
+TEST(FilterGAMGTest,TestSetupSOSFloat64) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestSetupSOSFloat64());
+}
+
+TEST(FilterGAMGTest,TestSetupDirectFormFloat64) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestSetupDirectFormFloat64());
+}
+
+TEST(FilterGAMGTest,TestSetupSOSWrongType) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestSetupSOSWrongType());
+}
+
+TEST(FilterGAMGTest,TestExecuteSOSFloat32) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteSOSFloat32());
+}
+
+TEST(FilterGAMGTest,TestExecuteSOSFloat64) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteSOSFloat64());
+}
+
+TEST(FilterGAMGTest,TestExecuteSOSEqualsDirectForm) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteSOSEqualsDirectForm());
+}
+
+TEST(FilterGAMGTest,TestAlwaysResetSOS) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestAlwaysResetSOS());
+}
+
+TEST(FilterGAMGTest,TestExecuteAVG10ShortBlocks) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteAVG10ShortBlocks());
+}
+
+TEST(FilterGAMGTest,TestSetupFFT) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestSetupFFT());
+}
+
+TEST(FilterGAMGTest,TestSetupFFTBelowThreshold) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestSetupFFTBelowThreshold());
+}
+
+TEST(FilterGAMGTest,TestSetupFFTIIR) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestSetupFFTIIR());
+}
+
+TEST(FilterGAMGTest,TestExecuteFFTEqualsTimeDomain) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteFFTEqualsTimeDomain());
+}
+
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -215,6 +215,31 @@ public:CLASS_REGISTER_DECLARATION()
         return ret;
     }
 
+    bool InitialiseFilterFIRLong(const MARTe::uint32 nOfCoefficients,
+                                 const MARTe::uint32 fftThreshold) {
+        bool ret = true;
+        if (isInitialised == false) {
+            numH = new MARTe::float32[nOfCoefficients];
+            for (MARTe::uint32 i = 0u; i < nOfCoefficients; i++) {
+                //Decaying alternated coefficients
+                numH[i] = ((i % 2u) == 0u) ? (1.0F / static_cast<MARTe::float32>(i + 1u)) : (-0.5F / static_cast<MARTe::float32>(i + 1u));
+            }
+            denH = new MARTe::float32[1];
+            denH[0] = 1.0F;
+            MARTe::Vector<MARTe::float32> numVec(numH, nOfCoefficients);
+            MARTe::Vector<MARTe::float32> denVec(denH, 1);
+            ret &= config.Write("Num", numVec);
+            ret &= config.Write("Den", denVec);
+            ret &= config.Write("ResetInEachState", 0);
+            ret &= config.Write("FFTThreshold", fftThreshold);
+            isInitialised = ret;
+        }
+        else {
+            ret = false;
+        }
+        return ret;
+    }
+
     bool IsInitialised() {
         return isInitialised;
     }
@@ -467,6 +492,112 @@ public:CLASS_REGISTER_DECLARATION()
         return ok;
     }
 
+    bool InitialiseFilterSOS() {
+        bool ret = true;
+        if (isInitialised == false) {
+            //Integrator followed by a 2 taps average
+            MARTe::float64 sosH[2][6] = { { 1.0, 0.0, 0.0, 1.0, -1.0, 0.0 }, { 0.5, 0.5, 0.0, 1.0, 0.0, 0.0 } };
+            MARTe::Matrix<MARTe::float64> sosMat(&sosH[0][0], 2u, 6u);
+            ret &= config.Write("Structure", "SOS");
+            ret &= config.Write("SOS", sosMat);
+            ret &= config.Write("ResetInEachState", 0);
+            isInitialised = ret;
+        }
+        else {
+            ret = false;
+        }
+        return ret;
+    }
+
+    bool InitialiseFilterSOSIIR2() {
+        bool ret = true;
+        if (isInitialised == false) {
+            //Same filter as InitialiseFilterIIR2() but not normalised and with the gain outside
+            MARTe::float64 sosH[6] = { 0.4, 0.8, 1.2, 2.0, 1.0, 0.4 };
+            MARTe::Vector<MARTe::float64> sosVec(&sosH[0], 6u);
+            ret &= config.Write("Structure", "SOS");
+            ret &= config.Write("SOS", sosVec);
+            ret &= config.Write("Gain", 0.5);
+            ret &= config.Write("ResetInEachState", 0);
+            isInitialised = ret;
+        }
+        else {
+            ret = false;
+        }
+        return ret;
+    }
+
+    bool InitialiseConfigDataBaseSignalType(const MARTe::char8 * const typeName,
+                                            const MARTe::uint32 typeSize,
+                                            const MARTe::uint32 numberOfSignals) {
+        using namespace MARTe;
+        bool ok = true;
+        uint32 signalByteSize = numberOfElements * typeSize;
+        uint32 totalByteSize = signalByteSize * numberOfSignals;
+        ok &= configSignals.CreateAbsolute("Signals.InputSignals");
+        for (uint32 i = 0u; i < numberOfSignals; i++) {
+            StreamString idx;
+            idx.Printf("%u", i);
+            ok &= configSignals.MoveAbsolute("Signals.InputSignals");
+            ok &= configSignals.CreateRelative(idx.Buffer());
+            StreamString qualifiedName;
+            qualifiedName.Printf("InputSignal%u", i + 1u);
+            ok &= configSignals.Write("QualifiedName", qualifiedName.Buffer());
+            ok &= configSignals.Write("DataSource", "TestDataSource");
+            ok &= configSignals.Write("Type", typeName);
+            ok &= configSignals.Write("NumberOfDimensions", 1);
+            ok &= configSignals.Write("NumberOfElements", numberOfElements);
+            ok &= configSignals.Write("ByteSize", signalByteSize);
+        }
+        ok &= configSignals.MoveAbsolute("Signals.InputSignals");
+        ok &= configSignals.Write("ByteSize", totalByteSize);
+
+        ok &= configSignals.CreateAbsolute("Signals.OutputSignals");
+        for (uint32 i = 0u; i < numberOfSignals; i++) {
+            StreamString idx;
+            idx.Printf("%u", i);
+            ok &= configSignals.MoveAbsolute("Signals.OutputSignals");
+            ok &= configSignals.CreateRelative(idx.Buffer());
+            StreamString qualifiedName;
+            qualifiedName.Printf("OutputSignal%u", i + 1u);
+            ok &= configSignals.Write("QualifiedName", qualifiedName.Buffer());
+            ok &= configSignals.Write("DataSource", "TestDataSource");
+            ok &= configSignals.Write("Type", typeName);
+            ok &= configSignals.Write("NumberOfDimensions", 1);
+            ok &= configSignals.Write("NumberOfElements", numberOfElements);
+            ok &= configSignals.Write("ByteSize", signalByteSize);
+        }
+        ok &= configSignals.MoveAbsolute("Signals.OutputSignals");
+        ok &= configSignals.Write("ByteSize", totalByteSize);
+
+        ok &= configSignals.CreateAbsolute("Memory.InputSignals");
+        ok &= configSignals.CreateRelative("0");
+        ok &= configSignals.Write("DataSource", "TestDataSource");
+        ok &= configSignals.CreateRelative("Signals");
+        for (uint32 i = 0u; i < numberOfSignals; i++) {
+            StreamString idx;
+            idx.Printf("%u", i);
+            ok &= configSignals.MoveAbsolute("Memory.InputSignals.0.Signals");
+            ok &= configSignals.CreateRelative(idx.Buffer());
+            ok &= configSignals.Write("Samples", 1);
+        }
+
+        ok &= configSignals.CreateAbsolute("Memory.OutputSignals");
+        ok &= configSignals.CreateRelative("0");
+        ok &= configSignals.Write("DataSource", "TestDataSource");
+        ok &= configSignals.CreateRelative("Signals");
+        for (uint32 i = 0u; i < numberOfSignals; i++) {
+            StreamString idx;
+            idx.Printf("%u", i);
+            ok &= configSignals.MoveAbsolute("Memory.OutputSignals.0.Signals");
+            ok &= configSignals.CreateRelative(idx.Buffer());
+            ok &= configSignals.Write("Samples", 1);
+        }
+
+        ok &= configSignals.MoveToRoot();
+        return ok;
+    }
+
     MARTe::uint32 numberOfElements;
     MARTe::uint32 numberOfSamples;
     MARTe::uint32 byteSize;
@@ -3156,6 +3287,402 @@ bool FilterGAMTest::TestResetOnlyWhenRequiredMemoryNotInit() {
     return ok;
 }
 
+bool FilterGAMTest::TestInitialiseSOS() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = gam.InitialiseFilterSOS();
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.IsSOSStructure();
+    ok &= (gam.GetNumberOfSections() == 2u);
+    ok &= (gam.GetNumberOfNumCoeff() == 0u);
+    ok &= (gam.GetNumberOfDenCoeff() == 0u);
+    ok &= !gam.GetResetInEachState();
+    //The integrator has infinite static gain
+    bool isInfinite;
+    (void) gam.GetStaticGain(isInfinite);
+    ok &= isInfinite;
+    return ok;
+}
+
+bool FilterGAMTest::TestInitialiseSOSOneSection() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = gam.InitialiseFilterSOSIIR2();
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.IsSOSStructure();
+    ok &= (gam.GetNumberOfSections() == 1u);
+    bool isInfinite;
+    ok &= MyIsEqual(gam.GetStaticGain(isInfinite), 0.6F / 1.7F);
+    ok &= !isInfinite;
+    return ok;
+}
+
+bool FilterGAMTest::TestInitialiseWrongStructure() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = gam.config.Write("Structure", "Lattice");
+    ok &= gam.InitialiseFilterFIR();
+    ok &= !gam.Initialise(gam.config);
+    return ok;
+}
+
+bool FilterGAMTest::TestInitialiseSOSNoSOS() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = gam.config.Write("Structure", "SOS");
+    ok &= gam.InitialiseFilterFIR();
+    ok &= !gam.Initialise(gam.config);
+    return ok;
+}
+
+bool FilterGAMTest::TestInitialiseSOSWrongNumberOfCoefficients() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    gam.SetName("Test");
+    float64 sosH[2][5] = { { 1.0, 0.0, 0.0, 1.0, -1.0 }, { 0.5, 0.5, 0.0, 1.0, 0.0 } };
+    Matrix<float64> sosMat(&sosH[0][0], 2u, 5u);
+    bool ok = gam.config.Write("Structure", "SOS");
+    ok &= gam.config.Write("SOS", sosMat);
+    ok &= !gam.Initialise(gam.config);
+    return ok;
+}
+
+bool FilterGAMTest::TestInitialiseSOSA0Zero() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    gam.SetName("Test");
+    float64 sosH[2][6] = { { 1.0, 0.0, 0.0, 1.0, -1.0, 0.0 }, { 0.5, 0.5, 0.0, 0.0, 0.0, 0.0 } };
+    Matrix<float64> sosMat(&sosH[0][0], 2u, 6u);
+    bool ok = gam.config.Write("Structure", "SOS");
+    ok &= gam.config.Write("SOS", sosMat);
+    ok &= !gam.Initialise(gam.config);
+    return ok;
+}
+
+bool FilterGAMTest::TestSetupSOSFloat64() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = gam.InitialiseFilterSOS();
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.InitialiseConfigDataBaseSignalType("float64", sizeof(float64), 3u);
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+    ok &= gam.Setup();
+    ok &= (gam.GetNumberOfSignals() == 3u);
+    ok &= (gam.GetNumberOfSamples() == gam.numberOfElements);
+    return ok;
+}
+
+bool FilterGAMTest::TestSetupDirectFormFloat64() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = gam.InitialiseFilterFIR();
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.InitialiseConfigDataBaseSignalType("float64", sizeof(float64), 1u);
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+    ok &= !gam.Setup();
+    return ok;
+}
+
+bool FilterGAMTest::TestSetupSOSWrongType() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = gam.InitialiseFilterSOS();
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.InitialiseConfigDataBaseSignalType("int32", sizeof(int32), 1u);
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+    ok &= !gam.Setup();
+    return ok;
+}
+
+bool FilterGAMTest::TestExecuteSOSFloat32() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    gam.SetName("Test");
+    const uint32 numberOfSignals = 5u;
+    bool ok = gam.InitialiseFilterSOS();
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.InitialiseConfigDataBaseSignalType("float32", sizeof(float32), numberOfSignals);
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+    ok &= gam.Setup();
+    for (uint32 s = 0u; (s < numberOfSignals) && (ok); s++) {
+        float32 *in = static_cast<float32*>(gam.GetInputSignalsMemory(s));
+        for (uint32 i = 0u; i < gam.numberOfElements; i++) {
+            in[i] = static_cast<float32>(s + 1u);
+        }
+    }
+    if (ok) {
+        ok &= gam.Execute();
+    }
+    //Integrator and average of the last 2 outputs of the integrator
+    for (uint32 s = 0u; (s < numberOfSignals) && (ok); s++) {
+        float32 *out = static_cast<float32*>(gam.GetOutputSignalsMemory(s));
+        for (uint32 i = 0u; i < gam.numberOfElements; i++) {
+            ok &= (out[i] == ((i + 0.5F) * static_cast<float32>(s + 1u)));
+        }
+    }
+    if (ok) {
+        ok &= gam.Execute();
+    }
+    for (uint32 s = 0u; (s < numberOfSignals) && (ok); s++) {
+        float32 *out = static_cast<float32*>(gam.GetOutputSignalsMemory(s));
+        for (uint32 i = 0u; i < gam.numberOfElements; i++) {
+            ok &= (out[i] == ((gam.numberOfElements + i + 0.5F) * static_cast<float32>(s + 1u)));
+        }
+    }
+    return ok;
+}
+
+bool FilterGAMTest::TestExecuteSOSFloat64() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    gam.SetName("Test");
+    const uint32 numberOfSignals = 3u;
+    bool ok = gam.InitialiseFilterSOS();
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.InitialiseConfigDataBaseSignalType("float64", sizeof(float64), numberOfSignals);
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+    ok &= gam.Setup();
+    for (uint32 s = 0u; (s < numberOfSignals) && (ok); s++) {
+        float64 *in = static_cast<float64*>(gam.GetInputSignalsMemory(s));
+        for (uint32 i = 0u; i < gam.numberOfElements; i++) {
+            in[i] = static_cast<float64>(s + 1u);
+        }
+    }
+    if (ok) {
+        ok &= gam.Execute();
+    }
+    for (uint32 s = 0u; (s < numberOfSignals) && (ok); s++) {
+        float64 *out = static_cast<float64*>(gam.GetOutputSignalsMemory(s));
+        for (uint32 i = 0u; i < gam.numberOfElements; i++) {
+            ok &= (out[i] == ((i + 0.5) * static_cast<float64>(s + 1u)));
+        }
+    }
+    return ok;
+}
+
+bool FilterGAMTest::TestExecuteSOSEqualsDirectForm() {
+    using namespace MARTe;
+    FilterGAMTestHelper gamDF;
+    gamDF.SetName("TestDF");
+    bool ok = gamDF.InitialiseFilterIIR2();
+    ok &= gamDF.Initialise(gamDF.config);
+    ok &= gamDF.InitialiseConfigDataBaseSignal1();
+    ok &= gamDF.SetConfiguredDatabase(gamDF.configSignals);
+    ok &= gamDF.AllocateInputSignalsMemory();
+    ok &= gamDF.AllocateOutputSignalsMemory();
+    ok &= gamDF.Setup();
+
+    FilterGAMTestHelper gamSOS;
+    gamSOS.SetName("TestSOS");
+    ok &= gamSOS.InitialiseFilterSOSIIR2();
+    ok &= gamSOS.Initialise(gamSOS.config);
+    ok &= gamSOS.InitialiseConfigDataBaseSignalType("float32", sizeof(float32), 1u);
+    ok &= gamSOS.SetConfiguredDatabase(gamSOS.configSignals);
+    ok &= gamSOS.AllocateInputSignalsMemory();
+    ok &= gamSOS.AllocateOutputSignalsMemory();
+    ok &= gamSOS.Setup();
+
+    float32 *inDF = static_cast<float32*>(gamDF.GetInputSignalsMemory());
+    float32 *outDF = static_cast<float32*>(gamDF.GetOutputSignalsMemory());
+    float32 *inSOS = static_cast<float32*>(gamSOS.GetInputSignalsMemory());
+    float32 *outSOS = static_cast<float32*>(gamSOS.GetOutputSignalsMemory());
+    for (uint32 k = 0u; (k < 3u) && (ok); k++) {
+        for (uint32 i = 0u; i < gamDF.numberOfElements; i++) {
+            inDF[i] = static_cast<float32>((k * gamDF.numberOfElements) + i);
+            inSOS[i] = inDF[i];
+        }
+        ok &= gamDF.Execute();
+        ok &= gamSOS.Execute();
+        for (uint32 i = 0u; i < gamDF.numberOfElements; i++) {
+            ok &= MyIsEqual(outDF[i], outSOS[i]);
+        }
+    }
+    return ok;
+}
+
+bool FilterGAMTest::TestAlwaysResetSOS() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = gam.InitialiseFilterSOS();
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.InitialiseConfigDataBaseSignalType("float32", sizeof(float32), 2u);
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+    ok &= gam.Setup();
+    float32 *in = static_cast<float32*>(gam.GetInputSignalsMemory(1u));
+    float32 *out = static_cast<float32*>(gam.GetOutputSignalsMemory(1u));
+    for (uint32 i = 0u; i < gam.numberOfElements; i++) {
+        in[i] = 1.0F;
+    }
+    for (uint32 k = 0u; (k < 2u) && (ok); k++) {
+        //Different states: the filter must be reset (ResetInEachState = 0 but the filter was not executed in the previous state)
+        ok &= gam.PrepareNextState((k == 0u) ? "" : "B", (k == 0u) ? "A" : "C");
+        ok &= gam.Execute();
+        for (uint32 i = 0u; i < gam.numberOfElements; i++) {
+            ok &= (out[i] == (i + 0.5F));
+        }
+    }
+    return ok;
+}
+
+bool FilterGAMTest::TestExecuteAVG10ShortBlocks() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam(3u, 1u);
+    gam.SetName("Test");
+    bool ok = true;
+
+    ok &= gam.InitialiseAVG10();
+    ok &= gam.Initialise(gam.config);
+
+    ok &= gam.InitialiseConfigDataBaseSignal1();
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+
+    ok &= gam.Setup();
+
+    float32 *gamMemoryIn = static_cast<float32*>(gam.GetInputSignalsMemory());
+    float32 *gamMemoryOut = static_cast<float32*>(gam.GetOutputSignalsMemory());
+    //Ramp split in blocks of 3 samples (i.e. less than the 9 past inputs needed by the filter).
+    uint32 t = 0u;
+    for (uint32 k = 0u; (k < 5u) && (ok); k++) {
+        for (uint32 i = 0u; i < gam.numberOfElements; i++) {
+            gamMemoryIn[i] = static_cast<float32>(t + i);
+        }
+        ok &= gam.Execute();
+        for (uint32 i = 0u; i < gam.numberOfElements; i++) {
+            float32 expected = 0.0F;
+            for (uint32 j = 0u; (j < 10u) && (j <= t); j++) {
+                expected += static_cast<float32>(t - j);
+            }
+            ok &= MyIsEqual(gamMemoryOut[i], expected / 10.0F);
+            t++;
+        }
+    }
+    return ok;
+}
+
+bool FilterGAMTest::TestSetupFFT() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam(100u, 1u);
+    gam.SetName("Test");
+    bool ok = gam.InitialiseFilterFIRLong(29u, 2900u);
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.InitialiseConfigDataBaseSignal1();
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+    ok &= gam.Setup();
+    //28 previous samples + 100 new samples
+    ok &= (gam.GetFFTSize() == 128u);
+    return ok;
+}
+
+bool FilterGAMTest::TestSetupFFTBelowThreshold() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam(100u, 1u);
+    gam.SetName("Test");
+    bool ok = gam.InitialiseFilterFIRLong(29u, 2901u);
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.InitialiseConfigDataBaseSignal1();
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+    ok &= gam.Setup();
+    ok &= (gam.GetFFTSize() == 0u);
+    return ok;
+}
+
+bool FilterGAMTest::TestSetupFFTIIR() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam(100u, 1u);
+    gam.SetName("Test");
+    bool ok = gam.InitialiseFilterIIR2();
+    ok &= gam.config.Write("FFTThreshold", 1);
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.InitialiseConfigDataBaseSignal1();
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+    ok &= gam.Setup();
+    ok &= (gam.GetFFTSize() == 0u);
+    return ok;
+}
+
+bool FilterGAMTest::TestExecuteFFTEqualsTimeDomain() {
+    using namespace MARTe;
+    const uint32 nOfElements = 50u;
+    const uint32 nOfCoefficients = 80u;
+    FilterGAMTestHelper gamTD(nOfElements, 1u);
+    gamTD.SetName("TestTD");
+    bool ok = gamTD.InitialiseFilterFIRLong(nOfCoefficients, 0u);
+    ok &= gamTD.Initialise(gamTD.config);
+    ok &= gamTD.InitialiseConfigDataBaseSignal2();
+    ok &= gamTD.SetConfiguredDatabase(gamTD.configSignals);
+    ok &= gamTD.AllocateInputSignalsMemory();
+    ok &= gamTD.AllocateOutputSignalsMemory();
+    ok &= gamTD.Setup();
+    ok &= (gamTD.GetFFTSize() == 0u);
+
+    FilterGAMTestHelper gamFFT(nOfElements, 1u);
+    gamFFT.SetName("TestFFT");
+    ok &= gamFFT.InitialiseFilterFIRLong(nOfCoefficients, 1u);
+    ok &= gamFFT.Initialise(gamFFT.config);
+    ok &= gamFFT.InitialiseConfigDataBaseSignal2();
+    ok &= gamFFT.SetConfiguredDatabase(gamFFT.configSignals);
+    ok &= gamFFT.AllocateInputSignalsMemory();
+    ok &= gamFFT.AllocateOutputSignalsMemory();
+    ok &= gamFFT.Setup();
+    ok &= (gamFFT.GetFFTSize() == 256u);
+
+    //The filter history (79 samples) spans more than one cycle
+    for (uint32 k = 0u; (k < 5u) && (ok); k++) {
+        if (k == 3u) {
+            //Both must be reset
+            ok &= gamTD.PrepareNextState("B", "C");
+            ok &= gamFFT.PrepareNextState("B", "C");
+        }
+        for (uint32 s = 0u; s < 2u; s++) {
+            float32 *inTD = static_cast<float32*>(gamTD.GetInputSignalsMemory(s));
+            float32 *inFFT = static_cast<float32*>(gamFFT.GetInputSignalsMemory(s));
+            for (uint32 i = 0u; i < nOfElements; i++) {
+                inTD[i] = static_cast<float32>(((k * nOfElements) + i + (s * 7u)) % 13u) / 13.0F;
+                inFFT[i] = inTD[i];
+            }
+        }
+        ok &= gamTD.Execute();
+        ok &= gamFFT.Execute();
+        for (uint32 s = 0u; s < 2u; s++) {
+            float32 *outTD = static_cast<float32*>(gamTD.GetOutputSignalsMemory(s));
+            float32 *outFFT = static_cast<float32*>(gamFFT.GetOutputSignalsMemory(s));
+            for (uint32 i = 0u; i < nOfElements; i++) {
+                ok &= MyIsEqual(outTD[i], outFFT[i]);
+            }
+        }
+    }
+    return ok;
+}
+
 bool FilterGAMTest::MyIsEqual(MARTe::float32 f1,
                               MARTe::float32 f2) {
     MARTe::float32 epsilon = 1e-5;
@@ -434,6 +434,116 @@ public:
      * @return true if PrepareNextState() fails.
      */
     bool TestResetOnlyWhenRequiredMemoryNotInit();
+
+    /**
+     * @brief Tests the Initialise() with Structure = "SOS" and two sections.
+     * @return true if the structure and the number of sections are correctly read.
+     */
+    bool TestInitialiseSOS();
+
+    /**
+     * @brief Tests the Initialise() with Structure = "SOS", one (not normalised) section written as a vector and a Gain.
+     * @return true if the static gain is correctly computed.
+     */
+    bool TestInitialiseSOSOneSection();
+
+    /**
+     * @brief Tests the Initialise() with an invalid Structure.
+     * @return true if Initialise() fails.
+     */
+    bool TestInitialiseWrongStructure();
+
+    /**
+     * @brief Tests the Initialise() with Structure = "SOS" and without the SOS coefficients.
+     * @return true if Initialise() fails.
+     */
+    bool TestInitialiseSOSNoSOS();
+
+    /**
+     * @brief Tests the Initialise() with sections with 5 coefficients.
+     * @return true if Initialise() fails.
+     */
+    bool TestInitialiseSOSWrongNumberOfCoefficients();
+
+    /**
+     * @brief Tests the Initialise() with a section with a0 = 0.
+     * @return true if Initialise() fails.
+     */
+    bool TestInitialiseSOSA0Zero();
+
+    /**
+     * @brief Tests the Setup() with Structure = "SOS" and float64 signals.
+     * @return true if Setup() succeeds.
+     */
+    bool TestSetupSOSFloat64();
+
+    /**
+     * @brief Tests that the direct form does not accept float64 signals.
+     * @return true if Setup() fails.
+     */
+    bool TestSetupDirectFormFloat64();
+
+    /**
+     * @brief Tests the Setup() with Structure = "SOS" and int32 signals.
+     * @return true if Setup() fails.
+     */
+    bool TestSetupSOSWrongType();
+
+    /**
+     * @brief Tests the SOS filter (integrator followed by a 2 taps average) with 5 float32 signals (i.e. more than one SIMD register).
+     * @return true if the output values are as expected in two consecutive executions.
+     */
+    bool TestExecuteSOSFloat32();
+
+    /**
+     * @brief Tests the SOS filter (integrator followed by a 2 taps average) with 3 float64 signals.
+     * @return true if the output values are as expected.
+     */
+    bool TestExecuteSOSFloat64();
+
+    /**
+     * @brief Compares the output of the direct form and the SOS structure for the same second order IIR filter.
+     * @return true if the outputs are equal (within float32 precision) for three consecutive executions.
+     */
+    bool TestExecuteSOSEqualsDirectForm();
+
+    /**
+     * @brief Tests that the SOS state is reset on state change.
+     * @return true if the output after the reset is the same as the first output.
+     */
+    bool TestAlwaysResetSOS();
+
+    /**
+     * @brief Tests a 10 taps average filter fed with blocks of 3 samples per cycle.
+     * @details The history of the filter is longer than the block, so that the output depends on the inputs of several previous cycles.
+     * @return true if the output values are the average of the last 10 inputs.
+     */
+    bool TestExecuteAVG10ShortBlocks();
+
+    /**
+     * @brief Tests the Setup() of a FIR filter with FFTThreshold = number of coefficients x number of samples.
+     * @return true if the overlap-save implementation is used with the expected FFT size.
+     */
+    bool TestSetupFFT();
+
+    /**
+     * @brief Tests the Setup() of a FIR filter with FFTThreshold > number of coefficients x number of samples.
+     * @return true if the time domain implementation is used.
+     */
+    bool TestSetupFFTBelowThreshold();
+
+    /**
+     * @brief Tests the Setup() of an IIR filter with FFTThreshold.
+     * @return true if the time domain implementation is used.
+     */
+    bool TestSetupFFTIIR();
+
+    /**
+     * @brief Compares the time domain and the overlap-save implementations of a FIR filter longer than the block of samples.
+     * @details Tests 5 cycles with two signals and a reset after the third cycle.
+     * @return true if the outputs are equal (within float32 precision).
+     */
+    bool TestExecuteFFTEqualsTimeDomain();
 private:
     bool MyIsEqual(MARTe::float32 f1,
                    MARTe::float32 f2);
@@ -192,3 +192,113 @@ TEST(HistogramComparatorTGTest,TestGetNumberOfBins) {
     HistogramComparatorTTest<uint8> test;
     ASSERT_TRUE(test.TestGetNumberOfBins());
 }
+
+TEST(HistogramComparatorTGTest,TestInRange_U32_LastPartialBin) {
+    HistogramComparatorTTest<uint32> test;
+    ASSERT_TRUE(test.TestInRange(0, 10, 5, 9, 3));
+}
+
+TEST(HistogramComparatorTGTest,TestInRange_U8_SmallRange) {
+    HistogramComparatorTTest<uint8> test;
+    ASSERT_TRUE(test.TestInRange(0, 4, 12, 3, 4));
+}
+
+TEST(HistogramComparatorTGTest,TestInRange_F32_Min) {
+    HistogramComparatorTTest<float32> test;
+    ASSERT_TRUE(test.TestInRange(-1.5, 8.5, 12, -1.6, 0));
+}
+
+TEST(HistogramComparatorTGTest,TestInRange_F32_Max) {
+    HistogramComparatorTTest<float32> test;
+    ASSERT_TRUE(test.TestInRange(-1.5, 8.5, 12, 8.5, 11));
+}
+
+TEST(HistogramComparatorTGTest,TestInRange_F32_In) {
+    HistogramComparatorTTest<float32> test;
+    ASSERT_TRUE(test.TestInRange(-1.5, 8.5, 12, 3.5, 6));
+}
+
+TEST(HistogramComparatorTGTest,TestInRange_F64_Min) {
+    HistogramComparatorTTest<float64> test;
+    ASSERT_TRUE(test.TestInRange(-1.5, 8.5, 12, -1.6, 0));
+}
+
+TEST(HistogramComparatorTGTest,TestInRange_F64_Max) {
+    HistogramComparatorTTest<float64> test;
+    ASSERT_TRUE(test.TestInRange(-1.5, 8.5, 12, 8.5, 11));
+}
+
+TEST(HistogramComparatorTGTest,TestInRange_F64_In) {
+    HistogramComparatorTTest<float64> test;
+    ASSERT_TRUE(test.TestInRange(-1.5, 8.5, 12, 3.4, 5));
+}
+
+TEST(HistogramComparatorTGTest,TestAccumulate_U8) {
+    HistogramComparatorTTest<uint8> test;
+    ASSERT_TRUE(test.TestAccumulate(10, 100, 11, 1, 0, 1, 256));
+}
+
+TEST(HistogramComparatorTGTest,TestAccumulate_I8) {
+    HistogramComparatorTTest<int8> test;
+    ASSERT_TRUE(test.TestAccumulate(-10, 80, 11, 1, -128, 1, 256));
+}
+
+TEST(HistogramComparatorTGTest,TestAccumulate_U16) {
+    HistogramComparatorTTest<uint16> test;
+    ASSERT_TRUE(test.TestAccumulate(100, 1000, 13, 1, 0, 3, 1000));
+}
+
+TEST(HistogramComparatorTGTest,TestAccumulate_I16) {
+    HistogramComparatorTTest<int16> test;
+    ASSERT_TRUE(test.TestAccumulate(-100, 800, 7, 1, -1000, 3, 1000));
+}
+
+TEST(HistogramComparatorTGTest,TestAccumulate_U32) {
+    HistogramComparatorTTest<uint32> test;
+    ASSERT_TRUE(test.TestAccumulate(1000, 10000, 11, 1, 0, 17, 1000));
+}
+
+TEST(HistogramComparatorTGTest,TestAccumulate_I32) {
+    HistogramComparatorTTest<int32> test;
+    ASSERT_TRUE(test.TestAccumulate(-1000, 8003, 11, 1, -2000, 11, 1000));
+}
+
+TEST(HistogramComparatorTGTest,TestAccumulate_U64) {
+    HistogramComparatorTTest<uint64> test;
+    ASSERT_TRUE(test.TestAccumulate(1000, 10000, 101, 1, 0, 17, 1000));
+}
+
+TEST(HistogramComparatorTGTest,TestAccumulate_I64) {
+    HistogramComparatorTTest<int64> test;
+    ASSERT_TRUE(test.TestAccumulate(-1000, 8000, 11, 1, -2000, 11, 1000));
+}
+
+TEST(HistogramComparatorTGTest,TestAccumulate_F32) {
+    HistogramComparatorTTest<float32> test;
+    ASSERT_TRUE(test.TestAccumulate(0.1, 10.7, 1000, 1, -1.0, 0.013, 1000));
+}
+
+TEST(HistogramComparatorTGTest,TestAccumulate_F64) {
+    HistogramComparatorTTest<float64> test;
+    ASSERT_TRUE(test.TestAccumulate(0.1, 10.7, 1003, 1, -1.0, 0.013, 1000));
+}
+
+TEST(HistogramComparatorTGTest,TestAccumulate_Partials_U16) {
+    HistogramComparatorTTest<uint16> test;
+    ASSERT_TRUE(test.TestAccumulate(100, 1000, 13, 4, 0, 3, 1000));
+}
+
+TEST(HistogramComparatorTGTest,TestAccumulate_Partials_F32) {
+    HistogramComparatorTTest<float32> test;
+    ASSERT_TRUE(test.TestAccumulate(0.1, 10.7, 1000, 3, -1.0, 0.013, 1000));
+}
+
+TEST(HistogramComparatorTGTest,TestSetNumberOfPartialHistograms) {
+    HistogramComparatorTTest<uint8> test;
+    ASSERT_TRUE(test.TestSetNumberOfPartialHistograms());
+}
+
+TEST(HistogramComparatorTGTest,TestGetNumberOfPartialHistograms) {
+    HistogramComparatorTTest<uint8> test;
+    ASSERT_TRUE(test.TestGetNumberOfPartialHistograms());
+}
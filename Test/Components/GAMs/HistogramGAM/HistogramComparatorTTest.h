@@ -85,6 +85,28 @@ public:
                      T value,
                      uint32 expected);
 
+    /**
+     * @brief Tests the HistogramComparatorT::Accumulate method against InRange
+     * for the values first + i * step, i = 0...nValues - 1.
+     */
+    bool TestAccumulate(T min,
+                        T max,
+                        uint32 nBins,
+                        uint32 nPartials,
+                        T first,
+                        T step,
+                        uint32 nValues);
+
+    /**
+     * @brief Tests the HistogramComparatorT::SetNumberOfPartialHistograms method
+     */
+    bool TestSetNumberOfPartialHistograms();
+
+    /**
+     * @brief Tests the HistogramComparatorT::GetNumberOfPartialHistograms method
+     */
+    bool TestGetNumberOfPartialHistograms();
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -140,5 +162,66 @@ bool HistogramComparatorTTest<T>::TestInRange(T min,
 
 }
 
+template<typename T>
+bool HistogramComparatorTTest<T>::TestAccumulate(T min,
+                                                 T max,
+                                                 uint32 nBins,
+                                                 uint32 nPartials,
+                                                 T first,
+                                                 T step,
+                                                 uint32 nValues) {
+    HistogramComparatorT<T> test;
+
+    test.SetMin((void*) &min);
+    test.SetMax((void*) &max);
+    test.SetNumberOfBins(nBins);
+    test.SetNumberOfPartialHistograms(nPartials);
+
+    T *values = new T[nValues];
+    uint32 *histogram = new uint32[nBins];
+    uint32 *expected = new uint32[nBins];
+    for (uint32 j = 0u; j < nBins; j++) {
+        histogram[j] = 0u;
+        expected[j] = 0u;
+    }
+    for (uint32 i = 0u; i < nValues; i++) {
+        values[i] = static_cast<T>(first + static_cast<T>(i * step));
+        expected[test.InRange((void*) &values[i])] += 2u;
+    }
+    //Twice, to check that the partial histograms are cleared after being merged
+    test.Accumulate((void*) values, nValues, histogram);
+    test.Accumulate((void*) values, nValues, histogram);
+
+    bool ret = (test.GetNumberOfPartialHistograms() == nPartials);
+    uint32 total = 0u;
+    for (uint32 j = 0u; (j < nBins) && (ret); j++) {
+        ret = (histogram[j] == expected[j]);
+        total += histogram[j];
+    }
+    if (ret) {
+        ret = (total == (2u * nValues));
+    }
+    delete[] values;
+    delete[] histogram;
+    delete[] expected;
+    return ret;
+}
+
+template<typename T>
+bool HistogramComparatorTTest<T>::TestSetNumberOfPartialHistograms() {
+    return TestAccumulate(0, 10, 12, 4, 0, 1, 11);
+}
+
+template<typename T>
+bool HistogramComparatorTTest<T>::TestGetNumberOfPartialHistograms() {
+    HistogramComparatorT<T> test;
+    bool ret = (test.GetNumberOfPartialHistograms() == 1u);
+    test.SetNumberOfPartialHistograms(3u);
+    ret &= (test.GetNumberOfPartialHistograms() == 3u);
+    test.SetNumberOfPartialHistograms(0u);
+    ret &= (test.GetNumberOfPartialHistograms() == 1u);
+    return ret;
+}
+
 #endif /* HISTOGRAM_COMPARATORTTEST_H_ */
 
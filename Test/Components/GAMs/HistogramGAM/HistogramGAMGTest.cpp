@@ -54,6 +54,16 @@ TEST(HistogramGAMGTest,TestInitialise) {
     ASSERT_TRUE(test.TestInitialise());
 }
 
+TEST(HistogramGAMGTest,TestInitialise_NumberOfPartialHistograms) {
+    HistogramGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_NumberOfPartialHistograms());
+}
+
+TEST(HistogramGAMGTest,TestInitialise_False_NumberOfPartialHistograms) {
+    HistogramGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_False_NumberOfPartialHistograms());
+}
+
 TEST(HistogramGAMGTest,TestSetup) {
     HistogramGAMTest test;
     ASSERT_TRUE(test.TestSetup());
@@ -64,14 +74,14 @@ TEST(HistogramGAMGTest,TestSetup_DifferentInputOutputNSignals) {
     ASSERT_TRUE(test.TestSetup_DifferentInputOutputNSignals());
 }
 
-TEST(HistogramGAMGTest,TestSetup_FalseInputNotScalar) {
+TEST(HistogramGAMGTest,TestSetup_InputArray) {
     HistogramGAMTest test;
-    ASSERT_TRUE(test.TestSetup_FalseInputNotScalar());
+    ASSERT_TRUE(test.TestSetup_InputArray());
 }
 
-TEST(HistogramGAMGTest,TestSetup_FalseSamplesNotOne) {
+TEST(HistogramGAMGTest,TestSetup_InputSamples) {
     HistogramGAMTest test;
-    ASSERT_TRUE(test.TestSetup_FalseSamplesNotOne());
+    ASSERT_TRUE(test.TestSetup_InputSamples());
 }
 
 TEST(HistogramGAMGTest,TestSetup_UndefinedMaxLim) {
@@ -104,6 +114,16 @@ TEST(HistogramGAMGTest,TestExecute_BeginCycleNumber) {
     ASSERT_TRUE(test.TestExecute_BeginCycleNumber());
 }
 
+TEST(HistogramGAMGTest,TestExecute_Block) {
+    HistogramGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Block());
+}
+
+TEST(HistogramGAMGTest,TestExecute_PartialHistograms) {
+    HistogramGAMTest test;
+    ASSERT_TRUE(test.TestExecute_PartialHistograms());
+}
+
 TEST(HistogramGAMGTest,TestPrepareNextState) {
     HistogramGAMTest test;
     ASSERT_TRUE(test.TestPrepareNextState());
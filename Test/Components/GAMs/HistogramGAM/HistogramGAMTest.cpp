@@ -63,6 +63,10 @@ HistogramGAMTestGAM    ();
 
     uint32 GetCycleCounter();
 
+    uint32 *GetNumberOfValues();
+
+    uint32 GetNumberOfPartialHistograms();
+
     void *GetInputSignalsMemory();
 
     void *GetOutputSignalsMemory();
@@ -89,6 +93,14 @@ uint32 HistogramGAMTestGAM::GetCycleCounter() {
     return cycleCounter;
 }
 
+uint32 *HistogramGAMTestGAM::GetNumberOfValues() {
+    return numberOfValues;
+}
+
+uint32 HistogramGAMTestGAM::GetNumberOfPartialHistograms() {
+    return numberOfPartialHistograms;
+}
+
 void *HistogramGAMTestGAM::GetInputSignalsMemory() {
     return GAM::GetInputSignalsMemory();
 }
@@ -235,6 +247,63 @@ static bool InitialiseMemoryMapInputBrokerEnviroment(const char8 * const config)
     return ok;
 }
 
+/**
+ * Helper function that executes a HistogramGAM with a float32[10] and an int16[5] input
+ * (writing the input memory directly) and checks that all the values are counted.
+ */
+static bool ExecuteBlockHistogram(const char8 * const config,
+                                  const uint32 expectedPartials) {
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config);
+    ReferenceT<HistogramGAMTestGAM> gam;
+    if (ret) {
+        gam = god->Find("Application.Functions.GAM1");
+        ret = gam.IsValid();
+    }
+    if (ret) {
+        ret = (gam->GetNumberOfPartialHistograms() == expectedPartials);
+    }
+    if (ret) {
+        HistogramComparator **comps = gam->GetComps();
+        ret = (comps[0]->GetNumberOfPartialHistograms() == expectedPartials);
+        ret &= (comps[1]->GetNumberOfPartialHistograms() == expectedPartials);
+    }
+    if (ret) {
+        uint32 *numberOfValues = gam->GetNumberOfValues();
+        ret = (numberOfValues[0] == 10u);
+        ret &= (numberOfValues[1] == 5u);
+    }
+    if (ret) {
+        float32 *inF32 = reinterpret_cast<float32 *>(gam->GetInputSignalsMemory());
+        int16 *inI16 = reinterpret_cast<int16 *>(&inF32[10]);
+        for (uint32 i = 0u; i < 10u; i++) {
+            inF32[i] = static_cast<float32>(i) - 0.5F;
+        }
+        inI16[0] = -11;
+        inI16[1] = -10;
+        inI16[2] = 0;
+        inI16[3] = 9;
+        inI16[4] = 10;
+        uint32 *outF32 = reinterpret_cast<uint32 *>(gam->GetOutputSignalsMemory());
+        uint32 *outI16 = &outF32[12];
+        const uint32 nCycles = 3u;
+        for (uint32 n = 0u; (n < nCycles) && (ret); n++) {
+            ret = gam->Execute();
+        }
+        //-0.5 is below the lower bound, then one value per bin of width 1
+        for (uint32 j = 0u; (j < 12u) && (ret); j++) {
+            ret = (outF32[j] == ((j < 10u) ? (nCycles) : (0u)));
+        }
+        //Bins of width 2 in [-10, 10)
+        const uint32 expectedI16[] = { 1u, 1u, 0u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 1u, 1u };
+        for (uint32 j = 0u; (j < 12u) && (ret); j++) {
+            ret = (outI16[j] == (expectedI16[j] * nCycles));
+        }
+    }
+    god->Purge();
+    return ret;
+}
+
 HistogramGAMTest::HistogramGAMTest() {
 
 }
@@ -265,6 +334,30 @@ bool HistogramGAMTest::TestInitialise() {
     return ret;
 }
 
+bool HistogramGAMTest::TestInitialise_NumberOfPartialHistograms() {
+    ConfigurationDatabase cdb;
+    uint32 x = 4u;
+    cdb.Write("NumberOfPartialHistograms", x);
+
+    HistogramGAMTestGAM test;
+
+    bool ret = test.Initialise(cdb);
+
+    ret &= test.GetNumberOfPartialHistograms() == 4u;
+    ret &= test.GetBeginCycle() == 0u;
+    return ret;
+}
+
+bool HistogramGAMTest::TestInitialise_False_NumberOfPartialHistograms() {
+    ConfigurationDatabase cdb;
+    uint32 x = 0u;
+    cdb.Write("NumberOfPartialHistograms", x);
+
+    HistogramGAMTestGAM test;
+
+    return !test.Initialise(cdb);
+}
+
 bool HistogramGAMTest::TestSetup() {
 
     const char8 *config = ""
@@ -635,7 +728,7 @@ bool HistogramGAMTest::TestSetup_DifferentInputOutputNSignals() {
     return ret;
 }
 
-bool HistogramGAMTest::TestSetup_FalseInputNotScalar() {
+bool HistogramGAMTest::TestSetup_InputArray() {
 
     const char8 *config = ""
             "$Application = {"
@@ -811,12 +904,23 @@ bool HistogramGAMTest::TestSetup_FalseInputNotScalar() {
             "}";
 
     ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
-    bool ret = !InitialiseMemoryMapInputBrokerEnviroment(config);
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config);
+    ReferenceT<HistogramGAMTestGAM> gam;
+    if (ret) {
+        gam = god->Find("Application.Functions.GAM1");
+        ret = gam.IsValid();
+    }
+    if (ret) {
+        uint32 *numberOfValues = gam->GetNumberOfValues();
+        for (uint32 i = 0u; (i < 10u) && (ret); i++) {
+            ret = (numberOfValues[i] == ((i == 2u) ? (12u) : (1u)));
+        }
+    }
     god->Purge();
     return ret;
 }
 
-bool HistogramGAMTest::TestSetup_FalseSamplesNotOne() {
+bool HistogramGAMTest::TestSetup_InputSamples() {
 
     const char8 *config = ""
             "$Application = {"
@@ -990,7 +1094,18 @@ bool HistogramGAMTest::TestSetup_FalseSamplesNotOne() {
             "     }"
             "}";
     ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
-    bool ret = !InitialiseMemoryMapInputBrokerEnviroment(config);
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config);
+    ReferenceT<HistogramGAMTestGAM> gam;
+    if (ret) {
+        gam = god->Find("Application.Functions.GAM1");
+        ret = gam.IsValid();
+    }
+    if (ret) {
+        uint32 *numberOfValues = gam->GetNumberOfValues();
+        for (uint32 i = 0u; (i < 10u) && (ret); i++) {
+            ret = (numberOfValues[i] == ((i == 0u) ? (2u) : (1u)));
+        }
+    }
     god->Purge();
     return ret;
 }
@@ -2482,6 +2597,163 @@ bool HistogramGAMTest::TestExecute_BeginCycleNumber() {
     return ret;
 }
 
+bool HistogramGAMTest::TestExecute_Block() {
+
+    const char8 *config = ""
+            "$Application = {"
+            "   Class = RealTimeApplication"
+            "   +Functions = {"
+            "       Class = ReferenceContainer"
+            "       +GAM1 = {"
+            "           Class = HistogramGAMTestGAM"
+            "             InputSignals = {"
+            "                 Source_F32 = {"
+            "                     DataSource = Input"
+            "                     MaxLim = 10"
+            "                     MinLim = 0"
+            "                     Type = float32"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 10"
+            "                 }"
+            "                 Source_I16 = {"
+            "                     DataSource = Input"
+            "                     MaxLim = 10"
+            "                     MinLim = -10"
+            "                     Type = int16"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 5"
+            "                 }"
+            "             }"
+            "             OutputSignals = {"
+            "                 Statistics_F32 = {"
+            "                     DataSource = DDB1"
+            "                     Type = uint32"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 12"
+            "                 }"
+            "                 Statistics_I16 = {"
+            "                     DataSource = DDB1"
+            "                     Type = uint32"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 12"
+            "                 }"
+            "             }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +Input = {"
+            "            Class = HistogramGAMTestDS"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Idle = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = { GAM1 }"
+            "                }"
+            "            }"
+            "         }"
+            "     }"
+            "     +Scheduler = {"
+            "         Class = GAMScheduler"
+            "         TimingDataSource = Timings"
+            "     }"
+            "}";
+
+    return ExecuteBlockHistogram(config, 1u);
+}
+
+bool HistogramGAMTest::TestExecute_PartialHistograms() {
+
+    const char8 *config = ""
+            "$Application = {"
+            "   Class = RealTimeApplication"
+            "   +Functions = {"
+            "       Class = ReferenceContainer"
+            "       +GAM1 = {"
+            "           Class = HistogramGAMTestGAM"
+            "           NumberOfPartialHistograms = 3"
+            "             InputSignals = {"
+            "                 Source_F32 = {"
+            "                     DataSource = Input"
+            "                     MaxLim = 10"
+            "                     MinLim = 0"
+            "                     Type = float32"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 10"
+            "                 }"
+            "                 Source_I16 = {"
+            "                     DataSource = Input"
+            "                     MaxLim = 10"
+            "                     MinLim = -10"
+            "                     Type = int16"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 5"
+            "                 }"
+            "             }"
+            "             OutputSignals = {"
+            "                 Statistics_F32 = {"
+            "                     DataSource = DDB1"
+            "                     Type = uint32"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 12"
+            "                 }"
+            "                 Statistics_I16 = {"
+            "                     DataSource = DDB1"
+            "                     Type = uint32"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 12"
+            "                 }"
+            "             }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +Input = {"
+            "            Class = HistogramGAMTestDS"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Idle = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = { GAM1 }"
+            "                }"
+            "            }"
+            "         }"
+            "     }"
+            "     +Scheduler = {"
+            "         Class = GAMScheduler"
+            "         TimingDataSource = Timings"
+            "     }"
+            "}";
+
+    return ExecuteBlockHistogram(config, 3u);
+}
+
 bool HistogramGAMTest::TestPrepareNextState() {
 
     const char8 *config = ""
@@ -64,6 +64,16 @@ public:
      */
     bool TestInitialise();
 
+    /**
+     * @brief Tests the HistogramGAM::Initialise method with NumberOfPartialHistograms.
+     */
+    bool TestInitialise_NumberOfPartialHistograms();
+
+    /**
+     * @brief Tests the HistogramGAM::Initialise method that fails if NumberOfPartialHistograms = 0.
+     */
+    bool TestInitialise_False_NumberOfPartialHistograms();
+
     /**
      * @brief Tests the HistogramGAM::Setup method.
      */
@@ -76,16 +86,16 @@ public:
     bool TestSetup_DifferentInputOutputNSignals();
 
     /**
-     * @brief Tests the HistogramGAM::Setup method that fails if one or more
-     * input signals have NumberOfElements>1
+     * @brief Tests the HistogramGAM::Setup method with an input signal
+     * that has NumberOfElements > 1.
      */
-    bool TestSetup_FalseInputNotScalar();
+    bool TestSetup_InputArray();
 
     /**
-     * @brief Tests the HistogramGAM::Setup method that fails if one or more
-     * input signals have NumberOfSamples > 1
+     * @brief Tests the HistogramGAM::Setup method with an input signal
+     * that has NumberOfSamples > 1.
      */
-    bool TestSetup_FalseSamplesNotOne();
+    bool TestSetup_InputSamples();
 
     /**
      * @brief Tests the HistogramGAM::Setup method that fails if MaxLim is not
@@ -121,6 +131,17 @@ public:
      */
     bool TestExecute_BeginCycleNumber();
 
+    /**
+     * @brief Tests the HistogramGAM::Execute method counting all the elements of array inputs.
+     */
+    bool TestExecute_Block();
+
+    /**
+     * @brief Tests the HistogramGAM::Execute method counting all the elements of array inputs
+     * with NumberOfPartialHistograms > 1.
+     */
+    bool TestExecute_PartialHistograms();
+
     /**
      * @brief Tests the PrepareNextState without a reset
      */
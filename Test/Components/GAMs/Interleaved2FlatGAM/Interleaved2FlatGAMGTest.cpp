@@ -53,6 +53,11 @@ TEST(Interleaved2FlatGAMGTest,TestSetup_MultiPacketNoSamples) {
     ASSERT_TRUE(test.TestSetup_MultiPacketNoSamples());
 }
 
+TEST(Interleaved2FlatGAMGTest,TestSetup_CopyPlan) {
+    Interleaved2FlatGAMTest test;
+    ASSERT_TRUE(test.TestSetup_CopyPlan());
+}
+
 TEST(Interleaved2FlatGAMGTest,TestSetup_False_SignalOverlap_In) {
     Interleaved2FlatGAMTest test;
     ASSERT_TRUE(test.TestSetup_False_SignalOverlap_In());
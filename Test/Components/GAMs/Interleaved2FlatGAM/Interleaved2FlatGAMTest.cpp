@@ -76,6 +76,10 @@ Interleaved2FlatGAMTestGAM    ();
     void *GetInputSignalsMemory1();
 
     void *GetOutputSignalsMemory1();
+
+    uint32 GetNumberOfCopySteps();
+
+    Interleaved2FlatGAMCopyStep *GetCopySteps();
 };
 
 Interleaved2FlatGAMTestGAM::Interleaved2FlatGAMTestGAM() {
@@ -130,6 +134,14 @@ void *Interleaved2FlatGAMTestGAM::GetOutputSignalsMemory1() {
     return GAM::GetOutputSignalsMemory();
 }
 
+uint32 Interleaved2FlatGAMTestGAM::GetNumberOfCopySteps() {
+    return numberOfCopySteps;
+}
+
+Interleaved2FlatGAMCopyStep *Interleaved2FlatGAMTestGAM::GetCopySteps() {
+    return copySteps;
+}
+
 CLASS_REGISTER(Interleaved2FlatGAMTestGAM, "1.0")
 
 /**
@@ -2692,6 +2704,34 @@ bool Interleaved2FlatGAMTest::TestSetup_False_DifferentPacketSize_Out() {
     return !InitialiseMemoryMapInputBrokerEnviroment(config6);
 }
 
+bool Interleaved2FlatGAMTest::TestSetup_CopyPlan() {
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config);
+
+    ReferenceT<Interleaved2FlatGAMTestGAM> gam;
+    if (ret) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gam.IsValid();
+    }
+    if (ret) {
+        //16 members of the interleaved input and 2 members of the interleaved output. All the bytes are covered by the members.
+        ret = (gam->GetNumberOfCopySteps() == 18u);
+    }
+    if (ret) {
+        Interleaved2FlatGAMCopyStep *steps = gam->GetCopySteps();
+        uint32 copiedBytes = 0u;
+        for (uint32 i = 0u; (i < gam->GetNumberOfCopySteps()) && (ret); i++) {
+            copiedBytes += steps[i].size * steps[i].numberOfSamples;
+            if (i > 0u) {
+                ret = (steps[i - 1u].size <= steps[i].size);
+            }
+        }
+        if (ret) {
+            ret = (copiedBytes == gam->GetTotalSignalsByteSize());
+        }
+    }
+    return ret;
+}
+
 bool Interleaved2FlatGAMTest::TestExecute() {
     bool ret = InitialiseMemoryMapInputBrokerEnviroment(config);
 
@@ -66,6 +66,11 @@ public:
      */
     bool TestSetup_MultiPacketNoSamples();
 
+    /**
+     * @brief Tests that the Setup method computes one copy step for each packet member, grouped by member size.
+     */
+    bool TestSetup_CopyPlan();
+
     /**
      * @brief Test that the Setup method fails when there is an overlap of the signal in input.
      */
@@ -0,0 +1,235 @@
+/**
+ * @file MathExpressionBlockEvaluatorGTest.cpp
+ * @brief Source file for class MathExpressionBlockEvaluatorGTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MathExpressionBlockEvaluatorGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "MathExpressionBlockEvaluatorTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(MathExpressionBlockEvaluatorGTest,TestConstructor) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestInitialise) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestInitialise_False_Twice) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestInitialise_False_Twice());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestSetInput) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestSetInput());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestSetInput_False) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestSetInput_False());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestSetOutput) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestSetOutput());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestSetOutput_False) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestSetOutput_False());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestCompile) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestCompile());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestCompile_False_TypeMismatch) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestCompile_False_TypeMismatch());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestCompile_False_WriteType) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestCompile_False_WriteType());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestCompile_False_NumberOfValues) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestCompile_False_NumberOfValues());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestCompile_False_UnusedInput) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestCompile_False_UnusedInput());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestCompile_False_UnwrittenOutput) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestCompile_False_UnwrittenOutput());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestCompile_False_UnknownVariable) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestCompile_False_UnknownVariable());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestCompile_False_StackNotEmpty) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestCompile_False_StackNotEmpty());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestCompile_False_FloatFunction) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestCompile_False_FloatFunction());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestCompile_False_UnsupportedOpcode) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestCompile_False_UnsupportedOpcode());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestExecute_Arithmetic) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestExecute_Arithmetic());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestExecute_Broadcast) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestExecute_Broadcast());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestExecute_InternalVariable) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestExecute_InternalVariable());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestExecute_Comparison) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestExecute_Comparison());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestExecute_Logical) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestExecute_Logical());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestExecute_IntegerSaturation) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestExecute_IntegerSaturation());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestExecute_IntegerDivision) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestExecute_IntegerDivision());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestExecute_Cast) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestExecute_Cast());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestExecute_Trigonometric) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestExecute_Trigonometric());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestGetBlockSize) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestGetBlockSize());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestGetNumberOfInstructions) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestGetNumberOfInstructions());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestGetNumberOfBuffers) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestGetNumberOfBuffers());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestCompile_Optimise) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestCompile_Optimise());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestExecute_Optimise_ConstantFolding) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestExecute_Optimise_ConstantFolding());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestExecute_Optimise_ConstantVariable) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestExecute_Optimise_ConstantVariable());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestExecute_Optimise_MultiplyAdd) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestExecute_Optimise_MultiplyAdd());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestExecute_Optimise_Polynomial) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestExecute_Optimise_Polynomial());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestExecute_Optimise_OverwrittenVariable) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestExecute_Optimise_OverwrittenVariable());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestExecute_Optimise_Scalar) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestExecute_Optimise_Scalar());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestExecute_Optimise_DivisionByZero) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestExecute_Optimise_DivisionByZero());
+}
+
+TEST(MathExpressionBlockEvaluatorGTest,TestExecute_Optimise_ConstantError) {
+    MathExpressionBlockEvaluatorTest test;
+    ASSERT_TRUE(test.TestExecute_Optimise_ConstantError());
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
@@ -0,0 +1,879 @@
+/**
+ * @file MathExpressionBlockEvaluatorTest.cpp
+ * @brief Source file for class MathExpressionBlockEvaluatorTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MathExpressionBlockEvaluatorTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "MathExpressionBlockEvaluatorTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * Compiles a program with two float32 inputs A and B and one float32 output C of nOfValues values.
+ */
+static bool CompileFloat32(MARTe::MathExpressionBlockEvaluator &evaluator,
+                           const MARTe::char8 * const expression,
+                           MARTe::float32 * const a,
+                           MARTe::float32 * const b,
+                           MARTe::float32 * const c,
+                           const MARTe::uint32 nOfValues) {
+    using namespace MARTe;
+    bool ok = evaluator.Initialise(2u, 1u);
+    if (ok) {
+        ok = evaluator.SetInput(0u, "A", Float32Bit, a, nOfValues);
+    }
+    if (ok) {
+        ok = evaluator.SetInput(1u, "B", Float32Bit, b, nOfValues);
+    }
+    if (ok) {
+        ok = evaluator.SetOutput(0u, "C", Float32Bit, c, nOfValues);
+    }
+    if (ok) {
+        ok = evaluator.Compile(expression);
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool MathExpressionBlockEvaluatorTest::TestConstructor() {
+    MathExpressionBlockEvaluator evaluator;
+    bool ok = (evaluator.GetBlockSize() == 0u);
+    if (ok) {
+        ok = (evaluator.GetNumberOfInstructions() == 0u);
+    }
+    if (ok) {
+        ok = (evaluator.GetNumberOfBuffers() == 0u);
+    }
+    return ok;
+}
+
+bool MathExpressionBlockEvaluatorTest::TestInitialise() {
+    MathExpressionBlockEvaluator evaluator;
+    return evaluator.Initialise(2u, 1u);
+}
+
+bool MathExpressionBlockEvaluatorTest::TestInitialise_False_Twice() {
+    MathExpressionBlockEvaluator evaluator;
+    bool ok = evaluator.Initialise(2u, 1u);
+    if (ok) {
+        ok = !evaluator.Initialise(2u, 1u);
+    }
+    return ok;
+}
+
+bool MathExpressionBlockEvaluatorTest::TestSetInput() {
+    MathExpressionBlockEvaluator evaluator;
+    int32 a[4];
+    uint8 b;
+    bool ok = evaluator.Initialise(2u, 1u);
+    if (ok) {
+        ok = evaluator.SetInput(0u, "A", SignedInteger32Bit, &a[0], 4u);
+    }
+    if (ok) {
+        ok = evaluator.SetInput(1u, "B", UnsignedInteger8Bit, &b, 1u);
+    }
+    return ok;
+}
+
+bool MathExpressionBlockEvaluatorTest::TestSetInput_False() {
+    MathExpressionBlockEvaluator evaluator;
+    int32 a[4];
+    bool ok = evaluator.Initialise(1u, 1u);
+    if (ok) {
+        ok = !evaluator.SetInput(1u, "A", SignedInteger32Bit, &a[0], 4u);
+    }
+    if (ok) {
+        ok = !evaluator.SetInput(0u, "A", CharString, &a[0], 4u);
+    }
+    if (ok) {
+        ok = !evaluator.SetInput(0u, "A", SignedInteger32Bit, &a[0], 0u);
+    }
+    return ok;
+}
+
+bool MathExpressionBlockEvaluatorTest::TestSetOutput() {
+    MathExpressionBlockEvaluator evaluator;
+    float64 c[4];
+    bool ok = evaluator.Initialise(1u, 1u);
+    if (ok) {
+        ok = evaluator.SetOutput(0u, "C", Float64Bit, &c[0], 4u);
+    }
+    return ok;
+}
+
+bool MathExpressionBlockEvaluatorTest::TestSetOutput_False() {
+    MathExpressionBlockEvaluator evaluator;
+    float64 c[4];
+    bool ok = evaluator.Initialise(1u, 1u);
+    if (ok) {
+        ok = !evaluator.SetOutput(1u, "C", Float64Bit, &c[0], 4u);
+    }
+    if (ok) {
+        ok = !evaluator.SetOutput(0u, "C", CharString, &c[0], 4u);
+    }
+    if (ok) {
+        ok = !evaluator.SetOutput(0u, "C", Float64Bit, &c[0], 0u);
+    }
+    return ok;
+}
+
+bool MathExpressionBlockEvaluatorTest::TestCompile() {
+    MathExpressionBlockEvaluator evaluator;
+    float32 a[8];
+    float32 b[8];
+    float32 c[8];
+    return CompileFloat32(evaluator, "READ A READ B ADD WRITE C", &a[0], &b[0], &c[0], 8u);
+}
+
+bool MathExpressionBlockEvaluatorTest::TestCompile_False_TypeMismatch() {
+    MathExpressionBlockEvaluator evaluator;
+    float32 a[4];
+    int32 b[4];
+    float32 c[4];
+    bool ok = evaluator.Initialise(2u, 1u);
+    if (ok) {
+        ok = evaluator.SetInput(0u, "A", Float32Bit, &a[0], 4u);
+    }
+    if (ok) {
+        ok = evaluator.SetInput(1u, "B", SignedInteger32Bit, &b[0], 4u);
+    }
+    if (ok) {
+        ok = evaluator.SetOutput(0u, "C", Float32Bit, &c[0], 4u);
+    }
+    if (ok) {
+        ok = !evaluator.Compile("READ A READ B ADD WRITE C");
+    }
+    if (ok) {
+        ok = evaluator.Compile("READ A READ B CAST float32 ADD WRITE C");
+    }
+    return ok;
+}
+
+bool MathExpressionBlockEvaluatorTest::TestCompile_False_WriteType() {
+    MathExpressionBlockEvaluator evaluator;
+    float32 a[4];
+    float32 b[4];
+    float32 c[4];
+    return !CompileFloat32(evaluator, "READ A READ B GT WRITE C", &a[0], &b[0], &c[0], 4u);
+}
+
+bool MathExpressionBlockEvaluatorTest::TestCompile_False_NumberOfValues() {
+    MathExpressionBlockEvaluator evaluator;
+    float32 a[4];
+    float32 b[3];
+    float32 c[4];
+    bool ok = evaluator.Initialise(2u, 1u);
+    if (ok) {
+        ok = evaluator.SetInput(0u, "A", Float32Bit, &a[0], 4u);
+    }
+    if (ok) {
+        ok = evaluator.SetInput(1u, "B", Float32Bit, &b[0], 3u);
+    }
+    if (ok) {
+        ok = evaluator.SetOutput(0u, "C", Float32Bit, &c[0], 4u);
+    }
+    if (ok) {
+        ok = !evaluator.Compile("READ A READ B ADD WRITE C");
+    }
+    return ok;
+}
+
+bool MathExpressionBlockEvaluatorTest::TestCompile_False_UnusedInput() {
+    MathExpressionBlockEvaluator evaluator;
+    float32 a[4];
+    float32 b[4];
+    float32 c[4];
+    return !CompileFloat32(evaluator, "READ A WRITE C", &a[0], &b[0], &c[0], 4u);
+}
+
+bool MathExpressionBlockEvaluatorTest::TestCompile_False_UnwrittenOutput() {
+    MathExpressionBlockEvaluator evaluator;
+    float32 a[4];
+    float32 b[4];
+    float32 c[4];
+    return !CompileFloat32(evaluator, "READ A READ B ADD WRITE D", &a[0], &b[0], &c[0], 4u);
+}
+
+bool MathExpressionBlockEvaluatorTest::TestCompile_False_UnknownVariable() {
+    MathExpressionBlockEvaluator evaluator;
+    float32 a[4];
+    float32 b[4];
+    float32 c[4];
+    return !CompileFloat32(evaluator, "READ A READ B ADD READ D ADD WRITE C", &a[0], &b[0], &c[0], 4u);
+}
+
+bool MathExpressionBlockEvaluatorTest::TestCompile_False_StackNotEmpty() {
+    MathExpressionBlockEvaluator evaluator;
+    float32 a[4];
+    float32 b[4];
+    float32 c[4];
+    return !CompileFloat32(evaluator, "READ A READ B READ A ADD WRITE C", &a[0], &b[0], &c[0], 4u);
+}
+
+bool MathExpressionBlockEvaluatorTest::TestCompile_False_FloatFunction() {
+    MathExpressionBlockEvaluator evaluator;
+    int32 a[4];
+    int32 c[4];
+    bool ok = evaluator.Initialise(1u, 1u);
+    if (ok) {
+        ok = evaluator.SetInput(0u, "A", SignedInteger32Bit, &a[0], 4u);
+    }
+    if (ok) {
+        ok = evaluator.SetOutput(0u, "C", SignedInteger32Bit, &c[0], 4u);
+    }
+    if (ok) {
+        ok = !evaluator.Compile("READ A SIN WRITE C");
+    }
+    if (ok) {
+        ok = !evaluator.Compile("READ A COS WRITE C");
+    }
+    if (ok) {
+        ok = !evaluator.Compile("READ A READ A POW WRITE C");
+    }
+    return ok;
+}
+
+bool MathExpressionBlockEvaluatorTest::TestCompile_False_UnsupportedOpcode() {
+    MathExpressionBlockEvaluator evaluator;
+    float32 a[4];
+    float32 b[4];
+    float32 c[4];
+    return !CompileFloat32(evaluator, "READ A READ B MOD WRITE C", &a[0], &b[0], &c[0], 4u);
+}
+
+bool MathExpressionBlockEvaluatorTest::TestExecute_Arithmetic() {
+    MathExpressionBlockEvaluator evaluator;
+    float32 a[5] = { 1.0F, 2.0F, -3.0F, 4.5F, 10.0F };
+    float32 b[5] = { 2.0F, 4.0F, 1.5F, -0.5F, 8.0F };
+    float32 c[5];
+    bool ok = CompileFloat32(evaluator, "READ A READ B ADD READ A READ B SUB MUL READ B DIV WRITE C", &a[0], &b[0], &c[0], 5u);
+    if (ok) {
+        ok = evaluator.Execute();
+        for (uint32 i = 0u; (i < 5u) && (ok); i++) {
+            ok = (c[i] == (((a[i] + b[i]) * (a[i] - b[i])) / b[i]));
+        }
+    }
+    return ok;
+}
+
+bool MathExpressionBlockEvaluatorTest::TestExecute_Broadcast() {
+    MathExpressionBlockEvaluator evaluator;
+    int16 a[3] = { 1, -2, 3 };
+    int16 gain = 7;
+    int16 c[3];
+    bool ok = evaluator.Initialise(2u, 1u);
+    if (ok) {
+        ok = evaluator.SetInput(0u, "A", SignedInteger16Bit, &a[0], 3u);
+    }
+    if (ok) {
+        ok = evaluator.SetInput(1u, "Gain", SignedInteger16Bit, &gain, 1u);
+    }
+    if (ok) {
+        ok = evaluator.SetOutput(0u, "C", SignedInteger16Bit, &c[0], 3u);
+    }
+    if (ok) {
+        ok = evaluator.Compile("READ A READ Gain MUL CONST int16 1 ADD WRITE C");
+    }
+    if (ok) {
+        evaluator.Execute();
+        ok = (c[0] == 8) && (c[1] == -13) && (c[2] == 22);
+    }
+    if (ok) {
+        gain = 2;
+        evaluator.Execute();
+        ok = (c[0] == 3) && (c[1] == -3) && (c[2] == 7);
+    }
+    return ok;
+}
+
+bool MathExpressionBlockEvaluatorTest::TestExecute_InternalVariable() {
+    MathExpressionBlockEvaluator evaluator;
+    float32 a[4] = { 1.0F, 2.0F, 3.0F, 4.0F };
+    float32 b[4] = { 4.0F, 3.0F, 2.0F, 1.0F };
+    float32 c[4];
+    bool ok = CompileFloat32(evaluator, "READ A READ B ADD WRITE T READ T READ T MUL WRITE C", &a[0], &b[0], &c[0], 4u);
+    if (ok) {
+        evaluator.Execute();
+        for (uint32 i = 0u; (i < 4u) && (ok); i++) {
+            ok = (c[i] == 25.0F);
+        }
+    }
+    return ok;
+}
+
+bool MathExpressionBlockEvaluatorTest::TestExecute_Comparison() {
+    MathExpressionBlockEvaluator evaluator;
+    uint32 a[3] = { 1u, 5u, 9u };
+    uint32 b = 5u;
+    uint8 results[6][3];
+    bool ok = evaluator.Initialise(2u, 6u);
+    if (ok) {
+        ok = evaluator.SetInput(0u, "A", UnsignedInteger32Bit, &a[0], 3u);
+    }
+    if (ok) {
+        ok = evaluator.SetInput(1u, "B", UnsignedInteger32Bit, &b, 1u);
+    }
+    const char8 * const names[6] = { "EQ", "NEQ", "GT", "LT", "GTE", "LTE" };
+    for (uint32 i = 0u; (i < 6u) && (ok); i++) {
+        ok = evaluator.SetOutput(i, names[i], UnsignedInteger8Bit, &results[i][0], 3u);
+    }
+    if (ok) {
+        ok = evaluator.Compile("READ A READ B EQ WRITE EQ READ A READ B NEQ WRITE NEQ READ A READ B GT WRITE GT "
+                               "READ A READ B LT WRITE LT READ A READ B GTE WRITE GTE READ A READ B LTE WRITE LTE");
+    }
+    if (ok) {
+        evaluator.Execute();
+        const uint8 expected[6][3] = { { 0u, 1u, 0u }, { 1u, 0u, 1u }, { 0u, 0u, 1u }, { 1u, 0u, 0u }, { 0u, 1u, 1u }, { 1u, 1u, 0u } };
+        for (uint32 i = 0u; (i < 6u) && (ok); i++) {
+            for (uint32 j = 0u; (j < 3u) && (ok); j++) {
+                ok = (results[i][j] == expected[i][j]);
+            }
+        }
+    }
+    return ok;
+}
+
+bool MathExpressionBlockEvaluatorTest::TestExecute_Logical() {
+    MathExpressionBlockEvaluator evaluator;
+    int8 a[4] = { 0, 0, 3, -1 };
+    int8 b[4] = { 0, 2, 0, 5 };
+    uint8 results[4][4];
+    bool ok = evaluator.Initialise(2u, 4u);
+    if (ok) {
+        ok = evaluator.SetInput(0u, "A", SignedInteger8Bit, &a[0], 4u);
+    }
+    if (ok) {
+        ok = evaluator.SetInput(1u, "B", SignedInteger8Bit, &b[0], 4u);
+    }
+    const char8 * const names[4] = { "AND", "OR", "XOR", "NOT" };
+    for (uint32 i = 0u; (i < 4u) && (ok); i++) {
+        ok = evaluator.SetOutput(i, names[i], UnsignedInteger8Bit, &results[i][0], 4u);
+    }
+    if (ok) {
+        ok = evaluator.Compile("READ A READ B AND WRITE AND READ A READ B OR WRITE OR READ A READ B XOR WRITE XOR READ A NOT WRITE NOT");
+    }
+    if (ok) {
+        evaluator.Execute();
+        const uint8 expected[4][4] = { { 0u, 0u, 0u, 1u }, { 0u, 1u, 1u, 1u }, { 0u, 1u, 1u, 0u }, { 1u, 1u, 0u, 0u } };
+        for (uint32 i = 0u; (i < 4u) && (ok); i++) {
+            for (uint32 j = 0u; (j < 4u) && (ok); j++) {
+                ok = (results[i][j] == expected[i][j]);
+            }
+        }
+    }
+    return ok;
+}
+
+bool MathExpressionBlockEvaluatorTest::TestExecute_IntegerSaturation() {
+    MathExpressionBlockEvaluator evaluator;
+    uint8 a[2] = { 250u, 3u };
+    uint8 b[2] = { 10u, 5u };
+    uint8 sum[2];
+    uint8 difference[2];
+    uint8 product[2];
+    bool ok = evaluator.Initialise(2u, 3u);
+    if (ok) {
+        ok = evaluator.SetInput(0u, "A", UnsignedInteger8Bit, &a[0], 2u);
+    }
+    if (ok) {
+        ok = evaluator.SetInput(1u, "B", UnsignedInteger8Bit, &b[0], 2u);
+    }
+    if (ok) {
+        ok = evaluator.SetOutput(0u, "Sum", UnsignedInteger8Bit, &sum[0], 2u);
+    }
+    if (ok) {
+        ok = evaluator.SetOutput(1u, "Difference", UnsignedInteger8Bit, &difference[0], 2u);
+    }
+    if (ok) {
+        ok = evaluator.SetOutput(2u, "Product", UnsignedInteger8Bit, &product[0], 2u);
+    }
+    if (ok) {
+        ok = evaluator.Compile("READ A READ B ADD WRITE Sum READ A READ B SUB WRITE Difference READ A READ B MUL WRITE Product");
+    }
+    if (ok) {
+        //the saturated values are errors, as for the RuntimeEvaluator, but the outputs are written
+        ok = !evaluator.Execute();
+    }
+    if (ok) {
+        ok = (sum[0] == 255u) && (sum[1] == 8u);
+    }
+    if (ok) {
+        ok = (difference[0] == 240u) && (difference[1] == 0u);
+    }
+    if (ok) {
+        ok = (product[0] == 255u) && (product[1] == 15u);
+    }
+    return ok;
+}
+
+bool MathExpressionBlockEvaluatorTest::TestExecute_IntegerDivision() {
+    MathExpressionBlockEvaluator evaluator;
+    int32 a[4] = { 7, -7, 5, (-2147483647 - 1) };
+    int32 b[4] = { 2, 2, 0, -1 };
+    int32 c[4];
+    bool ok = evaluator.Initialise(2u, 1u);
+    if (ok) {
+        ok = evaluator.SetInput(0u, "A", SignedInteger32Bit, &a[0], 4u);
+    }
+    if (ok) {
+        ok = evaluator.SetInput(1u, "B", SignedInteger32Bit, &b[0], 4u);
+    }
+    if (ok) {
+        ok = evaluator.SetOutput(0u, "C", SignedInteger32Bit, &c[0], 4u);
+    }
+    if (ok) {
+        ok = evaluator.Compile("READ A READ B DIV WRITE C");
+    }
+    if (ok) {
+        //the saturated values are errors, as for the RuntimeEvaluator, but the outputs are written
+        ok = !evaluator.Execute();
+    }
+    if (ok) {
+        ok = (c[0] == 3) && (c[1] == -3) && (c[2] == 0) && (c[3] == 2147483647);
+    }
+    return ok;
+}
+
+bool MathExpressionBlockEvaluatorTest::TestExecute_Cast() {
+    MathExpressionBlockEvaluator evaluator;
+    float64 a[5] = { 1.7, -300.0, 300.0, -1.2, 0.0 };
+    int16 b[5] = { -1, 200, 255, 256, 32767 };
+    int8 c[5];
+    uint8 d[5];
+    bool ok = evaluator.Initialise(2u, 2u);
+    if (ok) {
+        ok = evaluator.SetInput(0u, "A", Float64Bit, &a[0], 5u);
+    }
+    if (ok) {
+        ok = evaluator.SetInput(1u, "B", SignedInteger16Bit, &b[0], 5u);
+    }
+    if (ok) {
+        ok = evaluator.SetOutput(0u, "C", SignedInteger8Bit, &c[0], 5u);
+    }
+    if (ok) {
+        ok = evaluator.SetOutput(1u, "D", UnsignedInteger8Bit, &d[0], 5u);
+    }
+    if (ok) {
+        ok = evaluator.Compile("READ A CAST int8 WRITE C READ B CAST uint8 WRITE D");
+    }
+    if (ok) {
+        //the saturated values are errors, as for the RuntimeEvaluator, but the outputs are written
+        ok = !evaluator.Execute();
+    }
+    if (ok) {
+        ok = (c[0] == 1) && (c[1] == -128) && (c[2] == 127) && (c[3] == -1) && (c[4] == 0);
+    }
+    if (ok) {
+        ok = (d[0] == 0u) && (d[1] == 200u) && (d[2] == 255u) && (d[3] == 255u) && (d[4] == 255u);
+    }
+    return ok;
+}
+
+bool MathExpressionBlockEvaluatorTest::TestExecute_Trigonometric() {
+    MathExpressionBlockEvaluator evaluator;
+    float64 a[3] = { 0.0, 0.5, 1.0 };
+    float64 b[3] = { 2.0, 2.0, 3.0 };
+    float64 c[3];
+    bool ok = evaluator.Initialise(2u, 1u);
+    if (ok) {
+        ok = evaluator.SetInput(0u, "A", Float64Bit, &a[0], 3u);
+    }
+    if (ok) {
+        ok = evaluator.SetInput(1u, "B", Float64Bit, &b[0], 3u);
+    }
+    if (ok) {
+        ok = evaluator.SetOutput(0u, "C", Float64Bit, &c[0], 3u);
+    }
+    if (ok) {
+        ok = evaluator.Compile("READ A SIN READ B POW READ A COS READ B POW ADD WRITE C");
+    }
+    if (ok) {
+        evaluator.Execute();
+        ok = (c[0] == 1.0) && (c[1] > 0.9999) && (c[1] < 1.0001);
+    }
+    return ok;
+}
+
+bool MathExpressionBlockEvaluatorTest::TestGetBlockSize() {
+    MathExpressionBlockEvaluator evaluator;
+    float32 a[6];
+    float32 b = 0.0F;
+    float32 c[6];
+    bool ok = evaluator.Initialise(2u, 1u);
+    if (ok) {
+        ok = evaluator.SetInput(0u, "A", Float32Bit, &a[0], 6u);
+    }
+    if (ok) {
+        ok = evaluator.SetInput(1u, "B", Float32Bit, &b, 1u);
+    }
+    if (ok) {
+        ok = evaluator.SetOutput(0u, "C", Float32Bit, &c[0], 6u);
+    }
+    if (ok) {
+        ok = evaluator.Compile("READ A READ B ADD WRITE C");
+    }
+    if (ok) {
+        ok = (evaluator.GetBlockSize() == 6u);
+    }
+    return ok;
+}
+
+bool MathExpressionBlockEvaluatorTest::TestGetNumberOfInstructions() {
+    MathExpressionBlockEvaluator evaluator;
+    float32 a[4];
+    float32 b[4];
+    float32 c[4];
+    bool ok = CompileFloat32(evaluator, "READ A READ B ADD CAST float32 WRITE C", &a[0], &b[0], &c[0], 4u);
+    if (ok) {
+        //The CAST to the same type does not generate an instruction
+        ok = (evaluator.GetNumberOfInstructions() == 4u);
+    }
+    return ok;
+}
+
+bool MathExpressionBlockEvaluatorTest::TestGetNumberOfBuffers() {
+    MathExpressionBlockEvaluator evaluator;
+    float32 a[4];
+    float32 b[4];
+    float32 c[4];
+    bool ok = CompileFloat32(evaluator, "READ A READ B ADD READ A READ B SUB MUL WRITE C", &a[0], &b[0], &c[0], 4u);
+    if (ok) {
+        //The buffers of the operands are reused once consumed
+        ok = (evaluator.GetNumberOfBuffers() == 4u);
+    }
+    return ok;
+}
+
+bool MathExpressionBlockEvaluatorTest::TestCompile_Optimise() {
+    MathExpressionBlockEvaluator evaluator;
+    float32 a[4];
+    float32 b[4];
+    float32 c[4];
+    bool ok = evaluator.Initialise(2u, 1u);
+    if (ok) {
+        ok = evaluator.SetInput(0u, "A", Float32Bit, &a[0], 4u);
+    }
+    if (ok) {
+        ok = evaluator.SetInput(1u, "B", Float32Bit, &b[0], 4u);
+    }
+    if (ok) {
+        ok = evaluator.SetOutput(0u, "C", Float32Bit, &c[0], 4u);
+    }
+    if (ok) {
+        ok = evaluator.Compile("READ A READ B ADD WRITE C", true);
+    }
+    if (ok) {
+        //No copies: the ADD reads A and B and writes C
+        ok = (evaluator.GetNumberOfInstructions() == 1u);
+    }
+    return ok;
+}
+
+bool MathExpressionBlockEvaluatorTest::TestExecute_Optimise_ConstantFolding() {
+    MathExpressionBlockEvaluator evaluator;
+    float64 a[4] = { 1.0, -2.0, 0.5, 100.0 };
+    float64 c[4];
+    bool ok = evaluator.Initialise(1u, 1u);
+    if (ok) {
+        ok = evaluator.SetInput(0u, "A", Float64Bit, &a[0], 4u);
+    }
+    if (ok) {
+        ok = evaluator.SetOutput(0u, "C", Float64Bit, &c[0], 4u);
+    }
+    if (ok) {
+        ok = evaluator.Compile("CONST float64 2 CONST float64 3 MUL CONST int32 4 CAST float64 SUB READ A ADD WRITE C", true);
+    }
+    if (ok) {
+        ok = (evaluator.GetNumberOfInstructions() == 1u);
+    }
+    if (ok) {
+        evaluator.Execute();
+        for (uint32 i = 0u; (i < 4u) && (ok); i++) {
+            ok = (c[i] == (2.0 + a[i]));
+        }
+    }
+    return ok;
+}
+
+bool MathExpressionBlockEvaluatorTest::TestExecute_Optimise_ConstantVariable() {
+    MathExpressionBlockEvaluator evaluator;
+    float32 a[4] = { 1.0F, 2.0F, 3.0F, 4.0F };
+    float32 c[4];
+    bool ok = evaluator.Initialise(1u, 1u);
+    if (ok) {
+        ok = evaluator.SetInput(0u, "A", Float32Bit, &a[0], 4u);
+    }
+    if (ok) {
+        ok = evaluator.SetOutput(0u, "C", Float32Bit, &c[0], 4u);
+    }
+    if (ok) {
+        ok = evaluator.Compile("CONST float32 2.5 WRITE G READ G READ G MUL READ A MUL WRITE C", true);
+    }
+    if (ok) {
+        ok = (evaluator.GetNumberOfInstructions() == 1u);
+    }
+    if (ok) {
+        evaluator.Execute();
+        for (uint32 i = 0u; (i < 4u) && (ok); i++) {
+            ok = (c[i] == (6.25F * a[i]));
+        }
+    }
+    return ok;
+}
+
+bool MathExpressionBlockEvaluatorTest::TestExecute_Optimise_MultiplyAdd() {
+    MathExpressionBlockEvaluator evaluator;
+    int16 a[4] = { 1, 200, -300, 7 };
+    int16 b[4] = { 2, 200, 300, -7 };
+    int16 offset = 10;
+    int16 c[4];
+    bool ok = evaluator.Initialise(3u, 1u);
+    if (ok) {
+        ok = evaluator.SetInput(0u, "A", SignedInteger16Bit, &a[0], 4u);
+    }
+    if (ok) {
+        ok = evaluator.SetInput(1u, "B", SignedInteger16Bit, &b[0], 4u);
+    }
+    if (ok) {
+        ok = evaluator.SetInput(2u, "Offset", SignedInteger16Bit, &offset, 1u);
+    }
+    if (ok) {
+        ok = evaluator.SetOutput(0u, "C", SignedInteger16Bit, &c[0], 4u);
+    }
+    if (ok) {
+        ok = evaluator.Compile("READ Offset READ A READ B MUL ADD WRITE C", true);
+    }
+    if (ok) {
+        ok = (evaluator.GetNumberOfInstructions() == 1u);
+    }
+    if (ok) {
+        evaluator.Execute();
+        //The product saturates before the addition, as without the fusion
+        ok = (c[0] == 12) && (c[1] == 32767) && (c[2] == -32758) && (c[3] == -39);
+    }
+    return ok;
+}
+
+bool MathExpressionBlockEvaluatorTest::TestExecute_Optimise_Polynomial() {
+    const uint32 numberOfValues = 16u;
+    const uint32 degree = 40u;
+    float64 x[numberOfValues];
+    float64 optimised[numberOfValues];
+    float64 reference[numberOfValues];
+    for (uint32 i = 0u; i < numberOfValues; i++) {
+        x[i] = (static_cast<float64>(i) / 8.0) - 1.0;
+    }
+    //Horner form of a polynomial with constant coefficients
+    StreamString expression;
+    bool ok = expression.Printf("CONST float64 %f ", 1.0 / static_cast<float64>(degree + 1u));
+    for (uint32 k = degree; (k > 0u) && (ok); k--) {
+        ok = expression.Printf("READ X MUL CONST float64 %f ADD ", 1.0 / static_cast<float64>(k));
+    }
+    if (ok) {
+        ok = expression.Printf("%s", "WRITE Y");
+    }
+    MathExpressionBlockEvaluator evaluator;
+    MathExpressionBlockEvaluator referenceEvaluator;
+    if (ok) {
+        ok = evaluator.Initialise(1u, 1u);
+    }
+    if (ok) {
+        ok = evaluator.SetInput(0u, "X", Float64Bit, &x[0], numberOfValues);
+    }
+    if (ok) {
+        ok = evaluator.SetOutput(0u, "Y", Float64Bit, &optimised[0], numberOfValues);
+    }
+    if (ok) {
+        ok = evaluator.Compile(expression.Buffer(), true);
+    }
+    if (ok) {
+        ok = referenceEvaluator.Initialise(1u, 1u);
+    }
+    if (ok) {
+        ok = referenceEvaluator.SetInput(0u, "X", Float64Bit, &x[0], numberOfValues);
+    }
+    if (ok) {
+        ok = referenceEvaluator.SetOutput(0u, "Y", Float64Bit, &reference[0], numberOfValues);
+    }
+    if (ok) {
+        ok = referenceEvaluator.Compile(expression.Buffer());
+    }
+    if (ok) {
+        //One multiply-add per coefficient
+        ok = (evaluator.GetNumberOfInstructions() == degree);
+    }
+    if (ok) {
+        ok = (evaluator.GetNumberOfInstructions() < referenceEvaluator.GetNumberOfInstructions());
+    }
+    if (ok) {
+        evaluator.Execute();
+        referenceEvaluator.Execute();
+        for (uint32 i = 0u; (i < numberOfValues) && (ok); i++) {
+            ok = (optimised[i] == reference[i]);
+        }
+    }
+    return ok;
+}
+
+bool MathExpressionBlockEvaluatorTest::TestExecute_Optimise_OverwrittenVariable() {
+    MathExpressionBlockEvaluator evaluator;
+    float32 a[4] = { 1.0F, 2.0F, 3.0F, 4.0F };
+    float32 b[4] = { 10.0F, 20.0F, 30.0F, 40.0F };
+    float32 c[4];
+    bool ok = evaluator.Initialise(2u, 1u);
+    if (ok) {
+        ok = evaluator.SetInput(0u, "A", Float32Bit, &a[0], 4u);
+    }
+    if (ok) {
+        ok = evaluator.SetInput(1u, "B", Float32Bit, &b[0], 4u);
+    }
+    if (ok) {
+        ok = evaluator.SetOutput(0u, "C", Float32Bit, &c[0], 4u);
+    }
+    if (ok) {
+        //The first READ T must keep the value of A after T is overwritten with B
+        ok = evaluator.Compile("READ A WRITE T READ T READ B WRITE T READ T ADD WRITE C", true);
+    }
+    if (ok) {
+        evaluator.Execute();
+        for (uint32 i = 0u; (i < 4u) && (ok); i++) {
+            ok = (c[i] == (a[i] + b[i]));
+        }
+    }
+    return ok;
+}
+
+bool MathExpressionBlockEvaluatorTest::TestExecute_Optimise_Scalar() {
+    MathExpressionBlockEvaluator evaluator;
+    uint32 a = 7u;
+    uint32 b = 5u;
+    uint32 c;
+    uint8 d;
+    bool ok = evaluator.Initialise(2u, 2u);
+    if (ok) {
+        ok = evaluator.SetInput(0u, "A", UnsignedInteger32Bit, &a, 1u);
+    }
+    if (ok) {
+        ok = evaluator.SetInput(1u, "B", UnsignedInteger32Bit, &b, 1u);
+    }
+    if (ok) {
+        ok = evaluator.SetOutput(0u, "C", UnsignedInteger32Bit, &c, 1u);
+    }
+    if (ok) {
+        ok = evaluator.SetOutput(1u, "D", UnsignedInteger8Bit, &d, 1u);
+    }
+    if (ok) {
+        ok = evaluator.Compile("READ A READ B SUB CONST uint32 3 MUL WRITE C READ C READ A GT WRITE D", true);
+    }
+    if (ok) {
+        evaluator.Execute();
+        ok = (c == 6u) && (d == 0u);
+    }
+    if (ok) {
+        b = 9u;
+        evaluator.Execute();
+        ok = (c == 0u) && (d == 0u);
+    }
+    if (ok) {
+        a = 20u;
+        evaluator.Execute();
+        ok = (c == 33u) && (d == 1u);
+    }
+    return ok;
+}
+
+bool MathExpressionBlockEvaluatorTest::TestExecute_Optimise_DivisionByZero() {
+    MathExpressionBlockEvaluator evaluator;
+    int32 a = 7;
+    int32 b = 2;
+    int32 c;
+    bool ok = evaluator.Initialise(2u, 1u);
+    if (ok) {
+        ok = evaluator.SetInput(0u, "A", SignedInteger32Bit, &a, 1u);
+    }
+    if (ok) {
+        ok = evaluator.SetInput(1u, "B", SignedInteger32Bit, &b, 1u);
+    }
+    if (ok) {
+        ok = evaluator.SetOutput(0u, "C", SignedInteger32Bit, &c, 1u);
+    }
+    if (ok) {
+        ok = evaluator.Compile("READ A READ B DIV WRITE C", true);
+    }
+    if (ok) {
+        ok = evaluator.Execute();
+    }
+    if (ok) {
+        ok = (c == 3);
+    }
+    if (ok) {
+        b = 0;
+        ok = !evaluator.Execute();
+    }
+    if (ok) {
+        ok = (c == 0);
+    }
+    if (ok) {
+        b = -7;
+        ok = evaluator.Execute();
+    }
+    if (ok) {
+        ok = (c == -1);
+    }
+    return ok;
+}
+
+bool MathExpressionBlockEvaluatorTest::TestExecute_Optimise_ConstantError() {
+    MathExpressionBlockEvaluator evaluator;
+    int8 c;
+    int32 d;
+    bool ok = evaluator.Initialise(0u, 2u);
+    if (ok) {
+        ok = evaluator.SetOutput(0u, "C", SignedInteger8Bit, &c, 1u);
+    }
+    if (ok) {
+        ok = evaluator.SetOutput(1u, "D", SignedInteger32Bit, &d, 1u);
+    }
+    if (ok) {
+        ok = evaluator.Compile("CONST int8 100 CONST int8 100 ADD WRITE C CONST int32 1 CONST int32 0 DIV WRITE D", true);
+    }
+    if (ok) {
+        ok = !evaluator.Execute();
+    }
+    if (ok) {
+        ok = (c == 127) && (d == 0);
+    }
+    return ok;
+}
@@ -0,0 +1,245 @@
+/**
+ * @file MathExpressionBlockEvaluatorTest.h
+ * @brief Header file for class MathExpressionBlockEvaluatorTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MathExpressionBlockEvaluatorTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef MATHEXPRESSIONBLOCKEVALUATORTEST_H_
+#define MATHEXPRESSIONBLOCKEVALUATORTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "MathExpressionBlockEvaluator.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests the MathExpressionBlockEvaluator public methods.
+ */
+class MathExpressionBlockEvaluatorTest {
+    
+public:
+    /**
+     * @brief Tests the constructor.
+     */
+    bool TestConstructor();
+    
+    /**
+     * @brief Tests the Initialise method.
+     */
+    bool TestInitialise();
+    
+    /**
+     * @brief Tests that the Initialise method fails if called twice.
+     */
+    bool TestInitialise_False_Twice();
+    
+    /**
+     * @brief Tests the SetInput method.
+     */
+    bool TestSetInput();
+    
+    /**
+     * @brief Tests that the SetInput method fails with an invalid index, type or number of values.
+     */
+    bool TestSetInput_False();
+    
+    /**
+     * @brief Tests the SetOutput method.
+     */
+    bool TestSetOutput();
+    
+    /**
+     * @brief Tests that the SetOutput method fails with an invalid index, type or number of values.
+     */
+    bool TestSetOutput_False();
+    
+    /**
+     * @brief Tests the Compile method and the size of the compiled program.
+     */
+    bool TestCompile();
+    
+    /**
+     * @brief Tests that the Compile method fails if the operands have different types.
+     */
+    bool TestCompile_False_TypeMismatch();
+    
+    /**
+     * @brief Tests that the Compile method fails if a value is written to a variable of a different type.
+     */
+    bool TestCompile_False_WriteType();
+    
+    /**
+     * @brief Tests that the Compile method fails if the number of values of a signal is not compatible with the block size.
+     */
+    bool TestCompile_False_NumberOfValues();
+    
+    /**
+     * @brief Tests that the Compile method fails if an input signal is not read.
+     */
+    bool TestCompile_False_UnusedInput();
+    
+    /**
+     * @brief Tests that the Compile method fails if an output signal is not written.
+     */
+    bool TestCompile_False_UnwrittenOutput();
+    
+    /**
+     * @brief Tests that the Compile method fails if a variable is read before being written.
+     */
+    bool TestCompile_False_UnknownVariable();
+    
+    /**
+     * @brief Tests that the Compile method fails if values are left in the stack.
+     */
+    bool TestCompile_False_StackNotEmpty();
+    
+    /**
+     * @brief Tests that the Compile method fails if SIN, COS or POW are used with integer operands.
+     */
+    bool TestCompile_False_FloatFunction();
+    
+    /**
+     * @brief Tests that the Compile method fails with an unknown opcode.
+     */
+    bool TestCompile_False_UnsupportedOpcode();
+    
+    /**
+     * @brief Tests the Execute method with ADD, SUB, MUL and DIV on float32 arrays.
+     */
+    bool TestExecute_Arithmetic();
+    
+    /**
+     * @brief Tests the Execute method with a scalar input applied to all the elements.
+     */
+    bool TestExecute_Broadcast();
+    
+    /**
+     * @brief Tests the Execute method with an internal variable.
+     */
+    bool TestExecute_InternalVariable();
+    
+    /**
+     * @brief Tests the Execute method with the comparison operators.
+     */
+    bool TestExecute_Comparison();
+    
+    /**
+     * @brief Tests the Execute method with the logical operators.
+     */
+    bool TestExecute_Logical();
+    
+    /**
+     * @brief Tests that the integer ADD, SUB and MUL saturate.
+     */
+    bool TestExecute_IntegerSaturation();
+    
+    /**
+     * @brief Tests the integer DIV (including by zero and by -1).
+     */
+    bool TestExecute_IntegerDivision();
+    
+    /**
+     * @brief Tests the saturation of CAST.
+     */
+    bool TestExecute_Cast();
+    
+    /**
+     * @brief Tests the Execute method with SIN, COS and POW.
+     */
+    bool TestExecute_Trigonometric();
+    
+    /**
+     * @brief Tests the GetBlockSize method.
+     */
+    bool TestGetBlockSize();
+    
+    /**
+     * @brief Tests the GetNumberOfInstructions method.
+     */
+    bool TestGetNumberOfInstructions();
+    
+    /**
+     * @brief Tests the GetNumberOfBuffers method.
+     */
+    bool TestGetNumberOfBuffers();
+    
+    /**
+     * @brief Tests that the optimised READ and WRITE do not generate copies.
+     */
+    bool TestCompile_Optimise();
+    
+    /**
+     * @brief Tests the folding of the operations on constants.
+     */
+    bool TestExecute_Optimise_ConstantFolding();
+    
+    /**
+     * @brief Tests the replacement of internal variables assigned a constant.
+     */
+    bool TestExecute_Optimise_ConstantVariable();
+    
+    /**
+     * @brief Tests the multiply-add super-instruction.
+     */
+    bool TestExecute_Optimise_MultiplyAdd();
+    
+    /**
+     * @brief Tests that a polynomial has the same result with and without optimisation.
+     */
+    bool TestExecute_Optimise_Polynomial();
+    
+    /**
+     * @brief Tests that a value read from a variable is kept when the variable is overwritten.
+     */
+    bool TestExecute_Optimise_OverwrittenVariable();
+    
+    /**
+     * @brief Tests the optimised program with single value signals.
+     */
+    bool TestExecute_Optimise_Scalar();
+    
+    /**
+     * @brief Tests that the optimised program reports an integer division by zero.
+     */
+    bool TestExecute_Optimise_DivisionByZero();
+    
+    /**
+     * @brief Tests that the operations on constants which fail are not folded and are reported by Execute().
+     */
+    bool TestExecute_Optimise_ConstantError();
+
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* MATHEXPRESSIONBLOCKEVALUATORTEST_H_ */
@@ -114,6 +114,41 @@ TEST(MathExpressionGAMGTest,TestExecute_MultipleExpressions) {
     ASSERT_TRUE(test.TestExecute_MultipleExpressions());
 }
 
+TEST(MathExpressionGAMGTest,TestSetup_ElementWise) {
+    MathExpressionGAMTest test;
+    ASSERT_TRUE(test.TestSetup_ElementWise());
+}
+
+TEST(MathExpressionGAMGTest,TestSetup_Failed_ElementWiseNumberOfElements) {
+    MathExpressionGAMTest test;
+    ASSERT_TRUE(test.TestSetup_Failed_ElementWiseNumberOfElements());
+}
+
+TEST(MathExpressionGAMGTest,TestExecute_ElementWise) {
+    MathExpressionGAMTest test;
+    ASSERT_TRUE(test.TestExecute_ElementWise());
+}
+
+TEST(MathExpressionGAMGTest,TestSetup_Optimise) {
+    MathExpressionGAMTest test;
+    ASSERT_TRUE(test.TestSetup_Optimise());
+}
+
+TEST(MathExpressionGAMGTest,TestExecute_Optimise) {
+    MathExpressionGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Optimise());
+}
+
+TEST(MathExpressionGAMGTest,TestExecute_MultipleExpressions_Optimise) {
+    MathExpressionGAMTest test;
+    ASSERT_TRUE(test.TestExecute_MultipleExpressions_Optimise());
+}
+
+TEST(MathExpressionGAMGTest,TestExecute_Optimise_Failed_DivisionByZero) {
+    MathExpressionGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Optimise_Failed_DivisionByZero());
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
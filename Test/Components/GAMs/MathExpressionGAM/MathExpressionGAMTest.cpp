@@ -76,6 +76,10 @@ public:
         return evaluator;
     } 
     
+    MARTe::MathExpressionBlockEvaluator* GetBlockEvaluator() {
+        return blockEvaluator;
+    }
+    
 };
 CLASS_REGISTER(MathExpressionGAMHelper, "1.0");
 
@@ -1089,3 +1093,648 @@ bool MathExpressionGAMTest::TestExecute_MultipleExpressions() {
     god->Purge();
     return ok;
 }
+
+bool MathExpressionGAMTest::TestSetup_ElementWise() {
+    
+    const char8 * const config1 = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAM1 = {"
+            "            Class = MathExpressionGAMHelper"
+            "            ElementWise = 1"
+            "            Expression = \""
+            "                           Out = In1 * Gain + In2;"
+            "                           Cmp = In1 > In2;"
+            "                         \""
+            "            InputSignals = {"
+            "               In1 = {"
+            "                   DataSource = DDB1"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 8"
+            "               }"
+            "               In2 = {"
+            "                   DataSource = DDB1"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 8"
+            "               }"
+            "               Gain = {"
+            "                   DataSource = DDB1"
+            "                   Type = float32"
+            "               }"
+            "            }"
+            "            OutputSignals = {"
+            "               Out = {"
+            "                   DataSource = DDB1"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 8"
+            "               }"
+            "               Cmp = {"
+            "                   DataSource = DDB1"
+            "                   Type = uint8"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 8"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAM1}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ok = TestIntegratedInApplication(config1, false);
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<MathExpressionGAMHelper> gam = god->Find("Test.Functions.GAM1");
+    if (ok) {
+        ok = gam.IsValid();
+    }
+    if (ok) {
+        ok = (gam->GetEvaluator() == NULL_PTR(RuntimeEvaluator *));
+    }
+    if (ok) {
+        ok = (gam->GetBlockEvaluator() != NULL_PTR(MathExpressionBlockEvaluator *));
+    }
+    if (ok) {
+        ok = (gam->GetBlockEvaluator()->GetBlockSize() == 8u);
+    }
+    god->Purge();
+    return ok;
+}
+
+bool MathExpressionGAMTest::TestSetup_Failed_ElementWiseNumberOfElements() {
+    
+    const char8 * const config1 = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAM1 = {"
+            "            Class = MathExpressionGAMHelper"
+            "            ElementWise = 1"
+            "            Expression = \""
+            "                           Out = In1 * Gain + In2;"
+            "                           Cmp = In1 > In2;"
+            "                         \""
+            "            InputSignals = {"
+            "               In1 = {"
+            "                   DataSource = DDB1"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 8"
+            "               }"
+            "               In2 = {"
+            "                   DataSource = DDB1"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 8"
+            "               }"
+            "               Gain = {"
+            "                   DataSource = DDB1"
+            "                   Type = float32"
+            "               }"
+            "            }"
+            "            OutputSignals = {"
+            "               Out = {"
+            "                   DataSource = DDB1"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               Cmp = {"
+            "                   DataSource = DDB1"
+            "                   Type = uint8"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 8"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAM1}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ok = TestIntegratedInApplication(config1);
+    return !ok;
+}
+
+bool MathExpressionGAMTest::TestExecute_ElementWise() {
+    
+    const char8 * const config1 = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAM1 = {"
+            "            Class = MathExpressionGAMHelper"
+            "            ElementWise = 1"
+            "            Expression = \""
+            "                           Out = In1 * Gain + In2;"
+            "                           Cmp = In1 > In2;"
+            "                         \""
+            "            InputSignals = {"
+            "               In1 = {"
+            "                   DataSource = DDB1"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 8"
+            "               }"
+            "               In2 = {"
+            "                   DataSource = DDB1"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 8"
+            "               }"
+            "               Gain = {"
+            "                   DataSource = DDB1"
+            "                   Type = float32"
+            "               }"
+            "            }"
+            "            OutputSignals = {"
+            "               Out = {"
+            "                   DataSource = DDB1"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 8"
+            "               }"
+            "               Cmp = {"
+            "                   DataSource = DDB1"
+            "                   Type = uint8"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 8"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAM1}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ok = TestIntegratedInApplication(config1, false);
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<MathExpressionGAMHelper> gam = god->Find("Test.Functions.GAM1");
+    if (ok) {
+        ok = gam.IsValid();
+    }
+    float32 *in1  = NULL_PTR(float32 *);
+    float32 *in2  = NULL_PTR(float32 *);
+    float32 *gain = NULL_PTR(float32 *);
+    float32 *out  = NULL_PTR(float32 *);
+    uint8   *cmp  = NULL_PTR(uint8 *);
+    if (ok) {
+        in1  = static_cast<float32 *>(gam->GetInputSignalMemory(0u));
+        in2  = static_cast<float32 *>(gam->GetInputSignalMemory(1u));
+        gain = static_cast<float32 *>(gam->GetInputSignalMemory(2u));
+        out  = static_cast<float32 *>(gam->GetOutputSignalMemory(0u));
+        cmp  = static_cast<uint8 *>(gam->GetOutputSignalMemory(1u));
+        *gain = 2.0F;
+        for (uint32 i = 0u; i < 8u; i++) {
+            in1[i] = static_cast<float32>(i);
+            in2[i] = static_cast<float32>(7u - i);
+        }
+        ok = gam->Execute();
+    }
+    for (uint32 i = 0u; (i < 8u) && (ok); i++) {
+        ok = (out[i] == ((in1[i] * 2.0F) + in2[i]));
+        if (ok) {
+            ok = (cmp[i] == ((in1[i] > in2[i]) ? 1u : 0u));
+        }
+    }
+    god->Purge();
+    return ok;
+}
+
+bool MathExpressionGAMTest::TestSetup_Optimise() {
+    
+    const char8 * const config1 = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAM1 = {"
+            "            Class = MathExpressionGAMHelper"
+            "            Optimise = 1"
+            "            Expression = \""
+            "                           Out = In1 * Gain + In2;"
+            "                           Cmp = In1 > In2;"
+            "                         \""
+            "            InputSignals = {"
+            "               In1 = {"
+            "                   DataSource = DDB1"
+            "                   Type = float32"
+            "               }"
+            "               In2 = {"
+            "                   DataSource = DDB1"
+            "                   Type = float32"
+            "               }"
+            "               Gain = {"
+            "                   DataSource = DDB1"
+            "                   Type = float32"
+            "               }"
+            "            }"
+            "            OutputSignals = {"
+            "               Out = {"
+            "                   DataSource = DDB1"
+            "                   Type = float32"
+            "               }"
+            "               Cmp = {"
+            "                   DataSource = DDB1"
+            "                   Type = uint8"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAM1}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ok = TestIntegratedInApplication(config1, false);
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<MathExpressionGAMHelper> gam = god->Find("Test.Functions.GAM1");
+    if (ok) {
+        ok = gam.IsValid();
+    }
+    if (ok) {
+        ok = (gam->GetBlockEvaluator() != NULL_PTR(MathExpressionBlockEvaluator *));
+    }
+    if (ok) {
+        // one multiply-add and one comparison, both writing the output signals directly
+        ok = (gam->GetBlockEvaluator()->GetNumberOfInstructions() == 2u);
+    }
+    god->Purge();
+    return ok;
+}
+
+bool MathExpressionGAMTest::TestExecute_Optimise() {
+    
+    const char8 * const config1 = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAM1 = {"
+            "            Class = MathExpressionGAMHelper"
+            "            Optimise = 1"
+            "            Expression = \""
+            "                           Out = In1 * Gain + In2;"
+            "                           Cmp = In1 > In2;"
+            "                         \""
+            "            InputSignals = {"
+            "               In1 = {"
+            "                   DataSource = DDB1"
+            "                   Type = float32"
+            "               }"
+            "               In2 = {"
+            "                   DataSource = DDB1"
+            "                   Type = float32"
+            "               }"
+            "               Gain = {"
+            "                   DataSource = DDB1"
+            "                   Type = float32"
+            "               }"
+            "            }"
+            "            OutputSignals = {"
+            "               Out = {"
+            "                   DataSource = DDB1"
+            "                   Type = float32"
+            "               }"
+            "               Cmp = {"
+            "                   DataSource = DDB1"
+            "                   Type = uint8"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAM1}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ok = TestIntegratedInApplication(config1, false);
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<MathExpressionGAMHelper> gam = god->Find("Test.Functions.GAM1");
+    if (ok) {
+        ok = gam.IsValid();
+    }
+    float32 *in1  = NULL_PTR(float32 *);
+    float32 *in2  = NULL_PTR(float32 *);
+    float32 *gain = NULL_PTR(float32 *);
+    float32 *out  = NULL_PTR(float32 *);
+    uint8   *cmp  = NULL_PTR(uint8 *);
+    if (ok) {
+        in1  = static_cast<float32 *>(gam->GetInputSignalMemory(0u));
+        in2  = static_cast<float32 *>(gam->GetInputSignalMemory(1u));
+        gain = static_cast<float32 *>(gam->GetInputSignalMemory(2u));
+        out  = static_cast<float32 *>(gam->GetOutputSignalMemory(0u));
+        cmp  = static_cast<uint8 *>(gam->GetOutputSignalMemory(1u));
+    }
+    for (uint32 i = 0u; (i < 8u) && (ok); i++) {
+        *in1  = static_cast<float32>(i);
+        *in2  = static_cast<float32>(7u - i);
+        *gain = 0.5F * static_cast<float32>(i);
+        ok = gam->Execute();
+        if (ok) {
+            ok = (*out == ((*in1 * *gain) + *in2));
+        }
+        if (ok) {
+            ok = (*cmp == ((*in1 > *in2) ? 1u : 0u));
+        }
+    }
+    god->Purge();
+    return ok;
+}
+
+bool MathExpressionGAMTest::TestExecute_MultipleExpressions_Optimise() {
+    
+    const char8 * const config1 = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAM1 = {"
+            "            Class = MathExpressionGAM"
+            "            Optimise = 1"
+            "            Expression = \""
+            "                           GAM1_ReadWriteTime = GAM1_ReadTime + GAM1_WriteTime;"
+            "                           GAM1_TotalTime = GAM1_ReadWriteTime + GAM1_ExecTime;"
+            "                         \""
+            "            InputSignals = {"
+            "               GAM1_ReadTime = {"
+            "                   DataSource = Timings"
+            "                   Type = uint32"
+            "               }"
+            "               GAM1_WriteTime = {"
+            "                   DataSource = Timings"
+            "                   Type = uint32"
+            "               }"
+            "               GAM1_ExecTime = {"
+            "                   DataSource = Timings"
+            "                   Type = uint32"
+            "               }"
+            "            }"
+            "            OutputSignals = {"
+            "               GAM1_TotalTime = {"
+            "                   DataSource = DDB1"
+            "                   Type = uint32"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAM1}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+            
+    bool ok = TestIntegratedInApplication(config1, false);
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<MathExpressionGAM> gam = god->Find("Test.Functions.GAM1");
+    if (ok) {
+        ok = gam.IsValid();
+    }
+    if (ok) {
+        ok = gam->Execute();
+    }
+    god->Purge();
+    return ok;
+}
+
+bool MathExpressionGAMTest::TestExecute_Optimise_Failed_DivisionByZero() {
+    
+    const char8 * const config1 = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAM1 = {"
+            "            Class = MathExpressionGAMHelper"
+            "            Optimise = 1"
+            "            Expression = \""
+            "                           Out = In1 / In2;"
+            "                         \""
+            "            InputSignals = {"
+            "               In1 = {"
+            "                   DataSource = DDB1"
+            "                   Type = int32"
+            "               }"
+            "               In2 = {"
+            "                   DataSource = DDB1"
+            "                   Type = int32"
+            "               }"
+            "            }"
+            "            OutputSignals = {"
+            "               Out = {"
+            "                   DataSource = DDB1"
+            "                   Type = int32"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAM1}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ok = TestIntegratedInApplication(config1, false);
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<MathExpressionGAMHelper> gam = god->Find("Test.Functions.GAM1");
+    if (ok) {
+        ok = gam.IsValid();
+    }
+    int32 *in1 = NULL_PTR(int32 *);
+    int32 *in2 = NULL_PTR(int32 *);
+    int32 *out = NULL_PTR(int32 *);
+    if (ok) {
+        in1 = static_cast<int32 *>(gam->GetInputSignalMemory(0u));
+        in2 = static_cast<int32 *>(gam->GetInputSignalMemory(1u));
+        out = static_cast<int32 *>(gam->GetOutputSignalMemory(0u));
+    }
+    if (ok) {
+        *in1 = 7;
+        *in2 = 2;
+        ok = gam->Execute();
+    }
+    if (ok) {
+        ok = (*out == 3);
+    }
+    if (ok) {
+        *in2 = 0;
+        ok = !gam->Execute();
+    }
+    god->Purge();
+    return ok;
+}
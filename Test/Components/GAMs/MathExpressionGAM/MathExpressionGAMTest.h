@@ -132,6 +132,46 @@ public:
      * @brief Tests the Execute method.
      */
     bool TestExecute_MultipleExpressions();
+    
+    /**
+     * @brief   Tests the Setup method with ElementWise = 1.
+     * @details Array signals are accepted and the block size is
+     *          the largest number of values.
+     */
+    bool TestSetup_ElementWise();
+    
+    /**
+     * @brief   Tests the Setup method with ElementWise = 1.
+     * @details This test fails since an output signal has less
+     *          values than the block size.
+     */
+    bool TestSetup_Failed_ElementWiseNumberOfElements();
+    
+    /**
+     * @brief Tests the Execute method with ElementWise = 1.
+     */
+    bool TestExecute_ElementWise();
+    
+    /**
+     * @brief   Tests the Setup method with Optimise = 1.
+     * @details The optimised program replaces the RuntimeEvaluator.
+     */
+    bool TestSetup_Optimise();
+    
+    /**
+     * @brief Tests the Execute method with Optimise = 1.
+     */
+    bool TestExecute_Optimise();
+    
+    /**
+     * @brief Tests the Execute method with Optimise = 1 and an internal variable.
+     */
+    bool TestExecute_MultipleExpressions_Optimise();
+    
+    /**
+     * @brief Tests that the Execute method with Optimise = 1 fails on an integer division by zero.
+     */
+    bool TestExecute_Optimise_Failed_DivisionByZero();
 
 };
 
@@ -60,6 +60,16 @@ TEST(EventConditionTriggerGTest,TestInitialise_FalseNotOnlyMessages) {
     ASSERT_TRUE(test.TestInitialise_FalseNotOnlyMessages());
 }
 
+TEST(EventConditionTriggerGTest,TestInitialise_QueueSize) {
+    EventConditionTriggerTest test;
+    ASSERT_TRUE(test.TestInitialise_QueueSize());
+}
+
+TEST(EventConditionTriggerGTest,TestInitialise_FalseQueueSize) {
+    EventConditionTriggerTest test;
+    ASSERT_TRUE(test.TestInitialise_FalseQueueSize());
+}
+
 TEST(EventConditionTriggerGTest,TestSetMetadataConfig) {
     EventConditionTriggerTest test;
     ASSERT_TRUE(test.TestSetMetadataConfig());
@@ -80,6 +90,16 @@ TEST(EventConditionTriggerGTest,TestCheck) {
     ASSERT_TRUE(test.TestCheck());
 }
 
+TEST(EventConditionTriggerGTest,TestCheck_Overflow) {
+    EventConditionTriggerTest test;
+    ASSERT_TRUE(test.TestCheck_Overflow());
+}
+
+TEST(EventConditionTriggerGTest,TestCheck_WhileSending) {
+    EventConditionTriggerTest test;
+    ASSERT_TRUE(test.TestCheck_WhileSending());
+}
+
 TEST(EventConditionTriggerGTest,TestExecute_ImmediateReply) {
     EventConditionTriggerTest test;
     ASSERT_TRUE(test.TestExecute_ImmediateReply());
@@ -461,7 +461,11 @@ public:
 
     uint32 GetNumberOfConditions();
 
-    ReferenceContainer *GetMessageQueue();
+    bool StopExecutor();
+
+    bool SetSenderWaiting();
+
+    bool IsSenderWokenUp();
 
 };
 
@@ -483,8 +487,20 @@ uint32 EventConditionTriggerTestComp::GetNumberOfConditions() {
     return numberOfConditions;
 }
 
-ReferenceContainer *EventConditionTriggerTestComp::GetMessageQueue() {
-    return &messageQueue;
+bool EventConditionTriggerTestComp::StopExecutor() {
+    return executor.Stop();
+}
+
+bool EventConditionTriggerTestComp::SetSenderWaiting() {
+    //What the internal thread does before it looks at the queue for the last time before waiting
+    bool ret = eventSem.Reset();
+    senderWaiting = 1;
+    return ret;
+}
+
+bool EventConditionTriggerTestComp::IsSenderWokenUp() {
+    ErrorManagement::ErrorType err = eventSem.Wait(100u);
+    return err.ErrorsCleared();
 }
 
 /*---------------------------------------------------------------------------*/
@@ -846,6 +862,98 @@ bool EventConditionTriggerTest::TestInitialise_FalseNotOnlyMessages() {
 
 }
 
+bool EventConditionTriggerTest::TestInitialise_QueueSize() {
+
+    const char8 *config = ""
+            "                    Class = EventConditionTrigger"
+            "                    EventTrigger = {"
+            "                        Command1 = 1"
+            "                    }"
+            "                    +Message1 = {"
+            "                        Class = Message"
+            "                        Destination = Application.Data.Input"
+            "                        Function = \"TrigFun1\""
+            "                        Mode = ExpectsReply"
+            "                    }"
+            "                    +Message2 = {"
+            "                        Class = Message"
+            "                        Destination = Application.Data.Input"
+            "                        Function = \"TrigFun2\""
+            "                        Mode = ExpectsReply"
+            "                    }";
+
+    HeapManager::AddHeap(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ret = parser.Parse();
+    if (ret) {
+        EventConditionTriggerTestComp comp;
+        ret = comp.Initialise(cdb);
+        if (ret) {
+            ret = (comp.GetNumberOfMessages() == 2u);
+        }
+        if (ret) {
+            ret = (comp.GetQueueSize() == 32u);
+        }
+        if (ret) {
+            ret = (comp.GetNumberOfQueuedMessages() == 0u);
+        }
+    }
+    if (ret) {
+        EventConditionTriggerTestComp comp;
+        ret = cdb.MoveToRoot();
+        if (ret) {
+            ret = cdb.Write("QueueSize", 2u);
+        }
+        if (ret) {
+            ret = comp.Initialise(cdb);
+        }
+        if (ret) {
+            ret = (comp.GetQueueSize() == 2u);
+        }
+    }
+    return ret;
+}
+
+bool EventConditionTriggerTest::TestInitialise_FalseQueueSize() {
+
+    const char8 *config = ""
+            "                    Class = EventConditionTrigger"
+            "                    QueueSize = 1"
+            "                    EventTrigger = {"
+            "                        Command1 = 1"
+            "                    }"
+            "                    +Message1 = {"
+            "                        Class = Message"
+            "                        Destination = Application.Data.Input"
+            "                        Function = \"TrigFun1\""
+            "                        Mode = ExpectsReply"
+            "                    }"
+            "                    +Message2 = {"
+            "                        Class = Message"
+            "                        Destination = Application.Data.Input"
+            "                        Function = \"TrigFun2\""
+            "                        Mode = ExpectsReply"
+            "                    }";
+
+    EventConditionTriggerTestComp comp;
+    HeapManager::AddHeap(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ret = parser.Parse();
+    if (ret) {
+        ret = !comp.Initialise(cdb);
+    }
+    return ret;
+
+}
+
 bool EventConditionTriggerTest::TestSetMetadataConfig() {
 
     const char8 *config = ""
@@ -1185,13 +1293,140 @@ bool EventConditionTriggerTest::TestCheck() {
     }
 
     if (ret) {
-        ReferenceContainer* queue = comp.GetMessageQueue();
-        ret = queue->Size() == 3;
+        ret = comp.GetNumberOfQueuedMessages() == 3;
 
     }
     return ret;
 }
 
+bool EventConditionTriggerTest::TestCheck_Overflow() {
+    const char8 *config = ""
+            "                    Class = EventConditionTrigger"
+            "                    QueueSize = 5"
+            "                    EventTrigger = {"
+            "                        Command1 = 1"
+            "                    }"
+            "                    +Message1 = {"
+            "                        Class = Message"
+            "                        Destination = Application.Data.Input"
+            "                        Function = \"TrigFun1\""
+            "                        Mode = ExpectsReply"
+            "                    }"
+            "                    +Message2 = {"
+            "                        Class = Message"
+            "                        Destination = Application.Data.Input"
+            "                        Function = \"TrigFun2\""
+            "                        Mode = ExpectsReply"
+            "                    }";
+
+    SignalMetadata signalMetadata[1];
+    signalMetadata[0].isCommand = true;
+    signalMetadata[0].name = "Command1";
+    signalMetadata[0].offset = 0;
+    signalMetadata[0].type = UnsignedInteger32Bit;
+
+    EventConditionTriggerTestComp comp;
+    HeapManager::AddHeap(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ret = parser.Parse();
+    if (ret) {
+        ret = comp.Initialise(cdb);
+    }
+    if (ret) {
+        ret = comp.SetMetadataConfig(signalMetadata, 1);
+    }
+    //Keep the messages in the queue
+    if (ret) {
+        ret = comp.StopExecutor();
+    }
+    if (ret) {
+        uint32 mem = 1u;
+        ret = comp.Check(reinterpret_cast<uint8 *>(&mem), &signalMetadata[0]);
+        ret &= comp.Check(reinterpret_cast<uint8 *>(&mem), &signalMetadata[0]);
+        //Only one slot left
+        ret &= !comp.Check(reinterpret_cast<uint8 *>(&mem), &signalMetadata[0]);
+        ret &= !comp.Check(reinterpret_cast<uint8 *>(&mem), &signalMetadata[0]);
+    }
+    if (ret) {
+        ret = (comp.GetNumberOfQueuedMessages() == 4u);
+    }
+    if (ret) {
+        ret = (comp.GetNumberOfOverflows() == 2u);
+    }
+    if (ret) {
+        ret = (comp.GetNumberOfDroppedMessages() == 4u);
+    }
+    return ret;
+}
+
+bool EventConditionTriggerTest::TestCheck_WhileSending() {
+    const char8 *config = ""
+            "                    Class = EventConditionTrigger"
+            "                    EventTrigger = {"
+            "                        Command1 = 1"
+            "                    }"
+            "                    +Message1 = {"
+            "                        Class = Message"
+            "                        Destination = Application.Data.Input"
+            "                        Function = \"TrigFun1\""
+            "                        Mode = ExpectsReply"
+            "                    }"
+            "                    +Message2 = {"
+            "                        Class = Message"
+            "                        Destination = Application.Data.Input"
+            "                        Function = \"TrigFun2\""
+            "                        Mode = ExpectsReply"
+            "                    }";
+
+    SignalMetadata signalMetadata[1];
+    signalMetadata[0].isCommand = true;
+    signalMetadata[0].name = "Command1";
+    signalMetadata[0].offset = 0;
+    signalMetadata[0].type = UnsignedInteger32Bit;
+
+    EventConditionTriggerTestComp comp;
+    HeapManager::AddHeap(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ret = parser.Parse();
+    if (ret) {
+        ret = comp.Initialise(cdb);
+    }
+    if (ret) {
+        ret = comp.SetMetadataConfig(signalMetadata, 1);
+    }
+    //Keep the messages in the queue, as if the internal thread was still sending them
+    if (ret) {
+        ret = comp.StopExecutor();
+    }
+    uint32 mem = 1u;
+    if (ret) {
+        ret = comp.Check(reinterpret_cast<uint8 *>(&mem), &signalMetadata[0]);
+    }
+    //The internal thread has sent the previous messages and is about to wait
+    if (ret) {
+        ret = comp.SetSenderWaiting();
+    }
+    //The queue is not empty when the event is triggered
+    if (ret) {
+        ret = comp.Check(reinterpret_cast<uint8 *>(&mem), &signalMetadata[0]);
+    }
+    if (ret) {
+        ret = comp.IsSenderWokenUp();
+    }
+    if (ret) {
+        ret = (comp.GetNumberOfQueuedMessages() == 4u);
+    }
+    return ret;
+}
+
 bool EventConditionTriggerTest::TestExecute_ImmediateReply() {
 
     const char8 *config = ""
@@ -81,6 +81,17 @@ public:
      */
     bool TestInitialise_FalseNotOnlyMessages();
 
+    /**
+     * @brief Tests the EventConditionTrigger::Initialise method with the default and a configured QueueSize.
+     */
+    bool TestInitialise_QueueSize();
+
+    /**
+     * @brief Tests the EventConditionTrigger::Initialise method that fails if
+     * the QueueSize is less than the number of messages.
+     */
+    bool TestInitialise_FalseQueueSize();
+
     /**
      * @brief Tests the EventConditionTrigger::SetMetadataConfig method
      */
@@ -103,6 +114,19 @@ public:
      */
     bool TestCheck();
 
+    /**
+     * @brief Tests that the EventConditionTrigger::Check method discards the events
+     * which do not fit in the queue and counts them.
+     */
+    bool TestCheck_Overflow();
+
+    /**
+     * @brief Tests that the EventConditionTrigger::Check method wakes up the internal thread
+     * when an event is triggered while the thread is still sending the messages of a previous event
+     * and is about to wait.
+     */
+    bool TestCheck_WhileSending();
+
     /**
      * @brief Tests the EventConditionTrigger::Execute method
      * with messages with immediate replies
@@ -44,6 +44,11 @@ TEST(MuxGAMGTest,TestInitialise) {
     ASSERT_TRUE(test.TestInitialise());
 }
 
+TEST(MuxGAMGTest,TestInitialiseInvalidSelector) {
+    MuxGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseInvalidSelector());
+}
+
 TEST(MuxGAMGTest,TestSetupNoOutputs) {
     MuxGAMTest test;
     ASSERT_TRUE(test.TestSetupNoOutputs());
@@ -493,3 +498,53 @@ TEST(MuxGAMGTest,TestExecute4I2OInvalidSelectorSingle) {
 
 
 	
+
+TEST(MuxGAMGTest,TestExecute4I2OInvalidSelectorClampArrayuint8) {
+    MuxGAMTest test;
+    ASSERT_TRUE(test.TestExecute4I2OInvalidSelectorClamp<uint8>("uint8", 80, 80));
+}
+
+TEST(MuxGAMGTest,TestExecute4I2OInvalidSelectorClampArrayuint16) {
+    MuxGAMTest test;
+    ASSERT_TRUE(test.TestExecute4I2OInvalidSelectorClamp<uint16>("uint16", 80, 80));
+}
+
+TEST(MuxGAMGTest,TestExecute4I2OInvalidSelectorClampArrayfloat32) {
+    MuxGAMTest test;
+    ASSERT_TRUE(test.TestExecute4I2OInvalidSelectorClamp<float32>("float32", 80, 80));
+}
+
+TEST(MuxGAMGTest,TestExecute4I2OInvalidSelectorClampArrayfloat64) {
+    MuxGAMTest test;
+    ASSERT_TRUE(test.TestExecute4I2OInvalidSelectorClamp<float64>("float64", 80, 80));
+}
+
+TEST(MuxGAMGTest,TestExecute4I2OInvalidSelectorHoldArrayuint8) {
+    MuxGAMTest test;
+    ASSERT_TRUE(test.TestExecute4I2OInvalidSelectorHold<uint8>("uint8", 80, 80));
+}
+
+TEST(MuxGAMGTest,TestExecute4I2OInvalidSelectorHoldArrayuint16) {
+    MuxGAMTest test;
+    ASSERT_TRUE(test.TestExecute4I2OInvalidSelectorHold<uint16>("uint16", 80, 80));
+}
+
+TEST(MuxGAMGTest,TestExecute4I2OInvalidSelectorHoldArrayfloat32) {
+    MuxGAMTest test;
+    ASSERT_TRUE(test.TestExecute4I2OInvalidSelectorHold<float32>("float32", 80, 80));
+}
+
+TEST(MuxGAMGTest,TestExecute4I2OInvalidSelectorHoldArrayfloat64) {
+    MuxGAMTest test;
+    ASSERT_TRUE(test.TestExecute4I2OInvalidSelectorHold<float64>("float64", 80, 80));
+}
+
+TEST(MuxGAMGTest,TestExecute4I2OInvalidSelectorClampSingle) {
+    MuxGAMTest test;
+    ASSERT_TRUE(test.TestExecute4I2OInvalidSelectorClamp<float64>("float64", 80, 1));
+}
+
+TEST(MuxGAMGTest,TestExecute4I2OInvalidSelectorHoldSingle) {
+    MuxGAMTest test;
+    ASSERT_TRUE(test.TestExecute4I2OInvalidSelectorHold<float64>("float64", 80, 1));
+}
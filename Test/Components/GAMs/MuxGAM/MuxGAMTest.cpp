@@ -66,6 +66,37 @@ bool MuxGAMTest::TestInitialise() {
     return ok;
 }
 
+bool MuxGAMTest::TestInitialiseInvalidSelector() {
+    ConfigurationDatabase config;
+    bool ok = config.Write("InvalidSelector", "Error");
+    if (ok) {
+        MuxGAM gam;
+        ok = gam.Initialise(config);
+    }
+    if (ok) {
+        ok = config.Write("InvalidSelector", "Clamp");
+    }
+    if (ok) {
+        MuxGAM gam;
+        ok = gam.Initialise(config);
+    }
+    if (ok) {
+        ok = config.Write("InvalidSelector", "Hold");
+    }
+    if (ok) {
+        MuxGAM gam;
+        ok = gam.Initialise(config);
+    }
+    if (ok) {
+        ok = config.Write("InvalidSelector", "Wrap");
+    }
+    if (ok) {
+        MuxGAM gam;
+        ok = !gam.Initialise(config);
+    }
+    return ok;
+}
+
 bool MuxGAMTest::TestSetupNoOutputs() {
     ConfigurationDatabase config;
     MuxGAM gam;
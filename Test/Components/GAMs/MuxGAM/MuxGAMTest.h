@@ -52,6 +52,11 @@ public:
      */
     bool TestInitialise();
 
+    /**
+     * @brief Test MuxGAM::Initialise() with the InvalidSelector parameter.
+     */
+    bool TestInitialiseInvalidSelector();
+
     /**
      * @brief Test messages errors MuxGAM::Setup().
      * @details no outputs, no inputs
@@ -336,6 +341,24 @@ public:
                                         uint32 nOfElements,
                                         uint32 nOfSelectorElements);
 
+    /**
+     * @brief Test MuxGAM::Execute() with InvalidSelector = Clamp.
+     * @details the invalid selector elements select the last input signal.
+     */
+    template<typename T>
+    bool TestExecute4I2OInvalidSelectorClamp(StreamString strType,
+                                             uint32 nOfElements,
+                                             uint32 nOfSelectorElements);
+
+    /**
+     * @brief Test MuxGAM::Execute() with InvalidSelector = Hold.
+     * @details the invalid selector elements keep the last valid selector value.
+     */
+    template<typename T>
+    bool TestExecute4I2OInvalidSelectorHold(StreamString strType,
+                                            uint32 nOfElements,
+                                            uint32 nOfSelectorElements);
+
 };
 
 }
@@ -807,6 +830,127 @@ bool MuxGAMTest::TestExecute4I2OInvalidSelector(StreamString strType,
     }
     return ok;
 }
+
+template<typename T>
+bool MuxGAMTest::TestExecute4I2OInvalidSelectorClamp(StreamString strType,
+                                                     uint32 nOfElements,
+                                                     uint32 nOfSelectorElements) {
+    MuxGAMTestHelper gam;
+    bool ok = gam.config.Write("InvalidSelector", "Clamp");
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.Setup4Inputs2Outputs(strType, nOfElements, nOfSelectorElements);
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+
+    if (ok) {
+        ok &= gam.Setup();
+    }
+    if (ok) {
+        uint32 * selector0 = static_cast<uint32 *>(gam.GetInputSignalsMemory(0u));
+        uint32 * selector1 = static_cast<uint32 *>(gam.GetInputSignalsMemory(1u));
+        T * input0 = static_cast<T *>(gam.GetInputSignalsMemory(2u));
+        T * input1 = static_cast<T *>(gam.GetInputSignalsMemory(3u));
+        T * Output0 = static_cast<T *>(gam.GetOutputSignalsMemory(0u));
+        T * Output1 = static_cast<T *>(gam.GetOutputSignalsMemory(1u));
+        //initialize inputs
+        for (uint32 i = 0u; i < nOfElements; i++) {
+            input0[i] = static_cast<T>(i + 1.1);
+            input1[i] = 2.0 * static_cast<T>(i + 0.7);
+            Output0[i] = static_cast<T>(0.0);
+            Output1[i] = static_cast<T>(0.0);
+        }
+        //Even selector elements are invalid
+        for (uint32 i = 0u; i < nOfSelectorElements; i++) {
+            selector0[i] = ((i % 2u) == 0u) ? 7u : 0u;
+            selector1[i] = 0u;
+        }
+        if (ok) {
+            ok &= gam.Execute();
+        }
+        //Check output
+        for (uint32 i = 0u; (i < nOfElements) && ok; i++) {
+            uint32 selectorIdx = (nOfSelectorElements == 1u) ? 0u : i;
+            if ((selectorIdx % 2u) == 0u) {
+                ok &= (Output0[i] == input1[i]);
+            }
+            else {
+                ok &= (Output0[i] == input0[i]);
+            }
+            if (ok) {
+                ok &= (Output1[i] == input0[i]);
+            }
+        }
+    }
+    return ok;
+}
+
+template<typename T>
+bool MuxGAMTest::TestExecute4I2OInvalidSelectorHold(StreamString strType,
+                                                    uint32 nOfElements,
+                                                    uint32 nOfSelectorElements) {
+    MuxGAMTestHelper gam;
+    bool ok = gam.config.Write("InvalidSelector", "Hold");
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.Setup4Inputs2Outputs(strType, nOfElements, nOfSelectorElements);
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+
+    if (ok) {
+        ok &= gam.Setup();
+    }
+    if (ok) {
+        uint32 * selector0 = static_cast<uint32 *>(gam.GetInputSignalsMemory(0u));
+        uint32 * selector1 = static_cast<uint32 *>(gam.GetInputSignalsMemory(1u));
+        T * input0 = static_cast<T *>(gam.GetInputSignalsMemory(2u));
+        T * input1 = static_cast<T *>(gam.GetInputSignalsMemory(3u));
+        T * Output0 = static_cast<T *>(gam.GetOutputSignalsMemory(0u));
+        T * Output1 = static_cast<T *>(gam.GetOutputSignalsMemory(1u));
+        //initialize inputs
+        for (uint32 i = 0u; i < nOfElements; i++) {
+            input0[i] = static_cast<T>(i + 1.1);
+            input1[i] = 2.0 * static_cast<T>(i + 0.7);
+            Output0[i] = static_cast<T>(0.0);
+            Output1[i] = static_cast<T>(0.0);
+        }
+        //Valid selectors
+        for (uint32 i = 0u; i < nOfSelectorElements; i++) {
+            selector0[i] = 1u;
+            selector1[i] = 0u;
+        }
+        if (ok) {
+            ok &= gam.Execute();
+        }
+        //Even selector elements are invalid: the previous selector value is kept
+        for (uint32 i = 0u; i < nOfSelectorElements; i++) {
+            selector0[i] = ((i % 2u) == 0u) ? 7u : 0u;
+            selector1[i] = ((i % 2u) == 0u) ? 2u : 1u;
+        }
+        if (ok) {
+            ok &= gam.Execute();
+        }
+        //Check output
+        for (uint32 i = 0u; (i < nOfElements) && ok; i++) {
+            uint32 selectorIdx = (nOfSelectorElements == 1u) ? 0u : i;
+            if ((selectorIdx % 2u) == 0u) {
+                ok &= (Output0[i] == input1[i]);
+                if (ok) {
+                    ok &= (Output1[i] == input0[i]);
+                }
+            }
+            else {
+                ok &= (Output0[i] == input0[i]);
+                if (ok) {
+                    ok &= (Output1[i] == input1[i]);
+                }
+            }
+        }
+    }
+    return ok;
+}
 }
 
 #endif /* MUXGAMTEST_H_ */
@@ -315,5 +315,29 @@ TEST(PIDGAMGTest, TestExecuteSaturationki3) {
     ASSERT_TRUE(test.TestExecuteSaturationki3());
 }
 
+TEST(PIDGAMGTest, TestInitialiseParameterArrays) {
+    PIDGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseParameterArrays());
+}
+
+TEST(PIDGAMGTest, TestInitialiseWrongParameterArrays) {
+    PIDGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseWrongParameterArrays());
+}
+
+TEST(PIDGAMGTest, TestInitialiseWrongSaturationLimitsArray) {
+    PIDGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseWrongSaturationLimitsArray());
+}
+
+TEST(PIDGAMGTest, TestSetupWrongParameterElements) {
+    PIDGAMTest test;
+    ASSERT_TRUE(test.TestSetupWrongParameterElements());
+}
+
+TEST(PIDGAMGTest, TestExecuteMultiLoop) {
+    PIDGAMTest test;
+    ASSERT_TRUE(test.TestExecuteMultiLoop());
+}
 
 
@@ -97,7 +97,7 @@ public:
 
         ok = configSignals.CreateAbsolute("Signals.InputSignals");
         ok &= configSignals.CreateRelative("0");
-        ok &= configSignals.Write("NumberOfElements", 1);
+        ok &= configSignals.Write("NumberOfElements", numberOfElements);
         ok &= configSignals.Write("DataSource", "Reference");
         ok &= configSignals.Write("NumberOfDimensions", 1);
         ok &= configSignals.Write("Type", "float64");
@@ -116,7 +116,7 @@ public:
         ok &= configSignals.MoveToRoot();
         ok &= configSignals.CreateAbsolute("Signals.OutputSignals");
         ok &= configSignals.CreateRelative("0");
-        ok &= configSignals.Write("NumberOfElements", 1);
+        ok &= configSignals.Write("NumberOfElements", numberOfElements);
         ok &= configSignals.Write("DataSource", "Reference");
         ok &= configSignals.Write("NumberOfDimensions", 1);
         ok &= configSignals.Write("Type", "float64");
@@ -145,14 +145,14 @@ public:
 
         ok = configSignals.CreateAbsolute("Signals.InputSignals");
         ok &= configSignals.CreateRelative("0");
-        ok &= configSignals.Write("NumberOfElements", 1);
+        ok &= configSignals.Write("NumberOfElements", numberOfElements);
         ok &= configSignals.Write("DataSource", "Reference");
         ok &= configSignals.Write("NumberOfDimensions", 1);
         ok &= configSignals.Write("Type", "float64");
         ok &= configSignals.Write("ByteSize", byteSizePerSignal);
         ok &= configSignals.MoveAbsolute("Signals.InputSignals");
         ok &= configSignals.CreateRelative("1");
-        ok &= configSignals.Write("NumberOfElements", 1);
+        ok &= configSignals.Write("NumberOfElements", numberOfElements);
         ok &= configSignals.Write("DataSource", "Measurement");
         ok &= configSignals.Write("NumberOfDimensions", 1);
         ok &= configSignals.Write("Type", "float64");
@@ -177,7 +177,7 @@ public:
         ok &= configSignals.MoveToRoot();
         ok &= configSignals.CreateAbsolute("Signals.OutputSignals");
         ok &= configSignals.CreateRelative("0");
-        ok &= configSignals.Write("NumberOfElements", 1);
+        ok &= configSignals.Write("NumberOfElements", numberOfElements);
         ok &= configSignals.Write("DataSource", "Reference");
         ok &= configSignals.Write("NumberOfDimensions", 1);
         ok &= configSignals.Write("Type", "float64");
@@ -2415,5 +2415,133 @@ bool PIDGAMTest::TestExecuteSaturationki3() {
     return ret;
 }
 
+bool PIDGAMTest::TestInitialiseParameterArrays() {
+    PIDGAM gam;
+    bool ret;
+    ConfigurationDatabase config;
+    float64 kp[3] = { 1.0, 0.0, 2.0 };
+    config.Write("Kp", kp);
+    float64 ki = 1.0;
+    config.Write("Ki", ki);
+    float64 sampleTime = 0.001;
+    config.Write("SampleTime", sampleTime);
+    float64 maxOutput[3] = { 1.0, 2.0, 3.0 };
+    config.Write("MaxOutput", maxOutput);
+    float64 minOutput = -1.0;
+    config.Write("MinOutput", minOutput);
+    ret = gam.Initialise(config);
+    return ret;
+}
+
+bool PIDGAMTest::TestInitialiseWrongParameterArrays() {
+    PIDGAM gam;
+    bool ret;
+    ConfigurationDatabase config;
+    float64 kp[3] = { 1.0, 1.5, 2.0 };
+    config.Write("Kp", kp);
+    float64 ki[2] = { 1.0, 1.0 };
+    config.Write("Ki", ki);
+    float64 sampleTime = 0.001;
+    config.Write("SampleTime", sampleTime);
+    ret = !gam.Initialise(config);
+    return ret;
+}
+
+bool PIDGAMTest::TestInitialiseWrongSaturationLimitsArray() {
+    PIDGAM gam;
+    bool ret;
+    ConfigurationDatabase config;
+    float64 kp = 1.1;
+    config.Write("Kp", kp);
+    float64 sampleTime = 0.001;
+    config.Write("SampleTime", sampleTime);
+    float64 maxOutput[3] = { 1.0, -2.0, 3.0 };
+    config.Write("MaxOutput", maxOutput);
+    float64 minOutput = -1.0;
+    config.Write("MinOutput", minOutput);
+    ret = !gam.Initialise(config);
+    return ret;
+}
+
+bool PIDGAMTest::TestSetupWrongParameterElements() {
+    bool ret;
+    PIDGAMTestHelper gam(1.0, 1.2, 1.3, 0.001, 0x1.FFFFFFFFFFFFFp1023, -0x1.FFFFFFFFFFFFFp1023, 2u);
+    float64 kp[3] = { 1.0, 1.5, 2.0 };
+    ret = gam.config.Write("Kp", kp);
+    float64 sampleTime = 0.001;
+    ret &= gam.config.Write("SampleTime", sampleTime);
+    ret &= gam.Initialise(gam.config);
+    ret &= gam.HelperSetup2();
+    ret &= gam.SetConfiguredDatabase(gam.configSignals);
+    ret &= gam.AllocateInputSignalsMemory();
+    ret &= gam.AllocateOutputSignalsMemory();
+    if (ret) {
+        ret = !gam.Setup();
+    }
+    return ret;
+}
+
+bool PIDGAMTest::TestExecuteMultiLoop() {
+    bool ret;
+    const uint32 numberOfElements = 20u;
+    PIDGAMTestHelper gam(0, 500, 0, 0.001, 0.2, -0.2, numberOfElements);
+    float64 ki = 500.0;
+    ret = gam.config.Write("Ki", ki);
+    float64 sampleTime = 0.001;
+    ret &= gam.config.Write("SampleTime", sampleTime);
+    float64 maxOutput[numberOfElements];
+    float64 minOutput[numberOfElements];
+    for (uint32 j = 0u; j < numberOfElements; j++) {
+        if ((j % 2u) == 1u) {
+            maxOutput[j] = 0.2;
+            minOutput[j] = -0.2;
+        }
+        else {
+            maxOutput[j] = 1000.0;
+            minOutput[j] = -1000.0;
+        }
+    }
+    ret &= gam.config.Write("MaxOutput", maxOutput);
+    ret &= gam.config.Write("MinOutput", minOutput);
+    ret &= gam.Initialise(gam.config);
+
+    ret &= gam.HelperSetup2();
+    ret &= gam.SetConfiguredDatabase(gam.configSignals);
+    ret &= gam.AllocateInputSignalsMemory();
+    ret &= gam.AllocateOutputSignalsMemory();
+    ret &= gam.Setup();
+
+    float64 *gamMemoryInR = static_cast<float64 *>(gam.GetInputSignalsMemory());
+    float64 *gamMemoryInM = static_cast<float64 *>(gam.GetInputSignalsMemory(1));
+    float64 *gamMemoryOut = static_cast<float64 *>(gam.GetOutputSignalsMemory());
+    const uint32 maxRep = 7u;
+    //Same values as TestExecuteSaturationki2Subtract
+    float64 expectedSaturated[maxRep] = { 0.2, 0.2, 0.2, -0.1, -0.05, -0.025, -0.0125 };
+    //Without saturation the integral term accumulates the error
+    float64 expectedFree[maxRep] = { 0.5, 0.75, 0.875, 0.4375, 0.21875, 0.109375, 0.0546875 };
+
+    for (uint32 j = 0u; j < numberOfElements; j++) {
+        gamMemoryInM[j] = 0.0;
+        gamMemoryInR[j] = 1.0;
+    }
+    for (uint32 i = 0u; (i < maxRep) && ret; i++) {
+        if (i == 3u) {
+            for (uint32 j = 0u; j < numberOfElements; j++) {
+                gamMemoryInR[j] = 0.0;
+            }
+        }
+        gam.Execute();
+        for (uint32 j = 0u; (j < numberOfElements) && ret; j++) {
+            float64 expectedValue = ((j % 2u) == 1u) ? expectedSaturated[i] : expectedFree[i];
+            ret &= gam.IsEqualLargerMargins(gamMemoryOut[j], expectedValue);
+            if (!ret) {
+                printf("output value = %.17lf. expectedValue = %.17lf. index = %u element = %u\n", gamMemoryOut[j], expectedValue, i, j);
+            }
+            gamMemoryInM[j] = gamMemoryOut[j];
+        }
+    }
+    return ret;
+}
+
 }
 
@@ -345,6 +345,33 @@ public:
      */
     bool TestExecuteSaturationki3();
 
+    /**
+     * @brief Test the PIDGAM::Initialise() with array and scalar gains and saturation limits.
+     */
+    bool TestInitialiseParameterArrays();
+
+    /**
+     * @brief Test the PIDGAM::Initialise() with gain arrays of different sizes.
+     */
+    bool TestInitialiseWrongParameterArrays();
+
+    /**
+     * @brief Test the PIDGAM::Initialise() with an element of the MaxOutput array smaller than the MinOutput.
+     */
+    bool TestInitialiseWrongSaturationLimitsArray();
+
+    /**
+     * @brief Test the PIDGAM::Setup() with gain arrays which do not match the number of signal elements.
+     */
+    bool TestSetupWrongParameterElements();
+
+    /**
+     * @brief Test the PIDGAM::Execute() with a bank of PIDs.
+     * @details The odd elements behave as the PID of TestExecuteSaturationki2Subtract and the even elements as the same
+     * PID without saturation. The number of elements is larger than the block size of the GAM.
+     */
+    bool TestExecuteMultiLoop();
+
 
 };
 
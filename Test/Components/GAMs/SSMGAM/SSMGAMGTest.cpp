@@ -244,6 +244,41 @@ TEST(SSMGAMGTest, TestPrepareNextStateNoMemoryAllocated2) {
     ASSERT_TRUE(test.TestPrepareNextStateNoMemoryAllocated(1));
 }
 
+TEST(SSMGAMGTest, TestExecuteShiftRegister) {
+    SSMGAMTest test;
+    ASSERT_TRUE(test.TestExecuteShiftRegister());
+}
+
+TEST(SSMGAMGTest, TestExecuteShiftRegisterSparseStorage) {
+    SSMGAMTest test;
+    ASSERT_TRUE(test.TestExecuteShiftRegisterSparseStorage());
+}
+
+TEST(SSMGAMGTest, TestExecuteShiftRegisterSparseMatrix) {
+    SSMGAMTest test;
+    ASSERT_TRUE(test.TestExecuteShiftRegisterSparseMatrix());
+}
+
+TEST(SSMGAMGTest, TestExecuteShiftRegisterSamples) {
+    SSMGAMTest test;
+    ASSERT_TRUE(test.TestExecuteShiftRegisterSamples());
+}
+
+TEST(SSMGAMGTest, TestInitialiseWrongSparseMatrix) {
+    SSMGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseWrongSparseMatrix());
+}
+
+TEST(SSMGAMGTest, TestInitialiseWrongSparseFeedthroughMatrix) {
+    SSMGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseWrongSparseFeedthroughMatrix());
+}
+
+TEST(SSMGAMGTest, TestInitialiseWrongMatrixStorage) {
+    SSMGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseWrongMatrixStorage());
+}
+
 
 }
 
@@ -38,7 +38,10 @@
 /*---------------------------------------------------------------------------*/
 
 namespace {
-
+/**
+ * Number of states of the shift register model. The number of outputs plus the number of states is not a multiple of the cache line.
+ */
+const MARTe::uint32 SSMGAM_TEST_SHIFT_REGISTER_STATES = 12u;
 }
 
 /*---------------------------------------------------------------------------*/
@@ -357,6 +360,198 @@ SSMGAMTestHelper    () {
         float64 minLarger = 2 * *min;
         return ((f1-f2)<(minLarger)) && ((f1-f2)>-(minLarger));
     }
+    bool InitialiseConfigShiftRegister(const char8 * const matrixStorage = NULL_PTR(const char8 *)) {
+        bool ok = true;
+        //x[k+1][0] = u[k], x[k+1][i] = x[k][i - 1]
+        float64 stateMatrix[SSMGAM_TEST_SHIFT_REGISTER_STATES][SSMGAM_TEST_SHIFT_REGISTER_STATES];
+        float64 inputMatrix[SSMGAM_TEST_SHIFT_REGISTER_STATES][1];
+        //y[k] = sum((i + 1) * x[k][i]) + 0.5 * u[k]
+        float64 outputMatrix[1][SSMGAM_TEST_SHIFT_REGISTER_STATES];
+        for (uint32 i = 0u; i < SSMGAM_TEST_SHIFT_REGISTER_STATES; i++) {
+            for (uint32 j = 0u; j < SSMGAM_TEST_SHIFT_REGISTER_STATES; j++) {
+                stateMatrix[i][j] = ((i > 0u) && (j == (i - 1u))) ? 1.0 : 0.0;
+            }
+            inputMatrix[i][0] = (i == 0u) ? 1.0 : 0.0;
+            outputMatrix[0][i] = static_cast<float64>(i + 1u);
+        }
+        Matrix<float64> matrix(&stateMatrix[0][0], SSMGAM_TEST_SHIFT_REGISTER_STATES, SSMGAM_TEST_SHIFT_REGISTER_STATES);
+        ok &= config.Write("StateMatrix", matrix);
+        Matrix<float64> matrix2(&inputMatrix[0][0], SSMGAM_TEST_SHIFT_REGISTER_STATES, 1u);
+        ok &= config.Write("InputMatrix", matrix2);
+        Matrix<float64> matrix3(&outputMatrix[0][0], 1u, SSMGAM_TEST_SHIFT_REGISTER_STATES);
+        ok &= config.Write("OutputMatrix", matrix3);
+        float64 feedthoughMatrix[1][1];
+        feedthoughMatrix[0][0] = 0.5;
+        Matrix<float64> matrix4(&feedthoughMatrix[0][0], 1u, 1u);
+        ok &= config.Write("FeedthroughMatrix", matrix4);
+        ok &= config.Write("ResetInEachState", 0);
+        if (matrixStorage != NULL_PTR(const char8 *)) {
+            ok &= config.Write("MatrixStorage", matrixStorage);
+        }
+        return ok;
+    }
+
+    /**
+     * Same model as InitialiseConfigShiftRegister() with the state matrix in CSR form.
+     */
+    bool InitialiseConfigShiftRegisterSparse(const uint32 lastColumnIndex = (SSMGAM_TEST_SHIFT_REGISTER_STATES - 2u)) {
+        bool ok = true;
+        uint32 rowPointers[SSMGAM_TEST_SHIFT_REGISTER_STATES + 1u];
+        uint32 columnIndices[SSMGAM_TEST_SHIFT_REGISTER_STATES - 1u];
+        float64 values[SSMGAM_TEST_SHIFT_REGISTER_STATES - 1u];
+        rowPointers[0u] = 0u;
+        rowPointers[1u] = 0u;
+        for (uint32 i = 1u; i < SSMGAM_TEST_SHIFT_REGISTER_STATES; i++) {
+            columnIndices[i - 1u] = i - 1u;
+            values[i - 1u] = 1.0;
+            rowPointers[i + 1u] = i;
+        }
+        columnIndices[SSMGAM_TEST_SHIFT_REGISTER_STATES - 2u] = lastColumnIndex;
+        ok &= config.CreateRelative("StateMatrix");
+        ok &= config.Write("NumberOfRows", SSMGAM_TEST_SHIFT_REGISTER_STATES);
+        ok &= config.Write("NumberOfColumns", SSMGAM_TEST_SHIFT_REGISTER_STATES);
+        Vector<float64> valuesVector(&values[0], SSMGAM_TEST_SHIFT_REGISTER_STATES - 1u);
+        ok &= config.Write("Values", valuesVector);
+        Vector<uint32> columnIndicesVector(&columnIndices[0], SSMGAM_TEST_SHIFT_REGISTER_STATES - 1u);
+        ok &= config.Write("ColumnIndices", columnIndicesVector);
+        Vector<uint32> rowPointersVector(&rowPointers[0], SSMGAM_TEST_SHIFT_REGISTER_STATES + 1u);
+        ok &= config.Write("RowPointers", rowPointersVector);
+        ok &= config.MoveToAncestor(1u);
+
+        float64 inputMatrix[SSMGAM_TEST_SHIFT_REGISTER_STATES][1];
+        float64 outputMatrix[1][SSMGAM_TEST_SHIFT_REGISTER_STATES];
+        for (uint32 i = 0u; i < SSMGAM_TEST_SHIFT_REGISTER_STATES; i++) {
+            inputMatrix[i][0] = (i == 0u) ? 1.0 : 0.0;
+            outputMatrix[0][i] = static_cast<float64>(i + 1u);
+        }
+        Matrix<float64> matrix2(&inputMatrix[0][0], SSMGAM_TEST_SHIFT_REGISTER_STATES, 1u);
+        ok &= config.Write("InputMatrix", matrix2);
+        Matrix<float64> matrix3(&outputMatrix[0][0], 1u, SSMGAM_TEST_SHIFT_REGISTER_STATES);
+        ok &= config.Write("OutputMatrix", matrix3);
+        float64 feedthoughMatrix[1][1];
+        feedthoughMatrix[0][0] = 0.5;
+        Matrix<float64> matrix4(&feedthoughMatrix[0][0], 1u, 1u);
+        ok &= config.Write("FeedthroughMatrix", matrix4);
+        ok &= config.Write("ResetInEachState", 0);
+        return ok;
+    }
+
+    /**
+     * Initialises and executes the shift register model, numberOfSamples samples per Execute(), and checks the states and the output.
+     */
+    bool ExecuteShiftRegister(const uint32 numberOfSamples = 1u) {
+        bool ok = true;
+        const uint32 numberOfStates = SSMGAM_TEST_SHIFT_REGISTER_STATES;
+        ok &= Initialise(config);
+        if (ok) {
+            ok &= InitialiseConfigSignals(1u, 1u + numberOfStates, numberOfSamples);
+        }
+        if (ok) {
+            ok &= SetConfiguredDatabase(configSignals);
+        }
+        if (ok) {
+            ok &= AllocateInputSignalsMemory();
+            ok &= AllocateOutputSignalsMemory();
+        }
+        if (ok) {
+            ok &= Setup();
+        }
+        const uint32 numberOfCycles = 20u;
+        float64 inputs[numberOfCycles];
+        for (uint32 k = 0u; (k < numberOfCycles) && (ok); k++) {
+            inputs[k] = static_cast<float64>(k + 1u);
+        }
+        for (uint32 k0 = 0u; ((k0 + numberOfSamples) <= numberOfCycles) && (ok); k0 += numberOfSamples) {
+            float64 *gamMemoryIn = static_cast<float64 *>(GetInputSignalsMemory(0u));
+            for (uint32 s = 0u; s < numberOfSamples; s++) {
+                gamMemoryIn[s] = inputs[k0 + s];
+            }
+            ok = Execute();
+            for (uint32 s = 0u; (s < numberOfSamples) && (ok); s++) {
+                const uint32 k = k0 + s;
+                float64 expectedOutput = 0.5 * inputs[k];
+                for (uint32 i = 0u; (i < numberOfStates) && (ok); i++) {
+                    //The state i holds the input of i + 1 cycles before
+                    float64 expectedState = (k > i) ? inputs[k - i - 1u] : 0.0;
+                    expectedOutput += static_cast<float64>(i + 1u) * expectedState;
+                    float64 *gamMemoryOutState = static_cast<float64 *>(GetOutputSignalsMemory(1u + i));
+                    ok = IsEqualLargerMargins(gamMemoryOutState[s], expectedState);
+                    if (!ok) {
+                        printf("cycle %u state %u = %.16lf. expected = %.16lf\n", k, i, gamMemoryOutState[s], expectedState);
+                    }
+                }
+                if (ok) {
+                    float64 *gamMemoryOutVector = static_cast<float64 *>(GetOutputSignalsMemory(0u));
+                    ok = IsEqualLargerMargins(gamMemoryOutVector[s], expectedOutput);
+                    if (!ok) {
+                        printf("cycle %u output = %.16lf. expected = %.16lf\n", k, gamMemoryOutVector[s], expectedOutput);
+                    }
+                }
+            }
+        }
+        return ok;
+    }
+
+    bool InitialiseConfigSignals(uint32 numberOfInputs,
+                                 uint32 numberOfOutputs,
+                                 uint32 numberOfSamples = 1u) {
+        bool ok = true;
+        ok &= configSignals.CreateAbsolute("Signals.InputSignals");
+        for (uint32 i = 0u; i < numberOfInputs; i++) {
+            StreamString signalIndex;
+            ok &= signalIndex.Printf("%u", i);
+            ok &= configSignals.CreateRelative(signalIndex.Buffer());
+            ok &= configSignals.Write("Type", "float64");
+            ok &= configSignals.Write("NumberOfElements", 1);
+            ok &= configSignals.Write("NumberOfDimensions", 0);
+            ok &= configSignals.Write("DataSource", "TestDataSource");
+            ok &= configSignals.Write("ByteSize", numberOfSamples * 8u);
+            ok &= configSignals.MoveToAncestor(1u);
+        }
+        ok &= configSignals.Write("ByteSize", numberOfInputs * numberOfSamples * 8u);
+
+        ok &= configSignals.CreateAbsolute("Signals.OutputSignals");
+        for (uint32 i = 0u; i < numberOfOutputs; i++) {
+            StreamString signalIndex;
+            ok &= signalIndex.Printf("%u", i);
+            ok &= configSignals.CreateRelative(signalIndex.Buffer());
+            ok &= configSignals.Write("Type", "float64");
+            ok &= configSignals.Write("NumberOfElements", 1);
+            ok &= configSignals.Write("NumberOfDimensions", 0);
+            ok &= configSignals.Write("DataSource", "DataSourceOutputVector");
+            ok &= configSignals.Write("ByteSize", numberOfSamples * 8u);
+            ok &= configSignals.MoveToAncestor(1u);
+        }
+        ok &= configSignals.Write("ByteSize", numberOfOutputs * numberOfSamples * 8u);
+
+        ok &= configSignals.CreateAbsolute("Memory.InputSignals");
+        ok &= configSignals.CreateRelative("0");
+        ok &= configSignals.Write("DataSource", "TestDataSource");
+        ok &= configSignals.CreateRelative("Signals");
+        for (uint32 i = 0u; i < numberOfInputs; i++) {
+            StreamString signalIndex;
+            ok &= signalIndex.Printf("%u", i);
+            ok &= configSignals.CreateRelative(signalIndex.Buffer());
+            ok &= configSignals.Write("Samples", numberOfSamples);
+            ok &= configSignals.MoveToAncestor(1u);
+        }
+
+        ok &= configSignals.CreateAbsolute("Memory.OutputSignals");
+        ok &= configSignals.CreateRelative("0");
+        ok &= configSignals.Write("DataSource", "DataSourceOutputVector");
+        ok &= configSignals.CreateRelative("Signals");
+        for (uint32 i = 0u; i < numberOfOutputs; i++) {
+            StreamString signalIndex;
+            ok &= signalIndex.Printf("%u", i);
+            ok &= configSignals.CreateRelative(signalIndex.Buffer());
+            ok &= configSignals.Write("Samples", numberOfSamples);
+            ok &= configSignals.MoveToAncestor(1u);
+        }
+
+        ok &= configSignals.MoveToRoot();
+        return ok;
+    }
+
     ConfigurationDatabase config;
     ConfigurationDatabase configSignals;
 };
@@ -2011,5 +2206,87 @@ bool SSMGAMTest::TestPrepareNextStateNoMemoryAllocated(uint32 resetEachStateConf
     return ok;
 }
 
+bool SSMGAMTest::TestExecuteShiftRegister() {
+    bool ok = true;
+    SSMGAMTestHelper gam;
+    ok &= gam.InitialiseConfigShiftRegister();
+    if (ok) {
+        ok &= gam.ExecuteShiftRegister();
+    }
+    return ok;
+}
+
+bool SSMGAMTest::TestExecuteShiftRegisterSparseStorage() {
+    bool ok = true;
+    SSMGAMTestHelper gam;
+    ok &= gam.InitialiseConfigShiftRegister("Sparse");
+    if (ok) {
+        ok &= gam.ExecuteShiftRegister();
+    }
+    return ok;
+}
+
+bool SSMGAMTest::TestExecuteShiftRegisterSparseMatrix() {
+    bool ok = true;
+    SSMGAMTestHelper gam;
+    ok &= gam.InitialiseConfigShiftRegisterSparse();
+    if (ok) {
+        ok &= gam.ExecuteShiftRegister();
+    }
+    return ok;
+}
+
+bool SSMGAMTest::TestExecuteShiftRegisterSamples() {
+    bool ok = true;
+    SSMGAMTestHelper gam;
+    ok &= gam.InitialiseConfigShiftRegister();
+    if (ok) {
+        ok &= gam.ExecuteShiftRegister(4u);
+    }
+    return ok;
+}
+
+bool SSMGAMTest::TestInitialiseWrongSparseMatrix() {
+    bool ok = true;
+    SSMGAMTestHelper gam;
+    ok &= gam.InitialiseConfigShiftRegisterSparse(SSMGAM_TEST_SHIFT_REGISTER_STATES);
+    if (ok) {
+        ok &= !gam.Initialise(gam.config);
+    }
+    return ok;
+}
+
+bool SSMGAMTest::TestInitialiseWrongSparseFeedthroughMatrix() {
+    bool ok = true;
+    SSMGAMTestHelper gam;
+    ok &= gam.InitialiseConfigShiftRegister();
+    ok &= gam.config.Delete("FeedthroughMatrix");
+    ok &= gam.config.CreateRelative("FeedthroughMatrix");
+    float64 values[1] = { 0.5 };
+    uint32 columnIndices[1] = { 0u };
+    uint32 rowPointers[2] = { 0u, 1u };
+    Vector<float64> valuesVector(&values[0], 1u);
+    ok &= gam.config.Write("Values", valuesVector);
+    Vector<uint32> columnIndicesVector(&columnIndices[0], 1u);
+    ok &= gam.config.Write("ColumnIndices", columnIndicesVector);
+    Vector<uint32> rowPointersVector(&rowPointers[0], 2u);
+    ok &= gam.config.Write("RowPointers", rowPointersVector);
+    ok &= gam.config.MoveToAncestor(1u);
+    if (ok) {
+        ok &= !gam.Initialise(gam.config);
+    }
+    return ok;
+}
+
+bool SSMGAMTest::TestInitialiseWrongMatrixStorage() {
+    bool ok = true;
+    SSMGAMTestHelper gam;
+    ok &= gam.InitialiseConfigShiftRegister("Compressed");
+    if (ok) {
+        ok &= !gam.Initialise(gam.config);
+    }
+    return ok;
+}
+
 }
 
@@ -276,6 +276,50 @@ public:
      */
     bool TestPrepareNextStateNoMemoryAllocated(uint32 resetEachState);
 
+    /**
+     * @brief Test SSM::Execute() with more states than a cache line of coefficients.
+     * @details The system is a shift register of 12 states with one input and one output. The output is a
+     * weighted sum of the states and of the input.
+     * @return true if the states and the output are as expected.
+     */
+    bool TestExecuteShiftRegister();
+
+    /**
+     * @brief Test SSM::Execute() with MatrixStorage = Sparse.
+     * @return true if the states and the output are the same as in TestExecuteShiftRegister().
+     */
+    bool TestExecuteShiftRegisterSparseStorage();
+
+    /**
+     * @brief Test SSM::Execute() with the state matrix in CSR form.
+     * @return true if the states and the output are the same as in TestExecuteShiftRegister().
+     */
+    bool TestExecuteShiftRegisterSparseMatrix();
+
+    /**
+     * @brief Test SSM::Execute() with 4 samples per signal.
+     * @return true if each sample of the states and of the output is the same as in TestExecuteShiftRegister().
+     */
+    bool TestExecuteShiftRegisterSamples();
+
+    /**
+     * @brief Test SSM::Initialise() with a column index of the CSR state matrix out of range.
+     * @return true if Initialise() fails.
+     */
+    bool TestInitialiseWrongSparseMatrix();
+
+    /**
+     * @brief Test SSM::Initialise() with the feedthrough matrix in CSR form without NumberOfRows and NumberOfColumns.
+     * @return true if Initialise() fails.
+     */
+    bool TestInitialiseWrongSparseFeedthroughMatrix();
+
+    /**
+     * @brief Test SSM::Initialise() with an unknown MatrixStorage.
+     * @return true if Initialise() fails.
+     */
+    bool TestInitialiseWrongMatrixStorage();
+
 };
 
 }
@@ -0,0 +1,76 @@
+/**
+ * @file SimulinkClassesGTest.cpp
+ * @brief Source file for class SimulinkClassesGTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SimulinkClassesGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "SimulinkClassesTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+
+TEST(SimulinkClassesGTest, TestSetupTransposition) {
+    SimulinkClassesTest test;
+    ASSERT_TRUE(test.TestSetupTransposition());
+}
+
+TEST(SimulinkClassesGTest, TestSetupTransposition_Failed_UnsupportedType) {
+    SimulinkClassesTest test;
+    ASSERT_TRUE(test.TestSetupTransposition_Failed_UnsupportedType());
+}
+
+TEST(SimulinkClassesGTest, TestTransposeAndCopy_UInt8) {
+    SimulinkClassesTest test;
+    ASSERT_TRUE(test.TestTransposeAndCopy_UInt8());
+}
+
+TEST(SimulinkClassesGTest, TestTransposeAndCopy_Int16) {
+    SimulinkClassesTest test;
+    ASSERT_TRUE(test.TestTransposeAndCopy_Int16());
+}
+
+TEST(SimulinkClassesGTest, TestTransposeAndCopy_Float32) {
+    SimulinkClassesTest test;
+    ASSERT_TRUE(test.TestTransposeAndCopy_Float32());
+}
+
+TEST(SimulinkClassesGTest, TestTransposeAndCopy_Float64) {
+    SimulinkClassesTest test;
+    ASSERT_TRUE(test.TestTransposeAndCopy_Float64());
+}
+
+TEST(SimulinkClassesGTest, TestTransposeAndCopy_NoSetup) {
+    SimulinkClassesTest test;
+    ASSERT_TRUE(test.TestTransposeAndCopy_NoSetup());
+}
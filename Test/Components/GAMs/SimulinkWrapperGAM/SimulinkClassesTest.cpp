@@ -0,0 +1,194 @@
+/**
+ * @file SimulinkClassesTest.cpp
+ * @brief Source file for class SimulinkClassesTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SimulinkClassesTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "SimulinkClassesTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * @brief Gives access to SimulinkDataI::TransposeAndCopy() for testing.
+ */
+class SimulinkParameterHelper: public MARTe::SimulinkParameter {
+public:
+
+    SimulinkParameterHelper(const MARTe::TypeDescriptor &typeIn,
+                            const MARTe::uint32 numberOfRows,
+                            const MARTe::uint32 numberOfColumns) : MARTe::SimulinkParameter() {
+        type = typeIn;
+        numberOfDimensions = 2u;
+        numberOfElements[0u] = numberOfRows;
+        numberOfElements[1u] = numberOfColumns;
+        totalNumberOfElements = numberOfRows * numberOfColumns;
+        orientation = rtwCAPI_MATRIX_COL_MAJOR;
+    }
+
+    bool CallTransposeAndCopy(void * const destination,
+                              const void * const source) {
+        return TransposeAndCopy(destination, source);
+    }
+};
+
+/**
+ * Number of shapes tested by TestTransposeAndCopy().
+ */
+static const MARTe::uint32 SIMULINKCLASSESTEST_NUMBER_OF_SHAPES = 20u;
+
+/**
+ * Rows and columns of the shapes tested by TestTransposeAndCopy():
+ * scalar, 1xN, Nx1, multiples of the SSE2 blocks, shapes that are not
+ * multiples of 2 or 4, shapes across and multiple of the 32x32 tile.
+ */
+static const MARTe::uint32 SIMULINKCLASSESTEST_SHAPES[SIMULINKCLASSESTEST_NUMBER_OF_SHAPES][2u] = {
+    { 1u, 1u }, { 1u, 7u }, { 7u, 1u }, { 1u, 70u }, { 70u, 1u },
+    { 2u, 2u }, { 4u, 4u }, { 4u, 8u }, { 3u, 5u }, { 5u, 3u },
+    { 6u, 10u }, { 7u, 9u }, { 33u, 5u }, { 5u, 33u }, { 31u, 33u },
+    { 70u, 70u }, { 32u, 32u }, { 64u, 32u }, { 32u, 96u }, { 64u, 64u }
+};
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+bool SimulinkClassesTest::TestSetupTransposition() {
+    
+    const TypeDescriptor types[10u] = { UnsignedInteger8Bit, SignedInteger8Bit, UnsignedInteger16Bit, SignedInteger16Bit,
+                                        UnsignedInteger32Bit, SignedInteger32Bit, Float32Bit,
+                                        UnsignedInteger64Bit, SignedInteger64Bit, Float64Bit };
+    bool ok = true;
+    for (uint32 typeIdx = 0u; (typeIdx < 10u) && ok; typeIdx++) {
+        SimulinkParameterHelper matrix(types[typeIdx], 3u, 5u);
+        ok = matrix.SetupTransposition();
+        if (ok) {
+            SimulinkParameterHelper vector(types[typeIdx], 1u, 5u);
+            ok = vector.SetupTransposition();
+        }
+    }
+    
+    return ok;
+}
+
+bool SimulinkClassesTest::TestSetupTransposition_Failed_UnsupportedType() {
+    
+    SimulinkParameterHelper matrix(CharString, 2u, 2u);
+    char8 source[4u] = { 'a', 'b', 'c', 'd' };
+    char8 destination[4u] = { '\0', '\0', '\0', '\0' };
+    
+    bool ok = !matrix.SetupTransposition();
+    if (ok) {
+        ok = !matrix.CallTransposeAndCopy(&destination[0u], &source[0u]);
+    }
+    
+    return ok;
+}
+
+template<typename T>
+bool SimulinkClassesTest::TestTransposeAndCopy(const TypeDescriptor &type) {
+    
+    bool ok = true;
+    for (uint32 shapeIdx = 0u; (shapeIdx < SIMULINKCLASSESTEST_NUMBER_OF_SHAPES) && ok; shapeIdx++) {
+        
+        const uint32 numberOfRows    = SIMULINKCLASSESTEST_SHAPES[shapeIdx][0u];
+        const uint32 numberOfColumns = SIMULINKCLASSESTEST_SHAPES[shapeIdx][1u];
+        const uint32 numberOfValues  = numberOfRows * numberOfColumns;
+        
+        // Column-major source with a distinct value in each element (modulo the type range)
+        T *source      = new T[numberOfValues];
+        T *destination = new T[numberOfValues + 1u];
+        for (uint32 valueIdx = 0u; valueIdx < numberOfValues; valueIdx++) {
+            source[valueIdx] = static_cast<T>((valueIdx * 7u) + 1u);
+            destination[valueIdx] = static_cast<T>(0u);
+        }
+        const T guard = static_cast<T>(99u);
+        destination[numberOfValues] = guard;
+        
+        SimulinkParameterHelper parameter(type, numberOfRows, numberOfColumns);
+        ok = parameter.SetupTransposition();
+        if (ok) {
+            ok = parameter.CallTransposeAndCopy(destination, source);
+        }
+        
+        // Element by element reference
+        for (uint32 rowIdx = 0u; (rowIdx < numberOfRows) && ok; rowIdx++) {
+            for (uint32 colIdx = 0u; (colIdx < numberOfColumns) && ok; colIdx++) {
+                ok = (destination[colIdx + (numberOfColumns * rowIdx)] == source[rowIdx + (numberOfRows * colIdx)]);
+                if (!ok) {
+                    REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Wrong element (%u, %u) of a %u x %u matrix of %u-byte elements",
+                                        rowIdx, colIdx, numberOfRows, numberOfColumns, static_cast<uint32>(sizeof(T)));
+                }
+            }
+        }
+        if (ok) {
+            ok = (destination[numberOfValues] == guard);
+        }
+        
+        delete[] source;
+        delete[] destination;
+    }
+    
+    return ok;
+}
+
+bool SimulinkClassesTest::TestTransposeAndCopy_UInt8() {
+    return TestTransposeAndCopy<uint8>(UnsignedInteger8Bit);
+}
+
+bool SimulinkClassesTest::TestTransposeAndCopy_Int16() {
+    return TestTransposeAndCopy<int16>(SignedInteger16Bit);
+}
+
+bool SimulinkClassesTest::TestTransposeAndCopy_Float32() {
+    return TestTransposeAndCopy<float32>(Float32Bit);
+}
+
+bool SimulinkClassesTest::TestTransposeAndCopy_Float64() {
+    return TestTransposeAndCopy<float64>(Float64Bit);
+}
+
+bool SimulinkClassesTest::TestTransposeAndCopy_NoSetup() {
+    
+    SimulinkParameterHelper matrix(SignedInteger32Bit, 2u, 3u);
+    // column-major [1 2 3; 4 5 6]
+    int32 source[6u] = { 1, 4, 2, 5, 3, 6 };
+    int32 destination[6u] = { 0, 0, 0, 0, 0, 0 };
+    
+    bool ok = matrix.CallTransposeAndCopy(&destination[0u], &source[0u]);
+    for (uint32 valueIdx = 0u; (valueIdx < 6u) && ok; valueIdx++) {
+        ok = (destination[valueIdx] == static_cast<int32>(valueIdx + 1u));
+    }
+    
+    return ok;
+}
@@ -0,0 +1,104 @@
+/**
+ * @file SimulinkClassesTest.h
+ * @brief Header file for class SimulinkClassesTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class SimulinkClassesTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SIMULINKCLASSESTEST_H_
+#define SIMULINKCLASSESTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "SimulinkClasses.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+/**
+ * @brief Tests the transposition of the SimulinkDataI objects
+ *        (SetupTransposition() and TransposeAndCopy()) without a model.
+ */
+class SimulinkClassesTest {
+public:
+
+    /**
+     * @brief   Tests the SetupTransposition() method.
+     * @return  `true` if SetupTransposition() succeeds for all the numeric types.
+     */
+    bool TestSetupTransposition();
+    
+    /**
+     * @brief   Tests that SetupTransposition() and TransposeAndCopy() fail
+     *          on a non numeric type.
+     * @return  `true` if both methods fail.
+     */
+    bool TestSetupTransposition_Failed_UnsupportedType();
+    
+    /**
+     * @brief   Tests TransposeAndCopy() against an element by element
+     *          reference for a set of shapes: scalar, 1xN, Nx1, shapes
+     *          that are not multiples of the SSE2 blocks (2 and 4),
+     *          shapes larger than a tile (32) and multiples of the tile.
+     * @param[in] type a type with elements of sizeof(T) bytes.
+     * @return  `true` if all the transposed matrices match the reference
+     *          and no byte after the destination is written.
+     */
+    template<typename T>
+    bool TestTransposeAndCopy(const MARTe::TypeDescriptor &type);
+    
+    /**
+     * @brief TestTransposeAndCopy() with 1-byte elements.
+     */
+    bool TestTransposeAndCopy_UInt8();
+    
+    /**
+     * @brief TestTransposeAndCopy() with 2-byte elements.
+     */
+    bool TestTransposeAndCopy_Int16();
+    
+    /**
+     * @brief TestTransposeAndCopy() with 4-byte elements (SSE2 TransposeTile<uint32>).
+     */
+    bool TestTransposeAndCopy_Float32();
+    
+    /**
+     * @brief TestTransposeAndCopy() with 8-byte elements (SSE2 TransposeTile<uint64>).
+     */
+    bool TestTransposeAndCopy_Float64();
+    
+    /**
+     * @brief   Tests that TransposeAndCopy() calls SetupTransposition()
+     *          if it was not called before.
+     * @return  `true` if the matrix is transposed.
+     */
+    bool TestTransposeAndCopy_NoSetup();
+
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SIMULINKCLASSESTEST_H_ */
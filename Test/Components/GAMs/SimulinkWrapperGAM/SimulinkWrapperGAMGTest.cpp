@@ -292,11 +292,21 @@ TEST(SimulinkWrapperGAMGTest, TestExecute_WithStructuredSignals) {
     ASSERT_TRUE(test.TestExecute_WithStructuredSignals());
 }
 
+TEST(SimulinkWrapperGAMGTest, TestExecute_WithStructuredSignals_MergeContiguousCopies) {
+    SimulinkWrapperGAMTest test;
+    ASSERT_TRUE(test.TestExecute_WithStructuredSignals(true));
+}
+
 TEST(SimulinkWrapperGAMGTest, Test_MultiMixedSignalsTranspose) {
     SimulinkWrapperGAMTest test;
     ASSERT_TRUE(test.Test_MultiMixedSignalsTranspose(true));
 }
 
+TEST(SimulinkWrapperGAMGTest, Test_MultiMixedSignalsTranspose_MergeContiguousCopies) {
+    SimulinkWrapperGAMTest test;
+    ASSERT_TRUE(test.Test_MultiMixedSignalsTranspose(true, true));
+}
+
 #ifdef ROW_MAJOR_ND_FEATURE
 
 TEST(SimulinkWrapperGAMGTest, Test_MultiMixedSignalsNorm) {
@@ -326,6 +336,26 @@ TEST(SimulinkWrapperGAMGTest, TestSetup_StructTunableParametersFromExternalSourc
     ASSERT_TRUE(test.TestSetup_StructTunableParametersFromExternalSource_Failed());
 }
 
+TEST(SimulinkWrapperGAMGTest, TestUpdateParameters) {
+    SimulinkWrapperGAMTest test;
+    ASSERT_TRUE(test.TestUpdateParameters());
+}
+
+TEST(SimulinkWrapperGAMGTest, TestUpdateParameters_Failed_NotEnabled) {
+    SimulinkWrapperGAMTest test;
+    ASSERT_TRUE(test.TestUpdateParameters_Failed_NotEnabled());
+}
+
+TEST(SimulinkWrapperGAMGTest, TestUpdateParameters_Failed_InvalidParameter) {
+    SimulinkWrapperGAMTest test;
+    ASSERT_TRUE(test.TestUpdateParameters_Failed_InvalidParameter());
+}
+
+TEST(SimulinkWrapperGAMGTest, TestUpdateParameters_SkipInvalidParameter) {
+    SimulinkWrapperGAMTest test;
+    ASSERT_TRUE(test.TestUpdateParameters_SkipInvalidParameter());
+}
+
 #ifdef ENUM_FEATURE
 TEST(SimulinkWrapperGAMGTest, TestSetup_WithOutputEnumSignals) {
     SimulinkWrapperGAMTest test;
@@ -3436,13 +3436,15 @@ bool SimulinkWrapperGAMTest::Test_StructuredSignals() {
     return ok;
 }
 
-bool SimulinkWrapperGAMTest::TestExecute_WithStructuredSignals() {
+bool SimulinkWrapperGAMTest::TestExecute_WithStructuredSignals(const bool mergeContiguousCopies) {
 
     StreamString scriptCall = "createTestModel('hasStructSignals', true, 'hasInputs', true);";
 
     StreamString skipUnlinkedParams = "1";
 
-    StreamString inputSignals = ""
+    // The GAM options are inserted in the GAM block together with the signals
+    StreamString inputSignals = mergeContiguousCopies ? "MergeContiguousCopies = 1 " : "";
+    inputSignals += ""
         "InputSignals = { "
         "    In1_Structured = { "
         "        In1_ScalarDouble  = { "
@@ -3659,7 +3661,7 @@ bool SimulinkWrapperGAMTest::Test_StructuredSignals_Failed() {
     return ok;
 }
 
-bool SimulinkWrapperGAMTest::Test_MultiMixedSignalsTranspose(bool transpose) {
+bool SimulinkWrapperGAMTest::Test_MultiMixedSignalsTranspose(bool transpose, const bool mergeContiguousCopies) {
     StreamString scriptCall;
 
     if(transpose) {
@@ -3672,7 +3674,9 @@ bool SimulinkWrapperGAMTest::Test_MultiMixedSignalsTranspose(bool transpose) {
 
     StreamString skipUnlinkedParams = "1";
 
-    StreamString inputSignals = ""
+    // The GAM options are inserted in the GAM block together with the signals
+    StreamString inputSignals = mergeContiguousCopies ? "MergeContiguousCopies = 1 " : "";
+    inputSignals += ""
         "InputSignals = { "
         "    In1_Structured = { "
         "        In1_ScalarDouble  = { "
@@ -4295,6 +4299,376 @@ bool SimulinkWrapperGAMTest::TestSetup_StructTunableParametersFromExternalSource
     return ok;
 }
 
+bool SimulinkWrapperGAMTest::TestUpdateParameters() {
+    
+    StreamString scriptCall = "createTestModel('hasStructParams', true, 'hasTunableParams', true);";
+    
+    StreamString skipUnlinkedParams = "1";
+    
+    // The GAM options are inserted in the GAM block together with the signals
+    StreamString inputSignals = ""
+        "EnableParameterUpdates = 1 "
+        "InputSignals = { "
+        "In1_ScalarDouble  = {"
+        "    DataSource = Drv1"
+        "    Type = float64"
+        "    NumberOfElements = 1"
+        "    NumberOfDimensions = 0"
+        "}"
+        "In2_ScalarUint32  = {"
+        "    DataSource = Drv1"
+        "    Type = uint32"
+        "    NumberOfElements = 1"
+        "    NumberOfDimensions = 0"
+        "}"
+        "}";
+
+    StreamString outputSignals = ""
+        "OutputSignals = { "
+        "Out1_ScalarDouble = {"
+        "    DataSource = DDB1"
+        "    Type = float64"
+        "    NumberOfElements = 1"
+        "    NumberOfDimensions = 0"
+        "}"
+        "Out2_ScalarUint32  = {"
+        "    DataSource = DDB1"
+        "    Type = uint32"
+        "    NumberOfElements = 1"
+        "    NumberOfDimensions = 0"
+        "}"
+        "}";
+
+    StreamString parameters = "";
+        
+    StreamString modelName, modelFolder, modelFullPath;
+    
+    // Create the test model
+    modelName = testEnvironment.CreateTestModel(scriptCall);
+    
+    // Retrieve working directory from the test environment
+    modelFolder = testEnvironment.modelFolder;
+    
+    // Compose model library full path
+    modelFullPath  = modelFolder;
+    modelFullPath += "/";
+    modelFullPath += modelName;
+    modelFullPath += ".so";
+    
+    // Insert model name and build folder in the configuration buffer template
+    StreamString config;
+    config.Printf(configTemplate.Buffer(),
+                  modelFullPath.Buffer(),
+                  modelName.Buffer(),
+                  "ByteArray",
+                  "0",
+                  skipUnlinkedParams.Buffer(),
+                  inputSignals.Buffer(),
+                  outputSignals.Buffer(),
+                  parameters.Buffer()
+                 );
+    
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ok = parser.Parse();
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    
+    // External source with the first value of the parameter
+    ReferenceT<ReferenceContainer> cfgParameterContainer("ReferenceContainer", GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ReferenceT<AnyObject> objParam("AnyObject", GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    if (ok) {
+        cfgParameterContainer->SetName("ExtSource");
+        ok = ObjectRegistryDatabase::Instance()->Insert(cfgParameterContainer);
+    }
+    if (ok) {
+        float64 param = 1.0;
+        AnyType anyParam(param);
+        ok = objParam->Serialise(anyParam);
+    }
+    if (ok) {
+        objParam->SetName("structScalar-one");
+        ok = cfgParameterContainer->Insert(objParam);
+    }
+    
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    
+    ReferenceT<SimulinkWrapperGAMHelper> gam;
+    if (ok) {
+        gam = god->Find("Test.Functions.GAM1");
+        ok = gam.IsValid();
+    }
+    
+    float64* parameterAddress = NULL_PTR(float64*);
+    if (ok) {
+        for (uint32 paramIdx = 0u; paramIdx < gam->GetNumOfPars(); paramIdx++) {
+            if (gam->GetParameter(paramIdx)->fullName == "structScalar-one") {
+                parameterAddress = static_cast<float64*>(gam->GetParameter(paramIdx)->address);
+            }
+        }
+        ok = (parameterAddress != NULL_PTR(float64*));
+    }
+    if (ok) {
+        ok = (*parameterAddress == 1.0);
+    }
+    
+    // Reload the external source with a new value
+    if (ok) {
+        ok = cfgParameterContainer->Delete(objParam);
+    }
+    ReferenceT<AnyObject> newObjParam("AnyObject", GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    if (ok) {
+        float64 param = 2.0;
+        AnyType anyParam(param);
+        ok = newObjParam->Serialise(anyParam);
+    }
+    if (ok) {
+        newObjParam->SetName("structScalar-one");
+        ok = cfgParameterContainer->Insert(newObjParam);
+    }
+    
+    // The new value is only staged by the RPC...
+    if (ok) {
+        ok = gam->UpdateParameters().ErrorsCleared();
+    }
+    if (ok) {
+        ok = (*parameterAddress == 1.0);
+    }
+    
+    // ...and copied in the model memory by Execute()
+    if (ok) {
+        ok = gam->Execute();
+    }
+    if (ok) {
+        ok = (*parameterAddress == 2.0);
+    }
+
+    god->Purge();
+    
+    return ok;
+}
+
+bool SimulinkWrapperGAMTest::TestUpdateParameters_Failed_NotEnabled() {
+    
+    SimulinkWrapperGAM gam;
+    
+    return !gam.UpdateParameters().ErrorsCleared();
+}
+
+bool SimulinkWrapperGAMTest::TestUpdateParameters_Failed_InvalidParameter() {
+    return TestUpdateParametersWithInvalidParameter(false);
+}
+
+bool SimulinkWrapperGAMTest::TestUpdateParameters_SkipInvalidParameter() {
+    return TestUpdateParametersWithInvalidParameter(true);
+}
+
+bool SimulinkWrapperGAMTest::TestUpdateParametersWithInvalidParameter(const bool skipInvalid) {
+    
+    StreamString scriptCall = "createTestModel('hasStructParams', true, 'hasTunableParams', true);";
+    
+    StreamString skipInvalidTunableParams = skipInvalid ? "1" : "0";
+    
+    // The GAM options are inserted in the GAM block together with the signals
+    StreamString inputSignals = ""
+        "EnableParameterUpdates = 1 "
+        "InputSignals = { "
+        "In1_ScalarDouble  = {"
+        "    DataSource = Drv1"
+        "    Type = float64"
+        "    NumberOfElements = 1"
+        "    NumberOfDimensions = 0"
+        "}"
+        "In2_ScalarUint32  = {"
+        "    DataSource = Drv1"
+        "    Type = uint32"
+        "    NumberOfElements = 1"
+        "    NumberOfDimensions = 0"
+        "}"
+        "}";
+
+    StreamString outputSignals = ""
+        "OutputSignals = { "
+        "Out1_ScalarDouble = {"
+        "    DataSource = DDB1"
+        "    Type = float64"
+        "    NumberOfElements = 1"
+        "    NumberOfDimensions = 0"
+        "}"
+        "Out2_ScalarUint32  = {"
+        "    DataSource = DDB1"
+        "    Type = uint32"
+        "    NumberOfElements = 1"
+        "    NumberOfDimensions = 0"
+        "}"
+        "}";
+
+    StreamString parameters = "";
+        
+    StreamString modelName, modelFolder, modelFullPath;
+    
+    // Create the test model
+    modelName = testEnvironment.CreateTestModel(scriptCall);
+    
+    // Retrieve working directory from the test environment
+    modelFolder = testEnvironment.modelFolder;
+    
+    // Compose model library full path
+    modelFullPath  = modelFolder;
+    modelFullPath += "/";
+    modelFullPath += modelName;
+    modelFullPath += ".so";
+    
+    // Insert model name and build folder in the configuration buffer template
+    StreamString config;
+    config.Printf(configTemplate.Buffer(),
+                  modelFullPath.Buffer(),
+                  modelName.Buffer(),
+                  "ByteArray",
+                  "0",
+                  skipInvalidTunableParams.Buffer(),
+                  inputSignals.Buffer(),
+                  outputSignals.Buffer(),
+                  parameters.Buffer()
+                 );
+    
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ok = parser.Parse();
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    
+    // External source with the first values of the parameters
+    ReferenceT<ReferenceContainer> cfgParameterContainer("ReferenceContainer", GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ReferenceT<AnyObject> objParam("AnyObject", GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ReferenceT<AnyObject> objNestedParam("AnyObject", GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    if (ok) {
+        cfgParameterContainer->SetName("ExtSource");
+        ok = ObjectRegistryDatabase::Instance()->Insert(cfgParameterContainer);
+    }
+    if (ok) {
+        float64 param = 1.0;
+        AnyType anyParam(param);
+        ok = objParam->Serialise(anyParam);
+    }
+    if (ok) {
+        objParam->SetName("structScalar-one");
+        ok = cfgParameterContainer->Insert(objParam);
+    }
+    if (ok) {
+        float64 param = 1.0;
+        AnyType anyParam(param);
+        ok = objNestedParam->Serialise(anyParam);
+    }
+    if (ok) {
+        objNestedParam->SetName("structScalar-nested1-one");
+        ok = cfgParameterContainer->Insert(objNestedParam);
+    }
+    
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    
+    ReferenceT<SimulinkWrapperGAMHelper> gam;
+    if (ok) {
+        gam = god->Find("Test.Functions.GAM1");
+        ok = gam.IsValid();
+    }
+    
+    float64* parameterAddress       = NULL_PTR(float64*);
+    float64* nestedParameterAddress = NULL_PTR(float64*);
+    if (ok) {
+        for (uint32 paramIdx = 0u; paramIdx < gam->GetNumOfPars(); paramIdx++) {
+            if (gam->GetParameter(paramIdx)->fullName == "structScalar-one") {
+                parameterAddress = static_cast<float64*>(gam->GetParameter(paramIdx)->address);
+            }
+            if (gam->GetParameter(paramIdx)->fullName == "structScalar-nested1-one") {
+                nestedParameterAddress = static_cast<float64*>(gam->GetParameter(paramIdx)->address);
+            }
+        }
+        ok = (parameterAddress != NULL_PTR(float64*)) && (nestedParameterAddress != NULL_PTR(float64*));
+    }
+    if (ok) {
+        ok = (*parameterAddress == 1.0) && (*nestedParameterAddress == 1.0);
+    }
+    
+    // Reload the external source with a valid and an invalid (uint32 instead of float64) value
+    if (ok) {
+        ok = cfgParameterContainer->Delete(objParam);
+    }
+    if (ok) {
+        ok = cfgParameterContainer->Delete(objNestedParam);
+    }
+    ReferenceT<AnyObject> newObjParam("AnyObject", GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ReferenceT<AnyObject> newObjNestedParam("AnyObject", GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    if (ok) {
+        uint32 param = 2u;
+        AnyType anyParam(param);
+        ok = newObjParam->Serialise(anyParam);
+    }
+    if (ok) {
+        newObjParam->SetName("structScalar-one");
+        ok = cfgParameterContainer->Insert(newObjParam);
+    }
+    if (ok) {
+        float64 param = 5.0;
+        AnyType anyParam(param);
+        ok = newObjNestedParam->Serialise(anyParam);
+    }
+    if (ok) {
+        newObjNestedParam->SetName("structScalar-nested1-one");
+        ok = cfgParameterContainer->Insert(newObjNestedParam);
+    }
+    
+    // The invalid parameter fails the update only if it cannot be skipped
+    if (ok) {
+        ok = (gam->UpdateParameters().ErrorsCleared() == skipInvalid);
+    }
+    
+    // Execute() applies the staged set, if any
+    if (ok) {
+        ok = gam->Execute();
+    }
+    if (ok) {
+        ok = (*parameterAddress == 1.0);
+    }
+    if (ok) {
+        ok = (*nestedParameterAddress == (skipInvalid ? 5.0 : 1.0));
+    }
+
+    god->Purge();
+    
+    return ok;
+}
+
 #ifdef ENUM_FEATURE
 
 bool SimulinkWrapperGAMTest::TestSetup_WithOutputEnumSignals() {
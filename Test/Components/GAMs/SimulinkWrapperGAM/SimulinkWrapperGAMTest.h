@@ -361,14 +361,16 @@ public:
 
     /**
      * @brief Test execution and coherence when working in pure structured mode
+     * @param[in] mergeContiguousCopies value of the MergeContiguousCopies option.
      */
-    bool TestExecute_WithStructuredSignals();
+    bool TestExecute_WithStructuredSignals(const bool mergeContiguousCopies = false);
 
 
     /**
      * @brief Test execution and coherence when working with mixed signals and transposition takes place
+     * @param[in] mergeContiguousCopies value of the MergeContiguousCopies option.
      */
-    bool Test_MultiMixedSignalsTranspose(bool transpose);
+    bool Test_MultiMixedSignalsTranspose(bool transpose, const bool mergeContiguousCopies = false);
 
     /**
      * @brief Test the behaviour when working in pure structured signal mode, while enforcing
@@ -393,6 +395,40 @@ public:
      */
     bool TestSetup_StructTunableParametersFromExternalSource_Failed();
     
+    /**
+     * @brief Tests that UpdateParameters() stages a new value from the
+     *        external source and that Execute() applies it before the model step.
+     */
+    bool TestUpdateParameters();
+    
+    /**
+     * @brief Tests that UpdateParameters() fails if EnableParameterUpdates is not set.
+     */
+    bool TestUpdateParameters_Failed_NotEnabled();
+    
+    /**
+     * @brief Tests that, with SkipInvalidTunableParams = 0, UpdateParameters()
+     *        fails on a type-mismatched parameter and discards the whole staged set.
+     */
+    bool TestUpdateParameters_Failed_InvalidParameter();
+    
+    /**
+     * @brief Tests that, with SkipInvalidTunableParams = 1, UpdateParameters()
+     *        keeps the current value of a type-mismatched parameter and stages the others.
+     */
+    bool TestUpdateParameters_SkipInvalidParameter();
+    
+    /**
+     * @brief   Generic test of UpdateParameters() with a valid and an invalid new value.
+     * @details After Setup() the external source is reloaded with a new
+     *          value for `structScalar-nested1-one` and a uint32 value for
+     *          the float64 parameter `structScalar-one`. Execute() must not
+     *          change `structScalar-one` and must update `structScalar-nested1-one`
+     *          only if invalid parameters are skipped.
+     * @param[in] skipInvalid the SkipInvalidTunableParams value.
+     */
+    bool TestUpdateParametersWithInvalidParameter(const bool skipInvalid);
+    
 #ifdef ENUM_FEATURE
     /**
      * @brief Tests the setup of a model with enums in output signals
@@ -0,0 +1,362 @@
+/**
+ * @file StatisticsArrayHelperTGTest.cpp
+ * @brief Source file for class StatisticsArrayHelperTGTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class StatisticsArrayHelperTGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "gtest/gtest.h"
+#include "StatisticsArrayHelperTTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/* uint8 */
+
+TEST(StatisticsArrayHelperTGTest,TestConstructor_uint8) {
+    StatisticsArrayHelperTTest<uint8> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestConstructor(32, 16));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestReset_uint8) {
+    StatisticsArrayHelperTTest<uint8> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestReset(32, 16));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestPushSamples_uint8) {
+    StatisticsArrayHelperTTest<uint8> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestPushSamples(32, 13, false));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestPushSamples_InfiniteMaxMin_uint8) {
+    StatisticsArrayHelperTTest<uint8> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestPushSamples(16, 5, true));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestPushSamples_NonPowerOf2_uint8) {
+    StatisticsArrayHelperTTest<uint8> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestPushSamples(24, 5, false));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestGetAvg_OutOfRange_uint8) {
+    StatisticsArrayHelperTTest<uint8> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestGetAvg_OutOfRange(8, 4));
+}
+
+/* uint16 */
+
+TEST(StatisticsArrayHelperTGTest,TestConstructor_uint16) {
+    StatisticsArrayHelperTTest<uint16> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestConstructor(32, 16));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestReset_uint16) {
+    StatisticsArrayHelperTTest<uint16> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestReset(32, 16));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestPushSamples_uint16) {
+    StatisticsArrayHelperTTest<uint16> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestPushSamples(32, 13, false));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestPushSamples_InfiniteMaxMin_uint16) {
+    StatisticsArrayHelperTTest<uint16> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestPushSamples(16, 5, true));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestPushSamples_NonPowerOf2_uint16) {
+    StatisticsArrayHelperTTest<uint16> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestPushSamples(24, 5, false));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestGetAvg_OutOfRange_uint16) {
+    StatisticsArrayHelperTTest<uint16> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestGetAvg_OutOfRange(8, 4));
+}
+
+/* uint32 */
+
+TEST(StatisticsArrayHelperTGTest,TestConstructor_uint32) {
+    StatisticsArrayHelperTTest<uint32> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestConstructor(32, 16));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestReset_uint32) {
+    StatisticsArrayHelperTTest<uint32> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestReset(32, 16));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestPushSamples_uint32) {
+    StatisticsArrayHelperTTest<uint32> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestPushSamples(32, 13, false));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestPushSamples_InfiniteMaxMin_uint32) {
+    StatisticsArrayHelperTTest<uint32> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestPushSamples(16, 5, true));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestPushSamples_NonPowerOf2_uint32) {
+    StatisticsArrayHelperTTest<uint32> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestPushSamples(24, 5, false));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestGetAvg_OutOfRange_uint32) {
+    StatisticsArrayHelperTTest<uint32> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestGetAvg_OutOfRange(8, 4));
+}
+
+/* uint64 */
+
+TEST(StatisticsArrayHelperTGTest,TestConstructor_uint64) {
+    StatisticsArrayHelperTTest<uint64> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestConstructor(32, 16));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestReset_uint64) {
+    StatisticsArrayHelperTTest<uint64> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestReset(32, 16));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestPushSamples_uint64) {
+    StatisticsArrayHelperTTest<uint64> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestPushSamples(32, 13, false));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestPushSamples_InfiniteMaxMin_uint64) {
+    StatisticsArrayHelperTTest<uint64> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestPushSamples(16, 5, true));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestPushSamples_NonPowerOf2_uint64) {
+    StatisticsArrayHelperTTest<uint64> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestPushSamples(24, 5, false));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestGetAvg_OutOfRange_uint64) {
+    StatisticsArrayHelperTTest<uint64> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestGetAvg_OutOfRange(8, 4));
+}
+
+/* int8 */
+
+TEST(StatisticsArrayHelperTGTest,TestConstructor_int8) {
+    StatisticsArrayHelperTTest<int8> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestConstructor(32, 16));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestReset_int8) {
+    StatisticsArrayHelperTTest<int8> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestReset(32, 16));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestPushSamples_int8) {
+    StatisticsArrayHelperTTest<int8> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestPushSamples(32, 13, false));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestPushSamples_InfiniteMaxMin_int8) {
+    StatisticsArrayHelperTTest<int8> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestPushSamples(16, 5, true));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestPushSamples_NonPowerOf2_int8) {
+    StatisticsArrayHelperTTest<int8> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestPushSamples(24, 5, false));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestGetAvg_OutOfRange_int8) {
+    StatisticsArrayHelperTTest<int8> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestGetAvg_OutOfRange(8, 4));
+}
+
+/* int16 */
+
+TEST(StatisticsArrayHelperTGTest,TestConstructor_int16) {
+    StatisticsArrayHelperTTest<int16> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestConstructor(32, 16));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestReset_int16) {
+    StatisticsArrayHelperTTest<int16> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestReset(32, 16));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestPushSamples_int16) {
+    StatisticsArrayHelperTTest<int16> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestPushSamples(32, 13, false));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestPushSamples_InfiniteMaxMin_int16) {
+    StatisticsArrayHelperTTest<int16> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestPushSamples(16, 5, true));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestPushSamples_NonPowerOf2_int16) {
+    StatisticsArrayHelperTTest<int16> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestPushSamples(24, 5, false));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestGetAvg_OutOfRange_int16) {
+    StatisticsArrayHelperTTest<int16> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestGetAvg_OutOfRange(8, 4));
+}
+
+/* int32 */
+
+TEST(StatisticsArrayHelperTGTest,TestConstructor_int32) {
+    StatisticsArrayHelperTTest<int32> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestConstructor(32, 16));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestReset_int32) {
+    StatisticsArrayHelperTTest<int32> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestReset(32, 16));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestPushSamples_int32) {
+    StatisticsArrayHelperTTest<int32> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestPushSamples(32, 13, false));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestPushSamples_InfiniteMaxMin_int32) {
+    StatisticsArrayHelperTTest<int32> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestPushSamples(16, 5, true));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestPushSamples_NonPowerOf2_int32) {
+    StatisticsArrayHelperTTest<int32> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestPushSamples(24, 5, false));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestGetAvg_OutOfRange_int32) {
+    StatisticsArrayHelperTTest<int32> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestGetAvg_OutOfRange(8, 4));
+}
+
+/* int64 */
+
+TEST(StatisticsArrayHelperTGTest,TestConstructor_int64) {
+    StatisticsArrayHelperTTest<int64> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestConstructor(32, 16));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestReset_int64) {
+    StatisticsArrayHelperTTest<int64> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestReset(32, 16));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestPushSamples_int64) {
+    StatisticsArrayHelperTTest<int64> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestPushSamples(32, 13, false));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestPushSamples_InfiniteMaxMin_int64) {
+    StatisticsArrayHelperTTest<int64> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestPushSamples(16, 5, true));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestPushSamples_NonPowerOf2_int64) {
+    StatisticsArrayHelperTTest<int64> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestPushSamples(24, 5, false));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestGetAvg_OutOfRange_int64) {
+    StatisticsArrayHelperTTest<int64> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestGetAvg_OutOfRange(8, 4));
+}
+
+/* float32 */
+
+TEST(StatisticsArrayHelperTGTest,TestConstructor_float32) {
+    StatisticsArrayHelperTTest<float32> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestConstructor(32, 16));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestReset_float32) {
+    StatisticsArrayHelperTTest<float32> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestReset(32, 16));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestPushSamples_float32) {
+    StatisticsArrayHelperTTest<float32> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestPushSamples(32, 13, false));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestPushSamples_InfiniteMaxMin_float32) {
+    StatisticsArrayHelperTTest<float32> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestPushSamples(16, 5, true));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestPushSamples_NonPowerOf2_float32) {
+    StatisticsArrayHelperTTest<float32> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestPushSamples(24, 5, false));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestGetAvg_OutOfRange_float32) {
+    StatisticsArrayHelperTTest<float32> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestGetAvg_OutOfRange(8, 4));
+}
+
+/* float64 */
+
+TEST(StatisticsArrayHelperTGTest,TestConstructor_float64) {
+    StatisticsArrayHelperTTest<float64> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestConstructor(32, 16));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestReset_float64) {
+    StatisticsArrayHelperTTest<float64> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestReset(32, 16));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestPushSamples_float64) {
+    StatisticsArrayHelperTTest<float64> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestPushSamples(32, 13, false));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestPushSamples_InfiniteMaxMin_float64) {
+    StatisticsArrayHelperTTest<float64> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestPushSamples(16, 5, true));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestPushSamples_NonPowerOf2_float64) {
+    StatisticsArrayHelperTTest<float64> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestPushSamples(24, 5, false));
+}
+
+TEST(StatisticsArrayHelperTGTest,TestGetAvg_OutOfRange_float64) {
+    StatisticsArrayHelperTTest<float64> statisticsArrayHelperTTest;
+    ASSERT_TRUE(statisticsArrayHelperTTest.TestGetAvg_OutOfRange(8, 4));
+}
@@ -0,0 +1,225 @@
+/**
+ * @file StatisticsArrayHelperTTest.h
+ * @brief Header file for class StatisticsArrayHelperTTest
+ * @date 17/10/2026
+ * @author agent
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class StatisticsArrayHelperTTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef STATISTICSARRAYHELPERTTEST_H_
+#define STATISTICSARRAYHELPERTTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "StatisticsArrayHelperT.h"
+#include "StatisticsHelperT.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+template<typename Type>
+class StatisticsArrayHelperTTest {
+public:
+
+    /**
+     * @brief Tests the constructor.
+     */
+    bool TestConstructor(const uint32 windowSize,
+                         const uint32 nOfElements);
+
+    /**
+     * @brief Tests the Reset method.
+     */
+    bool TestReset(const uint32 windowSize,
+                   const uint32 nOfElements);
+
+    /**
+     * @brief Tests that each element of the PushSamples method gives the same statistics as a StatisticsHelperT.
+     */
+    bool TestPushSamples(const uint32 windowSize,
+                         const uint32 nOfElements,
+                         const bool infiniteMaxMin);
+
+    /**
+     * @brief Tests that the accessors fail for elements out of range.
+     */
+    bool TestGetAvg_OutOfRange(const uint32 windowSize,
+                               const uint32 nOfElements);
+};
+}
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+template<typename Type>
+bool StatisticsArrayHelperTTest<Type>::TestConstructor(const uint32 windowSize,
+                                                       const uint32 nOfElements) {
+    StatisticsArrayHelperT<Type> myStatisticsHelper(windowSize, nOfElements);
+    bool ok = (myStatisticsHelper.GetSize() == windowSize);
+    if (ok) {
+        ok = (myStatisticsHelper.GetNumberOfElements() == nOfElements);
+    }
+    if (ok) {
+        ok = (myStatisticsHelper.GetCounter() == 0u);
+    }
+    return ok;
+}
+
+template<typename Type>
+bool StatisticsArrayHelperTTest<Type>::TestReset(const uint32 windowSize,
+                                                 const uint32 nOfElements) {
+    StatisticsArrayHelperT<Type> myStatisticsHelper(windowSize, nOfElements);
+    Type *samples = new Type[nOfElements];
+    Type *sums = new Type[nOfElements];
+    for (uint32 e = 0u; e < nOfElements; e++) {
+        samples[e] = static_cast<Type>(e + 1u);
+    }
+    bool ok = myStatisticsHelper.PushSamples(samples);
+    if (ok) {
+        ok = (myStatisticsHelper.GetCounter() == 1u);
+    }
+    if (ok) {
+        ok = myStatisticsHelper.Reset();
+    }
+    if (ok) {
+        ok = (myStatisticsHelper.GetCounter() == 0u);
+    }
+    if (ok) {
+        ok = myStatisticsHelper.GetSum(sums, 0u, nOfElements);
+    }
+    for (uint32 e = 0u; (e < nOfElements) && (ok); e++) {
+        ok = (sums[e] == static_cast<Type>(0));
+    }
+    delete[] samples;
+    delete[] sums;
+    return ok;
+}
+
+template<typename Type>
+bool StatisticsArrayHelperTTest<Type>::TestPushSamples(const uint32 windowSize,
+                                                       const uint32 nOfElements,
+                                                       const bool infiniteMaxMin) {
+    StatisticsArrayHelperT<Type> myStatisticsHelper(windowSize, nOfElements);
+    StatisticsHelperT<Type> **references = new StatisticsHelperT<Type>*[nOfElements];
+    for (uint32 e = 0u; e < nOfElements; e++) {
+        references[e] = new StatisticsHelperT<Type>(windowSize);
+    }
+    Type *samples = new Type[nOfElements];
+    Type *avg = new Type[nOfElements];
+    Type *std = new Type[nOfElements];
+    Type *rms = new Type[nOfElements];
+    Type *min = new Type[nOfElements];
+    Type *max = new Type[nOfElements];
+    Type *sum = new Type[nOfElements];
+
+    uint32 seed = 1u;
+    bool ok = true;
+    for (uint32 i = 0u; (i < (4u * windowSize)) && (ok); i++) {
+        for (uint32 e = 0u; (e < nOfElements) && (ok); e++) {
+            seed = (seed * 1103515245u) + 12345u;
+            //Each element has a different offset and a small range so that the sums fit in all the types
+            samples[e] = static_cast<Type>(((seed >> 16u) % 8u) + (e % 4u));
+            ok = references[e]->PushSample(samples[e], infiniteMaxMin);
+        }
+        if (ok) {
+            ok = myStatisticsHelper.PushSamples(samples, infiniteMaxMin);
+        }
+        if (ok) {
+            ok = myStatisticsHelper.GetAvg(avg, 0u, nOfElements);
+        }
+        if (ok) {
+            ok = myStatisticsHelper.GetStd(std, 0u, nOfElements);
+        }
+        if (ok) {
+            ok = myStatisticsHelper.GetRms(rms, 0u, nOfElements);
+        }
+        if (ok) {
+            ok = myStatisticsHelper.GetMin(min, 0u, nOfElements);
+        }
+        if (ok) {
+            ok = myStatisticsHelper.GetMax(max, 0u, nOfElements);
+        }
+        if (ok) {
+            ok = myStatisticsHelper.GetSum(sum, 0u, nOfElements);
+        }
+        for (uint32 e = 0u; (e < nOfElements) && (ok); e++) {
+            ok = (avg[e] == references[e]->GetAvg());
+            if (ok) {
+                ok = (std[e] == references[e]->GetStd());
+            }
+            if (ok) {
+                ok = (rms[e] == references[e]->GetRms());
+            }
+            if (ok) {
+                ok = (min[e] == references[e]->GetMin());
+            }
+            if (ok) {
+                ok = (max[e] == references[e]->GetMax());
+            }
+            if (ok) {
+                ok = (sum[e] == references[e]->GetSum());
+            }
+        }
+        if (ok) {
+            ok = (myStatisticsHelper.GetCounter() == references[0]->GetCounter());
+        }
+    }
+
+    for (uint32 e = 0u; e < nOfElements; e++) {
+        delete references[e];
+    }
+    delete[] references;
+    delete[] samples;
+    delete[] avg;
+    delete[] std;
+    delete[] rms;
+    delete[] min;
+    delete[] max;
+    delete[] sum;
+    return ok;
+}
+
+template<typename Type>
+bool StatisticsArrayHelperTTest<Type>::TestGetAvg_OutOfRange(const uint32 windowSize,
+                                                             const uint32 nOfElements) {
+    StatisticsArrayHelperT<Type> myStatisticsHelper(windowSize, nOfElements);
+    Type *values = new Type[nOfElements + 1u];
+    bool ok = myStatisticsHelper.GetAvg(values, 1u, nOfElements - 1u);
+    if (ok) {
+        ok = !myStatisticsHelper.GetAvg(values, 1u, nOfElements);
+    }
+    if (ok) {
+        ok = !myStatisticsHelper.GetAvg(values, nOfElements + 1u, 0u);
+    }
+    if (ok) {
+        ok = !myStatisticsHelper.GetMax(NULL_PTR(Type *), 0u, 1u);
+    }
+    delete[] values;
+    return ok;
+}
+
+} /*namespace MARTe*/
+#endif /* STATISTICSARRAYHELPERTTEST_H_ */
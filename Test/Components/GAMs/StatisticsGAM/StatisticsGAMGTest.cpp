@@ -169,6 +169,16 @@ TEST(StatisticsGAMGTest,TestExecute_uint32_withAbsoluteMaxMin) {
     ASSERT_TRUE(test.TestExecute_uint32_withAbsoluteMaxMin());
 }
 
+TEST(StatisticsGAMGTest,TestSetup_MultipleSignals_WrongNumberOfOutputs) {
+    StatisticsGAMTest test;
+    ASSERT_TRUE(test.TestSetup_MultipleSignals_WrongNumberOfOutputs());
+}
+
+TEST(StatisticsGAMGTest,TestExecute_ArrayAndMultipleSignals) {
+    StatisticsGAMTest test;
+    ASSERT_TRUE(test.TestExecute_ArrayAndMultipleSignals());
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -197,6 +197,7 @@ SinkGAM    ();
     virtual bool Setup();
     virtual bool Execute();
     template <typename Type> bool GetInput (uint32 index, Type& value);
+    template <typename Type> bool GetInputArray (uint32 index, Type * const values, uint32 numberOfElements);
 };
 
 SinkGAM::SinkGAM() :
@@ -257,6 +258,31 @@ template<typename Type> bool SinkGAM::GetInput(uint32 signalIndex, Type& value)
     return ret;
 }
 
+template<typename Type> bool SinkGAM::GetInputArray(uint32 signalIndex, Type * const values, uint32 numberOfElements) {
+
+    bool ret = (GetNumberOfInputSignals() > signalIndex);
+
+    if (!ret) {
+        REPORT_ERROR_PARAMETERS(ErrorManagement::InitialisationError, "GetNumberOfInputSignals() <= %u", signalIndex);
+    }
+
+    uint32 signalNumberOfElements = 0u;
+
+    if (ret) {
+        ret = GetSignalNumberOfElements(InputSignals, signalIndex, signalNumberOfElements);
+    }
+
+    if (ret) {
+        ret = (signalNumberOfElements == numberOfElements);
+    }
+
+    if (ret) {
+        ret = MemoryOperationsHelper::Copy(values, GetInputSignalMemory(signalIndex), numberOfElements * sizeof(Type));
+    }
+
+    return ret;
+}
+
 CLASS_REGISTER(SinkGAM, "1.0")
 
 }
@@ -1400,3 +1426,266 @@ bool StatisticsGAMTest::TestExecute_uint32_withCycleCounter() {
 bool StatisticsGAMTest::TestExecute_uint32_withAbsoluteMaxMin() {
     return TestExecute_AnyType<MARTe::uint32>(324, 1, true);
 }
+
+bool StatisticsGAMTest::TestSetup_MultipleSignals_WrongNumberOfOutputs() {
+    const MARTe::char8 * const config = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +Constants = {"
+            "            Class = StatisticsGAMTestHelper_Constant"
+            "            OutputSignals = {"
+            "                Constant_1 = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    Default = 0.0"
+            "                }"
+            "                Constant_2 = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    Default = 0.0"
+            "                }"
+            "            }"
+            "        }"
+            "        +Statistics = {"
+            "            Class = StatisticsGAM"
+            "            WindowSize = 8"
+            "            InputSignals = {"
+            "               Constant_1 = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "               }"
+            "               Constant_2 = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "               }"
+            "            }"
+            "            OutputSignals = {"
+            "               Average_1 = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "               }"
+            "               Stdev_1 = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "               }"
+            "               Average_2 = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB"
+            "        +DDB = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Running = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {Constants Statistics}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ok = StatisticsGAMTestHelper::ConfigureApplication(config);
+    return !ok; // Expect failure
+}
+
+bool StatisticsGAMTest::TestExecute_ArrayAndMultipleSignals() {
+    const MARTe::char8 * const config = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +Constants = {"
+            "            Class = StatisticsGAMTestHelper_Constant"
+            "            OutputSignals = {"
+            "                Constant_array = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    NumberOfDimensions = 1"
+            "                    NumberOfElements = 4"
+            "                    Default = {1.0 2.0 3.0 4.0}"
+            "                }"
+            "                Constant_scalar = {"
+            "                    DataSource = DDB"
+            "                    Type = float32"
+            "                    Default = 5.0"
+            "                }"
+            "            }"
+            "        }"
+            "        +Statistics = {"
+            "            Class = StatisticsGAM"
+            "            WindowSize = 8"
+            "            InputSignals = {"
+            "               Constant_array = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               Constant_scalar = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "               }"
+            "            }"
+            "            OutputSignals = {"
+            "               Average_array = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               Stdev_array = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               Average_scalar = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "               }"
+            "               Stdev_scalar = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "               }"
+            "            }"
+            "        }"
+            "        +Sink = {"
+            "            Class = SinkGAM"
+            "            InputSignals = {"
+            "               Average_array = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               Stdev_array = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               Average_scalar = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "               }"
+            "               Stdev_scalar = {"
+            "                   DataSource = DDB"
+            "                   Type = float32"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB"
+            "        +DDB = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Running = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {Constants Statistics Sink}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ok = StatisticsGAMTestHelper::ConfigureApplication(config);
+
+    if (ok) {
+        using namespace MARTe;
+
+        ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+        ReferenceT<RealTimeApplication> application = god->Find("Test");
+        ReferenceT<SinkGAM> sink = application->Find("Functions.Sink");
+
+        ok = sink.IsValid();
+
+        if (ok) {
+            ok = StatisticsGAMTestHelper::StartApplication();
+        }
+
+        if (ok) {
+            Sleep::Sec(1.0);
+        }
+
+        float32 avgArray[4];
+        float32 stdArray[4];
+        float32 avgScalar = 0.0F;
+        float32 stdScalar = 0.0F;
+
+        if (ok) {
+            ok = sink->GetInputArray<float32>(0u, &avgArray[0], 4u);
+        }
+
+        if (ok) {
+            ok = sink->GetInputArray<float32>(1u, &stdArray[0], 4u);
+        }
+
+        if (ok) {
+            ok = sink->GetInput<float32>(2u, avgScalar);
+        }
+
+        if (ok) {
+            ok = sink->GetInput<float32>(3u, stdScalar);
+        }
+
+        uint32 i;
+        for (i = 0u; (i < 4u) && (ok); i++) {
+            ok = (avgArray[i] == static_cast<float32>(i + 1u));
+            if (ok) {
+                ok = (stdArray[i] == 0.0F);
+            }
+        }
+
+        if (ok) {
+            ok = (avgScalar == 5.0F);
+        }
+
+        if (ok) {
+            ok = (stdScalar == 0.0F);
+        }
+
+        if (ok) {
+            ok = StatisticsGAMTestHelper::StopApplication();
+        }
+    }
+
+    return ok;
+}
@@ -219,6 +219,19 @@ public:
      * @brief Tests the absolute Max/Min handling mode
      */
     bool TestExecute_uint32_withAbsoluteMaxMin();
+
+    /**
+     * @brief Tests the Setup() method
+     * @details The number of output signals is not a multiple of the number of input signals.
+     * @return true if Setup() fails.
+     */
+    bool TestSetup_MultipleSignals_WrongNumberOfOutputs();
+
+    /**
+     * @brief Tests the Execute method with an array and a scalar input signal.
+     * @return true if the statistics of each element are as expected.
+     */
+    bool TestExecute_ArrayAndMultipleSignals();
 };
 
 /*---------------------------------------------------------------------------*/
@@ -93,6 +93,11 @@ TEST(StatisticsHelperTGTest,TestGetAvg_1_uint8) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetAvg(32,1));
 }
 
+TEST(StatisticsHelperTGTest,TestGetAvg_NonPowerOf2_uint8) {
+    StatisticsHelperTTest<uint8> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetAvg_NonPowerOf2(24));
+}
+
 TEST(StatisticsHelperTGTest,TestGetMax_uint8) {
     StatisticsHelperTTest<uint8> statisticsHelperTTest;
     ASSERT_TRUE(statisticsHelperTTest.TestGetMax(32));
@@ -103,6 +108,11 @@ TEST(StatisticsHelperTGTest,TestGetMin_uint8) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetMin(32));
 }
 
+TEST(StatisticsHelperTGTest,TestGetMaxMinSlidingWindow_uint8) {
+    StatisticsHelperTTest<uint8> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMaxMinSlidingWindow(32));
+}
+
 TEST(StatisticsHelperTGTest,TestGetSum_uint8) {
     StatisticsHelperTTest<uint8> statisticsHelperTTest;
     ASSERT_TRUE(statisticsHelperTTest.TestGetSum(32));
@@ -165,6 +175,11 @@ TEST(StatisticsHelperTGTest,TestGetAvg_1_uint16) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetAvg(32,1));
 }
 
+TEST(StatisticsHelperTGTest,TestGetAvg_NonPowerOf2_uint16) {
+    StatisticsHelperTTest<uint16> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetAvg_NonPowerOf2(24));
+}
+
 TEST(StatisticsHelperTGTest,TestGetMax_uint16) {
     StatisticsHelperTTest<uint16> statisticsHelperTTest;
     ASSERT_TRUE(statisticsHelperTTest.TestGetMax(32));
@@ -175,6 +190,11 @@ TEST(StatisticsHelperTGTest,TestGetMin_uint16) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetMin(32));
 }
 
+TEST(StatisticsHelperTGTest,TestGetMaxMinSlidingWindow_uint16) {
+    StatisticsHelperTTest<uint16> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMaxMinSlidingWindow(32));
+}
+
 TEST(StatisticsHelperTGTest,TestGetSum_uint16) {
     StatisticsHelperTTest<uint16> statisticsHelperTTest;
     ASSERT_TRUE(statisticsHelperTTest.TestGetSum(32));
@@ -237,6 +257,11 @@ TEST(StatisticsHelperTGTest,TestGetAvg_1_uint32) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetAvg(32,1));
 }
 
+TEST(StatisticsHelperTGTest,TestGetAvg_NonPowerOf2_uint32) {
+    StatisticsHelperTTest<uint32> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetAvg_NonPowerOf2(24));
+}
+
 TEST(StatisticsHelperTGTest,TestGetMax_uint32) {
     StatisticsHelperTTest<uint32> statisticsHelperTTest;
     ASSERT_TRUE(statisticsHelperTTest.TestGetMax(32));
@@ -247,6 +272,16 @@ TEST(StatisticsHelperTGTest,TestGetMin_uint32) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetMin(32));
 }
 
+TEST(StatisticsHelperTGTest,TestGetMaxMinSlidingWindow_uint32) {
+    StatisticsHelperTTest<uint32> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMaxMinSlidingWindow(32));
+}
+
+TEST(StatisticsHelperTGTest,TestPushSampleWorstCase_uint32) {
+    StatisticsHelperTTest<uint32> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestPushSampleWorstCase(65536, 4));
+}
+
 TEST(StatisticsHelperTGTest,TestGetSum_uint32) {
     StatisticsHelperTTest<uint32> statisticsHelperTTest;
     ASSERT_TRUE(statisticsHelperTTest.TestGetSum(32));
@@ -309,6 +344,11 @@ TEST(StatisticsHelperTGTest,TestGetAvg_1_uint64) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetAvg(32,1));
 }
 
+TEST(StatisticsHelperTGTest,TestGetAvg_NonPowerOf2_uint64) {
+    StatisticsHelperTTest<uint64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetAvg_NonPowerOf2(24));
+}
+
 TEST(StatisticsHelperTGTest,TestGetMax_uint64) {
     StatisticsHelperTTest<uint64> statisticsHelperTTest;
     ASSERT_TRUE(statisticsHelperTTest.TestGetMax(32));
@@ -319,6 +359,16 @@ TEST(StatisticsHelperTGTest,TestGetMin_uint64) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetMin(32));
 }
 
+TEST(StatisticsHelperTGTest,TestGetMaxMinSlidingWindow_uint64) {
+    StatisticsHelperTTest<uint64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMaxMinSlidingWindow(32));
+}
+
+TEST(StatisticsHelperTGTest,TestPushSampleWorstCase_uint64) {
+    StatisticsHelperTTest<uint64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestPushSampleWorstCase(65536, 4));
+}
+
 TEST(StatisticsHelperTGTest,TestGetSum_uint64) {
     StatisticsHelperTTest<uint64> statisticsHelperTTest;
     ASSERT_TRUE(statisticsHelperTTest.TestGetSum(32));
@@ -381,6 +431,11 @@ TEST(StatisticsHelperTGTest,TestGetAvg_1_int8) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetAvg(32,1));
 }
 
+TEST(StatisticsHelperTGTest,TestGetAvg_NonPowerOf2_int8) {
+    StatisticsHelperTTest<int8> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetAvg_NonPowerOf2(24));
+}
+
 TEST(StatisticsHelperTGTest,TestGetMax_int8) {
     StatisticsHelperTTest<int8> statisticsHelperTTest;
     ASSERT_TRUE(statisticsHelperTTest.TestGetMax(32));
@@ -391,6 +446,11 @@ TEST(StatisticsHelperTGTest,TestGetMin_int8) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetMin(32));
 }
 
+TEST(StatisticsHelperTGTest,TestGetMaxMinSlidingWindow_int8) {
+    StatisticsHelperTTest<int8> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMaxMinSlidingWindow(32));
+}
+
 TEST(StatisticsHelperTGTest,TestGetSum_int8) {
     StatisticsHelperTTest<int8> statisticsHelperTTest;
     ASSERT_TRUE(statisticsHelperTTest.TestGetSum(32));
@@ -453,6 +513,11 @@ TEST(StatisticsHelperTGTest,TestGetAvg_1_int16) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetAvg(32,1));
 }
 
+TEST(StatisticsHelperTGTest,TestGetAvg_NonPowerOf2_int16) {
+    StatisticsHelperTTest<int16> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetAvg_NonPowerOf2(24));
+}
+
 TEST(StatisticsHelperTGTest,TestGetMax_int16) {
     StatisticsHelperTTest<int16> statisticsHelperTTest;
     ASSERT_TRUE(statisticsHelperTTest.TestGetMax(32));
@@ -463,6 +528,11 @@ TEST(StatisticsHelperTGTest,TestGetMin_int16) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetMin(32));
 }
 
+TEST(StatisticsHelperTGTest,TestGetMaxMinSlidingWindow_int16) {
+    StatisticsHelperTTest<int16> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMaxMinSlidingWindow(32));
+}
+
 TEST(StatisticsHelperTGTest,TestGetSum_int16) {
     StatisticsHelperTTest<int16> statisticsHelperTTest;
     ASSERT_TRUE(statisticsHelperTTest.TestGetSum(32));
@@ -525,6 +595,11 @@ TEST(StatisticsHelperTGTest,TestGetAvg_1_int32) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetAvg(32,1));
 }
 
+TEST(StatisticsHelperTGTest,TestGetAvg_NonPowerOf2_int32) {
+    StatisticsHelperTTest<int32> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetAvg_NonPowerOf2(24));
+}
+
 TEST(StatisticsHelperTGTest,TestGetMax_int32) {
     StatisticsHelperTTest<int32> statisticsHelperTTest;
     ASSERT_TRUE(statisticsHelperTTest.TestGetMax(32));
@@ -535,6 +610,16 @@ TEST(StatisticsHelperTGTest,TestGetMin_int32) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetMin(32));
 }
 
+TEST(StatisticsHelperTGTest,TestGetMaxMinSlidingWindow_int32) {
+    StatisticsHelperTTest<int32> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMaxMinSlidingWindow(32));
+}
+
+TEST(StatisticsHelperTGTest,TestPushSampleWorstCase_int32) {
+    StatisticsHelperTTest<int32> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestPushSampleWorstCase(65536, 4));
+}
+
 TEST(StatisticsHelperTGTest,TestGetSum_int32) {
     StatisticsHelperTTest<int32> statisticsHelperTTest;
     ASSERT_TRUE(statisticsHelperTTest.TestGetSum(32));
@@ -597,6 +682,11 @@ TEST(StatisticsHelperTGTest,TestGetAvg_1_int64) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetAvg(32,1));
 }
 
+TEST(StatisticsHelperTGTest,TestGetAvg_NonPowerOf2_int64) {
+    StatisticsHelperTTest<int64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetAvg_NonPowerOf2(24));
+}
+
 TEST(StatisticsHelperTGTest,TestGetMax_int64) {
     StatisticsHelperTTest<int64> statisticsHelperTTest;
     ASSERT_TRUE(statisticsHelperTTest.TestGetMax(32));
@@ -607,6 +697,16 @@ TEST(StatisticsHelperTGTest,TestGetMin_int64) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetMin(32));
 }
 
+TEST(StatisticsHelperTGTest,TestGetMaxMinSlidingWindow_int64) {
+    StatisticsHelperTTest<int64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMaxMinSlidingWindow(32));
+}
+
+TEST(StatisticsHelperTGTest,TestPushSampleWorstCase_int64) {
+    StatisticsHelperTTest<int64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestPushSampleWorstCase(65536, 4));
+}
+
 TEST(StatisticsHelperTGTest,TestGetSum_int64) {
     StatisticsHelperTTest<int64> statisticsHelperTTest;
     ASSERT_TRUE(statisticsHelperTTest.TestGetSum(32));
@@ -669,6 +769,11 @@ TEST(StatisticsHelperTGTest,TestGetAvg_1_float32) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetAvg(32,1));
 }
 
+TEST(StatisticsHelperTGTest,TestGetAvg_NoDrift_float32) {
+    StatisticsHelperTTest<float32> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetAvg_NoDrift(100, 4000000, 1e-3));
+}
+
 TEST(StatisticsHelperTGTest,TestGetMax_float32) {
     StatisticsHelperTTest<float32> statisticsHelperTTest;
     ASSERT_TRUE(statisticsHelperTTest.TestGetMax(32));
@@ -679,6 +784,16 @@ TEST(StatisticsHelperTGTest,TestGetMin_float32) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetMin(32));
 }
 
+TEST(StatisticsHelperTGTest,TestGetMaxMinSlidingWindow_float32) {
+    StatisticsHelperTTest<float32> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMaxMinSlidingWindow(32));
+}
+
+TEST(StatisticsHelperTGTest,TestPushSampleWorstCase_float32) {
+    StatisticsHelperTTest<float32> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestPushSampleWorstCase(65536, 4));
+}
+
 TEST(StatisticsHelperTGTest,TestGetSum_float32) {
     StatisticsHelperTTest<float32> statisticsHelperTTest;
     ASSERT_TRUE(statisticsHelperTTest.TestGetSum(32));
@@ -741,6 +856,11 @@ TEST(StatisticsHelperTGTest,TestGetAvg_1_float64) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetAvg(32,1));
 }
 
+TEST(StatisticsHelperTGTest,TestGetAvg_NoDrift_float64) {
+    StatisticsHelperTTest<float64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetAvg_NoDrift(100, 4000000, 1e-9));
+}
+
 TEST(StatisticsHelperTGTest,TestGetMax_float64) {
     StatisticsHelperTTest<float64> statisticsHelperTTest;
     ASSERT_TRUE(statisticsHelperTTest.TestGetMax(32));
@@ -751,6 +871,16 @@ TEST(StatisticsHelperTGTest,TestGetMin_float64) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetMin(32));
 }
 
+TEST(StatisticsHelperTGTest,TestGetMaxMinSlidingWindow_float64) {
+    StatisticsHelperTTest<float64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMaxMinSlidingWindow(32));
+}
+
+TEST(StatisticsHelperTGTest,TestPushSampleWorstCase_float64) {
+    StatisticsHelperTTest<float64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestPushSampleWorstCase(65536, 4));
+}
+
 TEST(StatisticsHelperTGTest,TestGetSum_float64) {
     StatisticsHelperTTest<float64> statisticsHelperTTest;
     ASSERT_TRUE(statisticsHelperTTest.TestGetSum(32));
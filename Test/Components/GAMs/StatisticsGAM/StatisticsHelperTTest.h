@@ -31,6 +31,7 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "HighResolutionTimer.h"
 #include "StatisticsHelperT.h"
 
 /*---------------------------------------------------------------------------*/
@@ -82,6 +83,21 @@ public:
      */
     bool TestGetAvg(const uint32 windowSize, const Type val);
 
+    /**
+     * @brief Tests the GetAvg method with a window size which is not a power of 2.
+     * @details Checks that the average is floor(sum / windowSize) after each sample.
+     */
+    bool TestGetAvg_NonPowerOf2(const uint32 windowSize);
+
+    /**
+     * @brief Tests that the GetAvg and GetStd methods do not drift after many samples.
+     * @details Pushes nOfSamples samples with a large offset and compares the statistics of
+     * the last window against a float64 computation.
+     */
+    bool TestGetAvg_NoDrift(const uint32 windowSize,
+                            const uint32 nOfSamples,
+                            const float64 tolerance);
+
     /**
      * @brief Tests the GetMax method.
      */
@@ -92,6 +108,20 @@ public:
      */
     bool TestGetMin(const uint32 windowSize);
 
+    /**
+     * @brief Tests the GetMax and GetMin methods against a brute force search over the time window.
+     */
+    bool TestGetMaxMinSlidingWindow(const uint32 windowSize);
+
+    /**
+     * @brief Benchmarks the PushSample method with monotonically decreasing and increasing signals,
+     * where each new sample evicts the maximum (respectively minimum) of the time window.
+     * @details Checks that the maximum and minimum are correct after each sample. The average time
+     * per PushSample() is only reported, as it depends on the host.
+     */
+    bool TestPushSampleWorstCase(const uint32 windowSize,
+                                 const uint32 numberOfWindows);
+
     /**
      * @brief Tests the GetRms method.
      */
@@ -213,6 +243,69 @@ bool StatisticsHelperTTest<Type>::TestGetAvg(const uint32 windowSize, const Type
     return (myStatisticsHelper.GetAvg() == val);
 }
 
+template<typename Type>
+bool StatisticsHelperTTest<Type>::TestGetAvg_NonPowerOf2(const uint32 windowSize) {
+    StatisticsHelperT<Type> myStatisticsHelper(windowSize);
+    bool ok = (myStatisticsHelper.GetSize() == windowSize);
+    const uint32 nOfSamples = 4u * windowSize;
+    int64 *samples = new int64[nOfSamples];
+    int64 offset = std::numeric_limits<Type>::is_signed ? 2 : 0;
+    uint32 seed = 7u;
+    for (uint32 i = 0u; (i < nOfSamples) && (ok); i++) {
+        seed = (seed * 1103515245u) + 12345u;
+        samples[i] = static_cast<int64>((seed >> 16u) % 4u) - offset;
+        ok = myStatisticsHelper.PushSample(static_cast<Type>(samples[i]));
+        int64 sum = 0;
+        uint32 first = (i >= windowSize) ? (i - windowSize + 1u) : (0u);
+        for (uint32 j = first; j <= i; j++) {
+            sum += samples[j];
+        }
+        int64 avg = sum / static_cast<int64>(windowSize);
+        if ((avg * static_cast<int64>(windowSize)) > sum) {
+            avg--;
+        }
+        if (ok) {
+            ok = (myStatisticsHelper.GetAvg() == static_cast<Type>(avg));
+        }
+    }
+    delete[] samples;
+    return ok;
+}
+
+template<typename Type>
+bool StatisticsHelperTTest<Type>::TestGetAvg_NoDrift(const uint32 windowSize,
+                                                     const uint32 nOfSamples,
+                                                     const float64 tolerance) {
+    StatisticsHelperT<Type> myStatisticsHelper(windowSize);
+    float64 *samples = new float64[windowSize];
+    uint32 seed = 3u;
+    bool ok = true;
+    for (uint32 i = 0u; (i < nOfSamples) && (ok); i++) {
+        seed = (seed * 1103515245u) + 12345u;
+        Type sample = static_cast<Type>(1000.0 + (static_cast<float64>((seed >> 8u) & 0xFFFFu) / 65536.0));
+        samples[i % windowSize] = static_cast<float64>(sample);
+        ok = myStatisticsHelper.PushSample(sample);
+    }
+    if (ok) {
+        float64 sum = 0.0;
+        float64 sumSq = 0.0;
+        for (uint32 j = 0u; j < windowSize; j++) {
+            sum += samples[j];
+            sumSq += samples[j] * samples[j];
+        }
+        float64 avg = sum / static_cast<float64>(windowSize);
+        float64 error = static_cast<float64>(myStatisticsHelper.GetAvg()) - avg;
+        ok = ((error < tolerance) && (error > -tolerance));
+        if (ok) {
+            float64 std = FastMath::SquareRoot<float64>((sumSq / static_cast<float64>(windowSize)) - (avg * avg));
+            REPORT_ERROR_STATIC(ErrorManagement::Information, "Average error after %d samples: %f, std %f (expected %f)", nOfSamples, error,
+                                static_cast<float64>(myStatisticsHelper.GetStd()), std);
+        }
+    }
+    delete[] samples;
+    return ok;
+}
+
 template<typename Type>
 bool StatisticsHelperTTest<Type>::TestGetMax(const uint32 windowSize) {
     StatisticsHelperT<Type> myStatisticsHelper(windowSize);
@@ -237,6 +330,75 @@ bool StatisticsHelperTTest<Type>::TestGetMin(const uint32 windowSize) {
     return (myStatisticsHelper.GetMin() == 0);
 }
 
+template<typename Type>
+bool StatisticsHelperTTest<Type>::TestGetMaxMinSlidingWindow(const uint32 windowSize) {
+    StatisticsHelperT<Type> myStatisticsHelper(windowSize);
+    const uint32 nOfSamples = 8u * windowSize;
+    uint32 size = myStatisticsHelper.GetSize();
+    Type *samples = new Type[nOfSamples];
+    uint32 seed = 12345u;
+    bool ok = true;
+    for (uint32 i = 0u; (i < nOfSamples) && (ok); i++) {
+        //Small pseudo-random values with plenty of repetitions
+        seed = (seed * 1103515245u) + 12345u;
+        samples[i] = static_cast<Type>((seed >> 16u) % 16u);
+        ok = myStatisticsHelper.PushSample(samples[i]);
+        uint32 first = (i >= size) ? (i - size + 1u) : (0u);
+        Type max = samples[first];
+        Type min = samples[first];
+        for (uint32 j = first; j <= i; j++) {
+            if (samples[j] > max) {
+                max = samples[j];
+            }
+            if (samples[j] < min) {
+                min = samples[j];
+            }
+        }
+        if (ok) {
+            ok = (myStatisticsHelper.GetMax() == max);
+        }
+        if (ok) {
+            ok = (myStatisticsHelper.GetMin() == min);
+        }
+    }
+    delete[] samples;
+    return ok;
+}
+
+template<typename Type>
+bool StatisticsHelperTTest<Type>::TestPushSampleWorstCase(const uint32 windowSize,
+                                                          const uint32 numberOfWindows) {
+    StatisticsHelperT<Type> myStatisticsHelper(windowSize);
+    uint32 size = myStatisticsHelper.GetSize();
+    uint32 nOfSamples = numberOfWindows * size;
+    uint64 ticks = 0u;
+    bool ok = true;
+    for (uint32 phase = 0u; (phase < 2u) && (ok); phase++) {
+        bool decreasing = (phase == 0u);
+        ok = myStatisticsHelper.Reset();
+        uint64 start = HighResolutionTimer::Counter();
+        for (uint32 i = 0u; (i < nOfSamples) && (ok); i++) {
+            Type sample = static_cast<Type>(decreasing ? (nOfSamples - i) : (i + 1u));
+            ok = myStatisticsHelper.PushSample(sample);
+            //On a ramp the extremes of the time window are its first and its last sample
+            uint32 first = (i >= size) ? (i - size + 1u) : (0u);
+            Type oldest = static_cast<Type>(decreasing ? (nOfSamples - first) : (first + 1u));
+            if (ok) {
+                ok = (myStatisticsHelper.GetMax() == (decreasing ? oldest : sample));
+            }
+            if (ok) {
+                ok = (myStatisticsHelper.GetMin() == (decreasing ? sample : oldest));
+            }
+        }
+        ticks += (HighResolutionTimer::Counter() - start);
+    }
+    if (ok) {
+        float64 nanosecondsPerSample = (static_cast<float64>(ticks) * HighResolutionTimer::Period() * 1e9) / static_cast<float64>(2u * nOfSamples);
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "PushSample worst case with a window of %d samples: %f ns per sample", size, nanosecondsPerSample);
+    }
+    return ok;
+}
+
 template<typename Type>
 bool StatisticsHelperTTest<Type>::TestGetRms() {
     StatisticsHelperT<Type> myStatisticsHelper(4);
@@ -133,3 +133,13 @@ TEST(TimeCorrectionGAMGTest,TestExecute_EstimationSlowChange) {
     TimeCorrectionGAMTest test;
     ASSERT_TRUE(test.TestExecute_EstimationSlowChange());
 }
+
+TEST(TimeCorrectionGAMGTest,TestSetup_FalseBadOutputType3) {
+    TimeCorrectionGAMTest test;
+    ASSERT_TRUE(test.TestSetup_FalseBadOutputType3());
+}
+
+TEST(TimeCorrectionGAMGTest,TestExecute_TimeStampsBlock) {
+    TimeCorrectionGAMTest test;
+    ASSERT_TRUE(test.TestExecute_TimeStampsBlock());
+}
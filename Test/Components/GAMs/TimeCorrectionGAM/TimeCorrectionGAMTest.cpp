@@ -489,6 +489,10 @@ bool TimeCorrectionGAMTest::TestSetup_FalseNumberOfOutputSignals() {
             "                   DataSource = DDB"
             "                   Type = uint8"
             "               }"
+            "               NumberOfCorrections = {"
+            "                   DataSource = DDB"
+            "                   Type = uint32"
+            "               }"
             "               IsCorrected2 = {"
             "                   DataSource = DDB"
             "                   Type = uint8"
@@ -1332,3 +1336,197 @@ bool TimeCorrectionGAMTest::TestExecute_EstimationSlowChange() {
     return ret;
 }
 
+bool TimeCorrectionGAMTest::TestSetup_FalseBadOutputType3() {
+
+    static const char8 * const config = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = TimeCorrectionGAMTestGAM"
+            "           ExpectedDelta=1000000"
+            "           DeltaTolerance=20"
+            "           FilterGain=0.9"
+            "            InputSignals = {"
+            "                InputTime = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint64"
+            "                   Frequency = 0"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "               CorrectedTime = {"
+            "                   DataSource = DDB"
+            "                   Type = uint64"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               IsCorrected = {"
+            "                   DataSource = DDB"
+            "                   Type = uint8"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               NumberOfCorrections = {"
+            "                   DataSource = DDB"
+            "                   Type = uint64"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +DDB = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Drv1 = {"
+            "            Class = TimeCorrectionGAMTestDS"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+    bool ret = !InitialiseMemoryMapInputBrokerEnviroment(config);
+    return ret;
+}
+
+bool TimeCorrectionGAMTest::TestExecute_TimeStampsBlock() {
+
+    static const char8 * const config = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = TimeCorrectionGAMTestGAM"
+            "           ExpectedDelta=1000000"
+            "           DeltaTolerance=20"
+            "           FilterGain=0.9"
+            "            InputSignals = {"
+            "                InputTime = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint64"
+            "                   Frequency = 0"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "               CorrectedTime = {"
+            "                   DataSource = DDB"
+            "                   Type = uint64"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               IsCorrected = {"
+            "                   DataSource = DDB"
+            "                   Type = uint8"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               NumberOfCorrections = {"
+            "                   DataSource = DDB"
+            "                   Type = uint32"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +DDB = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Drv1 = {"
+            "            Class = TimeCorrectionGAMTestDS"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config);
+
+    ReferenceT<TimeCorrectionGAMTestGAM> gam;
+    if (ret) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gam.IsValid();
+    }
+    uint64* input = NULL;
+    uint64* output = NULL;
+    if (ret) {
+        input = (uint64*) gam->GetInputSignalsMemory();
+        output = (uint64*) gam->GetOutputSignalsMemory();
+        ret = (input != NULL) && (output != NULL);
+
+    }
+
+    if (ret) {
+        const uint32 nOfTimeStamps = 4u;
+        uint8 *isCorrected = (uint8*) (&output[nOfTimeStamps]);
+        uint32 *nOfCorrections = (uint32*) (&isCorrected[nOfTimeStamps]);
+        uint64 fakeTime = 0u;
+        uint32 nIterations = 100;
+        uint64 expectedJump = 1000000;
+
+        for (uint32 i = 0u; (i < nIterations) && (ret); i++) {
+            //From the second cycle the third time-stamp of each block is wrong
+            for (uint32 j = 0u; j < nOfTimeStamps; j++) {
+                fakeTime += expectedJump;
+                input[j] = fakeTime;
+                if ((i > 0u) && (j == 2u)) {
+                    input[j] += 5000u;
+                }
+            }
+            gam->Execute();
+            for (uint32 j = 0u; (j < nOfTimeStamps) && (ret); j++) {
+                ret = (output[j] == (((i * nOfTimeStamps) + j + 1u) * expectedJump));
+                if (ret) {
+                    ret = (isCorrected[j] == (((i > 0u) && (j == 2u)) ? 1u : 0u));
+                }
+            }
+            if (ret) {
+                ret = (*nOfCorrections == ((i > 0u) ? 1u : 0u));
+            }
+        }
+    }
+    return ret;
+}
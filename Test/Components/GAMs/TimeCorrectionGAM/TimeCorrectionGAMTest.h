@@ -102,7 +102,7 @@ public:
 
     /**
      * @brief Tests the TimeCorrectionGAM::Setup method that fails if more
-     * than two signals is defined
+     * than three signals is defined
      */
     bool TestSetup_FalseNumberOfOutputSignals();
 
@@ -165,6 +165,18 @@ public:
      */
     bool TestExecute_EstimationSlowChange();
 
+    /**
+     * @brief Tests the TimeCorrectionGAM::Setup method that fails if the
+     * third output signal type is different than uint32
+     */
+    bool TestSetup_FalseBadOutputType3();
+
+    /**
+     * @brief Tests the TimeCorrectionGAM::Execute method
+     * correcting a block of time-stamps in each cycle
+     */
+    bool TestExecute_TimeStampsBlock();
+
 };
 
 /*---------------------------------------------------------------------------*/
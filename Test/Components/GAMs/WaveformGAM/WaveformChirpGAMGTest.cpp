@@ -85,6 +85,16 @@ TEST(WaveformChirpGAMTest, TestExecuteNyquistViolation) {
     ASSERT_TRUE(test.TestExecuteNyquistViolation());
 }
 
+TEST(WaveformChirpGAMTest, TestInitialiseWrongGenerator) {
+    WaveformChirpGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseWrongGenerator());
+}
+
+TEST(WaveformChirpGAMTest, TestExecuteTriggerRecursive) {
+    WaveformChirpGAMTest test;
+    ASSERT_TRUE(test.TestExecuteTriggerRecursive());
+}
+
 TEST(WaveformChirpGAMTest, TestExecuteUInt8) {
     WaveformChirpGAMTest test;
     StreamString auxStr = "uint8";
@@ -283,5 +283,88 @@ bool WaveformChirpGAMTest::TestExecuteNyquistViolation() {
     return ok;
 }
 
+bool WaveformChirpGAMTest::TestInitialiseWrongGenerator() {
+    bool ok = true;
+    uint32 sizeOutput = 4u;
+    WaveformChirpGAMTestHelper gam(1, 1, sizeOutput, 1);
+    gam.SetName("Test");
+    ok &= gam.InitialiseChirp1();
+    ok &= gam.config.Write("Generator", "Table");
+    gam.config.MoveToRoot();
+    if (ok) {
+        ok = !gam.Initialise(gam.config);
+    }
+    return ok;
+}
+
+bool WaveformChirpGAMTest::TestExecuteTriggerRecursive() {
+    using namespace MARTe;
+    bool ok = true;
+    uint32 timeIterationIncrement = 10000u;
+    uint32 numberOfIteration = 4000u;
+    uint32 sizeOutput = 100u;
+    WaveformChirpGAMTestHelper gamDirect(1, 1, sizeOutput, 1, "float64");
+    WaveformChirpGAMTestHelper gamRecursive(1, 1, sizeOutput, 1, "float64");
+    uint32 *timeDirect = NULL;
+    uint32 *timeRecursive = NULL;
+    float64 *outputDirect = NULL;
+    float64 *outputRecursive = NULL;
+
+    gamDirect.SetName("Direct");
+    gamRecursive.SetName("Recursive");
+    ok &= gamDirect.InitialiseChirp1Trigger();
+    ok &= gamRecursive.InitialiseChirp1Trigger();
+    ok &= gamRecursive.config.Write("Generator", "Recursive");
+    gamDirect.config.MoveToRoot();
+    gamRecursive.config.MoveToRoot();
+    if (ok) {
+        ok &= gamDirect.Initialise(gamDirect.config);
+        ok &= gamRecursive.Initialise(gamRecursive.config);
+    }
+    if (ok) {
+        ok &= gamDirect.InitialiseConfigDataBaseSignal1();
+        ok &= gamRecursive.InitialiseConfigDataBaseSignal1();
+    }
+    if (ok) {
+        ok &= gamDirect.SetConfiguredDatabase(gamDirect.configSignals);
+        ok &= gamRecursive.SetConfiguredDatabase(gamRecursive.configSignals);
+    }
+    if (ok) {
+        ok &= gamDirect.AllocateInputSignalsMemory();
+        ok &= gamRecursive.AllocateInputSignalsMemory();
+    }
+    if (ok) {
+        ok &= gamDirect.AllocateOutputSignalsMemory();
+        ok &= gamRecursive.AllocateOutputSignalsMemory();
+    }
+    if (ok) {
+        ok &= gamDirect.Setup();
+        ok &= gamRecursive.Setup();
+    }
+    if (ok) {
+        timeDirect = static_cast<uint32 *>(gamDirect.GetInputSignalsMemory());
+        timeRecursive = static_cast<uint32 *>(gamRecursive.GetInputSignalsMemory());
+        outputDirect = static_cast<float64 *>(gamDirect.GetOutputSignalsMemory());
+        outputRecursive = static_cast<float64 *>(gamRecursive.GetOutputSignalsMemory());
+        *timeDirect = 0u;
+        *timeRecursive = 0u;
+    }
+    //Both generators differ from the exact waveform by a few 1e-10 (Direct accumulates the rounding of the sample time)
+    const float64 tolerance = 1e-7;
+    for (uint32 i = 0u; (i < numberOfIteration) && ok; i++) {
+        ok &= gamDirect.Execute();
+        ok &= gamRecursive.Execute();
+        for (uint32 j = 0u; (j < sizeOutput) && ok; j++) {
+            float64 diff = outputDirect[j] - outputRecursive[j];
+            ok = ((diff < tolerance) && (diff > -tolerance));
+        }
+        if (!ok) {
+            REPORT_ERROR_STATIC_PARAMETERS(ErrorManagement::FatalError, "iteration which fails %u\n", i);
+        }
+        *timeDirect += timeIterationIncrement;
+        *timeRecursive += timeIterationIncrement;
+    }
+    return ok;
 }
 
+}
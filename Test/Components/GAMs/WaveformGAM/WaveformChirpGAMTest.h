@@ -99,6 +99,16 @@ public:
      */
     bool TestExecuteNyquistViolation();
 
+    /**
+     * @brief Test error message of WaveformChirp::Initialise() with an unknown Generator
+     */
+    bool TestInitialiseWrongGenerator();
+
+    /**
+     * @brief Verifies that Generator = Recursive computes the same chirp as Generator = Direct, with trigger mechanism Enable.
+     */
+    bool TestExecuteTriggerRecursive();
+
     /**
      * @brief Template test. Verifies the correctness of the data.
      */
@@ -436,6 +436,11 @@ TEST(WaveformPointsDefGAMTest, TestExecuteLargeElements) {
     ASSERT_TRUE(test.TestExecuteLargeElements());
 }
 
+TEST(WaveformPointsDefGAMTest, TestExecuteManyPoints) {
+    WaveformPointsDefGAMTest test;
+    ASSERT_TRUE(test.TestExecuteManyPoints());
+}
+
 
 
 /*---------------------------------------------------------------------------*/
@@ -640,3 +640,62 @@ bool WaveformPointsDefGAMTest::TestExecuteLargeElements() {
     return ok;
 }
 
+bool WaveformPointsDefGAMTest::TestExecuteManyPoints() {
+    bool ok = true;
+    const uint32 numberOfPoints = 10001u;
+    const uint32 sizeOutput = 100u;
+    WaveformPointsDefGAMTestHelper gam(1, 1, sizeOutput, 1, "float64", 0, 0, 2, 2);
+    uint32 timeIterationIncrement = 10000u;
+    gam.SetName("Test");
+    //A ramp of 1000 per second during 10 s
+    float64 *pointsMany = new float64[numberOfPoints];
+    float64 *timesMany = new float64[numberOfPoints];
+    for (uint32 i = 0u; i < numberOfPoints; i++) {
+        pointsMany[i] = static_cast<float64>(i);
+        timesMany[i] = static_cast<float64>(i) * 1e-3;
+    }
+    Vector<float64> pointsVector(pointsMany, numberOfPoints);
+    Vector<float64> timesVector(timesMany, numberOfPoints);
+    ok &= gam.config.Write("Points", pointsVector);
+    ok &= gam.config.Write("Times", timesVector);
+
+    gam.config.MoveToRoot();
+    ok &= gam.Initialise(gam.config);
+
+    ok &= gam.InitialiseConfigDataBaseSignal1();
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+
+    ok &= gam.Setup();
+
+    uint32 *timeIteration = NULL;
+    float64 *output = NULL;
+    if (ok) {
+        timeIteration = static_cast<uint32 *>(gam.GetInputSignalsMemory());
+        output = static_cast<float64 *>(gam.GetOutputSignalsMemory());
+        *timeIteration = 0u;
+        ok = gam.Execute();
+    }
+    for (uint32 n = 1u; (n < 700u) && ok; n++) {
+        //Skip some cycles to jump over several segments (the last sample is at 9.52 s, before the end of the sequence)
+        if ((n % 97u) == 0u) {
+            *timeIteration += 37u * timeIterationIncrement;
+        }
+        else {
+            *timeIteration += timeIterationIncrement;
+        }
+        ok = gam.Execute();
+        for (uint32 i = 0u; (i < sizeOutput) && ok; i++) {
+            float64 sampleTime = (static_cast<float64>(*timeIteration) / 1e6) + ((static_cast<float64>(i) * 1e-2) / static_cast<float64>(sizeOutput));
+            float64 diff = output[i] - (sampleTime * 1e3);
+            ok = ((diff < 1e-6) && (diff > -1e-6));
+            if (!ok) {
+                printf("Error. output = %.16lf, expected = %.16lf, iteration %u\n", output[i], sampleTime * 1e3, n);
+            }
+        }
+    }
+    delete[] pointsMany;
+    delete[] timesMany;
+    return ok;
+}
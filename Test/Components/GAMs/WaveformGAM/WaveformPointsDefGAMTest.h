@@ -182,6 +182,12 @@ public:
      * @details The origin of the test is the real time application with the Waveform() and UnpackGAM()
      */
     bool TestExecuteLargeElements();
+
+    /**
+     * @brief Test WaveformPointsDef::Execute() with 10001 points and time jumps.
+     * @details Verifies the segment tracking when currentTime advances sample by sample and when some cycles are skipped.
+     */
+    bool TestExecuteManyPoints();
 };
 
 /*---------------------------------------------------------------------------*/
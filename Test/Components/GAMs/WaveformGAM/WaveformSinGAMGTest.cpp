@@ -308,6 +308,16 @@ TEST(WaveformSinGAMTest, TestExecuteNegativeInput_2) {
     ASSERT_TRUE(test.TestExecuteNegativeInput_2());
 }
 
+TEST(WaveformSinGAMTest, TestInitialise_WrongGenerator) {
+    WaveformSinGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_WrongGenerator());
+}
+
+TEST(WaveformSinGAMTest, TestFloat64ExecuteTriggerRecursive) {
+    WaveformSinGAMTest test;
+    ASSERT_TRUE(test.TestFloat64ExecuteTriggerRecursive());
+}
+
 
 
 
@@ -3698,3 +3698,68 @@ bool WaveformSinGAMTest::TestExecuteNegativeInput_2() {
     }
     return ok;
 }
+
+bool WaveformSinGAMTest::TestInitialise_WrongGenerator() {
+    bool ok = true;
+    using namespace MARTe;
+    using namespace FastMath;
+    WaveformSinGAMTestHelper gam;
+    gam.SetName("Test");
+    ok &= gam.InitialiseWaveSin(10.0, 1.0, 0.0, 10);
+    ok &= gam.config.Write("Generator", "Table");
+    gam.config.MoveToRoot();
+    if (ok) {
+        ok = !gam.Initialise(gam.config);
+    }
+    return ok;
+}
+
+bool WaveformSinGAMTest::TestFloat64ExecuteTriggerRecursive() {
+    bool ok = true;
+    using namespace MARTe;
+    using namespace FastMath;
+    const uint32 numberOfElements = 100u;
+    WaveformSinGAMTestHelper gamDirect(1u, 1u, numberOfElements, 1u);
+    WaveformSinGAMTestHelper gamRecursive(1u, 1u, numberOfElements, 1u);
+    gamDirect.SetName("Direct");
+    gamRecursive.SetName("Recursive");
+    ok &= gamDirect.InitialiseWaveSinTrigger(1000, 7.3, 0.5, 10);
+    ok &= gamRecursive.InitialiseWaveSinTrigger(1000, 7.3, 0.5, 10);
+    ok &= gamRecursive.config.Write("Generator", "Recursive");
+    gamDirect.config.MoveToRoot();
+    gamRecursive.config.MoveToRoot();
+    ok &= gamDirect.Initialise(gamDirect.config);
+    ok &= gamRecursive.Initialise(gamRecursive.config);
+    ok &= gamDirect.InitialiseConfigDataBaseSignal1(Float64Bit);
+    ok &= gamRecursive.InitialiseConfigDataBaseSignal1(Float64Bit);
+    ok &= gamDirect.SetConfiguredDatabase(gamDirect.configSignals);
+    ok &= gamRecursive.SetConfiguredDatabase(gamRecursive.configSignals);
+    ok &= gamDirect.AllocateInputSignalsMemory();
+    ok &= gamRecursive.AllocateInputSignalsMemory();
+    ok &= gamDirect.AllocateOutputSignalsMemory();
+    ok &= gamRecursive.AllocateOutputSignalsMemory();
+    ok &= gamDirect.Setup();
+    ok &= gamRecursive.Setup();
+    if (ok) {
+        uint32 *gamMemoryInDirect = static_cast<uint32 *>(gamDirect.GetInputSignalsMemory());
+        uint32 *gamMemoryInRecursive = static_cast<uint32 *>(gamRecursive.GetInputSignalsMemory());
+        float64 *gamMemoryOutDirect = static_cast<float64 *>(gamDirect.GetOutputSignalsMemory());
+        float64 *gamMemoryOutRecursive = static_cast<float64 *>(gamRecursive.GetOutputSignalsMemory());
+        //Both generators differ from the exact waveform by a few 1e-10 (Direct accumulates the rounding of the sample time)
+        const float64 tolerance = 1e-7;
+        for (uint32 n = 0u; (n < 60u) && ok; n++) {
+            *gamMemoryInDirect = n * 100000u;
+            *gamMemoryInRecursive = n * 100000u;
+            ok &= gamDirect.Execute();
+            ok &= gamRecursive.Execute();
+            for (uint32 i = 0u; (i < numberOfElements) && ok; i++) {
+                float64 diff = gamMemoryOutDirect[i] - gamMemoryOutRecursive[i];
+                ok = ((diff < tolerance) && (diff > -tolerance));
+                if (gamMemoryOutDirect[i] == 0.0) {
+                    ok &= (gamMemoryOutRecursive[i] == 0.0);
+                }
+            }
+        }
+    }
+    return ok;
+}
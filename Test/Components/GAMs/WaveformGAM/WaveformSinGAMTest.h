@@ -319,6 +319,16 @@ public:
      */
     bool TestExecuteNegativeInput_2();
 
+    /**
+     * @brief Tests that Initialise fails with an unknown Generator.
+     */
+    bool TestInitialise_WrongGenerator();
+
+    /**
+     * @brief Tests that Generator = Recursive computes the same waveform as Generator = Direct, with the trigger mechanism enabled.
+     */
+    bool TestFloat64ExecuteTriggerRecursive();
+
 };
 
 /*---------------------------------------------------------------------------*/